@@ -36,11 +36,14 @@ from ._duvc_ctl import (
     list_devices, 
     open_camera,
     find_device_by_path,
+    reset_to_defaults as core_reset_to_defaults,
+    PresetStore, PresetRecaller, PresetRecallReport,
     
     # Core types 
     VidProp, CamProp, CamMode, PropSetting,
     Device,
     Camera as CoreCamera,  # C++ Camera class - rename to avoid confusion
+    ControllerCore,        # Native hot paths (name tables, cached ranges)
 )
 
 # Import our Python exceptions
@@ -133,11 +136,7 @@ class CameraController:
             DeviceNotFoundError: No cameras found or specified device not found
             DuvcSystemError: Camera connection failed
         """
-        import threading
-        self._lock = threading.Lock()  # Simple lock for state protection
-        self._core_camera: Optional[CoreCamera] = None
-        self._device: Optional[Device] = None
-        self._is_closed = False
+        self._init_state()
         self._connect(device, device_path, device_index, device_name)
 
         # Property range constants
@@ -170,6 +169,34 @@ class CameraController:
         ZOOM_DEFAULT = 100  # No zoom
         
         
+    def _init_state(self) -> None:
+        """Initialize connection state (before connecting)."""
+        import threading
+        self._lock = threading.Lock()  # Simple lock for state protection
+        self._core_camera: Optional[CoreCamera] = None
+        self._fast: Optional[ControllerCore] = None
+        self._device: Optional[Device] = None
+        self._is_closed = False
+        self._preset_recaller: Optional[PresetRecaller] = None
+
+    @classmethod
+    def _from_core(cls, device: Device, core_camera: CoreCamera) -> 'CameraController':
+        """Wrap an already open core camera, skipping device enumeration.
+
+        Used by benchmarks and tests running against a replayed or simulated
+        backend, whose devices are not enumerated by the system.
+        """
+        controller = cls.__new__(cls)
+        controller._init_state()
+        controller._device = device
+        controller._attach(core_camera)
+        return controller
+
+    def _attach(self, core_camera: CoreCamera) -> None:
+        """Use an open core camera for all operations."""
+        self._core_camera = core_camera
+        self._fast = ControllerCore(core_camera)
+
     def _connect(self, device: Optional[Device], device_path: Optional[str], device_index: Optional[int], device_name: Optional[str]) -> None:
         """Establish connection to camera using core C++ APIs.
         
@@ -259,7 +286,7 @@ class CameraController:
                 "• Insufficient permissions\n"
                 "• Hardware issue"
             )
-        self._core_camera = result.value()
+        self._attach(result.value())
 
     
     # Context manager support
@@ -276,7 +303,9 @@ class CameraController:
         """Close camera and release resources."""
         with self._lock:
             if self._core_camera and not self._is_closed:
+                self._preset_recaller = None
                 self._core_camera = None
+                self._fast = None
                 self._is_closed = True
     
     def _ensure_connected(self) -> None:
@@ -285,6 +314,17 @@ class CameraController:
             if self._is_closed or self._core_camera is None:
                 raise RuntimeError("Camera has been closed")
 
+    def _native(self) -> ControllerCore:
+        """Native property access, or RuntimeError once closed.
+
+        Lock-free: property access is the hot path, and the native object
+        stays valid for calls already holding it after close().
+        """
+        fast = self._fast
+        if fast is None:
+            raise RuntimeError("Camera has been closed")
+        return fast
+
     # ========================================================================
     # VIDEO PROPERTIES (VidProp)
     # ========================================================================
@@ -303,28 +343,15 @@ class CameraController:
         Note:
             Returns (None, None) when:
             - Device range query fails
-            - Range is invalid (min > max, max <= 0, or None values)
+            - Range is invalid (min > max, max <= 0, or None values; logged
+              through the duvc log)
             - Property not supported by device
+            
+            Ranges the device reports are cached natively per controller;
+            failed queries are retried on the next call.
         """
         try:
-            prop_range = self.get_property_range(property_name)
-            if prop_range:
-                device_min = prop_range.get('min')
-                device_max = prop_range.get('max')
-                
-                # Validate that range is sensible
-                if (device_min is not None and device_max is not None and
-                    device_min <= device_max and device_max > 0):
-                    # Valid device range
-                    return (device_min, device_max)
-                
-                # Log invalid range from device
-                import logging
-                logger = logging.getLogger(__name__)
-                logger.warning(
-                    f"Invalid range for '{property_name}' from device: "
-                    f"min={device_min}, max={device_max}. Skipping validation."
-                )
+            return self._native().range_bounds(property_name)
         except Exception as e:
             # Log query errors at debug level
             import logging
@@ -337,155 +364,142 @@ class CameraController:
     @property
     def brightness(self) -> int:
         """Camera brightness (uses device range, typically 0-255)."""
-        return self._get_video_property(VidProp.Brightness, "brightness")
+        return self._native().get(VidProp.Brightness)
 
     @brightness.setter  
     def brightness(self, value: int):
         """Set brightness using actual device range."""
-        min_val, max_val = self._get_dynamic_range("brightness", 0, 100)
-        self._set_video_property(VidProp.Brightness, "brightness", value, min_val, max_val)
+        self._native().set_in_range(VidProp.Brightness, value)
 
     @property
     def contrast(self) -> int:
         """Camera contrast (uses device range, typically 0-100)."""
-        return self._get_video_property(VidProp.Contrast, "contrast")
+        return self._native().get(VidProp.Contrast)
 
     @contrast.setter
     def contrast(self, value: int):
         """Set contrast using actual device range."""
-        min_val, max_val = self._get_dynamic_range("contrast", 0, 100)
-        self._set_video_property(VidProp.Contrast, "contrast", value, min_val, max_val)
+        self._native().set_in_range(VidProp.Contrast, value)
 
     @property
     def hue(self) -> int:
         """Camera hue (uses device range, often -180 to +180)."""
-        return self._get_video_property(VidProp.Hue, "hue")
+        return self._native().get(VidProp.Hue)
 
     @hue.setter
     def hue(self, value: int):
         """Set hue using actual device range."""
-        min_val, max_val = self._get_dynamic_range("hue", -180, 180)
-        self._set_video_property(VidProp.Hue, "hue", value, min_val, max_val)
+        self._native().set_in_range(VidProp.Hue, value)
 
     @property
     def saturation(self) -> int:
         """Camera saturation (uses device range, typically 0-100)."""
-        return self._get_video_property(VidProp.Saturation, "saturation")
+        return self._native().get(VidProp.Saturation)
 
     @saturation.setter
     def saturation(self, value: int):
         """Set saturation using actual device range."""
-        min_val, max_val = self._get_dynamic_range("saturation", 0, 100)
-        self._set_video_property(VidProp.Saturation, "saturation", value, min_val, max_val)
+        self._native().set_in_range(VidProp.Saturation, value)
 
     @property
     def sharpness(self) -> int:
         """Camera sharpness (uses device range)."""
-        return self._get_video_property(VidProp.Sharpness, "sharpness")
+        return self._native().get(VidProp.Sharpness)
 
     @sharpness.setter
     def sharpness(self, value: int):
         """Set sharpness using actual device range."""
-        min_val, max_val = self._get_dynamic_range("sharpness", 0, 100)
-        self._set_video_property(VidProp.Sharpness, "sharpness", value, min_val, max_val)
+        self._native().set_in_range(VidProp.Sharpness, value)
 
     @property
     def gamma(self) -> int:
         """Camera gamma (uses device range)."""
-        return self._get_video_property(VidProp.Gamma, "gamma")
+        return self._native().get(VidProp.Gamma)
 
     @gamma.setter
     def gamma(self, value: int):
         """Set gamma using actual device range."""
-        min_val, max_val = self._get_dynamic_range("gamma", 100, 300)
-        self._set_video_property(VidProp.Gamma, "gamma", value, min_val, max_val)
+        self._native().set_in_range(VidProp.Gamma, value)
 
     @property
     def color_enable(self) -> bool:
         """Color vs monochrome (True = color, False = mono)."""
-        return bool(self._get_video_property(VidProp.ColorEnable, "color_enable"))
+        return bool(self._native().get(VidProp.ColorEnable))
 
     @color_enable.setter
     def color_enable(self, value: bool):
         """Set color mode (no range needed for bool)."""
-        self._set_video_property(VidProp.ColorEnable, "color_enable", int(value))
+        self._native().set(VidProp.ColorEnable, int(value))
 
     @property
     def white_balance(self) -> int:
         """White balance temperature (uses device range, in Kelvin)."""
-        return self._get_video_property(VidProp.WhiteBalance, "white_balance")
+        return self._native().get(VidProp.WhiteBalance)
 
     @white_balance.setter
     def white_balance(self, value: int):
         """Set white balance using actual device range."""
-        min_val, max_val = self._get_dynamic_range("white_balance", 2700, 6500)
-        self._set_video_property(VidProp.WhiteBalance, "white_balance", value, min_val, max_val)
+        self._native().set_in_range(VidProp.WhiteBalance, value)
 
     @property
     def video_backlight_compensation(self) -> int:
         """Video backlight compensation (uses device range)."""
-        return self._get_video_property(VidProp.BacklightCompensation, "video_backlight_compensation")
+        return self._native().get(VidProp.BacklightCompensation)
 
     @video_backlight_compensation.setter
     def video_backlight_compensation(self, value: int):
         """Set backlight compensation using actual device range."""
-        min_val, max_val = self._get_dynamic_range("video_backlight_compensation", 0, 100)
-        self._set_video_property(VidProp.BacklightCompensation, "video_backlight_compensation", value, min_val, max_val)
+        self._native().set_in_range(VidProp.BacklightCompensation, value)
 
     @property
     def gain(self) -> int:
         """Sensor gain/amplification (uses device range)."""
-        return self._get_video_property(VidProp.Gain, "gain")
+        return self._native().get(VidProp.Gain)
 
     @gain.setter
     def gain(self, value: int):
         """Set gain using actual device range."""
-        min_val, max_val = self._get_dynamic_range("gain", 0, 100)
-        self._set_video_property(VidProp.Gain, "gain", value, min_val, max_val)
+        self._native().set_in_range(VidProp.Gain, value)
 
     @property
     def digital_multiplier(self) -> int:
         """Digital multiplier level (uses device range)."""
-        return self._get_video_property(VidProp.DigitalMultiplier, "digital_multiplier")
+        return self._native().get(VidProp.DigitalMultiplier)
 
     @digital_multiplier.setter
     def digital_multiplier(self, value: int):
         """Set digital multiplier using actual device range."""
-        min_val, max_val = self._get_dynamic_range("digital_multiplier", 0, 100)
-        self._set_video_property(VidProp.DigitalMultiplier, "digital_multiplier", value, min_val, max_val)
+        self._native().set_in_range(VidProp.DigitalMultiplier, value)
 
     @property
     def digital_multiplier_limit(self) -> int:
         """Digital multiplier limit (uses device range)."""
-        return self._get_video_property(VidProp.DigitalMultiplierLimit, "digital_multiplier_limit")
+        return self._native().get(VidProp.DigitalMultiplierLimit)
 
     @digital_multiplier_limit.setter
     def digital_multiplier_limit(self, value: int):
         """Set digital multiplier limit using actual device range."""
-        min_val, max_val = self._get_dynamic_range("digital_multiplier_limit", 0, 100)
-        self._set_video_property(VidProp.DigitalMultiplierLimit, "digital_multiplier_limit", value, min_val, max_val)
+        self._native().set_in_range(VidProp.DigitalMultiplierLimit, value)
 
     @property
     def white_balance_component(self) -> int:
         """White balance component adjustment (uses device range)."""
-        return self._get_video_property(VidProp.WhiteBalanceComponent, "white_balance_component")
+        return self._native().get(VidProp.WhiteBalanceComponent)
 
     @white_balance_component.setter
     def white_balance_component(self, value: int):
         """Set white balance component using actual device range."""
-        min_val, max_val = self._get_dynamic_range("white_balance_component", 0, 100)
-        self._set_video_property(VidProp.WhiteBalanceComponent, "white_balance_component", value, min_val, max_val)
+        self._native().set_in_range(VidProp.WhiteBalanceComponent, value)
 
     @property
     def power_line_frequency(self) -> int:
         """Power line frequency setting (uses device range)."""
-        return self._get_video_property(VidProp.PowerLineFrequency, "power_line_frequency")
+        return self._native().get(VidProp.PowerLineFrequency)
 
     @power_line_frequency.setter
     def power_line_frequency(self, value: int):
         """Set power line frequency using actual device range."""
-        min_val, max_val = self._get_dynamic_range("power_line_frequency", 0, 100)
-        self._set_video_property(VidProp.PowerLineFrequency, "power_line_frequency", value, min_val, max_val)
+        self._native().set_in_range(VidProp.PowerLineFrequency, value)
 
     # ========================================================================
     # CAMERA PROPERTIES (CamProp)
@@ -494,158 +508,148 @@ class CameraController:
     @property
     def pan(self) -> int:
         """Camera pan position (uses device range in degrees)."""
-        return self._get_camera_property(CamProp.Pan, "pan")
+        return self._native().get(CamProp.Pan)
 
     @pan.setter
     def pan(self, value: int):
         """Set camera pan using actual device range."""
-        min_val, max_val = self._get_dynamic_range("pan", -180, 180)
-        self._set_camera_property(CamProp.Pan, "pan", value, min_val, max_val)
+        self._native().set_in_range(CamProp.Pan, value)
 
     @property
     def tilt(self) -> int:
         """Camera tilt position (uses device range in degrees)."""
-        return self._get_camera_property(CamProp.Tilt, "tilt")
+        return self._native().get(CamProp.Tilt)
 
     @tilt.setter  
     def tilt(self, value: int):
         """Set camera tilt using actual device range."""
-        min_val, max_val = self._get_dynamic_range("tilt", -90, 90)
-        self._set_camera_property(CamProp.Tilt, "tilt", value, min_val, max_val)
+        self._native().set_in_range(CamProp.Tilt, value)
 
     @property
     def roll(self) -> int:
         """Camera roll rotation (uses device range in degrees)."""
-        return self._get_camera_property(CamProp.Roll, "roll")
+        return self._native().get(CamProp.Roll)
 
     @roll.setter
     def roll(self, value: int):
         """Set camera roll using actual device range."""
-        min_val, max_val = self._get_dynamic_range("roll", -180, 180)
-        self._set_camera_property(CamProp.Roll, "roll", value, min_val, max_val)
+        self._native().set_in_range(CamProp.Roll, value)
 
     @property
     def zoom(self) -> int:
         """Optical zoom level (uses device range)."""
-        return self._get_camera_property(CamProp.Zoom, "zoom")
+        return self._native().get(CamProp.Zoom)
 
     @zoom.setter
     def zoom(self, value: int):
         """Set optical zoom using actual device range."""
-        min_val, max_val = self._get_dynamic_range("zoom", 0, 100)
-        self._set_camera_property(CamProp.Zoom, "zoom", value, min_val, max_val)
+        self._native().set_in_range(CamProp.Zoom, value)
 
     @property
     def exposure(self) -> int:
         """Exposure time/shutter speed (uses device range)."""
-        return self._get_camera_property(CamProp.Exposure, "exposure")
+        return self._native().get(CamProp.Exposure)
 
     @exposure.setter
     def exposure(self, value: int):
         """Set exposure using actual device range."""
-        min_val, max_val = self._get_dynamic_range("exposure", -13, 1)
-        self._set_camera_property(CamProp.Exposure, "exposure", value, min_val, max_val)
+        self._native().set_in_range(CamProp.Exposure, value)
 
     @property
     def iris(self) -> int:
         """Aperture/iris diameter (uses device range)."""
-        return self._get_camera_property(CamProp.Iris, "iris")
+        return self._native().get(CamProp.Iris)
 
     @iris.setter
     def iris(self, value: int):
         """Set iris using actual device range."""
-        min_val, max_val = self._get_dynamic_range("iris", 0, 100)
-        self._set_camera_property(CamProp.Iris, "iris", value, min_val, max_val)
+        self._native().set_in_range(CamProp.Iris, value)
 
     @property
     def focus(self) -> int:
         """Focus distance position (uses device range)."""
-        return self._get_camera_property(CamProp.Focus, "focus")
+        return self._native().get(CamProp.Focus)
 
     @focus.setter
     def focus(self, value: int):
         """Set focus using actual device range."""
-        min_val, max_val = self._get_dynamic_range("focus", 0, 100)
-        self._set_camera_property(CamProp.Focus, "focus", value, min_val, max_val)
+        self._native().set_in_range(CamProp.Focus, value)
 
     @property
     def scan_mode(self) -> int:
         """Scan mode (progressive/interlaced, uses device range)."""
-        return self._get_camera_property(CamProp.ScanMode, "scan_mode")
+        return self._native().get(CamProp.ScanMode)
 
     @scan_mode.setter
     def scan_mode(self, value: int):
         """Set scan mode using actual device range."""
-        min_val, max_val = self._get_dynamic_range("scan_mode", 0, 2)
-        self._set_camera_property(CamProp.ScanMode, "scan_mode", value, min_val, max_val)
+        self._native().set_in_range(CamProp.ScanMode, value)
 
     @property
     def privacy(self) -> bool:
         """Privacy mode on/off."""
-        return bool(self._get_camera_property(CamProp.Privacy, "privacy"))
+        return bool(self._native().get(CamProp.Privacy))
 
     @privacy.setter
     def privacy(self, value: bool):
         """Set privacy mode (no range needed for bool)."""
-        self._set_camera_property(CamProp.Privacy, "privacy", int(value))
+        self._native().set(CamProp.Privacy, int(value))
 
     @property
     def digital_zoom(self) -> int:
         """Digital zoom level (uses device range)."""
-        return self._get_camera_property(CamProp.DigitalZoom, "digital_zoom")
+        return self._native().get(CamProp.DigitalZoom)
 
     @digital_zoom.setter
     def digital_zoom(self, value: int):
         """Set digital zoom using actual device range."""
-        min_val, max_val = self._get_dynamic_range("digital_zoom", 100, 400)
-        self._set_camera_property(CamProp.DigitalZoom, "digital_zoom", value, min_val, max_val)
+        self._native().set_in_range(CamProp.DigitalZoom, value)
 
     @property
     def backlight_compensation(self) -> int:
         """Camera-level backlight compensation (uses device range)."""
-        return self._get_camera_property(CamProp.BacklightCompensation, "backlight_compensation")
+        return self._native().get(CamProp.BacklightCompensation)
 
     @backlight_compensation.setter
     def backlight_compensation(self, value: int):
         """Set backlight compensation using actual device range."""
-        min_val, max_val = self._get_dynamic_range("backlight_compensation", 0, 100)
-        self._set_camera_property(CamProp.BacklightCompensation, "backlight_compensation", value, min_val, max_val)
+        self._native().set_in_range(CamProp.BacklightCompensation, value)
 
     # ========================================================================
     # RELATIVE MOVEMENT METHODS (For PTZ cameras)
     # ========================================================================
 
     def pan_relative(self, degrees: int):
-        """Move pan by relative amount (degrees). No range validation needed."""
-        self._set_camera_property(CamProp.PanRelative, "pan_relative", degrees)
+        """Move pan by relative amount (degrees), clamped to the device range."""
+        self._native().nudge(CamProp.Pan, degrees)
 
     def tilt_relative(self, degrees: int):
-        """Move tilt by relative amount (degrees). No range validation needed."""
-        self._set_camera_property(CamProp.TiltRelative, "tilt_relative", degrees)
+        """Move tilt by relative amount (degrees), clamped to the device range."""
+        self._native().nudge(CamProp.Tilt, degrees)
 
     def roll_relative(self, degrees: int):
-        """Roll by relative amount (degrees). No range validation needed."""
-        self._set_camera_property(CamProp.RollRelative, "roll_relative", degrees)
+        """Roll by relative amount (degrees), clamped to the device range."""
+        self._native().nudge(CamProp.Roll, degrees)
 
     def zoom_relative(self, steps: int):
-        """Zoom by relative amount (steps). No range validation needed."""
-        self._set_camera_property(CamProp.ZoomRelative, "zoom_relative", steps)
+        """Zoom by relative amount (steps), clamped to the device range."""
+        self._native().nudge(CamProp.Zoom, steps)
 
     def focus_relative(self, steps: int):
-        """Focus by relative amount (steps). No range validation needed."""
-        self._set_camera_property(CamProp.FocusRelative, "focus_relative", steps)
+        """Focus by relative amount (steps), clamped to the device range."""
+        self._native().nudge(CamProp.Focus, steps)
 
     def exposure_relative(self, steps: int):
-        """Adjust exposure by relative amount (steps). No range validation needed."""
-        self._set_camera_property(CamProp.ExposureRelative, "exposure_relative", steps)
+        """Adjust exposure by relative amount (steps), clamped to the device range."""
+        self._native().nudge(CamProp.Exposure, steps)
 
     def iris_relative(self, steps: int):
-        """Adjust iris by relative amount (steps). No range validation needed."""
-        self._set_camera_property(CamProp.IrisRelative, "iris_relative", steps)
+        """Adjust iris by relative amount (steps), clamped to the device range."""
+        self._native().nudge(CamProp.Iris, steps)
 
     def digital_zoom_relative(self, steps: int):
-        """Digital zoom by relative amount (steps). No range validation needed."""
-        self._set_camera_property(CamProp.DigitalZoomRelative, "digital_zoom_relative", steps)
+        """Digital zoom by relative amount (steps), clamped to the device range."""
+        self._native().nudge(CamProp.DigitalZoom, steps)
 
 
     # ========================================================================
@@ -658,7 +662,7 @@ class CameraController:
         # Try combined control first
         try:
             pan_tilt_value = (pan_degrees << 16) | (tilt_degrees & 0xFFFF)
-            self._set_camera_property(CamProp.PanTilt, "pan_tilt", pan_tilt_value)
+            self._native().set(CamProp.PanTilt, pan_tilt_value)
         except (PropertyNotSupportedError, AttributeError):
             # Fallback to individual controls
             self.pan = pan_degrees
@@ -669,33 +673,22 @@ class CameraController:
         self._ensure_connected()
         try:
             pan_tilt_value = (pan_delta << 16) | (tilt_delta & 0xFFFF)
-            self._set_camera_property(CamProp.PanTiltRelative, "pan_tilt_relative", pan_tilt_value)
+            self._native().set(CamProp.PanTiltRelative, pan_tilt_value)
         except (PropertyNotSupportedError, AttributeError):
             # Fallback to individual relative moves
             self.pan_relative(pan_delta)
             self.tilt_relative(tilt_delta)
 
     # ========================================================================
-    # INTERNAL PROPERTY HELPERS - ONLY USE CORE RESULT<T> API
+    # INTERNAL PROPERTY HELPERS - NATIVE FAST PATH (ControllerCore)
     # ========================================================================
     
     def _get_video_property(self, prop, prop_name: str) -> int:
-        """Get video property using core Result<T> API."""
-        self._ensure_connected()
-        try:
-            result = self._core_camera.get(prop)
-            if not result.is_ok():
-                raise PropertyNotSupportedError(
-                    f"Cannot get {prop_name}: {result.error().description()}"
-                )
-            return result.value().value
-        except Exception as e:
-            if isinstance(e, PropertyNotSupportedError):
-                raise
-            raise DuvcSystemError(f"Unexpected error reading {prop_name}: {e}")
+        """Get video property using the native fast path."""
+        return self._native().get(prop)
     
     def _set_video_property(self, prop, prop_name: str, value: int, min_val: Optional[int] = None, max_val: Optional[int] = None) -> None:
-        """Set video property using core Result<T> API with optional range validation.
+        """Set video property through the native fast path with optional range validation.
         
         Args:
             prop: Video property enum (VidProp)
@@ -722,37 +715,16 @@ class CameraController:
             if value > max_val:
                 raise InvalidValueError(f"{prop_name} must be <= {max_val}, got {value}")
         
-        try:
-            setting = PropSetting(value, CamMode.Manual)
-            result = self._core_camera.set(prop, setting)
-            if not result.is_ok():
-                raise PropertyNotSupportedError(
-                    f"Cannot set {prop_name}: {result.error().description()}"
-                )
-        except Exception as e:
-            if isinstance(e, (PropertyNotSupportedError, InvalidValueError)):
-                raise
-            raise DuvcSystemError(f"Unexpected error setting {prop_name}: {e}")
+        self._native().set(prop, value)
   
     def _get_camera_property(self, prop, prop_name: str) -> int:
-        """Get camera property using core Result<T> API."""
-        self._ensure_connected()
-        try:
-            result = self._core_camera.get(prop)
-            if not result.is_ok():
-                raise PropertyNotSupportedError(
-                    f"Cannot get {prop_name}: {result.error().description()}"
-                )
-            return result.value().value
-        except Exception as e:
-            if isinstance(e, PropertyNotSupportedError):
-                raise
-            raise DuvcSystemError(f"Unexpected error reading {prop_name}: {e}")
+        """Get camera property using the native fast path."""
+        return self._native().get(prop)
         
     def _set_camera_property(self, prop, prop_name: str, value: int, 
                             min_val: Optional[int] = None, 
                             max_val: Optional[int] = None) -> None:
-        """Set camera property using core Result<T> API with optional range validation.
+        """Set camera property through the native fast path with optional range validation.
         
         Args:
             prop: Camera property enum (CamProp)
@@ -779,67 +751,58 @@ class CameraController:
             if value > max_val:
                 raise InvalidValueError(f"{prop_name} must be <= {max_val}, got {value}")
         
-        # Set the property value via C++ core API
-        try:
-            setting = PropSetting(value, CamMode.Manual)
-            result = self._core_camera.set(prop, setting)
-            if not result.is_ok():
-                raise PropertyNotSupportedError(
-                    f"Cannot set {prop_name}: {result.error().description()}"
-                )
-        except Exception as e:
-            # Re-raise known exceptions, wrap others
-            if isinstance(e, (PropertyNotSupportedError, InvalidValueError)):
-                raise
-            raise DuvcSystemError(f"Unexpected error setting {prop_name}: {e}")
+        # Set the property value via the native fast path
+        self._native().set(prop, value)
 
     # ========================================================================
     # CONVENIENCE METHODS 
     # ========================================================================
     
-    def reset_to_defaults(self) -> None:
+    def reset_to_defaults(self) -> int:
         """Reset all supported properties to factory defaults.
         
-        Dynamically queries device capabilities and attempts to reset all supported
-        camera and video properties to their factory defaults. Partial success is
-        expected; some properties (e.g., Privacy on integrated cameras) may be
-        hardware-locked and fail silently.
+        Resets all supported camera and video properties in one native call.
+        Properties already at their default value and mode are skipped, and
+        properties that default to auto are written after the manual ones so
+        auto exposure, focus and white balance restart only once. Partial
+        success is expected; some properties (e.g., Privacy on integrated
+        cameras) may be hardware-locked.
         
-        No exceptions raised; failures are logged at debug level. Use
-        `reset_device_to_defaults(device)` for detailed per-property results.
+        Failures are logged at debug level. Use
+        `reset_device_to_defaults(device)` for per-property results.
+        
+        Returns:
+            Number of properties actually written.
         
         Examples:
             >>> with CameraController() as cam:
-            ...     cam.reset_to_defaults()
-            ...     # All supported properties reset to defaults
+            ...     written = cam.reset_to_defaults()
+            ...     print(f"{written} properties changed")
             
         Notes:
-            - Internally calls `reset_device_to_defaults(device)` from the
-            Result-based API for core functionality.
-            - Returns None; use the Result-based API for success/failure details.
+            - Relative controls (PanRelative, ZoomRelative, ...) are not touched.
             - Some hardware (e.g., integrated webcams) may have read-only properties.
         """
         self._ensure_connected()
-        from duvc_ctl import reset_device_to_defaults  # Import here to avoid circular dep
         
         try:
-            results = reset_device_to_defaults(self._device)
-            successes = sum(1 for v in results.values() if v)
-            failures = [k for k, v in results.items() if not v]
-            
-            if failures:
-                import logging
-                logger = logging.getLogger(__name__)
-                logger.debug(
-                    f"Reset completed with {successes}/{len(results)} properties. "
-                    f"Failed: {', '.join(failures)} (may be hardware-locked or unsupported)"
-                )
+            report = core_reset_to_defaults(self._core_camera)
         except Exception as e:
             import logging
             logger = logging.getLogger(__name__)
             logger.warning(f"reset_to_defaults encountered error: {e}")
             raise
 
+        if report.failed:
+            import logging
+            logger = logging.getLogger(__name__)
+            failures = [e.name for e in report.entries if e.error is not None]
+            logger.debug(
+                f"Reset wrote {report.writes} properties, skipped {report.skipped}. "
+                f"Failed: {', '.join(failures)} (may be hardware-locked or unsupported)"
+            )
+        return report.writes
+
     
     def center_camera(self):
         """Move pan/tilt to center position.
@@ -1135,35 +1098,8 @@ class CameraController:
             ValueError: If property name unknown
             PropertyNotSupportedError: If property not supported by device
         """
-        self._ensure_connected()
-        
-        # Handle "auto" value
-        if isinstance(value, str) and value.lower() == "auto":
-            return self._set_property_auto(property_name)
-        
-        # Parse mode string
-        parsed_mode = self._parse_mode_string(mode, property_name)
-        
-        # Set property using internal methods
-        if property_name in self._VIDEO_PROPERTIES:
-            prop_enum = self._VIDEO_PROPERTIES[property_name]
-            setting = PropSetting(int(value), parsed_mode)
-            result = self._core_camera.set(prop_enum, setting)
-            if not result.is_ok():
-                raise PropertyNotSupportedError(
-                    f"Cannot set {property_name}: {result.error().description()}"
-                )
-        elif property_name in self._CAMERA_PROPERTIES:
-            prop_enum = self._CAMERA_PROPERTIES[property_name]
-            setting = PropSetting(int(value), parsed_mode)
-            result = self._core_camera.set(prop_enum, setting)
-            if not result.is_ok():
-                raise PropertyNotSupportedError(
-                    f"Cannot set {property_name}: {result.error().description()}"
-                )
-        else:
-            available = list(self._VIDEO_PROPERTIES.keys()) + list(self._CAMERA_PROPERTIES.keys())
-            raise ValueError(f"Unknown property '{property_name}'. Available: {', '.join(available)}")
+        # Name lookup, mode parsing and error translation run natively
+        self._native().set(property_name, value, mode)
 
     def get(self, property_name: str) -> Union[int, bool]:
         """Get property value by name.
@@ -1178,29 +1114,7 @@ class CameraController:
             ValueError: If property name unknown
             PropertyNotSupportedError: If property not supported by device
         """
-
-        self._ensure_connected()
-        
-        if property_name in self._VIDEO_PROPERTIES:
-            prop_enum = self._VIDEO_PROPERTIES[property_name]
-            result = self._core_camera.get(prop_enum)
-            if not result.is_ok():
-                raise PropertyNotSupportedError(f"Cannot get {property_name}: {result.error().description()}")
-            value = result.value().value
-            # Convert to bool for boolean properties to match property descriptors
-            return bool(value) if property_name in self._BOOLEAN_PROPERTIES else value
-        elif property_name in self._CAMERA_PROPERTIES:
-            prop_enum = self._CAMERA_PROPERTIES[property_name]
-            result = self._core_camera.get(prop_enum)
-            if not result.is_ok():
-                raise PropertyNotSupportedError(f"Cannot get {property_name}: {result.error().description()}")
-            value = result.value().value
-            # Convert to bool for boolean properties to match property descriptors
-            return bool(value) if property_name in self._BOOLEAN_PROPERTIES else value
-        else:
-            available = list(self._VIDEO_PROPERTIES.keys()) + list(self._CAMERA_PROPERTIES.keys())
-            raise ValueError(f"Unknown property '{property_name}'. Available: {', '.join(available)}")
-
+        return self._native().get(property_name)
 
     def _parse_mode_string(self, mode: str, property_name: str) -> Union[CamMode, CamMode]:
         """Convert mode string to CamMode enum.
@@ -1239,22 +1153,7 @@ class CameraController:
 
     def _set_property_auto(self, property_name: str) -> None:
         """Set property to auto mode."""
-        if property_name in self._VIDEO_PROPERTIES:
-            prop_enum = self._VIDEO_PROPERTIES[property_name]
-            setting = PropSetting(0, CamMode.Auto)  # Value ignored in auto mode
-            result = self._core_camera.set(prop_enum, setting)
-        elif property_name in self._CAMERA_PROPERTIES:
-            prop_enum = self._CAMERA_PROPERTIES[property_name]
-            setting = PropSetting(0, CamMode.Auto)  # Value ignored in auto mode
-            result = self._core_camera.set(prop_enum, setting)
-        else:
-            available = list(self._VIDEO_PROPERTIES.keys()) + list(self._CAMERA_PROPERTIES.keys())
-            raise ValueError(f"Unknown property '{property_name}'. Available: {', '.join(available)}")
-        
-        if not result.is_ok():
-            raise PropertyNotSupportedError(
-                f"Cannot set {property_name} to auto: {result.error().description()}"
-            )
+        self._native().set(property_name, "auto")
 
     # ========================================================================
     # BULK OPERATIONS
@@ -1270,18 +1169,7 @@ class CameraController:
         Returns:
             Dict mapping property names to success status
         """
-        self._ensure_connected()
-        
-        results = {}
-        failed_properties = []
-        
-        for prop_name, value in properties.items():
-            try:
-                self.set(prop_name, value)
-                results[prop_name] = True
-            except Exception as e:
-                results[prop_name] = False
-                failed_properties.append((prop_name, str(e)))
+        results, failed_properties = self._native().set_many(properties)
         
         # Provide feedback for failed properties if requested
         if verbose and failed_properties:
@@ -1301,20 +1189,8 @@ class CameraController:
         Returns:
             Dict mapping property names to values. Unsupported properties omitted.
         """
-        self._ensure_connected()
-        
-        results = {}
-        
-        for prop_name in properties:
-            try:
-                value = self.get(prop_name)
-                results[prop_name] = value
-            except Exception:
-                # Skip properties that can't be read (not supported, etc.)
-                # This keeps the method simple and forgiving
-                pass
-        
-        return results
+        # Properties that can't be read (not supported, etc.) are skipped
+        return self._native().get_many(properties)
 
     # ========================================================================
     # PRESETS
@@ -1366,12 +1242,13 @@ class CameraController:
             List of preset names
         """
         built_in = ['daylight', 'indoor', 'night', 'conference']
+        stored = self.get_stored_preset_names()
         
         if hasattr(self, '_custom_presets'):
             custom = list(self._custom_presets.keys())
-            return built_in + custom
+            return built_in + custom + stored
         
-        return built_in
+        return built_in + stored
 
 
     def create_custom_preset(self, name: str, properties: Dict[str, Union[int, str]]) -> None:
@@ -1478,17 +1355,108 @@ class CameraController:
             results = self.set_multiple(self._custom_presets[preset_name])
             return all(results.values())
         
+        # Then presets saved with save_preset()
+        stored = self._load_preset_store()
+        preset = stored.find(preset_name) if stored is not None else None
+        if preset is not None:
+            return self._recaller().recall(preset).failed == 0
+        
         # Check built-in presets
         if preset_name not in presets:
             available = list(presets.keys())
             if hasattr(self, '_custom_presets'):
                 available.extend(self._custom_presets.keys())
+            if stored is not None:
+                available.extend(p.name for p in stored.presets)
             raise ValueError(f"Unknown preset '{preset_name}'. Available: {', '.join(available)}")
         
         results = self.set_multiple(presets[preset_name])
         return all(results.values())
 
 
+    @staticmethod
+    def _load_preset_store(store_path: Optional[str] = None) -> Optional[PresetStore]:
+        """Load the preset store, or None if it cannot be read.
+        
+        Used where stored presets are optional, so a missing or corrupt store
+        file does not break custom and built-in presets.
+        """
+        try:
+            store = PresetStore(store_path)
+            store.load()
+            return store
+        except Exception as e:
+            import logging
+            logger = logging.getLogger(__name__)
+            logger.warning(f"Could not load preset store: {e}")
+            return None
+
+    def _recaller(self) -> PresetRecaller:
+        """Get the camera's preset recaller, creating it on first use."""
+        self._ensure_connected()
+        if self._preset_recaller is None:
+            self._preset_recaller = PresetRecaller(self._core_camera)
+        return self._preset_recaller
+
+    def save_preset(self, name: str, store_path: Optional[str] = None) -> int:
+        """Save the camera's current property values as a persistent preset.
+        
+        The preset is written to the native preset store, which the CLI and C
+        API share, so it survives the process and can be recalled elsewhere.
+        
+        Args:
+            name: Preset name; an existing preset is replaced
+            store_path: Store file (default location if None)
+            
+        Returns:
+            Stored preset version
+        """
+        store = PresetStore(store_path)
+        store.load()
+        stored = store.put(self._recaller().capture(name))
+        store.save()
+        return stored.version
+
+    def recall_preset(self, name: str, store_path: Optional[str] = None) -> PresetRecallReport:
+        """Recall a preset saved with save_preset().
+        
+        Only properties whose last known value differs from the preset are
+        written, so switching between presets on an open camera is cheap.
+        
+        Args:
+            name: Preset name
+            store_path: Store file (default location if None)
+            
+        Returns:
+            Recall report with write counts and timing
+            
+        Raises:
+            ValueError: If the preset is not stored
+        """
+        store = PresetStore(store_path)
+        store.load()
+        preset = store.find(name)
+        if preset is None:
+            raise ValueError(f"Unknown stored preset '{name}'")
+        return self._recaller().recall(preset)
+
+    def get_stored_preset_names(self, store_path: Optional[str] = None) -> List[str]:
+        """Get names of presets saved with save_preset().
+        
+        Args:
+            store_path: Store file (default location if None)
+            
+        Returns:
+            List of preset names, empty if the store cannot be read
+        """
+        store = PresetStore(store_path)
+        try:
+            store.load()
+        except Exception:
+            return []
+        return [p.name for p in store.presets]
+
+
     # ========================================================================
     # CONVENIENCE DIRECT SETTER METHODS
     # ========================================================================
@@ -1,7 +1,9 @@
 """
 duvc-ctl - DirectShow UVC Camera Control Library
 
-Windows-only library for USB Video Class camera control via DirectShow.
+Library for USB Video Class camera control: DirectShow on Windows, V4L2 on
+Linux, and an in-memory fake backend (DUVC_BACKEND=fake or
+install_fake_backend()) for running without cameras anywhere.
 
 Two APIs available:
 1. CameraController (Pythonic) - Simple property-based access with exceptions
@@ -40,9 +42,9 @@ try:
     # Re-export all C++ bindings
     from ._duvc_ctl import *
 except ImportError as e:
-    msg = "Could not import C++ extension module for duvc-ctl. This library is Windows-only."
-    if sys.platform != "win32":
-        msg += "\n\nNote: duvc-ctl uses DirectShow APIs and requires Windows."
+    msg = "Could not import C++ extension module for duvc-ctl."
+    if sys.platform not in ("win32", "linux"):
+        msg += "\n\nNote: duvc-ctl wheels are built for Windows and Linux."
     raise ImportError(f"{msg}\nOriginal error: {e}") from e
 
 # Top-level aliases for Logitech extensions
@@ -471,14 +473,19 @@ def get_device_info(device: Device) -> DeviceInfo:
 
 def reset_device_to_defaults(device: Device) -> Dict[str, bool]:
     """
-    Reset supported properties to factory defaults using capabilities query.
-    
+    Reset supported properties to factory defaults.
+
+    Properties already at their default value and mode are left alone, and
+    properties that default to auto are written last. Relative controls
+    (PanRelative, ZoomRelative, ...) are not touched.
+
     Args:
         device: Single Device instance.
-    
+
     Returns:
         Dict[str, bool]: {prop.name: success} for each supported property.
-    
+        Skipped properties count as successes.
+
     Raises:
         TypeError: Invalid input.
     """
@@ -488,53 +495,18 @@ def reset_device_to_defaults(device: Device) -> Dict[str, bool]:
         raise TypeError(f"Expected Device, got {type(device)}.")
 
     results: Dict[str, bool] = {}
-    caps_result = get_device_capabilities(device)
-    if not caps_result.is_ok():
-        return results
-    caps = caps_result.value()
-
     camera_result = open_camera(device)
     if not camera_result.is_ok():
         return results
     camera = camera_result.value()
 
     try:
-        # Camera properties
-        for prop in caps.supported_camera_properties():
-            prop_name = prop.name
-            try:
-                range_result = camera.get_range(prop)
-                if range_result.is_ok():
-                    prop_range = range_result.value()
-                    default_val = prop_range.default_val  # PROPERTY, NOT METHOD
-                    default_mode = prop_range.default_mode  # PROPERTY, NOT METHOD
-                    setting = PropSetting(default_val, default_mode)
-                else:
-                    setting = PropSetting(0, CamMode.Auto)
-                
-                set_result = camera.set(prop, setting)
-                results[prop_name] = set_result.is_ok()
-            except Exception:
-                results[prop_name] = False
-
-        # Video properties
-        for prop in caps.supported_video_properties():
-            prop_name = prop.name
-            try:
-                range_result = camera.get_range(prop)
-                if range_result.is_ok():
-                    prop_range = range_result.value()
-                    default_val = prop_range.default_val  # PROPERTY, NOT METHOD
-                    default_mode = prop_range.default_mode  # PROPERTY, NOT METHOD
-                    setting = PropSetting(default_val, default_mode)
-                else:
-                    setting = PropSetting(0, CamMode.Auto)
-                
-                set_result = camera.set(prop, setting)
-                results[prop_name] = set_result.is_ok()
-            except Exception:
-                results[prop_name] = False
-
+        report = reset_to_defaults(camera)
+        for entry in report.entries:
+            results[entry.name] = entry.outcome != ResetOutcome.Failed
+    except Exception as e:
+        import logging
+        logging.warning(f"Failed to reset device {device.name}: {e}")
     finally:
         try:
             camera.close()
@@ -709,10 +681,10 @@ def enable_debug_logging() -> None:
 # PLATFORM DETECTION AND WARNINGS
 # =============================================================================
 
-if sys.platform != "win32":
+if native_platform_backend() == "none":
     warnings.warn(
-        "duvc-ctl is designed for Windows only and uses DirectShow APIs. "
-        "Most functionality may not be available on other platforms.",
+        "duvc-ctl has no camera backend on this platform; only fake devices "
+        "(DUVC_BACKEND=fake or install_fake_backend()) are available.",
         RuntimeWarning,
         stacklevel=2
     )
@@ -740,8 +712,8 @@ __all__ = [
     "CamMode", "CamProp", "VidProp", "ErrorCode", "LogLevel",
 
     # Core types (exported from C++)
-    "Device", "Camera", "PropSetting", "PropRange",
-    "PropertyCapability", "DeviceCapabilities",
+    "Device", "Camera", "ControllerCore", "PropSetting", "PropRange",
+    "PropertyCapability", "DeviceCapabilities", "CamPropSet", "VidPropSet",
 
     # Result types (exported from C++)
     "PropSettingResult", "PropRangeResult", "VoidResult", 
@@ -754,6 +726,55 @@ __all__ = [
     # Core functions (exported from C++)
     "list_devices", "open_camera", "is_device_connected", "get_device_capabilities",
 
+    # Retry and circuit breaker policy (exported from C++)
+    "RetryPolicy", "CircuitBreakerConfig", "DevicePolicy", "CircuitState", "PolicyStats",
+    "get_default_device_policy", "set_default_device_policy",
+
+    # Closed-loop property controllers (exported from C++)
+    "ControlEngine", "ControlLoopConfig", "ControlLoopStats", "ControlMode", "PidGains",
+
+    # Property search (exported from C++)
+    "SearchMethod", "SearchOptions", "SearchResult", "search_property",
+
+    # Settle waits (exported from C++)
+    "SettleStatus", "SettleResult",
+
+    # Cue list timelines (exported from C++)
+    "Cue", "CueDomain", "CueReport", "TimelineOptions", "TimelinePlayer", "TimelineReport",
+    "load_cue_file", "parse_cue_json", "parse_cue_binary", "serialize_cue_binary",
+
+    # Reset to defaults (exported from C++)
+    "ResetFilter", "ResetOutcome", "ResetEntry", "ResetReport", "reset_to_defaults",
+
+    # Presets (exported from C++)
+    "Preset", "PresetValue", "PresetPlan", "PresetPlanStep", "PresetRecallEntry",
+    "PresetRecallReport", "PresetStore", "PresetRecaller", "compile_preset",
+    "default_preset_path", "parse_presets", "serialize_presets",
+
+    # Device identity and indexed lookup (exported from C++)
+    "DeviceIdentity", "DeviceIndex", "parse_device_identity", "same_device_path",
+
+    # Desired-state reconciliation (exported from C++)
+    "DeviceSelector", "DesiredDeviceState", "DesiredState", "DriftEvent", "SweepReport",
+    "ReconcilerStats", "Reconciler", "parse_desired_state", "load_desired_state",
+
+    # Device profiles (exported from C++)
+    "RangeOverride", "DeviceProfile", "DeviceProfileDatabase", "parse_device_profiles",
+    "load_device_profiles", "builtin_device_profiles", "default_device_profiles_path",
+    "find_device_profile",
+
+    # Trace recording and replay (exported from C++)
+    "TraceOp", "TraceEvent", "Trace", "TraceRecorder", "ReplayOptions", "serialize_trace",
+    "parse_trace", "save_trace", "load_trace", "install_trace_recorder", "install_trace_replay",
+
+    # Fault injection (exported from C++)
+    "ChaosConfig", "ChaosStats", "ChaosController", "install_chaos",
+
+    # Fake devices (exported from C++)
+    "FakeControl", "FakeDevice", "FakeScenario", "FakeStats", "FakeBackend",
+    "parse_fake_scenario", "load_fake_scenario", "builtin_fake_scenario",
+    "install_fake_backend", "native_platform_backend",
+
     # Exception-throwing helpers (simple API)
     "open_camera_or_throw",
     "get_device_capabilities_or_throw",
@@ -765,6 +786,9 @@ __all__ = [
     "set_log_level", "get_log_level", "log_message", "log_debug", "log_info",
     "log_warning", "log_error", "log_critical", "set_log_callback",
 
+    # Callback delivery (exported from C++)
+    "flush_callbacks", "DispatchStats", "log_dispatch_stats", "device_event_dispatch_stats",
+
     # Error handling functions (exported from C++)
     "decode_system_error", "get_diagnostic_info",
 
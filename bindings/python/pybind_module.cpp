@@ -18,19 +18,26 @@
 #include <pybind11/functional.h>
 #include <pybind11/iostream.h>
 #include <pybind11/numpy.h>
+#include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 #include <atomic>
+#include <cctype>
+#include <cmath>
+#include <filesystem>
 #include <functional>
 #include <iomanip>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <Python.h>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <system_error>
+#include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -70,47 +77,257 @@
 // pybind11 namespace alias
 namespace py = pybind11;
 
+#ifdef _WIN32
 namespace duvc {
 
     // Static container to hold strong references to all KsPropertySet instances
     static std::vector<std::shared_ptr<KsPropertySet>> ks_property_set_instances;
 
     // Cleanup function to be called at module exit (registered via atexit)
-    void cleanup_ks_property_sets() {
+    static void cleanup_ks_property_sets() {
         ks_property_set_instances.clear();  // Clear all references when Python exits
     }
 
     // Register cleanup function via atexit to ensure it's called when Python exits
-    void register_cleanup() {
-        std::cout << "Cleaning up KsPropertySets..." << std::endl;
+    static void register_cleanup() {
         std::atexit(cleanup_ks_property_sets);
     }
 
 } // end namespace duvc
+#endif // _WIN32
 
 using namespace duvc;
 
 // ========================================
-// Device Callback Shutdown Detection
+// Per-Interpreter Module State
 // ========================================
 /**
- * @brief Thread-safe flag for active callbacks
- * Starts false; set true on register, false on unregister/shutdown.
+ * @brief Log record queued for Python
+ */
+struct PyLogRecord {
+    LogLevel level;
+    std::string message;
+};
+
+/**
+ * @brief Hotplug event queued for Python
+ */
+struct PyDeviceEvent {
+    bool added;
+    std::string path;
+};
+
+/**
+ * @brief Python side of a dispatcher
+ * Immutable once published; replaced and released with a thread state attached.
+ */
+struct PyCallbackTarget {
+    py::object callback;
+    py::object loop;    ///< asyncio loop to deliver on; None calls directly
+    bool batch = false; ///< One call with a list per batch instead of per event
+};
+
+/**
+ * @brief State of one module instance
+ *
+ * Owned by the module object (so every interpreter importing the module has
+ * its own) and shared with the native callbacks it installs. Nothing here
+ * relies on the GIL for mutual exclusion, so it holds up in free-threaded
+ * builds too.
+ */
+struct ModuleState {
+    using TargetSlot = std::shared_ptr<PyCallbackTarget> ModuleState::*;
+
+    std::mutex mutex; ///< Guards the targets and dispatcher creation
+    std::shared_ptr<PyCallbackTarget> log_target;
+    std::shared_ptr<PyCallbackTarget> device_target;
+
+    /// Device events are queued only while a callback is registered
+    std::atomic<bool> device_callbacks_active{false};
+    /// Records below this level are dropped before they are queued
+    std::atomic<int> python_log_level{static_cast<int>(LogLevel::Debug)};
+
+    // Native threads only post into these; one dispatcher thread each enters
+    // Python once per batch. Created on first use, stopped at exit, and
+    // never reset while the state lives.
+    std::unique_ptr<BatchDispatcher<PyLogRecord>> log_dispatcher;
+    std::unique_ptr<BatchDispatcher<PyDeviceEvent>> device_dispatcher;
+
+    std::shared_ptr<PyCallbackTarget> target(TargetSlot slot) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return this->*slot;
+    }
+
+    /// Publish a target; the previous one is released after the lock
+    void set_target(TargetSlot slot, std::shared_ptr<PyCallbackTarget> next) {
+        std::lock_guard<std::mutex> lock(mutex);
+        (this->*slot).swap(next);
+    }
+
+    BatchDispatcher<PyLogRecord> &logs();
+    BatchDispatcher<PyDeviceEvent> &device_events();
+
+    /// Dispatchers started so far (null until first use)
+    std::pair<BatchDispatcher<PyLogRecord> *, BatchDispatcher<PyDeviceEvent> *>
+    started() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return {log_dispatcher.get(), device_dispatcher.get()};
+    }
+};
+
+using ModuleStatePtr = std::shared_ptr<ModuleState>;
+
+/**
+ * @brief Hand a batch of argument tuples to a Python target (thread state
+ * attached)
+ *
+ * Exceptions raised by the callback are swallowed so one bad event does not
+ * lose the rest of the batch.
+ */
+static void deliver_python_batch(const PyCallbackTarget &target, py::list events) {
+    py::object callback = target.callback;
+    bool batch = target.batch;
+    py::cpp_function run([callback, events, batch]() {
+        auto call = [&](py::handle args, bool whole) {
+            try {
+                if (whole) {
+                    callback(args);
+                } else {
+                    callback(*py::reinterpret_borrow<py::tuple>(args));
+                }
+            } catch (const py::error_already_set &) {
+                PyErr_Clear();
+            }
+        };
+        if (batch) {
+            call(events, true);
+        } else {
+            for (py::handle args : events) {
+                call(args, false);
+            }
+        }
+    });
+    if (target.loop.is_none()) {
+        run();
+        return;
+    }
+    try {
+        target.loop.attr("call_soon_threadsafe")(run);
+    } catch (const py::error_already_set &) {
+        PyErr_Clear(); // Loop closed: the batch is dropped
+    }
+}
+
+/// Batch sink that converts events to argument tuples for a Python target.
+/// The dispatcher is owned by the state, so the raw pointer outlives it.
+template <typename T, typename Convert>
+static typename BatchDispatcher<T>::Sink
+python_batch_sink(ModuleState *state, ModuleState::TargetSlot slot, Convert convert) {
+    return [state, slot, convert](std::vector<T> &batch) {
+        if (Py_IsInitialized() == 0) {
+            return;
+        }
+        py::gil_scoped_acquire gil;
+        std::shared_ptr<PyCallbackTarget> target = state->target(slot);
+        if (!target) {
+            return;
+        }
+        py::list events;
+        for (auto &event : batch) {
+            events.append(convert(event));
+        }
+        deliver_python_batch(*target, std::move(events));
+    };
+}
+
+BatchDispatcher<PyLogRecord> &ModuleState::logs() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!log_dispatcher) {
+        log_dispatcher = std::make_unique<BatchDispatcher<PyLogRecord>>(
+            python_batch_sink<PyLogRecord>(this, &ModuleState::log_target,
+                                           [](PyLogRecord &record) {
+                return py::make_tuple(record.level, std::move(record.message));
+            }));
+    }
+    return *log_dispatcher;
+}
+
+BatchDispatcher<PyDeviceEvent> &ModuleState::device_events() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!device_dispatcher) {
+        device_dispatcher = std::make_unique<BatchDispatcher<PyDeviceEvent>>(
+            python_batch_sink<PyDeviceEvent>(this, &ModuleState::device_target,
+                                             [](PyDeviceEvent &event) {
+                return py::make_tuple(event.added, std::move(event.path));
+            }));
+    }
+    return *device_dispatcher;
+}
+
+/// Records the log callback captured for log_from_python() on this thread
+static thread_local std::vector<PyLogRecord> *t_python_records = nullptr;
+
+/**
+ * @brief Log from Python (thread state attached)
+ *
+ * Records logged from Python are delivered before the call returns. They are
+ * captured on this thread and handed to the Python callback directly rather
+ * than through the dispatcher, so the call never waits on its queue.
  */
-static std::atomic<bool> g_python_callback_active{false};
+static void log_from_python(const ModuleStatePtr &state, LogLevel level,
+                            const std::string &message) {
+    std::vector<PyLogRecord> records;
+    struct Capture {
+        explicit Capture(std::vector<PyLogRecord> *records) {
+            t_python_records = records;
+        }
+        ~Capture() { t_python_records = nullptr; }
+    };
+    {
+        Capture capture(&records);
+        log_message(level, message);
+    }
+    std::shared_ptr<PyCallbackTarget> target =
+        records.empty() ? nullptr : state->target(&ModuleState::log_target);
+    if (!target) {
+        return;
+    }
+    py::list events;
+    for (auto &record : records) {
+        events.append(py::make_tuple(record.level, std::move(record.message)));
+    }
+    deliver_python_batch(*target, std::move(events));
+}
 
 /**
- * @brief Stored callback function (file-scope for safe cleanup)
+ * @brief Safe cleanup: Disable flag and clear the device callback
+ * Used by atexit and unregister for reference release with a thread state.
  */
-static py::function stored_callback;
+static void callback_cleanup(ModuleState &state) noexcept {
+    state.device_callbacks_active.store(false);
+    state.set_target(&ModuleState::device_target, nullptr);
+}
 
 /**
- * @brief Safe cleanup: Disable flag and clear callback during finalization
- * Used by atexit and unregister for reference release while GIL held.
+ * @brief Stop the dispatcher threads before the interpreter goes away
+ * Called from atexit; detaches while the threads finish their last batch.
  */
-static void callback_cleanup() noexcept {
-    g_python_callback_active.store(false);
-    stored_callback = py::function();  // Explicit clear releases PyObject refs safely
+static void dispatcher_shutdown(ModuleState &state) noexcept {
+    if (state.target(&ModuleState::log_target)) {
+        set_log_callback(nullptr);
+    }
+    {
+        py::gil_scoped_release release;
+        auto dispatchers = state.started();
+        if (dispatchers.first) {
+            dispatchers.first->stop();
+        }
+        if (dispatchers.second) {
+            dispatchers.second->stop();
+        }
+    }
+    state.set_target(&ModuleState::log_target, nullptr);
+    callback_cleanup(state);
 }
 
 
@@ -129,51 +346,13 @@ class Camera;  // Forward for RAII camera handle - opaque binding uses this
 /// Convert Windows wide string (UTF-16) to UTF-8 std::string
 /// Used for Device.name and Device.path properties which are wide internally
 static std::string wstring_to_utf8(const std::wstring &wstr) {
-#ifdef _WIN32
-  if (wstr.empty())
-    return std::string();
-  int size = WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), -1, nullptr, 0,
-                                 nullptr, nullptr);
-  if (size <= 0)
-    return std::string();
-  std::string result(
-      size - 1,
-      '\0'); // -1 to exclude null terminator counted by WideCharToMultiByte
-  WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), -1, &result[0], size, nullptr,
-                      nullptr);
-  return result;
-#else
-  // Simple fallback for non-Windows platforms
-  std::string result;
-  result.reserve(wstr.size());
-  for (wchar_t wc : wstr) {
-    result.push_back(static_cast<char>(wc & 0xFF));
-  }
-  return result;
-#endif
+  return duvc::to_utf8(wstr);
 }
 
 /// Convert UTF-8 std::string to Windows wide string (UTF-16)
 /// Used when passing Python strings to DirectShow APIs
 static std::wstring utf8_to_wstring(const std::string &str) {
-#ifdef _WIN32
-  if (str.empty())
-    return std::wstring();
-  int size = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, nullptr, 0);
-  if (size <= 0)
-    return std::wstring();
-  std::wstring result(size - 1, L'\0'); // -1 to exclude null terminator
-  MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, &result[0], size);
-  return result;
-#else
-  // Simple fallback for non-Windows platforms
-  std::wstring result;
-  result.reserve(str.size());
-  for (char c : str) {
-    result.push_back(static_cast<wchar_t>(static_cast<unsigned char>(c)));
-  }
-  return result;
-#endif
+  return duvc::to_wstring(str);
 }
 
 // =============================================================================
@@ -215,12 +394,552 @@ static void unwrap_void_or_throw(const duvc::Result<void> &result) {
   }
 }
 
+// =============================================================================
+// Device Identity Helpers
+// =============================================================================
+
+/// Check whether two devices share an identity key. Identical paths and
+/// differing key hashes are decided without parsing either path.
+static bool same_identity(const duvc::Device &a, const duvc::Device &b) {
+  if (a.path == b.path) {
+    return true;
+  }
+  if (duvc::device_key_hash(a.path) != duvc::device_key_hash(b.path)) {
+    return false;
+  }
+  return duvc::parse_device_identity(a.path).key ==
+         duvc::parse_device_identity(b.path).key;
+}
+
+// =============================================================================
+// Control Engine Helpers
+// =============================================================================
+
+/// Bind a property of a Python-owned camera; the bindings keep it alive
+template <typename Prop>
+static duvc::PropertyAccess
+shared_property_access(std::shared_ptr<duvc::Camera> camera, Prop prop) {
+  duvc::PropertyAccess access;
+  access.get = [camera, prop] { return camera->get(prop); };
+  access.set = [camera, prop](const duvc::PropSetting &setting) {
+    return camera->set(prop, setting);
+  };
+  access.range = [camera, prop] { return camera->get_range(prop); };
+  return access;
+}
+
+/// Wrap a Python measurement callable for use on the engine thread. The
+/// callable returns a float, or None to skip the tick; exceptions skip it too.
+static duvc::MeasurementFeed python_measurement_feed(py::function fn) {
+  // The last copy may be dropped on the engine thread: take the GIL to free it
+  std::shared_ptr<py::function> holder(new py::function(std::move(fn)),
+                                       [](py::function *f) {
+                                         py::gil_scoped_acquire gil;
+                                         delete f;
+                                       });
+  return [holder]() -> std::optional<double> {
+    if (Py_IsInitialized() == 0) {
+      return std::nullopt;
+    }
+    py::gil_scoped_acquire gil;
+    try {
+      py::object value = (*holder)();
+      if (value.is_none()) {
+        return std::nullopt;
+      }
+      return value.cast<double>();
+    } catch (const py::error_already_set &) {
+      PyErr_Clear();
+    } catch (...) {
+      // Suppress non-Python exceptions (e.g. bad return type)
+    }
+    return std::nullopt;
+  };
+}
+
+/// Wrap a Python callable taking one report object for use on a native
+/// thread. Exceptions are swallowed so they never unwind into the library.
+template <typename T>
+static std::function<void(const T &)> python_report_callback(py::object fn) {
+  if (fn.is_none()) {
+    return nullptr;
+  }
+  // The last copy may be dropped on a native thread: take the GIL to free it
+  std::shared_ptr<py::object> holder(new py::object(std::move(fn)),
+                                     [](py::object *f) {
+                                       py::gil_scoped_acquire gil;
+                                       delete f;
+                                     });
+  return [holder](const T &report) {
+    if (Py_IsInitialized() == 0) {
+      return;
+    }
+    py::gil_scoped_acquire gil;
+    try {
+      (*holder)(report);
+    } catch (const py::error_already_set &) {
+      PyErr_Clear();
+    }
+  };
+}
+
+/// Wrap a Python score callable for search_property(). It returns a float,
+/// or a zero-argument callable computing it, which then runs while the
+/// device moves to the next position.
+static duvc::ProbeFunction python_search_probe(py::function fn) {
+  return [fn](int value) -> duvc::DeferredScore {
+    py::object result = fn(value);
+    if (PyCallable_Check(result.ptr())) {
+      auto deferred = py::reinterpret_borrow<py::function>(result);
+      return [deferred] { return deferred().cast<double>(); };
+    }
+    double score = result.cast<double>();
+    return [score] { return score; };
+  };
+}
+
+/// Holder deleter that stops the engine with the GIL released, so a tick
+/// waiting for the GIL in a Python measurement can finish
+struct ControlEngineDeleter {
+  void operator()(duvc::ControlEngine *engine) const {
+    py::gil_scoped_release release;
+    delete engine;
+  }
+};
+
 /// Declare Camera as opaque to prevent pybind11 from generating copy
 /// constructors Camera is move-only (non-copyable) due to RAII DirectShow
 /// handle management Opaque binding allows shared_ptr<Camera> to be passed
 /// to/from Python correctly
 PYBIND11_MAKE_OPAQUE(Camera);
 
+// =============================================================================
+// Capability Helpers
+// =============================================================================
+
+/// Bind a PropertySet as an immutable, iterable set of property enums
+template <typename Prop>
+static void bind_property_set(py::module_ &m, const char *name,
+                              const char *doc) {
+  using Set = duvc::PropertySet<Prop>;
+  py::class_<Set>(m, name, py::module_local(), doc)
+      .def(py::init<>(), "Construct empty set")
+      .def(py::init([](const std::vector<Prop> &props) {
+             Set set;
+             for (auto prop : props) {
+               set.insert(prop);
+             }
+             return set;
+           }),
+           py::arg("props"), "Construct from a list of properties")
+      .def_property_readonly("bits", &Set::bits, "Raw 64-bit support mask")
+      .def(
+          "__iter__",
+          [](const Set &set) {
+            return py::make_iterator(set.begin(), set.end());
+          },
+          py::keep_alive<0, 1>())
+      .def("__len__", &Set::size)
+      .def("__bool__", [](const Set &set) { return !set.empty(); })
+      .def("__contains__", &Set::contains, py::arg("prop"))
+      .def(py::self == py::self)
+      .def(py::self != py::self)
+      .def(py::self | py::self)
+      .def(py::self & py::self)
+      .def(py::self ^ py::self)
+      .def(py::self - py::self)
+      .def("__hash__", [](const Set &set) { return set.bits(); })
+      .def("__repr__", [name](const Set &set) {
+        std::string text = std::string(name) + "{";
+        bool first = true;
+        for (auto prop : set) {
+          text += (first ? "" : ", ") + std::string(duvc::to_string(prop));
+          first = false;
+        }
+        return text + "}";
+      });
+}
+
+// =============================================================================
+// CameraController Fast Path
+// =============================================================================
+
+/// Property as named by CameraController
+struct ControllerProperty {
+  const char *name;
+  bool video;   ///< VidProp (else CamProp)
+  int prop;     ///< Enum value
+  bool boolean; ///< get() by name returns bool
+  bool by_name; ///< Accepted by get()/set() by name (relative moves are not)
+};
+
+#define DUVC_VID(name, prop, boolean)                                          \
+  { name, true, static_cast<int>(VidProp::prop), boolean, true }
+#define DUVC_CAM(name, prop, boolean, by_name)                                 \
+  { name, false, static_cast<int>(CamProp::prop), boolean, by_name }
+
+/// Names in CameraController's table order (its "Available:" list); the
+/// first row of each enum gives the name used in messages
+static const ControllerProperty kControllerProperties[] = {
+    DUVC_VID("brightness", Brightness, false),
+    DUVC_VID("contrast", Contrast, false),
+    DUVC_VID("hue", Hue, false),
+    DUVC_VID("saturation", Saturation, false),
+    DUVC_VID("sharpness", Sharpness, false),
+    DUVC_VID("gamma", Gamma, false),
+    DUVC_VID("color_enable", ColorEnable, true),
+    DUVC_VID("white_balance", WhiteBalance, false),
+    DUVC_VID("video_backlight_compensation", BacklightCompensation, false),
+    DUVC_VID("gain", Gain, false),
+    DUVC_VID("digital_multiplier", DigitalMultiplier, false),
+    DUVC_VID("digital_multiplier_limit", DigitalMultiplierLimit, false),
+    DUVC_VID("white_balance_component", WhiteBalanceComponent, false),
+    DUVC_VID("power_line_frequency", PowerLineFrequency, false),
+    DUVC_VID("wb", WhiteBalance, false),
+    DUVC_VID("color", ColorEnable, true),
+    DUVC_VID("sat", Saturation, false),
+    DUVC_VID("bright", Brightness, false),
+    DUVC_CAM("pan", Pan, false, true),
+    DUVC_CAM("tilt", Tilt, false, true),
+    DUVC_CAM("roll", Roll, false, true),
+    DUVC_CAM("zoom", Zoom, false, true),
+    DUVC_CAM("exposure", Exposure, false, true),
+    DUVC_CAM("iris", Iris, false, true),
+    DUVC_CAM("focus", Focus, false, true),
+    DUVC_CAM("scan_mode", ScanMode, false, true),
+    DUVC_CAM("privacy", Privacy, true, true),
+    DUVC_CAM("digital_zoom", DigitalZoom, false, true),
+    DUVC_CAM("backlight_compensation", BacklightCompensation, false, true),
+    DUVC_CAM("z", Zoom, false, true),
+    DUVC_CAM("f", Focus, false, true),
+    DUVC_CAM("exp", Exposure, false, true),
+    DUVC_CAM("horizontal", Pan, false, true),
+    DUVC_CAM("vertical", Tilt, false, true),
+    DUVC_CAM("pan_relative", PanRelative, false, false),
+    DUVC_CAM("tilt_relative", TiltRelative, false, false),
+    DUVC_CAM("roll_relative", RollRelative, false, false),
+    DUVC_CAM("zoom_relative", ZoomRelative, false, false),
+    DUVC_CAM("exposure_relative", ExposureRelative, false, false),
+    DUVC_CAM("iris_relative", IrisRelative, false, false),
+    DUVC_CAM("focus_relative", FocusRelative, false, false),
+    DUVC_CAM("pan_tilt", PanTilt, false, false),
+    DUVC_CAM("pan_tilt_relative", PanTiltRelative, false, false),
+    DUVC_CAM("digital_zoom_relative", DigitalZoomRelative, false, false),
+};
+
+#undef DUVC_VID
+#undef DUVC_CAM
+
+/// Lookup tables built once from kControllerProperties
+struct ControllerNames {
+  std::unordered_map<std::string, const ControllerProperty *> by_name;
+  std::unordered_map<int, const ControllerProperty *> by_enum; ///< enum_key()
+  std::string available; ///< Names accepted by get()/set(), comma separated
+
+  static int enum_key(bool video, int prop) { return (video ? 0x100 : 0) | prop; }
+
+  static const ControllerNames &instance() {
+    static const ControllerNames names;
+    return names;
+  }
+
+private:
+  ControllerNames() {
+    for (const auto &entry : kControllerProperties) {
+      by_enum.emplace(enum_key(entry.video, entry.prop), &entry);
+      if (entry.by_name) {
+        by_name.emplace(entry.name, &entry);
+        available += (available.empty() ? "" : ", ") + std::string(entry.name);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Native hot paths of CameraController
+ *
+ * Resolves names through precomputed tables, caches device ranges for
+ * validation and raises the duvc_ctl exception types itself, so a property
+ * access is one call into the extension. Device I/O runs without the GIL.
+ */
+class ControllerCore {
+public:
+  explicit ControllerCore(std::shared_ptr<Camera> camera)
+      : camera_(std::move(camera)) {
+    if (!camera_) {
+      throw py::value_error("camera cannot be None");
+    }
+    try {
+      py::module_ errors = py::module_::import("duvc_ctl.exceptions");
+      not_supported_ = errors.attr("PropertyNotSupportedError");
+      invalid_value_ = errors.attr("InvalidValueError");
+    } catch (const py::error_already_set &) {
+      // Used without the package: fall back to builtin exception types
+      not_supported_ = py::reinterpret_borrow<py::object>(PyExc_RuntimeError);
+      invalid_value_ = py::reinterpret_borrow<py::object>(PyExc_ValueError);
+    }
+  }
+
+  /// Read a property; by name, boolean properties read as bool
+  py::object get(py::handle prop) {
+    Target target = resolve(prop);
+    Result<PropSetting> result = read(target);
+    if (!result.is_ok()) {
+      raise(not_supported_, "Cannot get " + target.name + ": " +
+                                result.error().description());
+    }
+    int value = result.value().value;
+    if (target.by_name && target.boolean) {
+      return py::bool_(value != 0);
+    }
+    return py::int_(value);
+  }
+
+  /// Write a property like CameraController.set(): "auto" selects auto mode
+  void set(py::handle prop, py::handle value, const std::string &mode) {
+    if (py::isinstance<py::str>(value) && lower(value.cast<std::string>()) == "auto") {
+      Target target = resolve(prop);
+      Result<void> result = write(target, PropSetting(0, CamMode::Auto));
+      if (!result.is_ok()) {
+        raise(not_supported_, "Cannot set " + target.name + " to auto: " +
+                                  result.error().description());
+      }
+      return;
+    }
+    CamMode parsed = parse_mode(mode, prop);
+    Target target = resolve(prop);
+    store(target, PropSetting(to_int(value), parsed));
+  }
+
+  /// Write a manual value after checking it against the cached device range
+  void set_in_range(py::handle prop, py::handle value) {
+    Target target = resolve(prop);
+    int v = to_int(value);
+    Bounds bounds = range_of(target);
+    if (bounds.known) {
+      if (v < bounds.min) {
+        raise(invalid_value_, target.name + " must be >= " +
+                                  std::to_string(bounds.min) + ", got " +
+                                  std::to_string(v));
+      }
+      if (v > bounds.max) {
+        raise(invalid_value_, target.name + " must be <= " +
+                                  std::to_string(bounds.max) + ", got " +
+                                  std::to_string(v));
+      }
+    }
+    store(target, PropSetting(v, CamMode::Manual));
+  }
+
+  /// Move a property by delta, clamped to its range (see Camera::nudge)
+  void nudge(py::handle prop, py::handle delta) {
+    Target target = resolve(prop);
+    int d = to_int(delta);
+    Result<void> result = [&] {
+      py::gil_scoped_release release;
+      return target.video ? camera_->nudge(static_cast<VidProp>(target.prop), d)
+                          : camera_->nudge(static_cast<CamProp>(target.prop), d);
+    }();
+    if (!result.is_ok()) {
+      raise(not_supported_, "Cannot move " + target.name + ": " +
+                                result.error().description());
+    }
+  }
+
+  /// Cached (min, max) of a property, or (None, None) if unusable
+  py::tuple range_bounds(py::handle prop) {
+    Bounds bounds = range_of(resolve(prop));
+    if (!bounds.known) {
+      return py::make_tuple(py::none(), py::none());
+    }
+    return py::make_tuple(bounds.min, bounds.max);
+  }
+
+  /// Forget cached ranges (e.g. after the device changed mode)
+  void clear_ranges() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bounds_.clear();
+  }
+
+  /// Write several properties; returns ({name: ok}, [(name, error)])
+  py::tuple set_many(const py::dict &values) {
+    py::dict results;
+    py::list failures;
+    for (auto item : values) {
+      try {
+        set(item.first, item.second, "manual");
+        results[item.first] = true;
+      } catch (const py::error_already_set &e) {
+        results[item.first] = false;
+        failures.append(py::make_tuple(item.first, py::str(e.value())));
+      } catch (const std::exception &e) {
+        results[item.first] = false;
+        failures.append(py::make_tuple(item.first, e.what()));
+      }
+    }
+    return py::make_tuple(results, failures);
+  }
+
+  /// Read several properties; unreadable ones are omitted
+  py::dict get_many(const py::iterable &names) {
+    py::dict results;
+    for (auto name : names) {
+      try {
+        results[name] = get(name);
+      } catch (const py::error_already_set &) {
+      } catch (const std::exception &) {
+        // Unsupported or unknown: skipped, as in CameraController
+      }
+    }
+    return results;
+  }
+
+  const std::shared_ptr<Camera> &camera() const { return camera_; }
+
+private:
+  struct Target {
+    bool video;
+    int prop;
+    bool boolean;
+    bool by_name; ///< Addressed by name (not enum)
+    std::string name; ///< For messages: the name given, else the table's
+  };
+
+  struct Bounds {
+    bool known = false;
+    int min = 0;
+    int max = 0;
+  };
+
+  static std::string lower(std::string text) {
+    for (char &c : text) {
+      c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return text;
+  }
+
+  [[noreturn]] static void raise(const py::object &type, const std::string &message) {
+    py::object error = type(message);
+    PyErr_SetObject(type.ptr(), error.ptr());
+    throw py::error_already_set();
+  }
+
+  static int to_int(py::handle value) {
+    return py::int_(py::reinterpret_borrow<py::object>(value)).cast<int>();
+  }
+
+  static std::string display_name(py::handle prop) {
+    return py::isinstance<py::str>(prop) ? prop.cast<std::string>()
+                                         : py::str(prop).cast<std::string>();
+  }
+
+  static CamMode parse_mode(const std::string &mode, py::handle prop) {
+    std::string key = lower(mode);
+    const char *space = " \t\r\n\f\v";
+    size_t first = key.find_first_not_of(space);
+    key = first == std::string::npos
+              ? std::string()
+              : key.substr(first, key.find_last_not_of(space) - first + 1);
+    if (key == "manual" || key == "m") {
+      return CamMode::Manual;
+    }
+    if (key == "auto" || key == "automatic" || key == "a") {
+      return CamMode::Auto;
+    }
+    throw py::value_error("Invalid mode '" + mode + "' for " + display_name(prop) +
+                          ". Available modes: manual, auto, automatic, m, a");
+  }
+
+  static Target resolve(py::handle prop) {
+    const auto &names = ControllerNames::instance();
+    if (py::isinstance<py::str>(prop)) {
+      std::string name = prop.cast<std::string>();
+      auto it = names.by_name.find(name);
+      if (it == names.by_name.end()) {
+        throw py::value_error("Unknown property '" + name +
+                              "'. Available: " + names.available);
+      }
+      return {it->second->video, it->second->prop, it->second->boolean, true,
+              std::move(name)};
+    }
+    bool video = py::isinstance<VidProp>(prop);
+    if (!video && !py::isinstance<CamProp>(prop)) {
+      throw py::type_error("Property must be a name, CamProp or VidProp");
+    }
+    int id = video ? static_cast<int>(prop.cast<VidProp>())
+                   : static_cast<int>(prop.cast<CamProp>());
+    auto it = names.by_enum.find(ControllerNames::enum_key(video, id));
+    if (it == names.by_enum.end()) {
+      std::string name = lower(video ? to_string(static_cast<VidProp>(id))
+                                     : to_string(static_cast<CamProp>(id)));
+      return {video, id, false, false, std::move(name)};
+    }
+    return {video, id, it->second->boolean, false, it->second->name};
+  }
+
+  Result<PropSetting> read(const Target &target) {
+    py::gil_scoped_release release;
+    return target.video ? camera_->get(static_cast<VidProp>(target.prop))
+                        : camera_->get(static_cast<CamProp>(target.prop));
+  }
+
+  Result<void> write(const Target &target, const PropSetting &setting) {
+    py::gil_scoped_release release;
+    return target.video
+               ? camera_->set(static_cast<VidProp>(target.prop), setting)
+               : camera_->set(static_cast<CamProp>(target.prop), setting);
+  }
+
+  void store(const Target &target, const PropSetting &setting) {
+    Result<void> result = write(target, setting);
+    if (!result.is_ok()) {
+      raise(not_supported_, "Cannot set " + target.name + ": " +
+                                result.error().description());
+    }
+  }
+
+  /// Device range, queried until the device answers; unusable ranges skip
+  /// validation. Failed queries are not cached, so a transient error does
+  /// not disable validation for the controller's lifetime.
+  Bounds range_of(const Target &target) {
+    int key = ControllerNames::enum_key(target.video, target.prop);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = bounds_.find(key);
+      if (it != bounds_.end()) {
+        return it->second;
+      }
+    }
+    Result<PropRange> range = [&] {
+      py::gil_scoped_release release;
+      return target.video
+                 ? camera_->get_range(static_cast<VidProp>(target.prop))
+                 : camera_->get_range(static_cast<CamProp>(target.prop));
+    }();
+    Bounds bounds;
+    if (!range.is_ok()) {
+      return bounds;
+    }
+    const PropRange &r = range.value();
+    if (r.min <= r.max && r.max > 0) {
+      bounds = {true, r.min, r.max};
+    } else {
+      log_warning("Invalid range for '" + target.name +
+                  "' from device: min=" + std::to_string(r.min) +
+                  ", max=" + std::to_string(r.max) + ". Skipping validation.");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    bounds_.emplace(key, bounds);
+    return bounds;
+  }
+
+  std::shared_ptr<Camera> camera_;
+  py::object not_supported_;
+  py::object invalid_value_;
+  std::mutex mutex_; ///< Guards bounds_
+  std::unordered_map<int, Bounds> bounds_;
+};
+
 // =============================================================================
 // Abstract Interface Trampoline Classes
 // =============================================================================
@@ -459,7 +1178,9 @@ static GUID guid_from_pyobj(py::handle obj) {
 // Main Python Module Definition
 // =============================================================================
 
-PYBIND11_MODULE(_duvc_ctl, m) {
+// Safe without the GIL: callback state lives in ModuleState, handles lock
+// internally and blocking calls detach from the interpreter
+PYBIND11_MODULE(_duvc_ctl, m, py::mod_gil_not_used()) {
   m.doc() = R"pbdoc(
 duvc-ctl C++ bindings for Python
 
@@ -479,8 +1200,23 @@ Core features:
 For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based API.
   )pbdoc";
 
+#ifdef _WIN32
   // Register the cleanup function to ensure it's called at Python exit for ksproperties
   register_cleanup();
+#endif
+
+  // Callback state of this module instance; the capsule keeps it alive as
+  // long as the module, native callbacks hold their own references
+  auto state = std::make_shared<ModuleState>();
+  m.attr("_module_state") =
+      py::capsule(new ModuleStatePtr(state), [](void *ptr) {
+        std::unique_ptr<ModuleStatePtr> owned(static_cast<ModuleStatePtr *>(ptr));
+        (*owned)->set_target(&ModuleState::log_target, nullptr);
+        callback_cleanup(**owned);
+        // Dispatcher threads may be waiting to enter Python while they join
+        py::gil_scoped_release release;
+        owned.reset();
+      });
 
   // =========================================================================
   // Core Enums (All Values Must Be Exposed)
@@ -672,16 +1408,24 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
       .def(
           "get_id", [](const Device &d) { return wstring_to_utf8(d.get_id()); },
           "Get stable identifier for this device")
+      .def_property_readonly(
+          "identity",
+          [](const Device &d) { return parse_device_identity(d.path); },
+          "Identity fields parsed from the path")
 
-      // Equality and hashing support for Python collections
+      // Equality and hashing support for Python collections: devices compare
+      // by identity key across path forms. The key hash is computed in place,
+      // and keys are only built when two different paths' hashes collide.
       .def("__eq__",
            [](const Device &a, const Device &b) {
-             return a.path == b.path; // Compare by unique path
+             return same_identity(a, b);
            })
       .def("__ne__",
-           [](const Device &a, const Device &b) { return a.path != b.path; })
+           [](const Device &a, const Device &b) {
+             return !same_identity(a, b);
+           })
       .def("__hash__",
-           [](const Device &d) { return std::hash<std::wstring>{}(d.path); })
+           [](const Device &d) { return device_key_hash(d.path); })
       .def("__copy__",
            [](const Device &self) {
              return Device(self); // Call copy constructor
@@ -701,6 +1445,113 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
                wstring_to_utf8(d.path) + "'>";
       });
 
+  py::class_<DeviceIdentity>(m, "DeviceIdentity", py::module_local(),
+                             "Identity fields parsed from a device path")
+      .def_property_readonly(
+          "bus", [](const DeviceIdentity &i) { return wstring_to_utf8(i.bus); },
+          "Bus enumerator, lower case")
+      .def_readonly("vid", &DeviceIdentity::vid, "USB vendor ID (None if absent)")
+      .def_readonly("pid", &DeviceIdentity::pid, "USB product ID (None if absent)")
+      .def_readonly("interface_number", &DeviceIdentity::interface_number,
+                    "Composite interface number (None if absent)")
+      .def_property_readonly("hardware_id",
+                             [](const DeviceIdentity &i) {
+                               return wstring_to_utf8(i.hardware_id);
+                             })
+      .def_property_readonly("instance",
+                             [](const DeviceIdentity &i) {
+                               return wstring_to_utf8(i.instance);
+                             })
+      .def_property_readonly("interface_guid",
+                             [](const DeviceIdentity &i) {
+                               return wstring_to_utf8(i.interface_guid);
+                             })
+      .def_property_readonly(
+          "key", [](const DeviceIdentity &i) { return wstring_to_utf8(i.key); },
+          "Case-folded key shared by every path form of the device")
+      .def_readonly("key_hash", &DeviceIdentity::key_hash)
+      .def_property_readonly(
+          "serial",
+          [](const DeviceIdentity &i) -> std::optional<std::string> {
+            if (!i.has_serial()) {
+              return std::nullopt;
+            }
+            return wstring_to_utf8(i.serial());
+          },
+          "Serial number (None if the path has none)")
+      .def("__repr__", [](const DeviceIdentity &i) {
+        std::ostringstream oss;
+        oss << "<DeviceIdentity bus='" << wstring_to_utf8(i.bus) << "'";
+        if (i.vid && i.pid) {
+          oss << " vid=0x" << std::hex << std::setw(4) << std::setfill('0')
+              << *i.vid << " pid=0x" << std::setw(4) << *i.pid << std::dec;
+        }
+        if (i.interface_number) {
+          oss << " mi=" << static_cast<int>(*i.interface_number);
+        }
+        if (i.has_serial()) {
+          oss << " serial='" << wstring_to_utf8(i.serial()) << "'";
+        }
+        oss << ">";
+        return oss.str();
+      });
+
+  m.def(
+      "parse_device_identity",
+      [](const std::string &path) {
+        return parse_device_identity(utf8_to_wstring(path));
+      },
+      py::arg("path"), "Parse identity fields from a device path");
+  m.def(
+      "same_device_path",
+      [](const std::string &a, const std::string &b) {
+        return same_device_path(utf8_to_wstring(a), utf8_to_wstring(b));
+      },
+      py::arg("a"), py::arg("b"),
+      "Check whether two paths name the same device instance");
+
+  auto entry_devices = [](const std::vector<const DeviceIndex::Entry *> &found) {
+    std::vector<Device> devices;
+    devices.reserve(found.size());
+    for (const auto *entry : found) {
+      devices.push_back(entry->device);
+    }
+    return devices;
+  };
+  py::class_<DeviceIndex>(m, "DeviceIndex", py::module_local(),
+                          "Devices indexed by path, serial, VID:PID and name")
+      .def(py::init<std::vector<Device>>(), py::arg("devices"))
+      .def(
+          "find_by_path",
+          [](const DeviceIndex &self,
+             const std::string &path) -> std::optional<Device> {
+            const auto *entry = self.find_by_path(utf8_to_wstring(path));
+            return entry ? std::optional<Device>(entry->device) : std::nullopt;
+          },
+          py::arg("path"), "Find device by path or instance ID")
+      .def(
+          "find_by_serial",
+          [](const DeviceIndex &self,
+             const std::string &serial) -> std::optional<Device> {
+            const auto *entry = self.find_by_serial(utf8_to_wstring(serial));
+            return entry ? std::optional<Device>(entry->device) : std::nullopt;
+          },
+          py::arg("serial"), "Find device by serial number")
+      .def(
+          "find_by_usb_id",
+          [entry_devices](const DeviceIndex &self, uint16_t vid, uint16_t pid) {
+            return entry_devices(self.find_by_usb_id(vid, pid));
+          },
+          py::arg("vid"), py::arg("pid"),
+          "Find devices by USB vendor and product ID")
+      .def(
+          "find_by_name",
+          [entry_devices](const DeviceIndex &self, const std::string &name) {
+            return entry_devices(self.find_by_name(utf8_to_wstring(name)));
+          },
+          py::arg("name"), "Find devices by exact name (case-insensitive)")
+      .def("__len__", &DeviceIndex::size);
+
   /// @brief Property setting with value and control mode
   ///
   /// Represents the value and control mode for a camera or video property.
@@ -795,6 +1646,8 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
                      "Valid range for property")
       .def_readwrite("current", &PropertyCapability::current,
                      "Current property value")
+      .def_readwrite("current_valid", &PropertyCapability::current_valid,
+                     "Current value was read successfully")
       .def("supports_auto", &PropertyCapability::supports_auto,
            "Check if property supports automatic mode")
       .def("__repr__", [](const PropertyCapability &c) {
@@ -802,6 +1655,61 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
                ">";
       });
 
+  /// @brief Property selection for reset_to_defaults()
+  py::class_<ResetFilter>(m, "ResetFilter", py::module_local(),
+                          "Selects the properties reset_to_defaults() writes")
+      .def(py::init<>())
+      .def_readwrite("camera", &ResetFilter::camera,
+                     "Include camera properties")
+      .def_readwrite("video", &ResetFilter::video, "Include video properties")
+      .def_readwrite("camera_props", &ResetFilter::camera_props,
+                     "Only these camera properties (empty = all)")
+      .def_readwrite("video_props", &ResetFilter::video_props,
+                     "Only these video properties (empty = all)")
+      .def_readwrite("include_relative", &ResetFilter::include_relative,
+                     "Also write relative controls (skipped by default)");
+
+  py::enum_<ResetOutcome>(m, "ResetOutcome", py::module_local(),
+                          "What reset_to_defaults() did with one property")
+      .value("Written", ResetOutcome::Written, "Default written")
+      .value("Skipped", ResetOutcome::Skipped, "Already at its default")
+      .value("Failed", ResetOutcome::Failed, "Write returned an error");
+
+  py::class_<ResetEntry>(m, "ResetEntry", py::module_local(),
+                         "Per-property reset result")
+      .def_readonly("video", &ResetEntry::video,
+                    "Video (True) or camera property")
+      .def_readonly("cam_prop", &ResetEntry::cam_prop)
+      .def_readonly("vid_prop", &ResetEntry::vid_prop)
+      .def_readonly("outcome", &ResetEntry::outcome)
+      .def_readonly("error", &ResetEntry::error,
+                    "Write error when outcome is Failed, else None")
+      .def_property_readonly("name",
+                             [](const ResetEntry &e) -> std::string {
+                               return e.video ? to_string(e.vid_prop)
+                                              : to_string(e.cam_prop);
+                             })
+      .def("__repr__", [](const ResetEntry &e) {
+        return std::string("<ResetEntry ") +
+               (e.video ? to_string(e.vid_prop) : to_string(e.cam_prop)) +
+               " " + to_string(e.outcome) + ">";
+      });
+
+  py::class_<ResetReport>(m, "ResetReport", py::module_local(),
+                          "Outcome of reset_to_defaults()")
+      .def_readonly("writes", &ResetReport::writes, "Properties written")
+      .def_readonly("skipped", &ResetReport::skipped,
+                    "Properties already at their defaults")
+      .def_readonly("failed", &ResetReport::failed,
+                    "Writes that returned an error")
+      .def_readonly("entries", &ResetReport::entries,
+                    "Writes in order, then skipped entries")
+      .def("__repr__", [](const ResetReport &r) {
+        return "<ResetReport writes=" + std::to_string(r.writes) +
+               " skipped=" + std::to_string(r.skipped) +
+               " failed=" + std::to_string(r.failed) + ">";
+      });
+
   /// @brief Error context with code and description
   ///
   /// Low-level error context from Result<T>.error().
@@ -1170,6 +2078,482 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
            &IDeviceConnection::get_video_property_range, py::arg("prop"),
            "Get video property range");
 
+  /// @brief Retry and circuit breaker policy types
+  ///
+  /// Durations are exposed as integer milliseconds. A policy belongs to the
+  /// device, so Camera.policy changes apply to every handle on that device.
+  py::enum_<CircuitState>(m, "CircuitState", py::module_local(),
+                          "Circuit breaker state")
+      .value("Closed", CircuitState::Closed, "Normal operation")
+      .value("Open", CircuitState::Open,
+             "Failing fast after repeated device failures")
+      .value("HalfOpen", CircuitState::HalfOpen, "Letting probe calls through");
+
+  py::class_<RetryPolicy>(m, "RetryPolicy", py::module_local(),
+                          "Retry behaviour for transient errors")
+      .def(py::init<>())
+      .def_readwrite("max_attempts", &RetryPolicy::max_attempts,
+                     "Total attempts including the first (1 = no retry)")
+      .def_property(
+          "initial_backoff_ms",
+          [](const RetryPolicy &r) { return r.initial_backoff.count(); },
+          [](RetryPolicy &r, long long ms) {
+            r.initial_backoff = std::chrono::milliseconds(ms);
+          },
+          "Delay before the first retry in milliseconds")
+      .def_property(
+          "max_backoff_ms",
+          [](const RetryPolicy &r) { return r.max_backoff.count(); },
+          [](RetryPolicy &r, long long ms) {
+            r.max_backoff = std::chrono::milliseconds(ms);
+          },
+          "Upper bound for retry delays in milliseconds")
+      .def_readwrite("multiplier", &RetryPolicy::multiplier,
+                     "Backoff growth factor per retry")
+      .def_readwrite("jitter", &RetryPolicy::jitter,
+                     "Randomized fraction of each delay [0, 1]");
+
+  py::class_<CircuitBreakerConfig>(m, "CircuitBreakerConfig",
+                                   py::module_local(),
+                                   "Circuit breaker thresholds")
+      .def(py::init<>())
+      .def_readwrite("failure_threshold",
+                     &CircuitBreakerConfig::failure_threshold,
+                     "Consecutive device failures before opening")
+      .def_property(
+          "open_duration_ms",
+          [](const CircuitBreakerConfig &c) { return c.open_duration.count(); },
+          [](CircuitBreakerConfig &c, long long ms) {
+            c.open_duration = std::chrono::milliseconds(ms);
+          },
+          "Fail-fast period in milliseconds")
+      .def_readwrite("half_open_probes",
+                     &CircuitBreakerConfig::half_open_probes,
+                     "Concurrent probe calls allowed when half-open");
+
+  py::class_<DevicePolicy>(m, "DevicePolicy", py::module_local(),
+                           "Retry and circuit breaker policy for a device")
+      .def(py::init<>())
+      .def_readwrite("enabled", &DevicePolicy::enabled,
+                     "False bypasses retries and the breaker")
+      .def_readwrite("retry", &DevicePolicy::retry, "Retry settings")
+      .def_readwrite("breaker", &DevicePolicy::breaker,
+                     "Circuit breaker settings");
+
+  py::class_<PolicyStats>(m, "PolicyStats", py::module_local(),
+                          "Retry and circuit breaker counters")
+      .def_readonly("attempts", &PolicyStats::attempts)
+      .def_readonly("successes", &PolicyStats::successes)
+      .def_readonly("failures", &PolicyStats::failures)
+      .def_readonly("retries", &PolicyStats::retries)
+      .def_readonly("short_circuited", &PolicyStats::short_circuited)
+      .def_readonly("trips", &PolicyStats::trips)
+      .def_readonly("consecutive_failures", &PolicyStats::consecutive_failures)
+      .def_readonly("state", &PolicyStats::state)
+      .def("__repr__", [](const PolicyStats &s) {
+        return std::string("<PolicyStats state=") + to_string(s.state) +
+               " attempts=" + std::to_string(s.attempts) +
+               " retries=" + std::to_string(s.retries) +
+               " failures=" + std::to_string(s.failures) +
+               " short_circuited=" + std::to_string(s.short_circuited) + ">";
+      });
+
+  m.def("get_default_device_policy", &default_device_policy,
+        "Get the policy applied to newly opened cameras");
+  m.def("set_default_device_policy", &set_default_device_policy,
+        py::arg("policy"), "Set the policy applied to newly opened cameras");
+
+  /// @brief Closed-loop property controllers
+  ///
+  /// Loops run on a native thread; the measurement callable is invoked there
+  /// with the GIL held once per period.
+  py::enum_<ControlMode>(m, "ControlMode", py::module_local(),
+                         "Control law applied by a loop")
+      .value("Pid", ControlMode::Pid,
+             "Positional PID around the value read when the loop started")
+      .value("StepLimited", ControlMode::StepLimited,
+             "Incremental proportional moves of at most max_step per tick");
+
+  py::class_<PidGains>(m, "PidGains", py::module_local(),
+                       "PID gains in device units per metric unit")
+      .def(py::init<>())
+      .def(py::init([](double kp, double ki, double kd) {
+             PidGains g;
+             g.kp = kp;
+             g.ki = ki;
+             g.kd = kd;
+             return g;
+           }),
+           py::arg("kp"), py::arg("ki") = 0.0, py::arg("kd") = 0.0)
+      .def_readwrite("kp", &PidGains::kp, "Proportional gain")
+      .def_readwrite("ki", &PidGains::ki, "Integral gain (per second)")
+      .def_readwrite("kd", &PidGains::kd, "Derivative gain (seconds)");
+
+  py::class_<ControlLoopConfig>(m, "ControlLoopConfig", py::module_local(),
+                                "Control loop configuration")
+      .def(py::init<>())
+      .def_readwrite("mode", &ControlLoopConfig::mode, "Control law")
+      .def_readwrite("setpoint", &ControlLoopConfig::setpoint,
+                     "Target metric value")
+      .def_readwrite("gains", &ControlLoopConfig::gains,
+                     "Gains (StepLimited uses kp only)")
+      .def_readwrite("deadband", &ControlLoopConfig::deadband,
+                     "|error| at or below which the output is held")
+      .def_readwrite("max_step", &ControlLoopConfig::max_step,
+                     "Largest change per tick in device units (0 = no limit)")
+      .def_property(
+          "period_ms",
+          [](const ControlLoopConfig &c) { return c.period.count(); },
+          [](ControlLoopConfig &c, long long ms) {
+            c.period = std::chrono::milliseconds(ms);
+          },
+          "Loop period in milliseconds");
+
+  py::class_<ControlLoopStats>(m, "ControlLoopStats", py::module_local(),
+                               "Control loop counters and timing")
+      .def_readonly("ticks", &ControlLoopStats::ticks)
+      .def_readonly("missed_measurements",
+                    &ControlLoopStats::missed_measurements)
+      .def_readonly("writes", &ControlLoopStats::writes)
+      .def_readonly("coalesced", &ControlLoopStats::coalesced)
+      .def_readonly("write_failures", &ControlLoopStats::write_failures)
+      .def_readonly("overruns", &ControlLoopStats::overruns)
+      .def_readonly("last_measurement", &ControlLoopStats::last_measurement)
+      .def_readonly("last_error", &ControlLoopStats::last_error)
+      .def_readonly("last_output", &ControlLoopStats::last_output)
+      .def_property_readonly("latency_avg_us",
+                             [](const ControlLoopStats &s) {
+                               return s.latency_avg.count();
+                             })
+      .def_property_readonly("latency_max_us",
+                             [](const ControlLoopStats &s) {
+                               return s.latency_max.count();
+                             })
+      .def_property_readonly("jitter_avg_us",
+                             [](const ControlLoopStats &s) {
+                               return s.jitter_avg.count();
+                             })
+      .def_property_readonly("jitter_max_us",
+                             [](const ControlLoopStats &s) {
+                               return s.jitter_max.count();
+                             })
+      .def_readonly("last_failure", &ControlLoopStats::last_failure)
+      .def("__repr__", [](const ControlLoopStats &s) {
+        return "<ControlLoopStats ticks=" + std::to_string(s.ticks) +
+               " writes=" + std::to_string(s.writes) +
+               " last_error=" + std::to_string(s.last_error) +
+               " latency_avg_us=" + std::to_string(s.latency_avg.count()) +
+               " jitter_avg_us=" + std::to_string(s.jitter_avg.count()) + ">";
+      });
+
+  py::class_<ControlEngine, std::unique_ptr<ControlEngine, ControlEngineDeleter>>(
+      m, "ControlEngine", py::module_local(),
+      "Runs closed-loop property controllers at a fixed rate")
+      .def(py::init<>())
+      .def(
+          "add_loop",
+          [](ControlEngine &self, std::shared_ptr<Camera> camera, CamProp prop,
+             py::function measure, const ControlLoopConfig &config) {
+            return unwrap_or_throw(self.add_loop(
+                shared_property_access(std::move(camera), prop),
+                python_measurement_feed(std::move(measure)), config));
+          },
+          py::arg("camera"), py::arg("prop"), py::arg("measure"),
+          py::arg("config"),
+          "Drive a camera property from measure() (float or None); returns "
+          "the loop id")
+      .def(
+          "add_loop",
+          [](ControlEngine &self, std::shared_ptr<Camera> camera, VidProp prop,
+             py::function measure, const ControlLoopConfig &config) {
+            return unwrap_or_throw(self.add_loop(
+                shared_property_access(std::move(camera), prop),
+                python_measurement_feed(std::move(measure)), config));
+          },
+          py::arg("camera"), py::arg("prop"), py::arg("measure"),
+          py::arg("config"),
+          "Drive a video property from measure() (float or None); returns "
+          "the loop id")
+      .def(
+          "remove_loop",
+          [](ControlEngine &self, ControlLoopId id) {
+            unwrap_void_or_throw(self.remove_loop(id));
+          },
+          py::arg("loop_id"), py::call_guard<py::gil_scoped_release>(),
+          "Unregister a loop (waits for a running tick)")
+      .def(
+          "set_setpoint",
+          [](ControlEngine &self, ControlLoopId id, double setpoint) {
+            unwrap_void_or_throw(self.set_setpoint(id, setpoint));
+          },
+          py::arg("loop_id"), py::arg("setpoint"), "Change a loop's setpoint")
+      .def(
+          "stats",
+          [](const ControlEngine &self, ControlLoopId id) {
+            return unwrap_or_throw(self.stats(id));
+          },
+          py::arg("loop_id"), "Get a loop's counters and timing")
+      .def_property_readonly("loop_count", &ControlEngine::loop_count,
+                             "Number of registered loops");
+
+  /// @brief Settle waits for motorized properties
+  py::enum_<SettleStatus>(m, "SettleStatus", py::module_local(),
+                          "How a settle wait ended")
+      .value("Converged", SettleStatus::Converged,
+             "Value reached the target within tolerance")
+      .value("Stalled", SettleStatus::Stalled,
+             "Value stopped changing outside the tolerance")
+      .value("TimedOut", SettleStatus::TimedOut,
+             "Deadline passed while the value was still changing");
+
+  py::class_<SettleResult>(m, "SettleResult", py::module_local(),
+                           "Outcome of a settle wait")
+      .def_readonly("status", &SettleResult::status)
+      .def_readonly("achieved", &SettleResult::achieved,
+                    "Last value read from the device")
+      .def_property_readonly(
+          "elapsed_ms", [](const SettleResult &r) { return r.elapsed.count(); })
+      .def_readonly("polls", &SettleResult::polls)
+      .def_property_readonly("converged", &SettleResult::converged)
+      .def("__repr__", [](const SettleResult &r) {
+        return std::string("<SettleResult status=") + to_string(r.status) +
+               " achieved=" + std::to_string(r.achieved.value) +
+               " elapsed_ms=" + std::to_string(r.elapsed.count()) + ">";
+      });
+
+  /// @brief Score-driven property search (autofocus, exposure)
+  ///
+  /// The score callable runs on the calling thread with the GIL held; device
+  /// moves overlapped with deferred scoring run on a native thread.
+  py::enum_<SearchMethod>(m, "SearchMethod", py::module_local(),
+                          "Search strategy")
+      .value("CoarseToFine", SearchMethod::CoarseToFine,
+             "Evenly spaced sweep, then repeated sweeps around the best")
+      .value("GoldenSection", SearchMethod::GoldenSection,
+             "Golden-section search (assumes a single peak)");
+
+  py::class_<SearchOptions>(m, "SearchOptions", py::module_local(),
+                            "Property search options")
+      .def(py::init<>())
+      .def_readwrite("method", &SearchOptions::method, "Search strategy")
+      .def_readwrite("maximize", &SearchOptions::maximize,
+                     "False searches for the lowest score")
+      .def_readwrite("lower", &SearchOptions::lower,
+                     "Lower bound (None = range minimum)")
+      .def_readwrite("upper", &SearchOptions::upper,
+                     "Upper bound (None = range maximum)")
+      .def_readwrite("points_per_pass", &SearchOptions::points_per_pass,
+                     "Samples per coarse-to-fine pass (>= 3)")
+      .def_readwrite("max_evaluations", &SearchOptions::max_evaluations,
+                     "Upper bound on scored positions")
+      .def_property(
+          "settle_ms",
+          [](const SearchOptions &o) { return o.settle.count(); },
+          [](SearchOptions &o, long long ms) {
+            o.settle = std::chrono::milliseconds(ms);
+          },
+          "Wait after each write before scoring, in milliseconds")
+      .def_readwrite("apply_best", &SearchOptions::apply_best,
+                     "Leave the property at the best value");
+
+  py::class_<SearchResult>(m, "SearchResult", py::module_local(),
+                           "Property search outcome and cost")
+      .def_readonly("best_value", &SearchResult::best_value)
+      .def_readonly("best_score", &SearchResult::best_score)
+      .def_readonly("evaluations", &SearchResult::evaluations)
+      .def_readonly("writes", &SearchResult::writes)
+      .def_property_readonly(
+          "elapsed_ms",
+          [](const SearchResult &r) { return r.elapsed.count(); })
+      .def_readonly("samples", &SearchResult::samples,
+                    "(value, score) pairs in evaluation order")
+      .def("__repr__", [](const SearchResult &r) {
+        return "<SearchResult best_value=" + std::to_string(r.best_value) +
+               " evaluations=" + std::to_string(r.evaluations) +
+               " writes=" + std::to_string(r.writes) +
+               " elapsed_ms=" + std::to_string(r.elapsed.count()) + ">";
+      });
+
+  m.def(
+      "search_property",
+      [](std::shared_ptr<Camera> camera, CamProp prop, py::function score,
+         const SearchOptions &options) {
+        return unwrap_or_throw(search_property(
+            shared_property_access(std::move(camera), prop),
+            python_search_probe(std::move(score)), options));
+      },
+      py::arg("camera"), py::arg("prop"), py::arg("score"),
+      py::arg("options") = SearchOptions{},
+      "Search a camera property for the best score(value)");
+  m.def(
+      "search_property",
+      [](std::shared_ptr<Camera> camera, VidProp prop, py::function score,
+         const SearchOptions &options) {
+        return unwrap_or_throw(search_property(
+            shared_property_access(std::move(camera), prop),
+            python_search_probe(std::move(score)), options));
+      },
+      py::arg("camera"), py::arg("prop"), py::arg("score"),
+      py::arg("options") = SearchOptions{},
+      "Search a video property for the best score(value)");
+
+  /// @brief Time-scheduled cue list playback
+  ///
+  /// prepare() and play() release the GIL; cues fire on native threads, so
+  /// timing does not depend on the interpreter.
+  py::enum_<CueDomain>(m, "CueDomain", py::module_local(),
+                       "What a cue writes")
+      .value("Camera", CueDomain::Camera, "Camera control property")
+      .value("Video", CueDomain::Video, "Video processing property")
+      .value("Preset", CueDomain::Preset, "Every value of a named preset");
+
+  py::class_<Cue>(m, "Cue", py::module_local(),
+                  "One timed property write or preset recall")
+      .def(py::init<>())
+      .def_property(
+          "time",
+          [](const Cue &c) { return c.at.count() / 1e6; },
+          [](Cue &c, double seconds) {
+            if (seconds < 0) {
+              throw std::invalid_argument("time must not be negative");
+            }
+            c.at = std::chrono::microseconds(
+                static_cast<long long>(std::llround(seconds * 1e6)));
+          },
+          "Offset from timeline start in seconds")
+      .def_property(
+          "device",
+          [](const Cue &c) { return wstring_to_utf8(c.device); },
+          [](Cue &c, const std::string &device) {
+            c.device = utf8_to_wstring(device);
+          },
+          "Device path or name (empty: use device_index)")
+      .def_readwrite("device_index", &Cue::device_index,
+                     "Index into the device list when device is empty")
+      .def_readwrite("domain", &Cue::domain)
+      .def_readwrite("cam_prop", &Cue::cam_prop,
+                     "Property when domain is Camera")
+      .def_readwrite("vid_prop", &Cue::vid_prop,
+                     "Property when domain is Video")
+      .def_readwrite("setting", &Cue::setting, "Value to write")
+      .def_readwrite("preset", &Cue::preset, "Preset name when domain is Preset");
+
+  py::class_<TimelineOptions>(m, "TimelineOptions", py::module_local(),
+                              "Timeline playback options")
+      .def(py::init<>())
+      .def_property(
+          "lead_ms",
+          [](const TimelineOptions &o) { return o.lead.count(); },
+          [](TimelineOptions &o, long long ms) {
+            o.lead = std::chrono::milliseconds(ms);
+          },
+          "How early each cue is handed to its device worker")
+      .def_property(
+          "spin_us",
+          [](const TimelineOptions &o) { return o.spin.count(); },
+          [](TimelineOptions &o, long long us) {
+            o.spin = std::chrono::microseconds(us);
+          },
+          "Busy-wait window before each cue fires")
+      .def_property(
+          "open_timeout_ms",
+          [](const TimelineOptions &o) { return o.open_timeout.count(); },
+          [](TimelineOptions &o, long long ms) {
+            o.open_timeout = std::chrono::milliseconds(ms);
+          },
+          "Deadline for opening each device in prepare()");
+
+  py::class_<CueReport>(m, "CueReport", py::module_local(),
+                        "Planned versus actual timing of one fired cue")
+      .def_readonly("index", &CueReport::index, "Position in the cue list")
+      .def_property_readonly(
+          "planned_us", [](const CueReport &r) { return r.planned.count(); })
+      .def_property_readonly(
+          "fired_us", [](const CueReport &r) { return r.fired.count(); })
+      .def_property_readonly(
+          "completed_us", [](const CueReport &r) { return r.completed.count(); })
+      .def_property_readonly(
+          "lateness_us", [](const CueReport &r) { return r.lateness().count(); })
+      .def_readonly("error", &CueReport::error)
+      .def("__repr__", [](const CueReport &r) {
+        return "<CueReport index=" + std::to_string(r.index) +
+               " planned_us=" + std::to_string(r.planned.count()) +
+               " lateness_us=" + std::to_string(r.lateness().count()) +
+               (r.error ? " error>" : ">");
+      });
+
+  py::class_<TimelineReport>(m, "TimelineReport", py::module_local(),
+                             "Outcome of a timeline run")
+      .def_readonly("cues", &TimelineReport::cues, "Fired cues in planned order")
+      .def_readonly("failures", &TimelineReport::failures)
+      .def_property_readonly(
+          "lateness_avg_us",
+          [](const TimelineReport &r) { return r.lateness_avg.count(); })
+      .def_property_readonly(
+          "lateness_max_us",
+          [](const TimelineReport &r) { return r.lateness_max.count(); })
+      .def_readonly("cancelled", &TimelineReport::cancelled)
+      .def("__repr__", [](const TimelineReport &r) {
+        return "<TimelineReport fired=" + std::to_string(r.cues.size()) +
+               " failures=" + std::to_string(r.failures) +
+               " lateness_max_us=" + std::to_string(r.lateness_max.count()) +
+               ">";
+      });
+
+  m.def(
+      "load_cue_file",
+      [](const std::string &path) {
+        return unwrap_or_throw(
+            load_cue_file(std::filesystem::path(utf8_to_wstring(path))));
+      },
+      py::arg("path"), "Load a JSON or binary cue file");
+  m.def(
+      "parse_cue_json",
+      [](const std::string &text) {
+        return unwrap_or_throw(parse_cue_json(text));
+      },
+      py::arg("text"), "Parse a JSON cue list");
+  m.def(
+      "serialize_cue_binary",
+      [](const std::vector<Cue> &cues) {
+        auto bytes = serialize_cue_binary(cues);
+        return py::bytes(reinterpret_cast<const char *>(bytes.data()),
+                         bytes.size());
+      },
+      py::arg("cues"), "Encode cues in the compact binary format");
+  m.def(
+      "parse_cue_binary",
+      [](const py::bytes &data) {
+        std::string raw = data;
+        return unwrap_or_throw(
+            parse_cue_binary(std::vector<uint8_t>(raw.begin(), raw.end())));
+      },
+      py::arg("data"), "Parse a compact binary cue list");
+
+  py::class_<TimelinePlayer>(m, "TimelinePlayer", py::module_local(),
+                             "Plays a cue list against a set of devices")
+      .def(py::init<std::vector<Cue>, TimelineOptions>(), py::arg("cues"),
+           py::arg("options") = TimelineOptions{})
+      .def(
+          "prepare",
+          [](TimelinePlayer &self, const std::vector<Device> &devices,
+             const std::vector<Preset> &presets) {
+            unwrap_void_or_throw(self.prepare(devices, nullptr, presets));
+          },
+          py::arg("devices"), py::arg("presets") = std::vector<Preset>{},
+          py::call_guard<py::gil_scoped_release>(),
+          "Resolve cues and open their devices ahead of playback; preset cues "
+          "name one of presets")
+      .def(
+          "play",
+          [](TimelinePlayer &self) { return unwrap_or_throw(self.play()); },
+          py::call_guard<py::gil_scoped_release>(),
+          "Run the timeline to completion and return the timing report")
+      .def("cancel", &TimelinePlayer::cancel,
+           "Stop a running play() from another thread")
+      .def_property_readonly("device_count", &TimelinePlayer::device_count)
+      .def_property_readonly("cues", &TimelinePlayer::cues);
+
   /// @brief RAII camera handle for device control
   ///
   /// Provides safe, convenient access to camera properties with automatic
@@ -1201,12 +2585,14 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
       .def(
           "is_valid",
           [](const std::shared_ptr<Camera> &self) {
+            py::gil_scoped_release release;
             return self->is_valid(); // Access via ->
           },
           "Check if camera is valid and connected")
       .def(
           "is_ok",
           [](const std::shared_ptr<Camera> &self) {
+            py::gil_scoped_release release;
             return self->is_valid(); // Alias for is_valid()
           },
           "Alias for is_valid() - check if camera is valid and connected")
@@ -1221,10 +2607,37 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
             return copy;
           },
           "Get the underlying device information")
+      .def_property(
+          "timeout_ms",
+          [](const std::shared_ptr<Camera> &self) {
+            return static_cast<long long>(self->timeout().count());
+          },
+          [](std::shared_ptr<Camera> &self, long long timeout_ms) {
+            if (timeout_ms < 0) {
+              throw py::value_error("timeout_ms must be >= 0");
+            }
+            self->set_timeout(std::chrono::milliseconds(timeout_ms));
+          },
+          "Per-operation deadline in milliseconds (0 waits indefinitely). "
+          "Operations that miss it return ErrorCode.DeviceBusy")
+      .def_property(
+          "policy",
+          [](const std::shared_ptr<Camera> &self) { return self->policy(); },
+          [](std::shared_ptr<Camera> &self, const DevicePolicy &policy) {
+            self->set_policy(policy);
+          },
+          "Retry and circuit breaker policy for the device")
+      .def(
+          "policy_stats",
+          [](const std::shared_ptr<Camera> &self) {
+            return self->policy_stats();
+          },
+          "Get retry and circuit breaker counters for the device")
       // Camera property operations
       .def(
           "get_camera_property",
           [](std::shared_ptr<Camera> &self, CamProp prop) {
+            py::gil_scoped_release release;
             return self->get(prop); // Call overload_cast<CamProp>
           },
           py::arg("prop"), "Get camera property value")
@@ -1232,6 +2645,7 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
           "set",
           [](std::shared_ptr<Camera> &self, CamProp prop,
              const PropSetting &setting) {
+            py::gil_scoped_release release;
             return self->set(
                 prop,
                 setting); // Call overload_cast<CamProp, const PropSetting&>
@@ -1240,6 +2654,7 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
       .def(
           "get_range",
           [](std::shared_ptr<Camera> &self, CamProp prop) {
+            py::gil_scoped_release release;
             return self->get_range(prop); // Call overload_cast<CamProp>
           },
           py::arg("prop"), "Get camera property range")
@@ -1249,6 +2664,7 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
           "set",
           [](std::shared_ptr<Camera> &self, CamProp prop,
              int value) -> Result<void> {
+            py::gil_scoped_release release;
             return self->set(prop, PropSetting(value, CamMode::Manual));
           },
           py::arg("prop"), py::arg("value"),
@@ -1258,6 +2674,7 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
           "set",
           [](std::shared_ptr<Camera> &self, VidProp prop,
              int value) -> Result<void> {
+            py::gil_scoped_release release;
             return self->set(prop, PropSetting(value, CamMode::Manual));
           },
           py::arg("prop"), py::arg("value"),
@@ -1272,6 +2689,7 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
                 (mode == "auto" || mode == "Auto" || mode == "a" || mode == "A")
                     ? CamMode::Auto
                     : CamMode::Manual;
+            py::gil_scoped_release release;
             return self->set(prop, PropSetting(value, cam_mode));
           },
           py::arg("prop"), py::arg("value"), py::arg("mode"),
@@ -1285,6 +2703,7 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
                 (mode == "auto" || mode == "Auto" || mode == "a" || mode == "A")
                     ? CamMode::Auto
                     : CamMode::Manual;
+            py::gil_scoped_release release;
             return self->set(prop, PropSetting(value, vid_mode));
           },
           py::arg("prop"), py::arg("value"), py::arg("mode"),
@@ -1294,6 +2713,7 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
       .def(
           "set_auto",
           [](std::shared_ptr<Camera> &self, CamProp prop) -> Result<void> {
+            py::gil_scoped_release release;
             return self->set(
                 prop, PropSetting(0, CamMode::Auto)); // Value ignored in auto
           },
@@ -1302,15 +2722,66 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
       .def(
           "set_auto",
           [](std::shared_ptr<Camera> &self, VidProp prop) -> Result<void> {
+            py::gil_scoped_release release;
             return self->set(
                 prop, PropSetting(0, CamMode::Auto)); // Value ignored in auto
           },
           py::arg("prop"), "Set video property to automatic mode")
 
+      // Relative moves
+      .def(
+          "nudge",
+          [](std::shared_ptr<Camera> &self, CamProp prop, int delta) {
+            py::gil_scoped_release release;
+            return self->nudge(prop, delta);
+          },
+          py::arg("prop"), py::arg("delta"),
+          "Move a camera property by delta, clamped to its range (through "
+          "its relative control when that control takes the step)")
+      .def(
+          "nudge",
+          [](std::shared_ptr<Camera> &self, VidProp prop, int delta) {
+            py::gil_scoped_release release;
+            return self->nudge(prop, delta);
+          },
+          py::arg("prop"), py::arg("delta"),
+          "Move a video property by delta, clamped to its range")
+
+      // Set and wait for motorized properties to arrive
+      .def(
+          "set_and_wait",
+          [](std::shared_ptr<Camera> &self, CamProp prop, int value,
+             int tolerance, long long deadline_ms) {
+            SettleOptions options;
+            options.tolerance = tolerance;
+            options.deadline = std::chrono::milliseconds(deadline_ms);
+            py::gil_scoped_release release;
+            return unwrap_or_throw(self->set_and_wait(
+                prop, PropSetting(value, CamMode::Manual), options));
+          },
+          py::arg("prop"), py::arg("value"), py::arg("tolerance") = 0,
+          py::arg("deadline_ms") = 3000,
+          "Set a camera property (manual) and wait until it settles")
+      .def(
+          "set_and_wait",
+          [](std::shared_ptr<Camera> &self, VidProp prop, int value,
+             int tolerance, long long deadline_ms) {
+            SettleOptions options;
+            options.tolerance = tolerance;
+            options.deadline = std::chrono::milliseconds(deadline_ms);
+            py::gil_scoped_release release;
+            return unwrap_or_throw(self->set_and_wait(
+                prop, PropSetting(value, CamMode::Manual), options));
+          },
+          py::arg("prop"), py::arg("value"), py::arg("tolerance") = 0,
+          py::arg("deadline_ms") = 3000,
+          "Set a video property (manual) and wait until it settles")
+
       // Video property operations
       .def(
           "get_video_property",
           [](std::shared_ptr<Camera> &self, VidProp prop) {
+            py::gil_scoped_release release;
             return self->get(prop); // Call overload_cast<VidProp>
           },
           py::arg("prop"), "Get video processing property value")
@@ -1318,6 +2789,7 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
           "set",
           [](std::shared_ptr<Camera> &self, VidProp prop,
              const PropSetting &setting) {
+            py::gil_scoped_release release;
             return self->set(
                 prop,
                 setting); // Call overload_cast<VidProp, const PropSetting&>
@@ -1327,6 +2799,7 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
       .def(
           "get_range",
           [](std::shared_ptr<Camera> &self, VidProp prop) {
+            py::gil_scoped_release release;
             return self->get_range(prop); // Call overload_cast<VidProp>
           },
           py::arg("prop"), "Get video processing property range")
@@ -1336,10 +2809,18 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
           "get",
           [](std::shared_ptr<Camera> &self, py::object prop) -> py::object {
             if (py::isinstance<CamProp>(prop)) {
-              auto result = self->get(prop.cast<CamProp>());
+              auto id = prop.cast<CamProp>();
+              Result<PropSetting> result = [&] {
+                py::gil_scoped_release release;
+                return self->get(id);
+              }();
               return py::cast(result);
             } else if (py::isinstance<VidProp>(prop)) {
-              auto result = self->get(prop.cast<VidProp>());
+              auto id = prop.cast<VidProp>();
+              Result<PropSetting> result = [&] {
+                py::gil_scoped_release release;
+                return self->get(id);
+              }();
               return py::cast(result);
             } else {
               throw py::type_error("Property must be CamProp or VidProp");
@@ -1377,6 +2858,41 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
                "\", valid=" + (self->is_valid() ? "True" : "False") + ")";
       });
 
+  /// @brief Native hot paths of the Pythonic CameraController
+  ///
+  /// Property access by name or enum in one extension call: names resolve
+  /// through precomputed tables, device ranges are cached for validation,
+  /// and failures raise PropertyNotSupportedError / InvalidValueError.
+  py::class_<ControllerCore, std::shared_ptr<ControllerCore>>(
+      m, "ControllerCore", py::module_local(),
+      "Native fast path behind CameraController")
+      .def(py::init<std::shared_ptr<Camera>>(), py::arg("camera"),
+           "Wrap an open camera")
+      .def_property_readonly("camera", &ControllerCore::camera,
+                             "Underlying camera")
+      .def("get", &ControllerCore::get, py::arg("prop"),
+           "Read a property by name, CamProp or VidProp (boolean properties "
+           "read by name return bool)")
+      .def("set", &ControllerCore::set, py::arg("prop"), py::arg("value"),
+           py::arg("mode") = "manual",
+           "Write a property; value 'auto' selects auto mode")
+      .def("set_in_range", &ControllerCore::set_in_range, py::arg("prop"),
+           py::arg("value"),
+           "Write a manual value after checking it against the device range")
+      .def("nudge", &ControllerCore::nudge, py::arg("prop"), py::arg("delta"),
+           "Move a property by delta, clamped to its range")
+      .def("range_bounds", &ControllerCore::range_bounds, py::arg("prop"),
+           "Cached (min, max) of a property, or (None, None) if unknown")
+      .def("clear_ranges", &ControllerCore::clear_ranges,
+           "Forget cached device ranges")
+      .def("set_many", &ControllerCore::set_many, py::arg("values"),
+           "Write several properties; returns ({name: ok}, [(name, error)])")
+      .def("get_many", &ControllerCore::get_many, py::arg("names"),
+           "Read several properties; unreadable ones are omitted");
+
+  bind_property_set<CamProp>(m, "CamPropSet", "Set of camera properties");
+  bind_property_set<VidProp>(m, "VidPropSet", "Set of video properties");
+
   /// @brief Complete device capability snapshot
   ///
   /// Provides comprehensive information about all supported properties
@@ -1406,6 +2922,12 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
       .def("supported_video_properties",
            &DeviceCapabilities::supported_video_properties,
            "Get list of supported video properties")
+      .def_property_readonly("camera_properties",
+                             &DeviceCapabilities::camera_properties,
+                             "Set of supported camera properties")
+      .def_property_readonly("video_properties",
+                             &DeviceCapabilities::video_properties,
+                             "Set of supported video properties")
       .def_property_readonly(
           "device",
           [](const DeviceCapabilities &caps) -> Device {
@@ -1425,31 +2947,30 @@ For Pythonic API, use duvc_ctl module. For low-level control, use Result-Based A
       // Iterator protocol support
       .def("__iter__",
            [](const DeviceCapabilities &caps) {
-             auto cam_props = caps.supported_camera_properties();
-             auto vid_props = caps.supported_video_properties();
-
-             // Combine both lists for iteration
-             py::list all_props;
+             // Camera properties, then video properties, in enum order
+             auto cam_props = caps.camera_properties();
+             auto vid_props = caps.video_properties();
+             py::tuple all_props(cam_props.size() + vid_props.size());
+             size_t i = 0;
              for (auto prop : cam_props) {
-               all_props.append(prop);
+               all_props[i++] = py::cast(prop);
              }
              for (auto prop : vid_props) {
-               all_props.append(prop);
+               all_props[i++] = py::cast(prop);
              }
-
              return py::iter(all_props);
            })
       .def("__len__",
            [](const DeviceCapabilities &caps) {
-             return caps.supported_camera_properties().size() +
-                    caps.supported_video_properties().size();
+             return caps.camera_properties().size() +
+                    caps.video_properties().size();
            })
       .def("__str__",
            [](const DeviceCapabilities &caps) {
-             auto cam_props = caps.supported_camera_properties();
-             auto vid_props = caps.supported_video_properties();
-             return std::to_string(cam_props.size()) + " camera properties, " +
-                    std::to_string(vid_props.size()) + " video properties";
+             return std::to_string(caps.camera_properties().size()) +
+                    " camera properties, " +
+                    std::to_string(caps.video_properties().size()) +
+                    " video properties";
            })
       .def("__repr__", [](const DeviceCapabilities &c) {
         return "<DeviceCapabilities accessible=" +
@@ -1773,45 +3294,50 @@ m.def(
             property returned by list_devices().
               )pbdoc");
 
-  // Device change callbacks with GIL management
+  // Device change callbacks, delivered in batches by a dispatcher thread
   m.def(
       "register_device_change_callback",
-      [](py::function callback) {
+      [state](py::function callback, bool batch, py::object loop) {
           if (!callback) {
               throw std::invalid_argument("Callback cannot be None");
           }
-          stored_callback = std::move(callback);  // Store in file-scope static
-          g_python_callback_active.store(true);
+          auto target = std::make_shared<PyCallbackTarget>();
+          target->callback = std::move(callback);
+          target->loop = std::move(loop);
+          target->batch = batch;
+          state->set_target(&ModuleState::device_target, std::move(target));
+          BatchDispatcher<PyDeviceEvent> *events = &state->device_events();
+          state->device_callbacks_active.store(true);
           register_device_change_callback(
-              [](bool added, const std::wstring &device_path) {
-                  // Skip if inactive, no callback, or Python finalizing
-                  if (!g_python_callback_active.load() || !stored_callback || Py_IsInitialized() == 0) {
+              [state, events](bool added, const std::wstring &device_path) {
+                  // Never enters Python: the dispatcher delivers
+                  if (!state->device_callbacks_active.load()) {
                       return;
                   }
-                  py::gil_scoped_acquire gil;
-                  // Re-check after GIL (race-safe during shutdown)
-                  if (!stored_callback) {
-                      return;
-                  }
-                  try {
-                      stored_callback(added, wstring_to_utf8(device_path));
-                  } catch (const py::error_already_set &) {
-                      PyErr_Clear();
-                  } catch (...) {
-                      // Suppress non-Python exceptions to avoid native crash
-                  }
+                  events->post({added, wstring_to_utf8(device_path)});
               });
       },
-      py::arg("callback"), "Register callback for device hotplug events"
+      py::arg("callback"), py::arg("batch") = false, py::arg("loop") = py::none(),
+      R"pbdoc(
+        Register callback for device hotplug events
+
+        Events are queued by the monitor thread and delivered from a dispatcher
+        thread, several at a time under one GIL acquisition.
+
+        Args:
+            callback: Called as callback(added, device_path), or with a list of
+                (added, device_path) tuples when batch is True
+            batch: Deliver each batch as one list
+            loop: asyncio event loop to run the callback on (via
+                call_soon_threadsafe) instead of the dispatcher thread
+              )pbdoc"
   );
 
   m.def(
       "unregister_device_change_callback",
-      []() {
+      [state]() {
           unregister_device_change_callback();  // Native cleanup first
-          g_python_callback_active.store(false);
-          stored_callback = py::function();  // Clear file-scope callback (safe Py_DECREF)
-          callback_cleanup();  // Ensure full state reset
+          callback_cleanup(*state);  // Clear flag and target (safe Py_DECREF)
       },
       "Unregister callback and release resources"
   );
@@ -1836,6 +3362,653 @@ m.def(
   m.def("get_device_capabilities",
         py::overload_cast<int>(&get_device_capabilities),
         py::arg("device_index"), "Create device capability snapshot by index");
+  m.def(
+      "reset_to_defaults",
+      [](std::shared_ptr<Camera> camera, const ResetFilter &filter) {
+        return unwrap_or_throw(reset_to_defaults(*camera, filter));
+      },
+      py::arg("camera"), py::arg("filter") = ResetFilter{},
+      py::call_guard<py::gil_scoped_release>(),
+      "Reset properties to their defaults, skipping ones already there");
+  m.def(
+      "reset_to_defaults",
+      [](std::shared_ptr<Camera> camera,
+         const DeviceCapabilities &capabilities, const ResetFilter &filter) {
+        return unwrap_or_throw(
+            reset_to_defaults(*camera, capabilities, filter));
+      },
+      py::arg("camera"), py::arg("capabilities"),
+      py::arg("filter") = ResetFilter{},
+      py::call_guard<py::gil_scoped_release>(),
+      "Reset properties to their defaults using a capability snapshot");
+
+  // Presets
+  py::class_<PresetValue>(m, "PresetValue", py::module_local(),
+                          "One property value stored in a preset")
+      .def(py::init<>())
+      .def(py::init([](CamProp prop, const PropSetting &setting) {
+             PresetValue v;
+             v.cam_prop = prop;
+             v.setting = setting;
+             return v;
+           }),
+           py::arg("prop"), py::arg("setting"))
+      .def(py::init([](VidProp prop, const PropSetting &setting) {
+             PresetValue v;
+             v.video = true;
+             v.vid_prop = prop;
+             v.setting = setting;
+             return v;
+           }),
+           py::arg("prop"), py::arg("setting"))
+      .def_readwrite("video", &PresetValue::video,
+                     "Video (True) or camera property")
+      .def_readwrite("cam_prop", &PresetValue::cam_prop)
+      .def_readwrite("vid_prop", &PresetValue::vid_prop)
+      .def_readwrite("setting", &PresetValue::setting)
+      .def_property_readonly("name", [](const PresetValue &v) -> std::string {
+        return v.video ? to_string(v.vid_prop) : to_string(v.cam_prop);
+      });
+
+  py::class_<Preset>(m, "Preset", py::module_local(),
+                     "Named, versioned set of property values")
+      .def(py::init<>())
+      .def(py::init([](const std::string &name) {
+             Preset p;
+             p.name = name;
+             return p;
+           }),
+           py::arg("name"))
+      .def_readwrite("name", &Preset::name)
+      .def_readwrite("version", &Preset::version,
+                     "Bumped by PresetStore.put() on every save")
+      .def_readwrite("values", &Preset::values)
+      .def("set", py::overload_cast<CamProp, const PropSetting &>(&Preset::set),
+           py::arg("prop"), py::arg("setting"),
+           "Set a camera property value, replacing any earlier one")
+      .def("set", py::overload_cast<VidProp, const PropSetting &>(&Preset::set),
+           py::arg("prop"), py::arg("setting"),
+           "Set a video property value, replacing any earlier one")
+      .def("__repr__", [](const Preset &p) {
+        return "<Preset '" + p.name + "' v" + std::to_string(p.version) +
+               " values=" + std::to_string(p.values.size()) + ">";
+      });
+
+  py::class_<PresetPlan::Step>(m, "PresetPlanStep", py::module_local(),
+                               "A write a preset plan may perform")
+      .def_readonly("value", &PresetPlan::Step::value)
+      .def_readonly("range", &PresetPlan::Step::range);
+
+  py::class_<PresetPlan>(m, "PresetPlan", py::module_local(),
+                         "Preset resolved against one device")
+      .def_readonly("name", &PresetPlan::name)
+      .def_readonly("version", &PresetPlan::version)
+      .def_readonly("steps", &PresetPlan::steps)
+      .def_readonly("unsupported", &PresetPlan::unsupported)
+      .def_readonly("adjusted", &PresetPlan::adjusted,
+                    "Steps whose value was clamped to the range");
+
+  py::class_<PresetRecallReport::Entry>(m, "PresetRecallEntry",
+                                        py::module_local(),
+                                        "What recall did with one plan step")
+      .def_readonly("value", &PresetRecallReport::Entry::value)
+      .def_readonly("outcome", &PresetRecallReport::Entry::outcome)
+      .def_readonly("error", &PresetRecallReport::Entry::error);
+
+  py::class_<PresetRecallReport>(m, "PresetRecallReport", py::module_local(),
+                                 "Result of one preset recall")
+      .def_readonly("writes", &PresetRecallReport::writes)
+      .def_readonly("skipped", &PresetRecallReport::skipped)
+      .def_readonly("failed", &PresetRecallReport::failed)
+      .def_readonly("unsupported", &PresetRecallReport::unsupported)
+      .def_readonly("entries", &PresetRecallReport::entries)
+      .def_property_readonly(
+          "compile_us",
+          [](const PresetRecallReport &r) { return r.compile_time.count(); })
+      .def_property_readonly(
+          "write_us",
+          [](const PresetRecallReport &r) { return r.write_time.count(); })
+      .def("__repr__", [](const PresetRecallReport &r) {
+        return "<PresetRecallReport writes=" + std::to_string(r.writes) +
+               " skipped=" + std::to_string(r.skipped) +
+               " failed=" + std::to_string(r.failed) + " us=" +
+               std::to_string((r.compile_time + r.write_time).count()) + ">";
+      });
+
+  m.def(
+      "default_preset_path",
+      []() { return wstring_to_utf8(default_preset_path().wstring()); },
+      "Get the default preset store location");
+  m.def(
+      "serialize_presets",
+      [](const std::vector<Preset> &presets) {
+        auto bytes = serialize_presets(presets);
+        return py::bytes(reinterpret_cast<const char *>(bytes.data()),
+                         bytes.size());
+      },
+      py::arg("presets"), "Encode presets in the binary store format");
+  m.def(
+      "parse_presets",
+      [](const py::bytes &data) {
+        std::string raw = data;
+        return unwrap_or_throw(
+            parse_presets(std::vector<uint8_t>(raw.begin(), raw.end())));
+      },
+      py::arg("data"), "Decode presets from the binary store format");
+  m.def("compile_preset", &compile_preset, py::arg("preset"),
+        py::arg("capabilities"),
+        "Compile a preset against a capability snapshot");
+
+  py::class_<PresetStore>(m, "PresetStore", py::module_local(),
+                          "Presets persisted in a single file")
+      .def(py::init([](py::object path) {
+             if (path.is_none()) {
+               return PresetStore();
+             }
+             return PresetStore(std::filesystem::path(
+                 utf8_to_wstring(path.cast<std::string>())));
+           }),
+           py::arg("path") = py::none(),
+           "Create store for a file (default location if None)")
+      .def(
+          "load",
+          [](PresetStore &self) { unwrap_void_or_throw(self.load()); },
+          "Replace the in-memory presets with the file's contents")
+      .def(
+          "save",
+          [](const PresetStore &self) { unwrap_void_or_throw(self.save()); },
+          "Write the presets to the file")
+      .def(
+          "find",
+          [](const PresetStore &self, const std::string &name)
+              -> std::optional<Preset> {
+            const Preset *p = self.find(name);
+            return p ? std::optional<Preset>(*p) : std::nullopt;
+          },
+          py::arg("name"), "Find preset by name (None if not stored)")
+      .def("put", &PresetStore::put, py::arg("preset"),
+           py::return_value_policy::copy,
+           "Add or replace a preset and return the stored copy")
+      .def("remove", &PresetStore::remove, py::arg("name"))
+      .def_property_readonly("presets", &PresetStore::presets)
+      .def_property_readonly("path", [](const PresetStore &self) {
+        return wstring_to_utf8(self.path().wstring());
+      });
+
+  py::class_<PresetRecaller>(m, "PresetRecaller", py::module_local(),
+                             "Recalls presets on one device with minimal writes")
+      .def(py::init([](std::shared_ptr<Camera> camera) {
+             return std::make_unique<PresetRecaller>(*camera);
+           }),
+           py::arg("camera"), py::keep_alive<1, 2>())
+      .def(py::init([](std::shared_ptr<Camera> camera,
+                       const DeviceCapabilities &capabilities) {
+             return std::make_unique<PresetRecaller>(*camera, capabilities);
+           }),
+           py::arg("camera"), py::arg("capabilities"), py::keep_alive<1, 2>())
+      .def("compile", &PresetRecaller::compile, py::arg("preset"),
+           py::call_guard<py::gil_scoped_release>(),
+           "Compile a preset against this device")
+      .def("recall",
+           py::overload_cast<const Preset &>(&PresetRecaller::recall),
+           py::arg("preset"), py::call_guard<py::gil_scoped_release>(),
+           "Recall a preset, writing only properties that differ")
+      .def("recall",
+           py::overload_cast<const PresetPlan &>(&PresetRecaller::recall),
+           py::arg("plan"), py::call_guard<py::gil_scoped_release>(),
+           "Recall a compiled plan")
+      .def("invalidate", &PresetRecaller::invalidate,
+           "Forget cached values so the next recall reads them again")
+      .def("capture", &PresetRecaller::capture, py::arg("name"),
+           py::arg("filter") = ResetFilter{},
+           py::call_guard<py::gil_scoped_release>(),
+           "Capture the device's current values as a preset");
+
+  // Desired-state reconciliation
+  py::class_<DeviceSelector>(m, "DeviceSelector", py::module_local(),
+                             "Selects the devices a desired-state entry "
+                             "applies to")
+      .def(py::init<>())
+      .def_property(
+          "path",
+          [](const DeviceSelector &s) { return wstring_to_utf8(s.path); },
+          [](DeviceSelector &s, const std::string &v) {
+            s.path = utf8_to_wstring(v);
+          })
+      .def_property(
+          "name",
+          [](const DeviceSelector &s) { return wstring_to_utf8(s.name); },
+          [](DeviceSelector &s, const std::string &v) {
+            s.name = utf8_to_wstring(v);
+          })
+      .def("matches", &DeviceSelector::matches, py::arg("device"));
+
+  py::class_<DesiredDeviceState>(m, "DesiredDeviceState", py::module_local(),
+                                 "Desired values for the devices one "
+                                 "selector matches")
+      .def(py::init<>())
+      .def_readwrite("selector", &DesiredDeviceState::selector)
+      .def_readwrite("properties", &DesiredDeviceState::properties);
+
+  py::class_<DesiredState>(m, "DesiredState", py::module_local(),
+                           "Desired state of a fleet")
+      .def(py::init<>())
+      .def_readwrite("devices", &DesiredState::devices)
+      .def_readwrite("interval", &DesiredState::interval)
+      .def_readwrite("max_ops_per_second", &DesiredState::max_ops_per_second)
+      .def_readwrite("tolerance", &DesiredState::tolerance)
+      .def_readwrite("timeout", &DesiredState::timeout)
+      .def("desired_for", &DesiredState::desired_for, py::arg("device"),
+           "Get the merged desired values for one device");
+
+  m.def(
+      "parse_desired_state",
+      [](const std::string &text) {
+        return unwrap_or_throw(parse_desired_state(text));
+      },
+      py::arg("text"), "Parse a JSON desired-state document");
+  m.def(
+      "load_desired_state",
+      [](const std::string &path) {
+        return unwrap_or_throw(
+            load_desired_state(std::filesystem::path(utf8_to_wstring(path))));
+      },
+      py::arg("path"), "Load a JSON desired-state document");
+
+  py::class_<DriftEvent>(m, "DriftEvent", py::module_local(),
+                         "A property found away from its desired value")
+      .def_readonly("device", &DriftEvent::device)
+      .def_readonly("desired", &DriftEvent::desired)
+      .def_readonly("actual", &DriftEvent::actual)
+      .def_readonly("corrected", &DriftEvent::corrected)
+      .def_readonly("error", &DriftEvent::error)
+      .def_property_readonly(
+          "latency_us", [](const DriftEvent &e) { return e.latency.count(); });
+
+  py::class_<SweepReport>(m, "SweepReport", py::module_local(),
+                          "Outcome of one sweep over the fleet")
+      .def_readonly("devices", &SweepReport::devices)
+      .def_readonly("reads", &SweepReport::reads)
+      .def_readonly("writes", &SweepReport::writes)
+      .def_readonly("drifted", &SweepReport::drifted)
+      .def_readonly("failures", &SweepReport::failures)
+      .def_readonly("converged", &SweepReport::converged)
+      .def_readonly("events", &SweepReport::events)
+      .def_property_readonly(
+          "duration_us", [](const SweepReport &r) { return r.duration.count(); })
+      .def("__repr__", [](const SweepReport &r) {
+        return "<SweepReport devices=" + std::to_string(r.devices) +
+               " drifted=" + std::to_string(r.drifted) +
+               " writes=" + std::to_string(r.writes) +
+               " failures=" + std::to_string(r.failures) + ">";
+      });
+
+  py::class_<ReconcilerStats>(m, "ReconcilerStats", py::module_local(),
+                              "Running totals of a reconciler")
+      .def_readonly("sweeps", &ReconcilerStats::sweeps)
+      .def_readonly("reads", &ReconcilerStats::reads)
+      .def_readonly("writes", &ReconcilerStats::writes)
+      .def_readonly("drift_events", &ReconcilerStats::drift_events)
+      .def_readonly("failures", &ReconcilerStats::failures)
+      .def_readonly("converged", &ReconcilerStats::converged)
+      .def_property_readonly("last_convergence_us",
+                             [](const ReconcilerStats &s) {
+                               return s.last_convergence_time.count();
+                             });
+
+  py::class_<Reconciler>(m, "Reconciler", py::module_local(),
+                         "Holds a fleet of cameras at a desired state")
+      .def(py::init([](DesiredState state,
+                       std::optional<std::vector<Device>> devices) {
+             Reconciler::DeviceSource source;
+             if (devices) {
+               source = [devices = *devices] { return devices; };
+             }
+             return std::make_unique<Reconciler>(std::move(state),
+                                                 std::move(source));
+           }),
+           py::arg("state"), py::arg("devices") = py::none(),
+           "Create reconciler (all connected devices if devices is None)")
+      .def("set_desired_state", &Reconciler::set_desired_state,
+           py::arg("state"))
+      .def(
+          "sweep",
+          [](Reconciler &self, py::object on_drift) {
+            auto callback = python_report_callback<DriftEvent>(on_drift);
+            py::gil_scoped_release release;
+            return self.sweep(std::move(callback));
+          },
+          py::arg("on_drift") = py::none(), "Sweep every device now")
+      .def(
+          "start",
+          [](Reconciler &self, py::object on_drift, py::object on_sweep) {
+            return self.start(python_report_callback<DriftEvent>(on_drift),
+                              python_report_callback<SweepReport>(on_sweep));
+          },
+          py::arg("on_drift") = py::none(), py::arg("on_sweep") = py::none(),
+          "Start sweeping in the background (False if already running)")
+      .def("stop", &Reconciler::stop, py::call_guard<py::gil_scoped_release>(),
+           "Stop background sweeping")
+      .def_property_readonly("running", &Reconciler::running)
+      .def("stats", &Reconciler::stats, "Get running totals");
+
+  // Device profiles
+  py::class_<RangeOverride>(m, "RangeOverride", py::module_local(),
+                            "Replacement for fields of a reported range")
+      .def(py::init<>())
+      .def_readwrite("min", &RangeOverride::min)
+      .def_readwrite("max", &RangeOverride::max)
+      .def_readwrite("step", &RangeOverride::step)
+      .def_readwrite("default_val", &RangeOverride::default_val)
+      .def_readwrite("default_mode", &RangeOverride::default_mode)
+      .def("empty", &RangeOverride::empty)
+      .def(
+          "apply",
+          [](const RangeOverride &o, const PropRange &range) {
+            return unwrap_or_throw(o.apply(range));
+          },
+          py::arg("range"));
+
+  py::class_<DeviceProfile>(m, "DeviceProfile", py::module_local(),
+                            "Known behaviour of one camera model")
+      .def(py::init<>())
+      .def_readwrite("vid", &DeviceProfile::vid)
+      .def_readwrite("pid", &DeviceProfile::pid)
+      .def_readwrite("name", &DeviceProfile::name)
+      .def_readwrite("camera_supported", &DeviceProfile::camera_supported)
+      .def_readwrite("video_supported", &DeviceProfile::video_supported)
+      .def_readwrite("camera_never_probe", &DeviceProfile::camera_never_probe)
+      .def_readwrite("video_never_probe", &DeviceProfile::video_never_probe)
+      .def_readwrite("write_interval", &DeviceProfile::write_interval)
+      .def_readwrite("camera_paced", &DeviceProfile::camera_paced)
+      .def_readwrite("video_paced", &DeviceProfile::video_paced)
+      .def("probes", py::overload_cast<CamProp>(&DeviceProfile::probes, py::const_),
+           py::arg("prop"))
+      .def("probes", py::overload_cast<VidProp>(&DeviceProfile::probes, py::const_),
+           py::arg("prop"))
+      .def("paces", py::overload_cast<CamProp>(&DeviceProfile::paces, py::const_),
+           py::arg("prop"))
+      .def("paces", py::overload_cast<VidProp>(&DeviceProfile::paces, py::const_),
+           py::arg("prop"))
+      .def("range_override",
+           py::overload_cast<CamProp>(&DeviceProfile::range_override, py::const_),
+           py::arg("prop"))
+      .def("range_override",
+           py::overload_cast<VidProp>(&DeviceProfile::range_override, py::const_),
+           py::arg("prop"))
+      .def(
+          "set_range_override",
+          [](DeviceProfile &p, CamProp prop, const RangeOverride &range) {
+            p.camera_ranges.at(static_cast<size_t>(prop)) = range;
+          },
+          py::arg("prop"), py::arg("range"))
+      .def(
+          "set_range_override",
+          [](DeviceProfile &p, VidProp prop, const RangeOverride &range) {
+            p.video_ranges.at(static_cast<size_t>(prop)) = range;
+          },
+          py::arg("prop"), py::arg("range"))
+      .def("__repr__", [](const DeviceProfile &p) {
+        return "<DeviceProfile '" + p.name + "'>";
+      });
+
+  py::class_<DeviceProfileDatabase,
+             std::unique_ptr<DeviceProfileDatabase, py::nodelete>>(
+      m, "DeviceProfileDatabase", py::module_local(),
+      "Process-wide device profile database")
+      .def_static("instance", &DeviceProfileDatabase::instance,
+                  py::return_value_policy::reference)
+      .def("find",
+           py::overload_cast<uint16_t, uint16_t>(&DeviceProfileDatabase::find,
+                                                 py::const_),
+           py::arg("vid"), py::arg("pid"))
+      .def("find",
+           py::overload_cast<const Device &>(&DeviceProfileDatabase::find,
+                                             py::const_),
+           py::arg("device"))
+      .def("add", &DeviceProfileDatabase::add, py::arg("profile"),
+           "Add or replace a profile (applies to devices opened afterwards)")
+      .def(
+          "load",
+          [](DeviceProfileDatabase &self, const std::string &path) {
+            return unwrap_or_throw(
+                self.load(std::filesystem::path(utf8_to_wstring(path))));
+          },
+          py::arg("path"), "Load profiles from a JSON file")
+      .def("profiles", &DeviceProfileDatabase::profiles)
+      .def("reset", &DeviceProfileDatabase::reset,
+           "Drop added profiles, keeping only the built-in ones");
+
+  m.def(
+      "parse_device_profiles",
+      [](const std::string &text) {
+        return unwrap_or_throw(parse_device_profiles(text));
+      },
+      py::arg("text"), "Parse device profiles from JSON");
+  m.def(
+      "load_device_profiles",
+      [](const std::string &path) {
+        return unwrap_or_throw(
+            load_device_profiles(std::filesystem::path(utf8_to_wstring(path))));
+      },
+      py::arg("path"), "Load device profiles from a JSON file");
+  m.def("builtin_device_profiles", &builtin_device_profiles,
+        "Get the profiles compiled into the library");
+  m.def(
+      "default_device_profiles_path",
+      [] { return default_device_profiles_path().u8string(); },
+      "Get the default user profile file");
+  m.def("find_device_profile", &find_device_profile, py::arg("device"),
+        "Find the profile for a device (None if unknown)");
+
+  // Trace recording and replay
+  py::enum_<TraceOp>(m, "TraceOp", "Traced platform or connection call")
+      .value("ListDevices", TraceOp::ListDevices)
+      .value("IsDeviceConnected", TraceOp::IsDeviceConnected)
+      .value("CreateConnection", TraceOp::CreateConnection)
+      .value("GetCameraProperty", TraceOp::GetCameraProperty)
+      .value("SetCameraProperty", TraceOp::SetCameraProperty)
+      .value("GetCameraPropertyRange", TraceOp::GetCameraPropertyRange)
+      .value("GetVideoProperty", TraceOp::GetVideoProperty)
+      .value("SetVideoProperty", TraceOp::SetVideoProperty)
+      .value("GetVideoPropertyRange", TraceOp::GetVideoPropertyRange);
+
+  py::class_<TraceEvent>(m, "TraceEvent", py::module_local(),
+                         "One recorded call")
+      .def(py::init<>())
+      .def_readwrite("op", &TraceEvent::op)
+      .def_readwrite("device", &TraceEvent::device)
+      .def_readwrite("property", &TraceEvent::property)
+      .def_readwrite("argument", &TraceEvent::argument)
+      .def_readwrite("error", &TraceEvent::error)
+      .def_readwrite("message", &TraceEvent::message)
+      .def_readwrite("setting", &TraceEvent::setting)
+      .def_readwrite("range", &TraceEvent::range)
+      .def_readwrite("connected", &TraceEvent::connected)
+      .def_readwrite("listed", &TraceEvent::listed)
+      .def_readwrite("latency", &TraceEvent::latency);
+
+  py::class_<Trace, std::shared_ptr<Trace>>(
+      m, "Trace", py::module_local(),
+      "Recorded calls and the devices they refer to")
+      .def(py::init<>())
+      .def_readwrite("devices", &Trace::devices)
+      .def_readwrite("events", &Trace::events)
+      .def("__len__", [](const Trace &t) { return t.events.size(); });
+
+  py::class_<TraceRecorder, std::shared_ptr<TraceRecorder>>(
+      m, "TraceRecorder", py::module_local(), "Sink for recorded calls")
+      .def(py::init<>())
+      .def("snapshot", &TraceRecorder::snapshot,
+           "Copy the calls recorded so far")
+      .def("clear", &TraceRecorder::clear)
+      .def("__len__", &TraceRecorder::size);
+
+  py::class_<ReplayOptions>(m, "ReplayOptions", py::module_local(),
+                            "Trace replay options")
+      .def(py::init<>())
+      .def_readwrite("time_scale", &ReplayOptions::time_scale)
+      .def_readwrite("loop", &ReplayOptions::loop);
+
+  m.def(
+      "serialize_trace",
+      [](const Trace &trace) {
+        auto bytes = serialize_trace(trace);
+        return py::bytes(reinterpret_cast<const char *>(bytes.data()),
+                         bytes.size());
+      },
+      py::arg("trace"), "Encode a trace in the binary trace format");
+  m.def(
+      "parse_trace",
+      [](const py::bytes &data) {
+        std::string raw = data;
+        return unwrap_or_throw(
+            parse_trace(std::vector<uint8_t>(raw.begin(), raw.end())));
+      },
+      py::arg("data"), "Decode a trace from the binary trace format");
+  m.def(
+      "save_trace",
+      [](const Trace &trace, const std::string &path) {
+        unwrap_or_throw(
+            save_trace(trace, std::filesystem::path(utf8_to_wstring(path))));
+      },
+      py::arg("trace"), py::arg("path"), "Write a trace file");
+  m.def(
+      "load_trace",
+      [](const std::string &path) {
+        return unwrap_or_throw(
+            load_trace(std::filesystem::path(utf8_to_wstring(path))));
+      },
+      py::arg("path"), "Read a trace file");
+  m.def("install_trace_recorder", &install_trace_recorder,
+        py::arg("recorder"),
+        "Record calls of devices opened from now on (None stops recording)");
+  m.def(
+      "install_trace_replay",
+      [](std::optional<Trace> trace, const ReplayOptions &options) {
+        install_trace_replay(
+            trace ? std::make_shared<const Trace>(std::move(*trace)) : nullptr,
+            options);
+      },
+      py::arg("trace"), py::arg("options") = ReplayOptions(),
+      "Answer calls of devices opened from now on from a trace (None restores "
+      "the native backend)");
+
+  // Fault injection
+  py::class_<ChaosConfig>(m, "ChaosConfig", py::module_local(),
+                          "What faults to inject and how often")
+      .def(py::init<>())
+      .def_readwrite("seed", &ChaosConfig::seed)
+      .def_readwrite("error_rate", &ChaosConfig::error_rate)
+      .def_readwrite("errors", &ChaosConfig::errors)
+      .def_readwrite("latency", &ChaosConfig::latency)
+      .def_readwrite("spike_rate", &ChaosConfig::spike_rate)
+      .def_readwrite("spike_latency", &ChaosConfig::spike_latency)
+      .def_readwrite("hang_rate", &ChaosConfig::hang_rate)
+      .def_readwrite("hang_duration", &ChaosConfig::hang_duration)
+      .def_readwrite("removal_rate", &ChaosConfig::removal_rate)
+      .def_readwrite("removal_duration", &ChaosConfig::removal_duration)
+      .def_readwrite("flap_period", &ChaosConfig::flap_period);
+
+  py::class_<ChaosStats>(m, "ChaosStats", py::module_local(),
+                         "Counters of a chaos controller")
+      .def_readonly("calls", &ChaosStats::calls)
+      .def_readonly("errors", &ChaosStats::errors)
+      .def_readonly("spikes", &ChaosStats::spikes)
+      .def_readonly("hangs", &ChaosStats::hangs)
+      .def_readonly("removals", &ChaosStats::removals)
+      .def_readonly("absent_calls", &ChaosStats::absent_calls)
+      .def_readonly("opens", &ChaosStats::opens)
+      .def_readonly("open_connections", &ChaosStats::open_connections);
+
+  py::class_<ChaosController, std::shared_ptr<ChaosController>>(
+      m, "ChaosController", py::module_local(), "Shared state of a chaos layer")
+      .def(py::init<ChaosConfig>(), py::arg("config") = ChaosConfig())
+      .def("config", &ChaosController::config)
+      .def("set_config", &ChaosController::set_config, py::arg("config"))
+      .def("remove", &ChaosController::remove, py::arg("device"),
+           py::arg("duration") = std::chrono::milliseconds(0),
+           py::call_guard<py::gil_scoped_release>(),
+           "Unplug a device (zero duration keeps it away until restore())")
+      .def("restore", &ChaosController::restore, py::arg("device"),
+           py::call_guard<py::gil_scoped_release>())
+      .def("present", &ChaosController::present, py::arg("device"),
+           py::call_guard<py::gil_scoped_release>())
+      .def("stats", &ChaosController::stats);
+  m.def(
+      "install_chaos",
+      [](std::shared_ptr<ChaosController> controller) {
+        install_chaos(std::move(controller));
+      },
+      py::arg("controller"),
+      "Inject faults into devices opened from now on (None restores the "
+      "native backend)");
+
+  // Fake devices
+  py::class_<FakeControl>(m, "FakeControl", py::module_local(),
+                          "One control of a fake device")
+      .def(py::init<>())
+      .def_readwrite("range", &FakeControl::range)
+      .def_readwrite("value", &FakeControl::value)
+      .def_readwrite("read_only", &FakeControl::read_only);
+
+  py::class_<FakeDevice>(m, "FakeDevice", py::module_local(),
+                         "One fake camera (assign whole dicts to camera/video)")
+      .def(py::init<>())
+      .def_readwrite("device", &FakeDevice::device)
+      .def_readwrite("camera", &FakeDevice::camera)
+      .def_readwrite("video", &FakeDevice::video)
+      .def_readwrite("latency", &FakeDevice::latency)
+      .def_readwrite("motor_speed", &FakeDevice::motor_speed);
+
+  py::class_<FakeScenario>(m, "FakeScenario", py::module_local(),
+                           "Devices a fake backend starts with")
+      .def(py::init<>())
+      .def_readwrite("devices", &FakeScenario::devices);
+
+  py::class_<FakeStats>(m, "FakeStats", py::module_local(),
+                        "Counters of a fake backend")
+      .def_readonly("calls", &FakeStats::calls)
+      .def_readonly("writes", &FakeStats::writes)
+      .def_readonly("opens", &FakeStats::opens)
+      .def_readonly("open_connections", &FakeStats::open_connections);
+
+  py::class_<FakeBackend, std::shared_ptr<FakeBackend>>(
+      m, "FakeBackend", py::module_local(), "In-memory cameras of a scenario")
+      .def(py::init<FakeScenario>(), py::arg("scenario") = builtin_fake_scenario())
+      .def("devices", &FakeBackend::devices)
+      .def("connected", &FakeBackend::connected, py::arg("device"))
+      .def("set_connected", &FakeBackend::set_connected, py::arg("device"),
+           py::arg("connected"), "Unplug or replug a device")
+      .def("reset", &FakeBackend::reset,
+           "Restore starting values and plug every device back in")
+      .def("stats", &FakeBackend::stats);
+  m.def(
+      "parse_fake_scenario",
+      [](const std::string &text) {
+        return unwrap_or_throw(parse_fake_scenario(text));
+      },
+      py::arg("text"), "Parse a fake scenario from JSON");
+  m.def(
+      "load_fake_scenario",
+      [](const std::string &path) {
+        return unwrap_or_throw(
+            load_fake_scenario(std::filesystem::path(utf8_to_wstring(path))));
+      },
+      py::arg("path"), "Load a fake scenario from a JSON file");
+  m.def("builtin_fake_scenario", &builtin_fake_scenario,
+        "Get the scenario compiled into the library");
+  m.def(
+      "install_fake_backend",
+      [](std::shared_ptr<FakeBackend> backend) {
+        install_fake_backend(std::move(backend));
+      },
+      py::arg("backend"),
+      "Serve devices (including enumeration) from a fake backend (None "
+      "restores the native backend)");
+  m.def("native_platform_backend", &native_platform_backend,
+        "Name of the operating system backend: directshow, v4l2, fake "
+        "(DUVC_BACKEND=fake) or none");
 
   // String Conversion Functions
   m.def("to_string", py::overload_cast<CamProp>(&to_string), py::arg("prop"),
@@ -1846,6 +4019,8 @@ m.def(
         "Convert camera mode enum to string");
   m.def("to_string", py::overload_cast<ErrorCode>(&to_string), py::arg("code"),
         "Convert error code enum to string");
+  m.def("to_string", py::overload_cast<TraceOp>(&to_string), py::arg("op"),
+        "Convert trace operation enum to string");
   m.def("to_string", py::overload_cast<LogLevel>(&to_string), py::arg("level"),
         "Convert log level enum to string");
 
@@ -1877,60 +4052,148 @@ m.def(
       },
       py::arg("wide_string_as_utf8"), "Convert wide string to UTF-8");
 
-  // Logging API with GIL management for callbacks
+  // Logging API: native threads queue records, a dispatcher delivers them
   m.def(
       "set_log_callback",
-      [](std::optional<py::function> callback) {
-        static py::function stored_log_callback;
-
+      [state](std::optional<py::function> callback,
+              std::optional<LogLevel> min_level, bool batch, py::object loop) {
         if (!callback) {
-          // Clear callback
-          stored_log_callback = py::function();
-          set_log_callback(
-              nullptr); // Assuming C++ accepts nullptr to clear the callback
-        } else {
-          // Set callback
-          stored_log_callback = callback.value();
-          set_log_callback([](LogLevel level, const std::string &message) {
-            py::gil_scoped_acquire gil;
-            try {
-              stored_log_callback(level, message);
-            } catch (const py::error_already_set &) {
-              PyErr_Clear();
-            }
-          });
+          // Clear callback; records already queued are dropped
+          set_log_callback(nullptr);
+          state->set_target(&ModuleState::log_target, nullptr);
+          return;
         }
+        auto target = std::make_shared<PyCallbackTarget>();
+        target->callback = std::move(*callback);
+        target->loop = std::move(loop);
+        target->batch = batch;
+        BatchDispatcher<PyLogRecord> *logs = &state->logs();
+        state->set_target(&ModuleState::log_target, std::move(target));
+        state->python_log_level.store(
+            static_cast<int>(min_level.value_or(LogLevel::Debug)));
+        set_log_callback([state, logs](LogLevel level, const std::string &message) {
+          // Suppressed records never reach Python
+          if (static_cast<int>(level) < state->python_log_level.load()) {
+            return;
+          }
+          if (t_python_records) {
+            t_python_records->push_back({level, message});
+            return;
+          }
+          logs->post({level, message});
+        });
       },
-      py::arg("callback") = py::none(),
-      "Set global log callback function (pass None to clear)");
+      py::arg("callback") = py::none(), py::arg("min_level") = py::none(),
+      py::arg("batch") = false, py::arg("loop") = py::none(),
+      R"pbdoc(
+        Set global log callback function (pass None to clear)
+
+        Records are queued by the logging thread without taking the GIL and
+        delivered from a dispatcher thread, several at a time under one GIL
+        acquisition. Records logged from Python (log_info() and friends) are
+        delivered before that call returns.
+
+        Args:
+            callback: Called as callback(level, message), or with a list of
+                (level, message) tuples when batch is True
+            min_level: Drop records below this level before they are queued
+                (in addition to set_log_level())
+            batch: Deliver each batch as one list
+            loop: asyncio event loop to run the callback on (via
+                call_soon_threadsafe) instead of the dispatcher thread
+              )pbdoc");
+
+  m.def(
+      "flush_callbacks",
+      [state](int timeout_ms) {
+        auto timeout = std::chrono::milliseconds(timeout_ms);
+        auto dispatchers = state->started();
+        bool flushed = true;
+        if (dispatchers.first) {
+          flushed = dispatchers.first->flush(timeout) && flushed;
+        }
+        if (dispatchers.second) {
+          flushed = dispatchers.second->flush(timeout) && flushed;
+        }
+        return flushed;
+      },
+      py::arg("timeout_ms") = 1000, py::call_guard<py::gil_scoped_release>(),
+      "Wait until queued log records and device events have been delivered "
+      "(scheduled, with a loop); returns False on timeout");
+
+  py::class_<DispatchStats>(m, "DispatchStats", py::module_local(),
+                            "Counters of a callback dispatcher")
+      .def_readonly("posted", &DispatchStats::posted)
+      .def_readonly("dropped", &DispatchStats::dropped)
+      .def_readonly("delivered", &DispatchStats::delivered)
+      .def_readonly("batches", &DispatchStats::batches)
+      .def_readonly("max_batch", &DispatchStats::max_batch);
+  m.def(
+      "log_dispatch_stats",
+      [state]() {
+        auto *logs = state->started().first;
+        return logs ? logs->stats() : DispatchStats();
+      },
+      "Get log callback delivery counters");
+  m.def(
+      "device_event_dispatch_stats",
+      [state]() {
+        auto *events = state->started().second;
+        return events ? events->stats() : DispatchStats();
+      },
+      "Get device change callback delivery counters");
 
   m.def("set_log_level", &set_log_level, py::arg("level"),
         "Set minimum log level");
   m.def("get_log_level", &get_log_level, "Get current minimum log level");
-  m.def("log_message", &log_message, py::arg("level"), py::arg("message"),
+  m.def(
+      "log_message",
+      [state](LogLevel level, const std::string &msg) {
+        log_from_python(state, level, msg);
+      },
+      py::arg("level"), py::arg("message"),
         "Log a message at specified level");
-  m.def("log_debug", &log_debug, py::arg("message"), "Log debug message");
-  m.def("log_info", &log_info, py::arg("message"), "Log info message");
-  m.def("log_warning", &log_warning, py::arg("message"), "Log warning message");
-  m.def("log_error", &log_error, py::arg("message"), "Log error message");
-  m.def("log_critical", &log_critical, py::arg("message"),
-        "Log critical message");
+  m.def(
+      "log_debug",
+      [state](const std::string &msg) { log_from_python(state, LogLevel::Debug, msg); },
+      py::arg("message"), "Log debug message");
+  m.def(
+      "log_info",
+      [state](const std::string &msg) { log_from_python(state, LogLevel::Info, msg); },
+      py::arg("message"), "Log info message");
+  m.def(
+      "log_warning",
+      [state](const std::string &msg) { log_from_python(state, LogLevel::Warning, msg); },
+      py::arg("message"), "Log warning message");
+  m.def(
+      "log_error",
+      [state](const std::string &msg) { log_from_python(state, LogLevel::Error, msg); },
+      py::arg("message"), "Log error message");
+  m.def(
+      "log_critical",
+      [state](const std::string &msg) { log_from_python(state, LogLevel::Critical, msg); },
+      py::arg("message"), "Log critical message");
 
   // Logging macro equivalents
   m.def(
-      "duvc_log_debug", [](const std::string &msg) { log_debug(msg); },
+      "duvc_log_debug",
+      [state](const std::string &msg) { log_from_python(state, LogLevel::Debug, msg); },
       py::arg("message"), "Debug log macro equivalent");
   m.def(
-      "duvc_log_info", [](const std::string &msg) { log_info(msg); },
+      "duvc_log_info",
+      [state](const std::string &msg) { log_from_python(state, LogLevel::Info, msg); },
       py::arg("message"), "Info log macro equivalent");
   m.def(
-      "duvc_log_warning", [](const std::string &msg) { log_warning(msg); },
+      "duvc_log_warning",
+      [state](const std::string &msg) { log_from_python(state, LogLevel::Warning, msg); },
       py::arg("message"), "Warning log macro equivalent");
   m.def(
-      "duvc_log_error", [](const std::string &msg) { log_error(msg); },
+      "duvc_log_error",
+      [state](const std::string &msg) { log_from_python(state, LogLevel::Error, msg); },
       py::arg("message"), "Error log macro equivalent");
   m.def(
-      "duvc_log_critical", [](const std::string &msg) { log_critical(msg); },
+      "duvc_log_critical",
+      [state](const std::string &msg) { log_from_python(state, LogLevel::Critical, msg); },
       py::arg("message"), "Critical log macro equivalent");
 
   // Error Decoding Functions
@@ -2546,19 +4809,16 @@ m.def(
   // Exception registration
   py::register_exception<std::runtime_error>(m, "DuvcRuntimeError");
 
-// Safe shutdown cleanup via atexit (runs before Py_Finalize)
-static bool atexit_registered = false;
-if (!atexit_registered) {
-    atexit_registered = true;
-    try {
-        py::module_ atexit_mod = py::module_::import("atexit");
-        // CRITICAL: Wrap lambda with py::cpp_function for Python callable conversion
-        atexit_mod.attr("register")(py::cpp_function([]() {
-            callback_cleanup();  // Clear flag and callback while GIL held
-        }));
-    } catch (const py::error_already_set&) {
-        PyErr_Clear();  // Graceful fail if atexit unavailable
-    }
+// Safe shutdown cleanup via atexit (runs before the interpreter finalizes;
+// registered per module instance so every interpreter stops its own threads)
+try {
+    py::module_ atexit_mod = py::module_::import("atexit");
+    // CRITICAL: Wrap lambda with py::cpp_function for Python callable conversion
+    atexit_mod.attr("register")(py::cpp_function([state]() {
+        dispatcher_shutdown(*state);  // Drain dispatchers, clear callbacks with thread state
+    }));
+} catch (const py::error_already_set&) {
+    PyErr_Clear();  // Graceful fail if atexit unavailable
 }
 
   // Platform identification
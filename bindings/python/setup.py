@@ -37,6 +37,7 @@ setup(
         "Intended Audience :: Developers",
         "License :: OSI Approved :: MIT License",
         "Operating System :: Microsoft :: Windows",
+        "Operating System :: POSIX :: Linux",
         "Programming Language :: Python :: 3",
         "Programming Language :: Python :: 3.8",
         "Programming Language :: Python :: 3.9", 
@@ -47,6 +48,6 @@ setup(
         "Topic :: Multimedia :: Video",
         "Topic :: Software Development :: Libraries :: Python Modules",
     ],
-    keywords="camera uvc directshow ptz video control webcam",
+    keywords="camera uvc directshow v4l2 ptz video control webcam",
     zip_safe=False,
 )
@@ -6,12 +6,20 @@
 
 #include "duvc-ctl/duvc.hpp"
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
 #include <ctime>
 #include <cwctype>
+#include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -19,8 +27,11 @@
 #include <vector>
 
 #ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
 #include <wchar.h>
 #include <windows.h>
+#include <shellapi.h>
 #pragma warning(disable : 4996)
 #endif
 
@@ -41,7 +52,7 @@ static constexpr const wchar_t* DUVC_CLI_VERSION = L"2.1.0";
 // ============================================================================
 
 enum class Verbosity { QUIET, NORMAL, VERBOSE };
-enum class OutputFormat { TEXT, JSON };
+enum class OutputFormat { TEXT, JSON, JSONL, CSV, MSGPACK };
 
 struct CLIFlags {
   Verbosity verbosity = Verbosity::NORMAL;
@@ -54,15 +65,34 @@ static CLIFlags g_flags;
 // UTILITY FUNCTIONS
 // ============================================================================
 
+/// Get the arguments as wide strings. On Windows argv is in the ANSI code
+/// page, so the wide command line is split again instead of decoding argv;
+/// elsewhere argv is taken to be UTF-8.
 static std::vector<std::wstring> convert_args(int argc, char **argv) {
   std::vector<std::wstring> wargs;
+#ifdef _WIN32
+  int wargc = 0;
+  if (LPWSTR *wargv = CommandLineToArgvW(GetCommandLineW(), &wargc)) {
+    wargs.assign(wargv, wargv + wargc);
+    LocalFree(wargv);
+    return wargs;
+  }
+  // Fall back to the ANSI arguments in the active code page
+  wargs.reserve(argc);
+  for (int i = 0; i < argc; ++i) {
+    int n = MultiByteToWideChar(CP_ACP, 0, argv[i], -1, nullptr, 0);
+    std::wstring arg(n > 0 ? n - 1 : 0, L'\0');
+    if (n > 1) {
+      MultiByteToWideChar(CP_ACP, 0, argv[i], -1, &arg[0], n);
+    }
+    wargs.push_back(std::move(arg));
+  }
+#else
   wargs.reserve(argc);
   for (int i = 0; i < argc; ++i) {
-    std::wstring warg;
-    for (char c : std::string(argv[i]))
-      warg += static_cast<wchar_t>(c);
-    wargs.push_back(std::move(warg));
+    wargs.push_back(duvc::to_wstring(std::string(argv[i])));
   }
+#endif
   return wargs;
 }
 
@@ -95,30 +125,106 @@ static void log_error(const std::wstring &msg) {
   }
 }
 
-static std::wstring json_escape(const std::wstring &str) {
-  std::wstring result;
-  for (wchar_t ch : str) {
-    switch (ch) {
-    case L'"':
-      result += L"\\\"";
-      break;
-    case L'\\':
-      result += L"\\\\";
-      break;
-    case L'\n':
-      result += L"\\n";
-      break;
-    case L'\r':
-      result += L"\\r";
-      break;
-    case L'\t':
-      result += L"\\t";
-      break;
-    default:
-      result += ch;
+/// Structured output requested (commands without record output print JSON)
+static bool json_output() { return g_flags.format != OutputFormat::TEXT; }
+
+/// Output is a stream of records (one per line or row), not one document
+static bool record_output() {
+  return g_flags.format == OutputFormat::JSONL ||
+         g_flags.format == OutputFormat::CSV ||
+         g_flags.format == OutputFormat::MSGPACK;
+}
+
+/// Encoding for the selected output format; @p stream writes JSON as lines
+static duvc::SerialFormat serial_format(bool stream = false) {
+  switch (g_flags.format) {
+  case OutputFormat::CSV:
+    return duvc::SerialFormat::Csv;
+  case OutputFormat::MSGPACK:
+    return duvc::SerialFormat::MessagePack;
+  case OutputFormat::JSONL:
+    return duvc::SerialFormat::JsonLines;
+  default:
+    return stream ? duvc::SerialFormat::JsonLines : duvc::SerialFormat::Json;
+  }
+}
+
+/**
+ * Wide stream buffer that writes UTF-8 to stdout
+ *
+ * std::wcout is pointed at this buffer, so text and encoded output
+ * (write_output()) reach stdout as bytes through the same FILE, in order.
+ */
+class Utf8StdoutBuffer : public std::wstreambuf {
+public:
+  Utf8StdoutBuffer() { setp(wide_, wide_ + kCapacity); }
+
+protected:
+  int_type overflow(int_type ch) override {
+    drain();
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(ch);
+      pbump(1);
+    }
+    return traits_type::not_eof(ch);
+  }
+
+  int sync() override {
+    drain();
+    return std::fflush(stdout) == 0 ? 0 : -1;
+  }
+
+private:
+  static constexpr size_t kCapacity = 512;
+
+  /// Encode the buffered characters, keeping a high surrogate for its pair
+  void drain() {
+    size_t length = static_cast<size_t>(pptr() - pbase());
+    size_t keep = 0;
+    if (sizeof(wchar_t) == 2 && length > 0 && wide_[length - 1] >= 0xD800 &&
+        wide_[length - 1] <= 0xDBFF) {
+      keep = 1;
+    }
+    size_t encode = length - keep;
+    bytes_.resize(duvc::utf8_length(wide_, encode));
+    duvc::encode_utf8(wide_, encode, &bytes_[0]);
+    std::fwrite(bytes_.data(), 1, bytes_.size(), stdout);
+    if (keep) {
+      wide_[0] = wide_[length - 1];
+    }
+    setp(wide_, wide_ + kCapacity);
+    pbump(static_cast<int>(keep));
+  }
+
+  wchar_t wide_[kCapacity];
+  std::string bytes_;
+};
+
+/// Write encoded output to stdout as raw bytes; a JSON document gets a newline
+static void write_output(const duvc::Serializer &out) {
+  std::wcout.flush();
+#ifdef _WIN32
+  if (g_flags.format == OutputFormat::MSGPACK) {
+    _setmode(_fileno(stdout), _O_BINARY);
+  }
+#endif
+  std::fwrite(out.buffer().data(), 1, out.size(), stdout);
+  if (out.format() == duvc::SerialFormat::Json) {
+    std::fputc('\n', stdout);
+  }
+  std::fflush(stdout);
+
+  // A CSV stream cannot add columns once its header is out; say so once each
+  static std::mutex mutex;
+  static std::vector<std::string> reported;
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const auto &column : out.dropped_columns()) {
+    if (std::find(reported.begin(), reported.end(), column) == reported.end()) {
+      reported.push_back(column);
+      log_error(L"CSV column not in header, dropped: " +
+                duvc::to_wstring(column));
     }
   }
-  return result;
 }
 
 // ============================================================================
@@ -264,147 +370,382 @@ static bool validate_value(int value, const PropRange &range,
 // ============================================================================
 
 static void on_device_change(bool added, const std::wstring &device_path) {
-  if (g_flags.format == OutputFormat::JSON) {
-    std::wcout << L"{\"event\":\"" << (added ? L"added" : L"removed")
-               << L"\",\"path\":\"" << json_escape(device_path) << L"\"}\n";
-  } else {
-    std::wcout << (added ? L"[ADDED] " : L"[REMOVED] ") << device_path << L"\n";
+  if (json_output()) {
+    // One serializer for the whole stream, so CSV writes its header once
+    static std::mutex mutex;
+    static duvc::Serializer out(serial_format(true));
+    std::lock_guard<std::mutex> lock(mutex);
+    out.begin_object()
+        .field("event", added ? "added" : "removed")
+        .field("path", device_path)
+        .end_object();
+    write_output(out);
+    out.clear();
+    return;
   }
+  std::wcout << (added ? L"[ADDED] " : L"[REMOVED] ") << device_path << L"\n";
   std::wcout.flush();
 }
 
+// ============================================================================
+// PARALLEL DEVICE PROBING
+// ============================================================================
+
+/// Worker pool settings for multi-device commands (--jobs / --timeout)
+struct ProbeOptions {
+  unsigned jobs = 0;                        // 0 = derive from hardware
+  std::chrono::milliseconds timeout{10000}; // 0 = wait indefinitely
+};
+
+/// Outcome of probing one device; assembled in index order
+template <typename Data> struct ProbeResult {
+  bool ok = false;
+  bool timed_out = false;
+  Data data;
+};
+
+/// Reads one device into a private result; returns false on failure.
+/// Runs on a worker thread, so it must only touch its arguments.
+template <typename Data>
+using DeviceProbeFn =
+    std::function<bool(size_t index, const Device &device, Data &data)>;
+
+/// Probe threads abandoned after a timeout (may still be inside a driver)
+static std::atomic<unsigned> g_abandoned_probes{0};
+
+/// Consume --jobs/--timeout (either "--flag N" or "--flag=N") at args[i]
+static bool parse_probe_option(const std::vector<const wchar_t *> &args,
+                               size_t &i, ProbeOptions &opts) {
+  std::wstring arg = args[i];
+  std::wstring value;
+  bool is_jobs = arg == L"--jobs" || starts_with(arg, L"--jobs=");
+  bool is_timeout = arg == L"--timeout" || starts_with(arg, L"--timeout=");
+  if (!is_jobs && !is_timeout) {
+    return false;
+  }
+
+  size_t eq = arg.find(L'=');
+  if (eq != std::wstring::npos) {
+    value = arg.substr(eq + 1);
+  } else if (i + 1 < args.size()) {
+    value = args[++i];
+  }
+
+  int parsed = _wtoi(value.c_str());
+  if (parsed < 0) {
+    parsed = 0;
+  }
+  if (is_jobs) {
+    opts.jobs = static_cast<unsigned>(parsed);
+  } else {
+    opts.timeout = std::chrono::milliseconds(parsed);
+  }
+  return true;
+}
+
+/**
+ * Probe the given devices concurrently on a bounded pool of worker threads.
+ *
+ * Each probe reads into its own result; results come back in the order of
+ * @p indices so the caller can emit a single, stable stream. Workers that
+ * finish are joined. A probe that exceeds the per-device timeout is reported
+ * as timed out and its worker is detached, freeing the slot for the remaining
+ * devices; it only touches the shared state it co-owns (see
+ * finish_probe_command() for how the process exits around it).
+ */
+template <typename Data>
+static std::vector<ProbeResult<Data>>
+probe_devices(const std::vector<Device> &devices,
+              const std::vector<size_t> &indices, const ProbeOptions &opts,
+              const DeviceProbeFn<Data> &probe) {
+  using clock = std::chrono::steady_clock;
+
+  // Shared with worker threads, which may outlive this call on timeout
+  struct ProbeState {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<ProbeResult<Data>> results;
+    std::vector<size_t> finished;
+  };
+
+  const size_t count = indices.size();
+  auto state = std::make_shared<ProbeState>();
+  state->results.resize(count);
+
+  unsigned jobs = opts.jobs;
+  if (jobs == 0) {
+    jobs = std::clamp(std::thread::hardware_concurrency(), 1u, 8u);
+  }
+
+  std::vector<std::thread> workers(count);
+  std::vector<std::optional<clock::time_point>> deadlines(count);
+  std::vector<bool> settled(count, false);
+  size_t next = 0;
+  size_t running = 0;
+  size_t remaining = count;
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  while (remaining > 0) {
+    while (running < jobs && next < count) {
+      size_t pos = next++;
+      if (opts.timeout.count() > 0) {
+        deadlines[pos] = clock::now() + opts.timeout;
+      }
+      ++running;
+
+      workers[pos] = std::thread([state, pos, index = indices[pos],
+                                  device = devices[indices[pos]], probe]() {
+        Data data;
+        bool ok = false;
+        try {
+          ok = probe(index, device, data);
+        } catch (...) {
+          ok = false;
+        }
+        std::lock_guard<std::mutex> guard(state->mutex);
+        state->results[pos].ok = ok;
+        state->results[pos].data = std::move(data);
+        state->finished.push_back(pos);
+        state->cv.notify_all();
+      });
+    }
+
+    std::optional<clock::time_point> wake;
+    for (size_t pos = 0; pos < next; ++pos) {
+      if (!settled[pos] && deadlines[pos] && (!wake || *deadlines[pos] < *wake))
+        wake = deadlines[pos];
+    }
+
+    auto has_finished = [&state] { return !state->finished.empty(); };
+    if (wake) {
+      state->cv.wait_until(lock, *wake, has_finished);
+    } else {
+      state->cv.wait(lock, has_finished);
+    }
+
+    std::vector<size_t> finished;
+    finished.swap(state->finished);
+    for (size_t pos : finished) {
+      if (!settled[pos]) {
+        settled[pos] = true;
+        --running;
+        --remaining;
+      }
+    }
+    if (!finished.empty()) {
+      // Finished workers have only their return left; join them unlocked
+      lock.unlock();
+      for (size_t pos : finished) {
+        if (workers[pos].joinable()) {
+          workers[pos].join();
+        }
+      }
+      lock.lock();
+    }
+
+    auto now = clock::now();
+    for (size_t pos = 0; pos < next; ++pos) {
+      if (!settled[pos] && deadlines[pos] && now >= *deadlines[pos]) {
+        settled[pos] = true;
+        state->results[pos].timed_out = true;
+        --running;
+        --remaining;
+        workers[pos].detach();
+        g_abandoned_probes.fetch_add(1);
+        log_verbose(L"Device " + std::to_wstring(indices[pos]) +
+                    L" timed out after " +
+                    std::to_wstring(opts.timeout.count()) + L" ms");
+      }
+    }
+  }
+
+  // Copy under the lock; abandoned workers may still write into state
+  return state->results;
+}
+
+/// Return from a probing command.
+///
+/// Only a timed-out probe's worker is detached, and it may still be blocked
+/// inside a driver call holding library state (device actors, COM objects).
+/// Normal exit would run static destructors underneath it or hang waiting for
+/// it, so in that case the output streams are flushed and the process exits
+/// without static teardown. With no abandoned worker every thread has been
+/// joined and the command returns normally.
+static int finish_probe_command(int rc) {
+  if (g_abandoned_probes.load() > 0) {
+    std::wcout.flush();
+    std::wcerr.flush();
+    std::_Exit(rc);
+  }
+  return rc;
+}
+
 // ============================================================================
 // COMMAND HANDLERS
 // ============================================================================
 
+/// What --detailed learns about one device
+struct ListEntry {
+  bool connected = false;
+  bool opened = false;
+  std::vector<const wchar_t *> cam_props;
+  std::vector<const wchar_t *> vid_props;
+};
+
+static bool probe_list_entry(size_t /*index*/, const Device &device,
+                             ListEntry &entry) {
+  entry.connected = duvc::is_device_connected(device);
+  if (!entry.connected) {
+    return true;
+  }
+
+  auto cam_res = duvc::open_camera(device);
+  if (!cam_res) {
+    return false;
+  }
+  entry.opened = true;
+  Camera cam = std::move(cam_res).value();
+  for (auto &m : CAM_PROP_MAP) {
+    if (cam.get_range(m.prop)) {
+      entry.cam_props.push_back(m.name);
+    }
+  }
+  for (auto &m : VID_PROP_MAP) {
+    if (cam.get_range(m.prop)) {
+      entry.vid_props.push_back(m.name);
+    }
+  }
+  return true;
+}
+
+static void render_list_entry(size_t index, const Device &device,
+                              const ListEntry &entry) {
+  std::wcout << L"[" << index << L"] " << device.name << L"\n";
+  std::wcout << L"    Path: " << device.path << L"\n";
+  std::wcout << L"    Status: "
+             << (entry.connected ? L"CONNECTED" : L"DISCONNECTED") << L"\n";
+
+  if (!entry.connected) {
+    return;
+  }
+  if (!entry.opened) {
+    std::wcout << L"    Controls: Unable to query\n";
+    return;
+  }
+
+  auto names = [](const std::vector<const wchar_t *> &props) {
+    for (size_t j = 0; j < props.size(); ++j) {
+      if (j > 0)
+        std::wcout << L", ";
+      std::wcout << props[j];
+    }
+    std::wcout << L" (" << props.size() << L")\n";
+  };
+  std::wcout << L"    Supported properties:\n";
+  std::wcout << L"      Camera: ";
+  names(entry.cam_props);
+  std::wcout << L"      Video: ";
+  names(entry.vid_props);
+}
+
+/// Write one device record; @p probe is null unless --detailed
+static void write_list_entry(duvc::Serializer &out, size_t index,
+                             const Device &device,
+                             const ProbeResult<ListEntry> *probe) {
+  out.begin_object();
+  out.field("index", index).field("name", device.name).field("path", device.path);
+  if (probe && probe->timed_out) {
+    out.field("timed_out", true);
+  } else if (probe) {
+    const ListEntry &entry = probe->data;
+    out.field("connected", entry.connected);
+    if (entry.opened) {
+      out.key("controls")
+          .begin_object()
+          .field("cam", entry.cam_props.size())
+          .field("vid", entry.vid_props.size())
+          .end_object();
+      out.key("supported_cam").begin_array();
+      for (const wchar_t *name : entry.cam_props)
+        out.value(name);
+      out.end_array();
+      out.key("supported_vid").begin_array();
+      for (const wchar_t *name : entry.vid_props)
+        out.value(name);
+      out.end_array();
+    }
+  }
+  out.end_object();
+}
+
 static int cmd_list(const std::vector<const wchar_t *> &args) {
   bool detailed = false;
+  ProbeOptions probe_opts;
 
   for (size_t i = 0; i < args.size(); ++i) {
     std::wstring arg = args[i];
     if (arg == L"--detailed" || arg == L"-d") {
       detailed = true;
+    } else {
+      parse_probe_option(args, i, probe_opts);
     }
   }
 
   auto devices = duvc::list_devices();
 
-  if (g_flags.format == OutputFormat::JSON) {
-    std::wcout << L"{\"devices\":[";
-    for (size_t i = 0; i < devices.size(); ++i) {
-      if (i > 0)
-        std::wcout << L",";
-      std::wcout << L"{\"index\":" << i << L",\"name\":\""
-                 << json_escape(devices[i].name) << L"\"" << L",\"path\":\""
-                 << json_escape(devices[i].path) << L"\"";
-
-      if (detailed) {
-        bool connected = duvc::is_device_connected(devices[i]);
-        std::wcout << L",\"connected\":" << (connected ? L"true" : L"false");
-
-        if (connected) {
-          auto cam_res = duvc::open_camera(devices[i]);
-          if (cam_res) {
-            Camera cam = std::move(cam_res).value();
-            int cam_count = 0, vid_count = 0;
-
-            std::vector<std::wstring> cam_props, vid_props;
-            for (auto &m : CAM_PROP_MAP) {
-              if (cam.get_range(m.prop)) {
-                cam_count++;
-                cam_props.push_back(m.name);
-              }
-            }
-            for (auto &m : VID_PROP_MAP) {
-              if (cam.get_range(m.prop)) {
-                vid_count++;
-                vid_props.push_back(m.name);
-              }
-            }
-
-            std::wcout << L",\"controls\":{\"cam\":" << cam_count
-                       << L",\"vid\":" << vid_count << L"}";
-            std::wcout << L",\"supported_cam\":[";
-            for (size_t j = 0; j < cam_props.size(); ++j) {
-              if (j > 0)
-                std::wcout << L",";
-              std::wcout << L"\"" << cam_props[j] << L"\"";
-            }
-            std::wcout << L"],\"supported_vid\":[";
-            for (size_t j = 0; j < vid_props.size(); ++j) {
-              if (j > 0)
-                std::wcout << L",";
-              std::wcout << L"\"" << vid_props[j] << L"\"";
-            }
-            std::wcout << L"]";
-          } else {
-            log_verbose(L"Failed to open camera " + std::to_wstring(i) +
-                        L" for detailed scan");
-          }
-        }
+  std::vector<ProbeResult<ListEntry>> probes;
+  if (detailed) {
+    std::vector<size_t> indices(devices.size());
+    for (size_t i = 0; i < indices.size(); ++i)
+      indices[i] = i;
+    probes = probe_devices<ListEntry>(devices, indices, probe_opts,
+                                      probe_list_entry);
+    for (size_t i = 0; i < probes.size(); ++i) {
+      if (!probes[i].ok && !probes[i].timed_out) {
+        log_verbose(L"Failed to open camera " + std::to_wstring(i) +
+                    L" for detailed scan");
       }
+    }
+  }
 
-      std::wcout << L"}";
+  if (json_output()) {
+    duvc::Serializer out(serial_format());
+    bool document = !record_output();
+    if (document) {
+      out.begin_object().key("devices").begin_array();
+    }
+    for (size_t i = 0; i < devices.size(); ++i) {
+      write_list_entry(out, i, devices[i], detailed ? &probes[i] : nullptr);
+    }
+    if (document) {
+      out.end_array().end_object();
     }
-    std::wcout << L"]}\n";
+    write_output(out);
   } else {
     if (g_flags.verbosity >= Verbosity::NORMAL) {
       std::wcout << L"Devices: " << devices.size() << L"\n";
     }
 
     for (size_t i = 0; i < devices.size(); ++i) {
-      std::wcout << L"[" << i << L"] " << devices[i].name << L"\n";
-
       if (detailed) {
-        std::wcout << L"    Path: " << devices[i].path << L"\n";
-        bool connected = duvc::is_device_connected(devices[i]);
-        std::wcout << L"    Status: "
-                   << (connected ? L"CONNECTED" : L"DISCONNECTED") << L"\n";
-
-        if (connected) {
-          auto cam_res = duvc::open_camera(devices[i]);
-          if (cam_res) {
-            Camera cam = std::move(cam_res).value();
-            int cam_count = 0, vid_count = 0;
-
-            std::wcout << L"    Supported properties:\n";
-            std::wcout << L"      Camera: ";
-            bool first_cam = true;
-            for (auto &m : CAM_PROP_MAP) {
-              if (cam.get_range(m.prop)) {
-                if (!first_cam)
-                  std::wcout << L", ";
-                std::wcout << m.name;
-                cam_count++;
-                first_cam = false;
-              }
-            }
-            std::wcout << L" (" << cam_count << L")\n";
-
-            std::wcout << L"      Video: ";
-            bool first_vid = true;
-            for (auto &m : VID_PROP_MAP) {
-              if (cam.get_range(m.prop)) {
-                if (!first_vid)
-                  std::wcout << L", ";
-                std::wcout << m.name;
-                vid_count++;
-                first_vid = false;
-              }
-            }
-            std::wcout << L" (" << vid_count << L")\n";
-          } else {
-            log_verbose(L"Failed to open camera for detailed scan");
-            std::wcout << L"    Controls: Unable to query\n";
-          }
+        if (probes[i].timed_out) {
+          std::wcout << L"[" << i << L"] " << devices[i].name << L"\n"
+                     << L"    Path: " << devices[i].path << L"\n"
+                     << L"    Status: TIMED OUT\n";
+        } else {
+          render_list_entry(i, devices[i], probes[i].data);
         }
-      } else if (g_flags.verbosity >= Verbosity::NORMAL) {
+        continue;
+      }
+
+      std::wcout << L"[" << i << L"] " << devices[i].name << L"\n";
+      if (g_flags.verbosity >= Verbosity::NORMAL) {
         std::wcout << L"    " << devices[i].path << L"\n";
       }
     }
   }
 
-  return 0;
+  return finish_probe_command(0);
 }
 
 static int cmd_get(int index, const std::wstring &domain,
@@ -431,12 +772,32 @@ static int cmd_get(int index, const std::wstring &domain,
     return 3;
   }
 
-  if (g_flags.format == OutputFormat::JSON) {
-    std::wcout << L"{\"device\":" << index << L",\"domain\":\"" << domain
-               << L"\"" << L",\"properties\":[";
+  duvc::Serializer out(serial_format());
+  bool document = !record_output();
+  if (json_output() && document) {
+    out.begin_object()
+        .field("device", index)
+        .field("domain", domain)
+        .key("properties")
+        .begin_array();
   }
 
-  bool first = true;
+  auto emit = [&](const std::wstring &name, const PropSetting &s) {
+    if (!json_output()) {
+      std::wcout << name << L"=" << s.value << L" ("
+                 << duvc::to_wstring(s.mode) << L")\n";
+      return;
+    }
+    out.begin_object();
+    if (!document) {
+      out.field("device", index).field("domain", domain);
+    }
+    out.field("name", name)
+        .field("value", s.value)
+        .field("mode", duvc::to_wstring(s.mode))
+        .end_object();
+  };
+
   int error_count = 0;
 
   for (const auto &prop_name : props) {
@@ -454,20 +815,7 @@ static int cmd_get(int index, const std::wstring &domain,
         error_count++;
         continue;
       }
-
-      auto s = r.value();
-
-      if (g_flags.format == OutputFormat::JSON) {
-        if (!first)
-          std::wcout << L",";
-        std::wcout << L"{\"name\":\"" << json_escape(duvc::to_wstring(*p))
-                   << L"\",\"value\":" << s.value << L",\"mode\":\""
-                   << duvc::to_wstring(s.mode) << L"\"}";
-        first = false;
-      } else {
-        std::wcout << duvc::to_wstring(*p) << L"=" << s.value << L" ("
-                   << duvc::to_wstring(s.mode) << L")\n";
-      }
+      emit(duvc::to_wstring(*p), r.value());
     } else {
       auto p = parse_vid_prop(prop_name);
       if (!p) {
@@ -482,25 +830,15 @@ static int cmd_get(int index, const std::wstring &domain,
         error_count++;
         continue;
       }
-
-      auto s = r.value();
-
-      if (g_flags.format == OutputFormat::JSON) {
-        if (!first)
-          std::wcout << L",";
-        std::wcout << L"{\"name\":\"" << json_escape(duvc::to_wstring(*p))
-                   << L"\",\"value\":" << s.value << L",\"mode\":\""
-                   << duvc::to_wstring(s.mode) << L"\"}";
-        first = false;
-      } else {
-        std::wcout << duvc::to_wstring(*p) << L"=" << s.value << L" ("
-                   << duvc::to_wstring(s.mode) << L")\n";
-      }
+      emit(duvc::to_wstring(*p), r.value());
     }
   }
 
-  if (g_flags.format == OutputFormat::JSON) {
-    std::wcout << L"]}\n";
+  if (json_output() && document) {
+    out.end_array().end_object();
+  }
+  if (json_output()) {
+    write_output(out);
   }
 
   return error_count > 0 ? 4 : 0;
@@ -657,61 +995,33 @@ static int cmd_set(int index, const std::wstring &domain,
 
       CamProp target_prop = *p;
 
-      // If relative flag is set, calculate absolute value from current + delta
+      // Relative changes move by delta in one call, clamped to the range
       if (force_relative || op->is_relative) {
-        log_verbose(L"Relative mode: reading current value for " +
-                    op->prop_name);
-
-        auto current = cam.get(*p);
-        if (!current) {
-          log_error(L"Cannot apply relative change - failed to read current "
-                    L"value for: " +
-                    op->prop_name);
+        log_verbose(L"Relative: " + op->prop_name + L" delta=" +
+                    (value >= 0 ? L"+" : L"") + std::to_wstring(value));
+        auto result = cam.nudge(*p, value);
+        if (!result) {
+          log_error(L"Failed to apply relative change to: " + op->prop_name);
+          log_verbose(L"Nudge failed: " +
+                      duvc::to_wstring(result.error().description()));
           error_count++;
-          continue;
-        }
-
-        int current_val = current.value().value;
-        int delta = value;
-        int new_val = current_val + delta;
-
-        // Validate the new value is in range
-        auto range = cam.get_range(*p);
-        if (range) {
-          if (new_val < range.value().min || new_val > range.value().max) {
-            log_error(op->prop_name +
-                      L": Relative change would result in out-of-range value " +
-                      std::to_wstring(new_val) + L" (range: [" +
-                      std::to_wstring(range.value().min) + L"," +
-                      std::to_wstring(range.value().max) + L"])");
-            error_count++;
-            continue;
-          }
+        } else if (g_flags.verbosity >= Verbosity::NORMAL &&
+                   g_flags.format == OutputFormat::TEXT) {
+          std::wcout << L"OK\n";
         }
-
-        std::wostringstream rel_msg;
-        rel_msg << L"Relative: " << op->prop_name << L" current=" << current_val
-                << L" delta=" << (delta >= 0 ? L"+" : L"") << delta << L" new="
-                << new_val;
-        log_verbose(rel_msg.str());
-
-        value = new_val;
-        // Keep target_prop as the regular property (not *Relative)
+        continue;
       }
 
-      // Validate non-relative values
-      if (!force_relative && !op->is_relative) {
-        auto range = cam.get_range(*p);
-        if (range) {
-          std::wstring error_msg;
-          if (!validate_value(value, range.value(), error_msg)) {
-            log_error(op->prop_name + L": " + error_msg);
-            error_count++;
-            continue;
-          }
-        } else {
-          log_verbose(L"Range not available for validation: " + op->prop_name);
+      auto range = cam.get_range(*p);
+      if (range) {
+        std::wstring error_msg;
+        if (!validate_value(value, range.value(), error_msg)) {
+          log_error(op->prop_name + L": " + error_msg);
+          error_count++;
+          continue;
         }
+      } else {
+        log_verbose(L"Range not available for validation: " + op->prop_name);
       }
 
       std::wostringstream debug_msg;
@@ -738,49 +1048,24 @@ static int cmd_set(int index, const std::wstring &domain,
         continue;
       }
 
-      // If relative flag is set, calculate absolute value from current + delta
+      // Relative changes move by delta in one call, clamped to the range
       if (force_relative || op->is_relative) {
-        log_verbose(L"Relative mode: reading current value for " +
-                    op->prop_name);
-
-        auto current = cam.get(*p);
-        if (!current) {
-          log_error(L"Cannot apply relative change - failed to read current "
-                    L"value for: " +
-                    op->prop_name);
+        log_verbose(L"Relative: " + op->prop_name + L" delta=" +
+                    (value >= 0 ? L"+" : L"") + std::to_wstring(value));
+        auto result = cam.nudge(*p, value);
+        if (!result) {
+          log_error(L"Failed to apply relative change to: " + op->prop_name);
+          log_verbose(L"Nudge failed: " +
+                      duvc::to_wstring(result.error().description()));
           error_count++;
-          continue;
-        }
-
-        int current_val = current.value().value;
-        int delta = value;
-        int new_val = current_val + delta;
-
-        // Validate the new value is in range
-        auto range = cam.get_range(*p);
-        if (range) {
-          if (new_val < range.value().min || new_val > range.value().max) {
-            log_error(op->prop_name +
-                      L": Relative change would result in out-of-range value " +
-                      std::to_wstring(new_val) + L" (range: [" +
-                      std::to_wstring(range.value().min) + L"," +
-                      std::to_wstring(range.value().max) + L"])");
-            error_count++;
-            continue;
-          }
+        } else if (g_flags.verbosity >= Verbosity::NORMAL &&
+                   g_flags.format == OutputFormat::TEXT) {
+          std::wcout << L"OK\n";
         }
-
-        std::wostringstream rel_msg;
-        rel_msg << L"Relative: " << op->prop_name << L" current=" << current_val
-                << L" delta=" << (delta >= 0 ? L"+" : L"") << delta << L" new="
-                << new_val;
-        log_verbose(rel_msg.str());
-
-        value = new_val;
+        continue;
       }
 
-      // Validate absolute value (for non-relative or after relative
-      // calculation)
+      // Validate absolute value
       auto range = cam.get_range(*p);
       if (range) {
         std::wstring error_msg;
@@ -818,241 +1103,455 @@ static int cmd_reset(int index, const std::wstring &domain,
     return 2;
   }
 
-  auto cam_res = duvc::open_camera(devices[index]);
-  if (!cam_res) {
-    log_error(L"Failed to open camera");
-    log_verbose(L"Camera open failed for device " + std::to_wstring(index));
-    return 3;
-  }
-  Camera cam = std::move(cam_res).value();
-
   bool is_cam = is_cam_domain(domain);
   bool is_vid = is_vid_domain(domain);
-  bool reset_all =
-      (props.size() == 1 && _wcsicmp(props[0].c_str(), L"all") == 0);
+  bool reset_all = domain == L"all" || (props.size() == 1 &&
+                                        _wcsicmp(props[0].c_str(), L"all") == 0);
 
   if (!is_cam && !is_vid && domain != L"all") {
     log_error(L"Invalid domain");
     return 3;
   }
 
-  int reset_count = 0;
-
-  if (domain == L"all") {
-    for (auto &m : CAM_PROP_MAP) {
-      auto range = cam.get_range(m.prop);
-      if (range) {
-        auto r = range.value();
-        PropSetting s{r.default_val, r.default_mode};
-        if (cam.set(m.prop, s)) {
-          reset_count++;
-          log_verbose(L"Reset " + std::wstring(m.name) + L" to default");
-        }
-      }
-    }
-
-    for (auto &m : VID_PROP_MAP) {
-      auto range = cam.get_range(m.prop);
-      if (range) {
-        auto r = range.value();
-        PropSetting s{r.default_val, r.default_mode};
-        if (cam.set(m.prop, s)) {
-          reset_count++;
-          log_verbose(L"Reset " + std::wstring(m.name) + L" to default");
-        }
-      }
-    }
-
-    if (g_flags.verbosity >= Verbosity::NORMAL &&
-        g_flags.format == OutputFormat::TEXT) {
-      std::wcout << L"Reset " << reset_count << L" properties\n";
-    }
-    return 0;
-  }
-
-  if (is_cam) {
-    if (reset_all) {
-      for (auto &m : CAM_PROP_MAP) {
-        auto range = cam.get_range(m.prop);
-        if (range) {
-          auto r = range.value();
-          PropSetting s{r.default_val, r.default_mode};
-          if (cam.set(m.prop, s)) {
-            reset_count++;
-            log_verbose(L"Reset " + std::wstring(m.name) + L" to default");
-          }
-        }
-      }
-    } else {
-      for (const auto &prop_name : props) {
+  duvc::ResetFilter filter;
+  filter.camera = is_cam || domain == L"all";
+  filter.video = is_vid || domain == L"all";
+  if (!reset_all) {
+    for (const auto &prop_name : props) {
+      if (is_cam) {
         auto p = parse_cam_prop(prop_name);
         if (!p) {
           log_error(L"Unknown camera property: " + prop_name);
           continue;
         }
-
-        auto range = cam.get_range(*p);
-        if (!range) {
-          log_error(L"Range not available for: " + prop_name);
-          log_verbose(L"Cannot reset without range information");
-          continue;
-        }
-
-        auto r = range.value();
-        PropSetting s{r.default_val, r.default_mode};
-        if (cam.set(*p, s)) {
-          reset_count++;
-          log_verbose(L"Reset " + prop_name + L" to " +
-                      std::to_wstring(r.default_val));
-        } else {
-          log_error(L"Failed to reset: " + prop_name);
-        }
-      }
-    }
-  } else if (is_vid) {
-    if (reset_all) {
-      for (auto &m : VID_PROP_MAP) {
-        auto range = cam.get_range(m.prop);
-        if (range) {
-          auto r = range.value();
-          PropSetting s{r.default_val, r.default_mode};
-          if (cam.set(m.prop, s)) {
-            reset_count++;
-            log_verbose(L"Reset " + std::wstring(m.name) + L" to default");
-          }
-        }
-      }
-    } else {
-      for (const auto &prop_name : props) {
+        filter.camera_props.push_back(*p);
+      } else {
         auto p = parse_vid_prop(prop_name);
         if (!p) {
           log_error(L"Unknown video property: " + prop_name);
           continue;
         }
-
-        auto range = cam.get_range(*p);
-        if (!range) {
-          log_error(L"Range not available for: " + prop_name);
-          log_verbose(L"Cannot reset without range information");
-          continue;
-        }
-
-        auto r = range.value();
-        PropSetting s{r.default_val, r.default_mode};
-        if (cam.set(*p, s)) {
-          reset_count++;
-          log_verbose(L"Reset " + prop_name + L" to " +
-                      std::to_wstring(r.default_val));
-        } else {
-          log_error(L"Failed to reset: " + prop_name);
-        }
+        filter.video_props.push_back(*p);
       }
     }
+    if (filter.camera_props.empty() && filter.video_props.empty()) {
+      return 3;
+    }
   }
 
-  if (g_flags.verbosity >= Verbosity::NORMAL &&
-      g_flags.format == OutputFormat::TEXT) {
-    std::wcout << L"Reset " << reset_count << L" properties\n";
+  auto cam_res = duvc::open_camera(devices[index]);
+  if (!cam_res) {
+    log_error(L"Failed to open camera");
+    log_verbose(L"Camera open failed for device " + std::to_wstring(index));
+    return 3;
+  }
+  Camera cam = std::move(cam_res).value();
+
+  auto result = duvc::reset_to_defaults(cam, filter);
+  if (!result) {
+    log_error(L"Reset failed");
+    log_verbose(duvc::to_wstring(result.error().description()));
+    return 4;
+  }
+  const auto &report = result.value();
+
+  auto entry_name = [](const duvc::ResetEntry &e) -> std::wstring {
+    return e.video ? duvc::to_wstring(e.vid_prop) : duvc::to_wstring(e.cam_prop);
+  };
+
+  for (const auto &entry : report.entries) {
+    if (entry.outcome == duvc::ResetOutcome::Written) {
+      log_verbose(L"Reset " + entry_name(entry) + L" to default");
+    } else if (entry.outcome == duvc::ResetOutcome::Skipped) {
+      log_verbose(entry_name(entry) + L" already at default");
+    } else {
+      log_error(L"Failed to reset: " + entry_name(entry));
+    }
+  }
+
+  // Explicitly named properties the device does not report a range for
+  if (!reset_all) {
+    auto reported = [&](bool video, int prop) {
+      for (const auto &e : report.entries) {
+        if (e.video == video &&
+            prop == (video ? static_cast<int>(e.vid_prop)
+                           : static_cast<int>(e.cam_prop))) {
+          return true;
+        }
+      }
+      return false;
+    };
+    for (auto p : filter.camera_props) {
+      if (!reported(false, static_cast<int>(p))) {
+        log_error(std::wstring(L"Range not available for: ") + duvc::to_wstring(p));
+      }
+    }
+    for (auto p : filter.video_props) {
+      if (!reported(true, static_cast<int>(p))) {
+        log_error(std::wstring(L"Range not available for: ") + duvc::to_wstring(p));
+      }
+    }
+  }
+
+  if (json_output()) {
+    duvc::Serializer out(serial_format());
+    out.begin_object()
+        .field("writes", report.writes)
+        .field("skipped", report.skipped)
+        .field("failed", report.failed)
+        .end_object();
+    write_output(out);
+  } else if (g_flags.verbosity >= Verbosity::NORMAL) {
+    std::wcout << L"Reset " << report.writes << L" properties ("
+               << report.skipped << L" already at default";
+    if (report.failed) {
+      std::wcout << L", " << report.failed << L" failed";
+    }
+    std::wcout << L")\n";
   }
 
   return 0;
 }
 
-static int cmd_snapshot(int index, const std::vector<Device> &devices,
-                        const std::vector<const wchar_t *> &args) {
-  if (index < 0 || index >= static_cast<int>(devices.size())) {
-    log_error(L"Invalid device index");
-    return 2;
-  }
+/// One property value read by a snapshot
+struct PropertyValue {
+  const wchar_t *domain;
+  const wchar_t *name;
+  PropSetting setting;
+};
 
-  auto cam_res = duvc::open_camera(devices[index]);
+static bool probe_snapshot(size_t /*index*/, const Device &device,
+                           std::vector<PropertyValue> &values) {
+  auto cam_res = duvc::open_camera(device);
   if (!cam_res) {
-    log_error(L"Failed to open camera");
-    log_verbose(L"Camera open failed for device " + std::to_wstring(index));
-    return 3;
+    return false;
   }
   Camera cam = std::move(cam_res).value();
 
+  for (auto &m : CAM_PROP_MAP) {
+    auto val = cam.get(m.prop);
+    if (val) {
+      values.push_back({L"cam", m.name, val.value()});
+    }
+  }
+  for (auto &m : VID_PROP_MAP) {
+    auto val = cam.get(m.prop);
+    if (val) {
+      values.push_back({L"vid", m.name, val.value()});
+    }
+  }
+  return true;
+}
+
+/// Write a device's snapshot as one document object
+static void write_snapshot(duvc::Serializer &out, size_t index,
+                           const Device &device,
+                           const std::vector<PropertyValue> &values) {
+  out.begin_object();
+  out.field("device", index).field("name", device.name);
+  out.key("properties").begin_object();
+  for (const wchar_t *domain : {L"cam", L"vid"}) {
+    out.key(domain).begin_object();
+    for (const auto &v : values) {
+      if (std::wcscmp(v.domain, domain) == 0) {
+        out.key(v.name)
+            .begin_object()
+            .field("value", v.setting.value)
+            .field("mode", duvc::to_wstring(v.setting.mode))
+            .end_object();
+      }
+    }
+    out.end_object();
+  }
+  out.end_object();
+  out.end_object();
+}
+
+/// Write a device's snapshot as one record per property
+static void write_snapshot_records(duvc::Serializer &out, size_t index,
+                                   const Device &device,
+                                   const std::vector<PropertyValue> &values) {
+  for (const auto &v : values) {
+    out.begin_object()
+        .field("device", index)
+        .field("name", device.name)
+        .field("domain", v.domain)
+        .field("property", v.name)
+        .field("value", v.setting.value)
+        .field("mode", duvc::to_wstring(v.setting.mode))
+        .end_object();
+  }
+}
+
+static int cmd_snapshot(int index, bool all, const std::vector<Device> &devices,
+                        const std::vector<const wchar_t *> &args) {
+  if (!all && (index < 0 || index >= static_cast<int>(devices.size()))) {
+    log_error(L"Invalid device index");
+    return 2;
+  }
+
   std::wstring output_file;
+  ProbeOptions probe_opts;
   for (size_t i = 0; i < args.size(); ++i) {
     std::wstring arg = args[i];
     if ((arg == L"-o" || arg == L"--output") && i + 1 < args.size()) {
       output_file = args[i + 1];
+    } else {
+      parse_probe_option(args, i, probe_opts);
     }
   }
 
-  std::wostringstream output;
+  std::vector<size_t> indices;
+  if (all) {
+    for (size_t i = 0; i < devices.size(); ++i)
+      indices.push_back(i);
+  } else {
+    indices.push_back(static_cast<size_t>(index));
+  }
 
-  if (g_flags.format == OutputFormat::JSON) {
-    output << L"{\"device\":" << index << L",\"name\":\""
-           << json_escape(devices[index].name) << L"\""
-           << L",\"properties\":{\"cam\":{";
+  auto probes = probe_devices<std::vector<PropertyValue>>(
+      devices, indices, probe_opts, probe_snapshot);
 
-    bool first_cam = true;
-    for (auto &m : CAM_PROP_MAP) {
-      auto val = cam.get(m.prop);
-      if (val) {
-        if (!first_cam)
-          output << L",";
-        auto v = val.value();
-        output << L"\"" << m.name << L"\":{\"value\":" << v.value
-               << L",\"mode\":\"" << duvc::to_wstring(v.mode) << L"\"}";
-        first_cam = false;
-      }
-    }
+  if (!all && (probes[0].timed_out || !probes[0].ok)) {
+    log_error(probes[0].timed_out ? L"Timed out reading camera"
+                                  : L"Failed to open camera");
+    log_verbose(L"Camera open failed for device " + std::to_wstring(index));
+    return finish_probe_command(3);
+  }
 
-    output << L"},\"vid\":{";
+  // Text is encoded once at the end; structured output is UTF-8 throughout
+  duvc::Serializer out(serial_format());
+  std::wostringstream text;
+  int rc = 0;
+  bool document = !record_output();
 
-    bool first_vid = true;
-    for (auto &m : VID_PROP_MAP) {
-      auto val = cam.get(m.prop);
-      if (val) {
-        if (!first_vid)
-          output << L",";
-        auto v = val.value();
-        output << L"\"" << m.name << L"\":{\"value\":" << v.value
-               << L",\"mode\":\"" << duvc::to_wstring(v.mode) << L"\"}";
-        first_vid = false;
-      }
+  if (json_output() && document && all) {
+    out.begin_object().key("snapshots").begin_array();
+  }
+  for (size_t i = 0; i < probes.size(); ++i) {
+    const Device &device = devices[indices[i]];
+    bool ok = probes[i].ok && !probes[i].timed_out;
+    const wchar_t *failure = probes[i].timed_out ? L"timed out" : L"open failed";
+    if (!ok) {
+      rc = 3;
     }
 
-    output << L"}}}\n";
-  } else {
-    for (auto &m : CAM_PROP_MAP) {
-      auto val = cam.get(m.prop);
-      if (val) {
-        auto v = val.value();
-        output << L"cam." << m.name << L"=" << v.value << L":"
-               << duvc::to_wstring(v.mode) << L"\n";
+    if (!json_output()) {
+      if (all) {
+        text << L"# [" << indices[i] << L"] " << device.name << L"\n";
       }
-    }
-
-    for (auto &m : VID_PROP_MAP) {
-      auto val = cam.get(m.prop);
-      if (val) {
-        auto v = val.value();
-        output << L"vid." << m.name << L"=" << v.value << L":"
-               << duvc::to_wstring(v.mode) << L"\n";
+      if (!ok) {
+        text << L"# " << failure << L"\n";
+        continue;
+      }
+      for (const auto &v : probes[i].data) {
+        text << v.domain << L"." << v.name << L"=" << v.setting.value << L":"
+             << duvc::to_wstring(v.setting.mode) << L"\n";
       }
+    } else if (!ok) {
+      if (document) {
+        out.begin_object()
+            .field("device", indices[i])
+            .field("name", device.name)
+            .field("error", failure)
+            .end_object();
+      } else {
+        // Records carry property values only; report the gap on stderr
+        log_error(L"Device " + std::to_wstring(indices[i]) + L": " + failure);
+      }
+    } else if (document) {
+      write_snapshot(out, indices[i], device, probes[i].data);
+    } else {
+      write_snapshot_records(out, indices[i], device, probes[i].data);
     }
   }
+  if (json_output() && document && all) {
+    out.end_array().end_object();
+  }
 
   if (!output_file.empty()) {
-    std::wofstream file(output_file);
+    std::ofstream file(std::filesystem::path(output_file), std::ios::binary);
     if (!file) {
       log_error(L"Failed to open output file: " + output_file);
-      return 4;
+      return finish_probe_command(4);
+    }
+    if (json_output()) {
+      file.write(out.buffer().data(),
+                 static_cast<std::streamsize>(out.size()));
+      if (out.format() == duvc::SerialFormat::Json) {
+        file << '\n';
+      }
+    } else {
+      file << duvc::to_utf8(text.str());
     }
-    file << output.str();
     if (g_flags.verbosity >= Verbosity::NORMAL &&
         g_flags.format == OutputFormat::TEXT) {
       std::wcout << L"Saved to " << output_file << L"\n";
     }
+  } else if (json_output()) {
+    write_output(out);
   } else {
-    std::wcout << output.str();
+    std::wcout << text.str();
   }
 
-  return 0;
+  return finish_probe_command(rc);
+}
+
+/// One supported property with its range and current value
+struct Capability {
+  const wchar_t *domain;
+  const wchar_t *name;
+  PropRange range;
+  int current;
+  CamMode mode;
+};
+
+static bool probe_capabilities(size_t /*index*/, const Device &device,
+                               std::vector<Capability> &capabilities) {
+  auto cam_res = duvc::open_camera(device);
+  if (!cam_res) {
+    return false;
+  }
+  Camera cam = std::move(cam_res).value();
+
+  auto add = [&](const wchar_t *domain, const wchar_t *name,
+                 const PropRange &r, const duvc::Result<PropSetting> &gv) {
+    int curVal = 0;
+    CamMode curMode = r.default_mode;
+    if (gv) {
+      auto v = gv.value();
+      curVal = v.value;
+      curMode = v.mode;
+    }
+    capabilities.push_back({domain, name, r, curVal, curMode});
+  };
+
+  for (auto &m : CAM_PROP_MAP) {
+    auto rr = cam.get_range(m.prop);
+    if (rr)
+      add(L"cam", m.name, rr.value(), cam.get(m.prop));
+  }
+  for (auto &m : VID_PROP_MAP) {
+    auto rr = cam.get_range(m.prop);
+    if (rr)
+      add(L"vid", m.name, rr.value(), cam.get(m.prop));
+  }
+  return true;
+}
+
+/// Write one capability's members (without braces)
+static void write_capability_fields(duvc::Serializer &out,
+                                    const Capability &c) {
+  out.field("domain", c.domain)
+      .field("property", c.name)
+      .field("min", c.range.min)
+      .field("max", c.range.max)
+      .field("step", c.range.step)
+      .field("default", c.range.default_val)
+      .field("current", c.current)
+      .field("mode", duvc::to_wstring(c.mode));
+}
+
+static int cmd_capabilities(int index, bool all,
+                            const std::vector<Device> &devices,
+                            const std::vector<const wchar_t *> &args) {
+  if (!all && (index < 0 || index >= static_cast<int>(devices.size()))) {
+    log_error(L"Invalid device index");
+    return 2;
+  }
+
+  ProbeOptions probe_opts;
+  for (size_t i = 0; i < args.size(); ++i) {
+    parse_probe_option(args, i, probe_opts);
+  }
+
+  std::vector<size_t> indices;
+  if (all) {
+    for (size_t i = 0; i < devices.size(); ++i)
+      indices.push_back(i);
+  } else {
+    indices.push_back(static_cast<size_t>(index));
+  }
+
+  auto probes = probe_devices<std::vector<Capability>>(
+      devices, indices, probe_opts, probe_capabilities);
+
+  if (!all && (probes[0].timed_out || !probes[0].ok)) {
+    log_error(probes[0].timed_out ? L"Timed out reading camera"
+                                  : L"Failed to open camera");
+    log_verbose(L"Camera open failed for device " + std::to_wstring(index));
+    return finish_probe_command(3);
+  }
+
+  int rc = 0;
+  duvc::Serializer out(serial_format());
+  bool document = !record_output();
+  if (json_output() && document && all) {
+    out.begin_object().key("devices").begin_array();
+  }
+
+  for (size_t i = 0; i < probes.size(); ++i) {
+    size_t device_index = indices[i];
+    bool ok = probes[i].ok && !probes[i].timed_out;
+    if (!ok) {
+      rc = 3;
+    }
+
+    if (json_output() && document) {
+      out.begin_object().field("device", device_index);
+      if (ok) {
+        out.key("capabilities").begin_array();
+        for (const auto &c : probes[i].data) {
+          out.begin_object();
+          write_capability_fields(out, c);
+          out.end_object();
+        }
+        out.end_array();
+      } else {
+        out.field("error", probes[i].timed_out ? "timed out" : "open failed");
+      }
+      out.end_object();
+    } else if (json_output()) {
+      if (!ok) {
+        log_error(L"Device " + std::to_wstring(device_index) + L": " +
+                  (probes[i].timed_out ? L"timed out" : L"open failed"));
+        continue;
+      }
+      for (const auto &c : probes[i].data) {
+        out.begin_object().field("device", device_index);
+        write_capability_fields(out, c);
+        out.end_object();
+      }
+    } else {
+      if (g_flags.verbosity >= Verbosity::NORMAL || all) {
+        std::wcout << L"Capabilities: " << devices[device_index].name << L"\n";
+      }
+      if (!ok) {
+        std::wcout << L"  "
+                   << (probes[i].timed_out ? L"Timed out" : L"Unable to query")
+                   << L"\n";
+        continue;
+      }
+      for (const auto &c : probes[i].data) {
+        std::wstring label = c.domain;
+        std::transform(label.begin(), label.end(), label.begin(), ::towupper);
+        std::wcout << L"  " << label << L" " << c.name << L": ["
+                   << c.range.min << L"," << c.range.max << L"] step="
+                   << c.range.step << L" default=" << c.range.default_val
+                   << L" current=" << c.current << L" ("
+                   << duvc::to_wstring(c.mode) << L")\n";
+      }
+    }
+  }
+
+  if (json_output() && document && all) {
+    out.end_array().end_object();
+  }
+  if (json_output()) {
+    write_output(out);
+  }
+
+  return finish_probe_command(rc);
 }
 
 static int cmd_range(int index, const std::wstring &domain,
@@ -1081,31 +1580,40 @@ static int cmd_range(int index, const std::wstring &domain,
     return 3;
   }
 
-  if (g_flags.format == OutputFormat::JSON) {
-    std::wcout << L"{\"device\":" << index << L",\"ranges\":[";
+  duvc::Serializer out(serial_format());
+  bool document = !record_output();
+  if (json_output() && document) {
+    out.begin_object().field("device", index).key("ranges").begin_array();
   }
 
-  bool first = true;
+  // label prefixes text lines ("cam." when listing a whole domain)
+  auto emit = [&](const wchar_t *dom, const std::wstring &name,
+                  const wchar_t *label, const PropRange &r) {
+    if (!json_output()) {
+      std::wcout << label << name << L": [" << r.min << L"," << r.max
+                 << L"] step=" << r.step << L" default=" << r.default_val
+                 << L" (" << duvc::to_wstring(r.default_mode) << L")\n";
+      return;
+    }
+    out.begin_object();
+    if (!document) {
+      out.field("device", index);
+    }
+    out.field("domain", dom)
+        .field("property", name)
+        .field("min", r.min)
+        .field("max", r.max)
+        .field("step", r.step)
+        .field("default", r.default_val)
+        .field("mode", duvc::to_wstring(r.default_mode))
+        .end_object();
+  };
 
   if (domain == L"all" || (is_cam && all_props)) {
     for (auto &m : CAM_PROP_MAP) {
       auto range = cam.get_range(m.prop);
       if (range) {
-        auto r = range.value();
-        if (g_flags.format == OutputFormat::JSON) {
-          if (!first)
-            std::wcout << L",";
-          std::wcout << L"{\"domain\":\"cam\",\"property\":\"" << m.name
-                     << L"\",\"min\":" << r.min << L",\"max\":" << r.max
-                     << L",\"step\":" << r.step << L",\"default\":"
-                     << r.default_val << L",\"mode\":\""
-                     << duvc::to_wstring(r.default_mode) << L"\"}";
-          first = false;
-        } else {
-          std::wcout << L"cam." << m.name << L": [" << r.min << L"," << r.max
-                     << L"] step=" << r.step << L" default=" << r.default_val
-                     << L" (" << duvc::to_wstring(r.default_mode) << L")\n";
-        }
+        emit(L"cam", m.name, L"cam.", range.value());
       }
     }
   }
@@ -1114,91 +1622,44 @@ static int cmd_range(int index, const std::wstring &domain,
     for (auto &m : VID_PROP_MAP) {
       auto range = cam.get_range(m.prop);
       if (range) {
-        auto r = range.value();
-        if (g_flags.format == OutputFormat::JSON) {
-          if (!first)
-            std::wcout << L",";
-          std::wcout << L"{\"domain\":\"vid\",\"property\":\"" << m.name
-                     << L"\",\"min\":" << r.min << L",\"max\":" << r.max
-                     << L",\"step\":" << r.step << L",\"default\":"
-                     << r.default_val << L",\"mode\":\""
-                     << duvc::to_wstring(r.default_mode) << L"\"}";
-          first = false;
-        } else {
-          std::wcout << L"vid." << m.name << L": [" << r.min << L"," << r.max
-                     << L"] step=" << r.step << L" default=" << r.default_val
-                     << L" (" << duvc::to_wstring(r.default_mode) << L")\n";
-        }
+        emit(L"vid", m.name, L"vid.", range.value());
       }
     }
   }
 
   if (!all_props && domain != L"all") {
     for (const auto &prop_name : props) {
+      std::optional<duvc::Result<PropRange>> range;
       if (is_cam) {
         auto p = parse_cam_prop(prop_name);
         if (!p) {
           log_error(L"Unknown camera property: " + prop_name);
           continue;
         }
-
-        auto range = cam.get_range(*p);
-        if (!range) {
-          log_error(L"Range not available for: " + prop_name);
-          log_verbose(L"Property may not be supported by device");
-          continue;
-        }
-
-        auto r = range.value();
-        if (g_flags.format == OutputFormat::JSON) {
-          if (!first)
-            std::wcout << L",";
-          std::wcout << L"{\"domain\":\"cam\",\"property\":\"" << prop_name
-                     << L"\",\"min\":" << r.min << L",\"max\":" << r.max
-                     << L",\"step\":" << r.step << L",\"default\":"
-                     << r.default_val << L",\"mode\":\""
-                     << duvc::to_wstring(r.default_mode) << L"\"}";
-          first = false;
-        } else {
-          std::wcout << prop_name << L": [" << r.min << L"," << r.max
-                     << L"] step=" << r.step << L" default=" << r.default_val
-                     << L" (" << duvc::to_wstring(r.default_mode) << L")\n";
-        }
-      } else if (is_vid) {
+        range = cam.get_range(*p);
+      } else {
         auto p = parse_vid_prop(prop_name);
         if (!p) {
           log_error(L"Unknown video property: " + prop_name);
           continue;
         }
+        range = cam.get_range(*p);
+      }
 
-        auto range = cam.get_range(*p);
-        if (!range) {
-          log_error(L"Range not available for: " + prop_name);
-          log_verbose(L"Property may not be supported by device");
-          continue;
-        }
-
-        auto r = range.value();
-        if (g_flags.format == OutputFormat::JSON) {
-          if (!first)
-            std::wcout << L",";
-          std::wcout << L"{\"domain\":\"vid\",\"property\":\"" << prop_name
-                     << L"\",\"min\":" << r.min << L",\"max\":" << r.max
-                     << L",\"step\":" << r.step << L",\"default\":"
-                     << r.default_val << L",\"mode\":\""
-                     << duvc::to_wstring(r.default_mode) << L"\"}";
-          first = false;
-        } else {
-          std::wcout << prop_name << L": [" << r.min << L"," << r.max
-                     << L"] step=" << r.step << L" default=" << r.default_val
-                     << L" (" << duvc::to_wstring(r.default_mode) << L")\n";
-        }
+      if (!*range) {
+        log_error(L"Range not available for: " + prop_name);
+        log_verbose(L"Property may not be supported by device");
+        continue;
       }
+      emit(is_cam ? L"cam" : L"vid", prop_name, L"", range->value());
     }
   }
 
-  if (g_flags.format == OutputFormat::JSON) {
-    std::wcout << L"]}\n";
+  if (json_output() && document) {
+    out.end_array().end_object();
+  }
+  if (json_output()) {
+    write_output(out);
   }
 
   return 0;
@@ -1235,6 +1696,7 @@ static int cmd_monitor(const std::vector<const wchar_t *> &args) {
     bool is_cam = is_cam_domain(domain);
     std::optional<int> last_value;
     std::optional<CamMode> last_mode;
+    duvc::Serializer events(serial_format(true));
 
     if (g_flags.verbosity >= Verbosity::NORMAL &&
         g_flags.format == OutputFormat::TEXT) {
@@ -1258,10 +1720,14 @@ static int cmd_monitor(const std::vector<const wchar_t *> &args) {
             auto now = std::time(nullptr);
             auto tm = *std::localtime(&now);
 
-            if (g_flags.format == OutputFormat::JSON) {
-              std::wcout << L"{\"property\":\"" << prop_name << L"\",\"value\":"
-                         << v.value << L",\"mode\":\""
-                         << duvc::to_wstring(v.mode) << L"\"}\n";
+            if (json_output()) {
+              events.begin_object()
+                  .field("property", prop_name)
+                  .field("value", v.value)
+                  .field("mode", duvc::to_wstring(v.mode))
+                  .end_object();
+              write_output(events);
+              events.clear();
             } else {
               std::wcout << L"[" << std::put_time(&tm, L"%H:%M:%S") << L"] "
                          << prop_name << L"=" << v.value << L" ("
@@ -1290,10 +1756,14 @@ static int cmd_monitor(const std::vector<const wchar_t *> &args) {
             auto now = std::time(nullptr);
             auto tm = *std::localtime(&now);
 
-            if (g_flags.format == OutputFormat::JSON) {
-              std::wcout << L"{\"property\":\"" << prop_name << L"\",\"value\":"
-                         << v.value << L",\"mode\":\""
-                         << duvc::to_wstring(v.mode) << L"\"}\n";
+            if (json_output()) {
+              events.begin_object()
+                  .field("property", prop_name)
+                  .field("value", v.value)
+                  .field("mode", duvc::to_wstring(v.mode))
+                  .end_object();
+              write_output(events);
+              events.clear();
             } else {
               std::wcout << L"[" << std::put_time(&tm, L"%H:%M:%S") << L"] "
                          << prop_name << L"=" << v.value << L" ("
@@ -1333,6 +1803,447 @@ static int cmd_monitor(const std::vector<const wchar_t *> &args) {
   return 0;
 }
 
+static int cmd_play(const std::vector<const wchar_t *> &args) {
+  if (args.empty()) {
+    log_error(L"Usage: play <cue-file> [--lead MS] [--compile out.cue] "
+              L"[--store FILE]");
+    return 1;
+  }
+  std::wstring cue_file = args[0];
+  std::wstring compile_to;
+  std::filesystem::path store_path = duvc::default_preset_path();
+  duvc::TimelineOptions options;
+
+  for (size_t i = 1; i < args.size(); ++i) {
+    std::wstring arg = args[i];
+    if (arg == L"--lead" && i + 1 < args.size()) {
+      options.lead = std::chrono::milliseconds(std::max(0, _wtoi(args[++i])));
+    } else if (arg == L"--compile" && i + 1 < args.size()) {
+      compile_to = args[++i];
+    } else if (arg == L"--store" && i + 1 < args.size()) {
+      store_path = args[++i];
+    } else {
+      log_error(L"Unknown play option: " + arg);
+      return 1;
+    }
+  }
+
+  auto cues = duvc::load_cue_file(std::filesystem::path(cue_file));
+  if (!cues) {
+    log_error(L"Failed to load cue file");
+    log_verbose(duvc::to_wstring(cues.error().description()));
+    return 3;
+  }
+
+  if (!compile_to.empty()) {
+    auto bytes = duvc::serialize_cue_binary(cues.value());
+    std::ofstream out(std::filesystem::path(compile_to), std::ios::binary);
+    out.write(reinterpret_cast<const char *>(bytes.data()),
+              static_cast<std::streamsize>(bytes.size()));
+    if (!out) {
+      log_error(L"Failed to write: " + compile_to);
+      return 3;
+    }
+    if (g_flags.verbosity >= Verbosity::NORMAL &&
+        g_flags.format == OutputFormat::TEXT) {
+      std::wcout << L"Compiled " << cues.value().size() << L" cues ("
+                 << bytes.size() << L" bytes) to " << compile_to << L"\n";
+    }
+    return 0;
+  }
+
+  // Presets are only read when a cue recalls one
+  duvc::PresetStore store(store_path);
+  bool recalls = std::any_of(
+      cues.value().begin(), cues.value().end(),
+      [](const duvc::Cue &cue) { return cue.domain == duvc::CueDomain::Preset; });
+  if (recalls) {
+    auto loaded = store.load();
+    if (!loaded) {
+      log_error(L"Failed to load preset store");
+      log_verbose(duvc::to_wstring(loaded.error().description()));
+      return 3;
+    }
+  }
+
+  duvc::TimelinePlayer player(std::move(cues).value(), options);
+  auto prepared =
+      player.prepare(duvc::list_devices(), nullptr, store.presets());
+  if (!prepared) {
+    log_error(L"Failed to prepare timeline");
+    log_verbose(duvc::to_wstring(prepared.error().description()));
+    return 3;
+  }
+  if (g_flags.verbosity >= Verbosity::NORMAL &&
+      g_flags.format == OutputFormat::TEXT) {
+    std::wcout << L"Playing " << player.cues().size() << L" cues on "
+               << player.device_count() << L" device(s)\n";
+  }
+
+  auto played = player.play();
+  if (!played) {
+    log_error(L"Timeline playback failed");
+    log_verbose(duvc::to_wstring(played.error().description()));
+    return 4;
+  }
+  const auto &report = played.value();
+
+  auto property_name = [&](const duvc::Cue &cue) {
+    return cue.domain == duvc::CueDomain::Camera
+               ? std::wstring(duvc::to_wstring(cue.cam_prop))
+               : std::wstring(duvc::to_wstring(cue.vid_prop));
+  };
+  auto describe_cue = [&](const duvc::Cue &cue) {
+    if (cue.domain == duvc::CueDomain::Preset) {
+      return L"preset " + duvc::to_wstring(cue.preset);
+    }
+    return property_name(cue) + L"=" + std::to_wstring(cue.setting.value);
+  };
+
+  if (json_output()) {
+    // Records are the cues alone; a document adds the run's summary
+    duvc::Serializer out(serial_format());
+    bool document = !record_output();
+    if (document) {
+      out.begin_object().key("cues").begin_array();
+    }
+    for (const auto &r : report.cues) {
+      const auto &cue = player.cues()[r.index];
+      out.begin_object().field("index", r.index);
+      if (cue.domain == duvc::CueDomain::Preset) {
+        out.field("preset", cue.preset);
+      } else {
+        out.field("property", property_name(cue)).field("value", cue.setting.value);
+      }
+      out.field("planned_us", r.planned.count())
+          .field("fired_us", r.fired.count())
+          .field("completed_us", r.completed.count())
+          .field("ok", !r.error);
+      if (r.error) {
+        out.field("error", r.error->description());
+      }
+      out.end_object();
+    }
+    if (document) {
+      out.end_array()
+          .field("failures", report.failures)
+          .field("lateness_avg_us", report.lateness_avg.count())
+          .field("lateness_max_us", report.lateness_max.count())
+          .field("cancelled", report.cancelled)
+          .end_object();
+    }
+    write_output(out);
+  } else if (g_flags.verbosity >= Verbosity::NORMAL) {
+    for (const auto &r : report.cues) {
+      const auto &cue = player.cues()[r.index];
+      std::wcout << L"  #" << r.index << L" " << std::fixed
+                 << std::setprecision(6) << (r.planned.count() / 1e6)
+                 << L"s " << describe_cue(cue)
+                 << L"  fired " << std::showpos << r.lateness().count()
+                 << std::noshowpos << L"us";
+      if (r.error) {
+        std::wcout << L"  FAILED: "
+                   << duvc::to_wstring(r.error->description());
+      }
+      std::wcout << L"\n";
+    }
+    std::wcout << report.cues.size() << L" cues fired, " << report.failures
+               << L" failed; lateness avg " << report.lateness_avg.count()
+               << L"us, max " << report.lateness_max.count() << L"us\n";
+  }
+
+  return report.failures > 0 ? 4 : 0;
+}
+
+static int cmd_preset(const std::vector<const wchar_t *> &args) {
+  const wchar_t *usage =
+      L"Usage: preset save <index> <name> | recall <index> <name> | list | "
+      L"delete <name> [--store FILE]";
+  std::vector<std::wstring> positional;
+  std::filesystem::path store_path = duvc::default_preset_path();
+  for (size_t i = 0; i < args.size(); ++i) {
+    std::wstring arg = args[i];
+    if (arg == L"--store" && i + 1 < args.size()) {
+      store_path = std::filesystem::path(std::wstring(args[++i]));
+    } else {
+      positional.push_back(arg);
+    }
+  }
+  if (positional.empty()) {
+    log_error(usage);
+    return 1;
+  }
+
+  duvc::PresetStore store(store_path);
+  auto loaded = store.load();
+  if (!loaded) {
+    log_error(L"Failed to load preset store");
+    log_verbose(duvc::to_wstring(loaded.error().description()));
+    return 3;
+  }
+
+  const std::wstring &action = positional[0];
+  if (_wcsicmp(action.c_str(), L"list") == 0) {
+    if (json_output()) {
+      duvc::Serializer out(serial_format());
+      bool document = !record_output();
+      if (document) {
+        out.begin_array();
+      }
+      for (const auto &p : store.presets()) {
+        out.begin_object()
+            .field("name", p.name)
+            .field("version", p.version)
+            .field("values", p.values.size())
+            .end_object();
+      }
+      if (document) {
+        out.end_array();
+      }
+      write_output(out);
+    } else {
+      for (const auto &p : store.presets()) {
+        std::wcout << duvc::to_wstring(p.name) << L" (v" << p.version << L", "
+                   << p.values.size() << L" values)\n";
+      }
+    }
+    return 0;
+  }
+
+  if (_wcsicmp(action.c_str(), L"delete") == 0) {
+    if (positional.size() < 2) {
+      log_error(usage);
+      return 1;
+    }
+    if (!store.remove(duvc::to_utf8(positional[1]))) {
+      log_error(L"Preset not found: " + positional[1]);
+      return 3;
+    }
+    auto saved = store.save();
+    if (!saved) {
+      log_error(L"Failed to save preset store");
+      log_verbose(duvc::to_wstring(saved.error().description()));
+      return 4;
+    }
+    return 0;
+  }
+
+  bool save = _wcsicmp(action.c_str(), L"save") == 0;
+  bool recall = _wcsicmp(action.c_str(), L"recall") == 0;
+  if ((!save && !recall) || positional.size() < 3) {
+    log_error(usage);
+    return 1;
+  }
+
+  auto devices = duvc::list_devices();
+  int index = _wtoi(positional[1].c_str());
+  if (index < 0 || index >= static_cast<int>(devices.size())) {
+    log_error(L"Invalid device index");
+    return 2;
+  }
+  std::string name = duvc::to_utf8(positional[2]);
+
+  if (recall && !store.find(name)) {
+    log_error(L"Preset not found: " + positional[2]);
+    return 3;
+  }
+
+  auto cam_res = duvc::open_camera(devices[index]);
+  if (!cam_res) {
+    log_error(L"Failed to open camera");
+    log_verbose(L"Camera open failed for device " + std::to_wstring(index));
+    return 3;
+  }
+  Camera cam = std::move(cam_res).value();
+  duvc::PresetRecaller recaller(cam);
+
+  if (save) {
+    const auto &stored = store.put(recaller.capture(name));
+    auto saved = store.save();
+    if (!saved) {
+      log_error(L"Failed to save preset store");
+      log_verbose(duvc::to_wstring(saved.error().description()));
+      return 4;
+    }
+    if (json_output()) {
+      duvc::Serializer out(serial_format());
+      out.begin_object()
+          .field("name", stored.name)
+          .field("version", stored.version)
+          .field("values", stored.values.size())
+          .end_object();
+      write_output(out);
+    } else if (g_flags.verbosity >= Verbosity::NORMAL) {
+      std::wcout << L"Saved preset " << positional[2] << L" (v"
+                 << stored.version << L", " << stored.values.size()
+                 << L" values)\n";
+    }
+    return 0;
+  }
+
+  auto report = recaller.recall(*store.find(name));
+  for (const auto &entry : report.entries) {
+    if (entry.error) {
+      const auto &v = entry.value;
+      log_error(std::wstring(L"Failed to set: ") +
+                (v.video ? duvc::to_wstring(v.vid_prop)
+                         : duvc::to_wstring(v.cam_prop)));
+      log_verbose(duvc::to_wstring(entry.error->description()));
+    }
+  }
+  if (json_output()) {
+    duvc::Serializer out(serial_format());
+    out.begin_object()
+        .field("writes", report.writes)
+        .field("skipped", report.skipped)
+        .field("failed", report.failed)
+        .field("unsupported", report.unsupported)
+        .field("compile_us", report.compile_time.count())
+        .field("write_us", report.write_time.count())
+        .end_object();
+    write_output(out);
+  } else if (g_flags.verbosity >= Verbosity::NORMAL) {
+    std::wcout << L"Recalled " << positional[2] << L": " << report.writes
+               << L" written, " << report.skipped << L" unchanged";
+    if (report.unsupported) {
+      std::wcout << L", " << report.unsupported << L" unsupported";
+    }
+    std::wcout << L" in "
+               << (report.compile_time + report.write_time).count() / 1000.0
+               << L" ms\n";
+  }
+  return report.failed ? 4 : 0;
+}
+
+static int cmd_reconcile(const std::vector<const wchar_t *> &args) {
+  if (args.empty()) {
+    log_error(L"Usage: reconcile <state.json> [--once | --sweeps N]");
+    return 1;
+  }
+  std::wstring state_file = args[0];
+  int sweeps = 0; // 0: until interrupted
+  bool once = false;
+  for (size_t i = 1; i < args.size(); ++i) {
+    std::wstring arg = args[i];
+    if (arg == L"--once") {
+      once = true;
+    } else if (arg == L"--sweeps" && i + 1 < args.size()) {
+      sweeps = std::max(1, _wtoi(args[++i]));
+    } else {
+      log_error(L"Unknown reconcile option: " + arg);
+      return 1;
+    }
+  }
+
+  auto state = duvc::load_desired_state(std::filesystem::path(state_file));
+  if (!state) {
+    log_error(L"Failed to load desired state");
+    log_verbose(duvc::to_wstring(state.error().description()));
+    return 3;
+  }
+
+  // Guarded by output_mutex; one serializer so CSV writes its header once
+  std::mutex output_mutex;
+  duvc::Serializer events(serial_format(true));
+  auto property_name = [](const duvc::PresetValue &v) {
+    return v.video ? std::wstring(duvc::to_wstring(v.vid_prop))
+                   : std::wstring(duvc::to_wstring(v.cam_prop));
+  };
+  auto on_drift = [&](const duvc::DriftEvent &e) {
+    std::lock_guard<std::mutex> lock(output_mutex);
+    if (json_output()) {
+      events.begin_object()
+          .field("event", "drift")
+          .field("device", e.device.name)
+          .field("property", property_name(e.desired))
+          .field("desired", e.desired.setting.value);
+      if (e.actual) {
+        events.field("actual", e.actual->value);
+      }
+      events.field("corrected", e.corrected)
+          .field("latency_us", e.latency.count())
+          .end_object();
+      write_output(events);
+      events.clear();
+    } else if (g_flags.verbosity >= Verbosity::NORMAL) {
+      std::wcout << L"  " << e.device.name << L" " << property_name(e.desired)
+                 << L": ";
+      if (e.actual) {
+        std::wcout << e.actual->value
+                   << (e.actual->mode == CamMode::Auto ? L" (auto)" : L"");
+      } else {
+        std::wcout << L"?";
+      }
+      std::wcout << L" -> "
+                 << (e.desired.setting.mode == CamMode::Auto
+                         ? std::wstring(L"auto")
+                         : std::to_wstring(e.desired.setting.value));
+      if (!e.corrected && e.error) {
+        std::wcout << L"  FAILED: " << duvc::to_wstring(e.error->description());
+      }
+      std::wcout << L"\n";
+    }
+  };
+
+  int done = 0;
+  bool failed = false;
+  std::condition_variable finished;
+  auto on_sweep = [&](const duvc::SweepReport &r) {
+    std::lock_guard<std::mutex> lock(output_mutex);
+    if (json_output()) {
+      events.begin_object()
+          .field("event", "sweep")
+          .field("devices", r.devices)
+          .field("reads", r.reads)
+          .field("writes", r.writes)
+          .field("drifted", r.drifted)
+          .field("failures", r.failures)
+          .field("converged", r.converged)
+          .field("duration_us", r.duration.count())
+          .end_object();
+      write_output(events);
+      events.clear();
+    } else if (g_flags.verbosity >= Verbosity::NORMAL) {
+      std::wcout << L"Swept " << r.devices << L" device(s): " << r.drifted
+                 << L" drifted, " << r.writes << L" corrected, " << r.failures
+                 << L" failed in " << r.duration.count() / 1000 << L" ms\n";
+    }
+    std::wcout.flush();
+    failed = r.failures > 0;
+    ++done;
+    finished.notify_all();
+  };
+
+  duvc::Reconciler reconciler(std::move(state).value());
+  if (once) {
+    on_sweep(reconciler.sweep(on_drift));
+    return failed ? 4 : 0;
+  }
+
+  if (g_flags.verbosity >= Verbosity::NORMAL &&
+      g_flags.format == OutputFormat::TEXT) {
+    std::wcout << L"Reconciling "
+               << (sweeps ? std::to_wstring(sweeps) + L" sweep(s)"
+                          : std::wstring(L"until Ctrl+C"))
+               << L"\n";
+  }
+  reconciler.start(on_drift, on_sweep);
+  {
+    std::unique_lock<std::mutex> lock(output_mutex);
+    finished.wait(lock, [&] { return sweeps > 0 && done >= sweeps; });
+  }
+  reconciler.stop();
+
+  auto stats = reconciler.stats();
+  if (g_flags.verbosity >= Verbosity::NORMAL &&
+      g_flags.format == OutputFormat::TEXT) {
+    std::wcout << stats.drift_events << L" drift event(s), " << stats.writes
+               << L" correction(s); last convergence took "
+               << stats.last_convergence_time.count() / 1000 << L" ms\n";
+  }
+  return failed ? 4 : 0;
+}
+
 static void print_usage() {
   std::wcout
       << L"duvc-cli - DirectShow UVC camera control\n\n"
@@ -1342,6 +2253,10 @@ static void print_usage() {
       << L"  -v, --verbose         Verbose output with detailed errors\n"
       << L"  -q, --quiet           Minimal output (errors only)\n"
       << L"  -j, --json            Output in JSON format\n"
+      << L"  --format FORMAT       text, json, jsonl, csv or msgpack; list,\n"
+      << L"                        snapshot, capabilities, range and monitor\n"
+      << L"                        write one record per item for jsonl, csv\n"
+      << L"                        and msgpack, other commands print JSON\n"
       << L"  -h, --help            Show this help\n\n"
       << L" --version              Show version information\n\n"
       << L"Commands:\n"
@@ -1356,16 +2271,29 @@ static void print_usage() {
       << L"  range <index> <domain> <prop>[,<prop>...|all]  Show ranges\n"
       << L"  reset <index> <domain> <prop>[,<prop>...|all]  Reset defaults\n"
       << L"  reset <index> all     Reset all properties\n"
-      << L"  snapshot <index> [-o file]  Dump all values\n"
-      << L"  capabilities <index>  Show all properties\n"
+      << L"  snapshot <index|--all> [-o file]  Dump all values\n"
+      << L"  capabilities <index|all>  Show all properties\n"
       << L"  status <index>        Check connection\n"
       << L"  monitor [seconds]     Monitor device changes\n"
       << L"  monitor <index> <domain> <prop> [--interval=N]  Monitor property\n"
+      << L"  play <cue-file> [--lead MS] [--compile out.cue] [--store FILE]  "
+         L"Play a timed cue list (JSON or binary; preset cues read --store)\n"
+      << L"  preset save|recall <index> <name>  Store or recall current "
+         L"values\n"
+      << L"  preset list | preset delete <name>  Manage stored presets "
+         L"(--store FILE)\n"
+      << L"  reconcile <state.json> [--once|--sweeps N]  Hold cameras at a "
+         L"desired state\n"
+      << L"\nMulti-device probing (list --detailed, capabilities, snapshot):\n"
+      << L"  --jobs N              Probe up to N devices concurrently\n"
+      << L"  --timeout MS          Give up on a device after MS milliseconds "
+         L"(default 10000, 0 = no limit)\n"
       << L"\nDomains: cam (camera) | vid (video)\n\n"
       << L"Relative Values:\n"
       << L"  Use --relative or -r flag with set command for relative changes:\n"
       << L"  duvc-cli set --relative 0 cam Exposure +2   # Increase by 2\n"
-      << L"  duvc-cli set -r 0 cam Exposure -3           # Decrease by 3\n\n"
+      << L"  duvc-cli set -r 0 cam Exposure -3           # Decrease by 3\n"
+      << L"  Relative changes stop at the ends of the property's range.\n\n"
       << L"Camera Properties:\n"
       << L"  Pan, Tilt, Roll, Zoom, Exposure, Iris, Focus, ScanMode, Privacy,\n"
       << L"  PanRelative, TiltRelative, RollRelative, ZoomRelative, ExposureRelative, IrisRelative, FocusRelative,\n"
@@ -1377,6 +2305,7 @@ static void print_usage() {
       << L"  DigitalMultiplier, DigitalMultiplierLimit, WhiteBalanceComponent, PowerLineFrequency\n\n"
       << L"Examples:\n"
       << L"  duvc-cli list --detailed\n"
+      << L"  duvc-cli list --detailed --jobs 4 --timeout 3000\n"
       << L"  duvc-cli get 0 cam Pan,Tilt,Zoom --json\n"
       << L"  duvc-cli set 0 cam Exposure -6              # Absolute: set to "
          L"-6\n"
@@ -1387,16 +2316,26 @@ static void print_usage() {
       << L"  duvc-cli set 0 cam Focus auto\n"
       << L"  duvc-cli reset 0 cam all\n"
       << L"  duvc-cli snapshot 0 -o backup.json --json\n"
-      << L"  duvc-cli monitor 0 cam Exposure --interval=2 --verbose\n";
+      << L"  duvc-cli monitor 0 cam Exposure --interval=2 --verbose\n"
+      << L"  duvc-cli play cues.json\n"
+      << L"  duvc-cli preset save 0 podium\n"
+      << L"  duvc-cli preset recall 0 podium --json\n"
+      << L"  duvc-cli reconcile fleet.json --once\n";
 }
 
 int main(int argc, char **argv) {
+  // Never destroyed: the standard streams flush it at exit
+  std::wcout.rdbuf(new Utf8StdoutBuffer());
+#ifdef _WIN32
+  SetConsoleOutputCP(CP_UTF8);
+#endif
+
   auto wargs = convert_args(argc, argv);
   std::vector<const wchar_t *> wargv;
   for (const auto &a : wargs)
     wargv.push_back(a.c_str());
 
-  if (argc < 2) {
+  if (wargv.size() < 2) {
     print_usage();
     return 1;
   }
@@ -1414,6 +2353,29 @@ int main(int argc, char **argv) {
     } else if (arg == L"-j" || arg == L"--json") {
       g_flags.format = OutputFormat::JSON;
       cmd_start++;
+    } else if (arg == L"--format" || starts_with(arg, L"--format=")) {
+      std::wstring name;
+      if (arg.size() > 8) {
+        name = arg.substr(9);
+      } else if (i + 1 < wargv.size()) {
+        name = wargv[++i];
+        cmd_start++;
+      }
+      cmd_start++;
+      if (name == L"text") {
+        g_flags.format = OutputFormat::TEXT;
+      } else if (name == L"json") {
+        g_flags.format = OutputFormat::JSON;
+      } else if (name == L"jsonl") {
+        g_flags.format = OutputFormat::JSONL;
+      } else if (name == L"csv") {
+        g_flags.format = OutputFormat::CSV;
+      } else if (name == L"msgpack") {
+        g_flags.format = OutputFormat::MSGPACK;
+      } else {
+        log_error(L"Unknown output format: " + name);
+        return 1;
+      }
     } else if (arg == L"-h" || arg == L"--help") {
       print_usage();
       return 0;
@@ -1450,11 +2412,14 @@ int main(int argc, char **argv) {
     }
     bool connected = duvc::is_device_connected(devices[index]);
 
-    if (g_flags.format == OutputFormat::JSON) {
-      std::wcout << L"{\"index\":" << index << L",\"name\":\""
-                 << json_escape(devices[index].name) << L"\""
-                 << L",\"connected\":" << (connected ? L"true" : L"false")
-                 << L"}\n";
+    if (json_output()) {
+      duvc::Serializer out(serial_format());
+      out.begin_object()
+          .field("index", index)
+          .field("name", devices[index].name)
+          .field("connected", connected)
+          .end_object();
+      write_output(out);
     } else {
       std::wcout << devices[index].name << L": "
                  << (connected ? L"CONNECTED" : L"DISCONNECTED") << L"\n";
@@ -1467,106 +2432,34 @@ int main(int argc, char **argv) {
         wargv.begin() + cmd_start + 1, wargv.end()));
   }
 
+  if (_wcsicmp(cmd.c_str(), L"play") == 0) {
+    return cmd_play(std::vector<const wchar_t *>(wargv.begin() + cmd_start + 1,
+                                                 wargv.end()));
+  }
+
+  if (_wcsicmp(cmd.c_str(), L"preset") == 0) {
+    return cmd_preset(std::vector<const wchar_t *>(
+        wargv.begin() + cmd_start + 1, wargv.end()));
+  }
+
+  if (_wcsicmp(cmd.c_str(), L"reconcile") == 0) {
+    return cmd_reconcile(std::vector<const wchar_t *>(
+        wargv.begin() + cmd_start + 1, wargv.end()));
+  }
+
   if (_wcsicmp(cmd.c_str(), L"capabilities") == 0) {
     if (wargv.size() < cmd_start + 2) {
-      log_error(L"Usage: capabilities <index>");
+      log_error(L"Usage: capabilities <index|all> [--jobs N] [--timeout MS]");
       return 1;
     }
-    int index = _wtoi(wargv[cmd_start + 1]);
+    std::wstring target = wargv[cmd_start + 1];
+    bool all = target == L"all" || target == L"--all";
+    int index = all ? -1 : _wtoi(target.c_str());
     auto devices = duvc::list_devices();
-    if (index < 0 || index >= static_cast<int>(devices.size())) {
-      log_error(L"Invalid device index");
-      return 2;
-    }
-
-    auto cam_res = duvc::open_camera(devices[index]);
-    if (!cam_res) {
-      log_error(L"Failed to open camera");
-      log_verbose(L"Camera open failed for device " + std::to_wstring(index));
-      return 3;
-    }
-    Camera cam = std::move(cam_res).value();
-
-    if (g_flags.verbosity >= Verbosity::NORMAL &&
-        g_flags.format == OutputFormat::TEXT) {
-      std::wcout << L"Capabilities: " << devices[index].name << L"\n";
-    }
-
-    if (g_flags.format == OutputFormat::JSON) {
-      std::wcout << L"{\"device\":" << index << L",\"capabilities\":[";
-    }
 
-    bool first = true;
-
-    for (auto &m : CAM_PROP_MAP) {
-      auto rr = cam.get_range(m.prop);
-      if (!rr)
-        continue;
-      auto r = rr.value();
-
-      int curVal = 0;
-      CamMode curMode = r.default_mode;
-      auto gv = cam.get(m.prop);
-      if (gv) {
-        auto v = gv.value();
-        curVal = v.value;
-        curMode = v.mode;
-      }
-
-      if (g_flags.format == OutputFormat::JSON) {
-        if (!first)
-          std::wcout << L",";
-        std::wcout << L"{\"domain\":\"cam\",\"property\":\"" << m.name
-                   << L"\",\"min\":" << r.min << L",\"max\":" << r.max
-                   << L",\"step\":" << r.step << L",\"default\":"
-                   << r.default_val << L",\"current\":" << curVal
-                   << L",\"mode\":\"" << duvc::to_wstring(curMode) << L"\"}";
-        first = false;
-      } else {
-        std::wcout << L"  CAM " << m.name << L": [" << r.min << L"," << r.max
-                   << L"] step=" << r.step << L" default=" << r.default_val
-                   << L" current=" << curVal << L" ("
-                   << duvc::to_wstring(curMode) << L")\n";
-      }
-    }
-
-    for (auto &m : VID_PROP_MAP) {
-      auto rr = cam.get_range(m.prop);
-      if (!rr)
-        continue;
-      auto r = rr.value();
-
-      int curVal = 0;
-      CamMode curMode = r.default_mode;
-      auto gv = cam.get(m.prop);
-      if (gv) {
-        auto v = gv.value();
-        curVal = v.value;
-        curMode = v.mode;
-      }
-
-      if (g_flags.format == OutputFormat::JSON) {
-        if (!first)
-          std::wcout << L",";
-        std::wcout << L"{\"domain\":\"vid\",\"property\":\"" << m.name
-                   << L"\",\"min\":" << r.min << L",\"max\":" << r.max
-                   << L",\"step\":" << r.step << L",\"default\":"
-                   << r.default_val << L",\"current\":" << curVal
-                   << L",\"mode\":\"" << duvc::to_wstring(curMode) << L"\"}";
-        first = false;
-      } else {
-        std::wcout << L"  VID " << m.name << L": [" << r.min << L"," << r.max
-                   << L"] step=" << r.step << L" default=" << r.default_val
-                   << L" current=" << curVal << L" ("
-                   << duvc::to_wstring(curMode) << L")\n";
-      }
-    }
-
-    if (g_flags.format == OutputFormat::JSON) {
-      std::wcout << L"]}\n";
-    }
-
-    return 0;
+    return cmd_capabilities(index, all, devices,
+                            std::vector<const wchar_t *>(
+                                wargv.begin() + cmd_start + 2, wargv.end()));
   }
 
   if (_wcsicmp(cmd.c_str(), L"get") == 0) {
@@ -1735,13 +2628,15 @@ int main(int argc, char **argv) {
 
   if (_wcsicmp(cmd.c_str(), L"snapshot") == 0) {
     if (wargv.size() < cmd_start + 2) {
-      log_error(L"Usage: snapshot <index> [-o file]");
+      log_error(L"Usage: snapshot <index|--all> [-o file]");
       return 1;
     }
-    int index = _wtoi(wargv[cmd_start + 1]);
+    std::wstring target = wargv[cmd_start + 1];
+    bool all = target == L"all" || target == L"--all";
+    int index = all ? -1 : _wtoi(target.c_str());
     auto devices = duvc::list_devices();
 
-    return cmd_snapshot(index, devices,
+    return cmd_snapshot(index, all, devices,
                         std::vector<const wchar_t *>(
                             wargv.begin() + cmd_start + 2, wargv.end()));
   }
@@ -160,6 +160,81 @@ typedef struct {
   size_t data_size;           /**< Size of data in bytes */
 } duvc_vendor_property_t;
 
+/**
+ * @brief Circuit breaker states
+ */
+typedef enum {
+  DUVC_CIRCUIT_CLOSED = 0, /**< Normal operation */
+  DUVC_CIRCUIT_OPEN,       /**< Failing fast after repeated device failures */
+  DUVC_CIRCUIT_HALF_OPEN   /**< Letting probe calls through */
+} duvc_circuit_state_t;
+
+/**
+ * @brief Per-device retry and circuit breaker policy
+ */
+typedef struct {
+  int enabled;                 /**< 0 disables retries and the breaker */
+  uint32_t max_attempts;       /**< Total attempts including the first */
+  uint32_t initial_backoff_ms; /**< Delay before the first retry */
+  uint32_t max_backoff_ms;     /**< Upper bound for retry delays */
+  double backoff_multiplier;   /**< Backoff growth factor per retry */
+  double jitter;               /**< Randomized fraction of each delay [0,1] */
+  uint32_t failure_threshold;  /**< Consecutive failures before opening */
+  uint32_t open_duration_ms;   /**< Fail-fast period once open */
+  uint32_t half_open_probes;   /**< Concurrent probes allowed when half-open */
+} duvc_policy_t;
+
+/**
+ * @brief Retry and circuit breaker counters for a device
+ */
+typedef struct {
+  uint64_t attempts;             /**< Operations sent to the device */
+  uint64_t successes;            /**< Attempts that succeeded */
+  uint64_t failures;             /**< Attempts that failed with device errors */
+  uint64_t retries;              /**< Attempts that were retries */
+  uint64_t short_circuited;      /**< Calls rejected by the open breaker */
+  uint64_t trips;                /**< Times the breaker opened */
+  uint32_t consecutive_failures; /**< Current failure streak */
+  duvc_circuit_state_t state;    /**< Current breaker state */
+} duvc_policy_stats_t;
+
+/**
+ * @brief Encodings for exported data
+ */
+typedef enum {
+  DUVC_FORMAT_JSON = 0,    /**< One JSON document */
+  DUVC_FORMAT_JSON_LINES,  /**< One JSON record per line */
+  DUVC_FORMAT_CSV,         /**< Header row, then one row per record */
+  DUVC_FORMAT_MSGPACK      /**< MessagePack (binary) */
+} duvc_output_format_t;
+
+/**
+ * @brief Identity fields parsed from a device path
+ */
+typedef struct {
+  char bus[16];              /**< Bus enumerator, lower case ("" if unknown) */
+  int has_usb_ids;           /**< 1 if vid and pid are valid */
+  uint16_t vid;              /**< USB vendor ID */
+  uint16_t pid;              /**< USB product ID */
+  int32_t interface_number;  /**< Composite interface (MI_xx), or -1 */
+  int has_serial;            /**< 1 if the instance ID is a serial number */
+  char interface_guid[39];   /**< Interface class GUID, lower case ("" if
+                                none) */
+  uint64_t key_hash;         /**< Hash of the path-form-independent key */
+} duvc_device_identity_t;
+
+/**
+ * @brief Outcome of a preset recall
+ */
+typedef struct {
+  int32_t writes;       /**< Properties written */
+  int32_t skipped;      /**< Properties already holding the preset value */
+  int32_t failed;       /**< Writes that returned an error */
+  int32_t unsupported;  /**< Preset values the device cannot take */
+  uint64_t compile_us;  /**< Time spent planning the recall */
+  uint64_t write_us;    /**< Time spent writing */
+} duvc_preset_recall_report_t;
+
 /**
  * @brief Opaque device handle
  */
@@ -407,6 +482,56 @@ duvc_result_t duvc_get_device_id(const duvc_device_t *device, char *buffer,
  */
 duvc_result_t duvc_device_is_valid(const duvc_device_t *device, int *valid);
 
+/**
+ * @brief Parse device identity from the device path
+ * @param device Device to query
+ * @param[out] identity Receives bus, VID/PID, interface and GUID
+ * @return DUVC_SUCCESS on success, error code on failure
+ *
+ * Fields the path does not carry are zero or empty.
+ */
+duvc_result_t duvc_get_device_identity(const duvc_device_t *device,
+                                       duvc_device_identity_t *identity);
+
+/**
+ * @brief Get device serial number
+ * @param device Device to query
+ * @param[out] buffer Buffer to receive serial (empty if the path has none)
+ * @param buffer_size Size of buffer in bytes
+ * @param[out] required Required buffer size (including null terminator)
+ * @return DUVC_SUCCESS on success, DUVC_ERROR_BUFFER_TOO_SMALL if buffer too
+ * small
+ */
+duvc_result_t duvc_get_device_serial(const duvc_device_t *device, char *buffer,
+                                     size_t buffer_size, size_t *required);
+
+/**
+ * @brief Find device by serial number
+ * @param serial_utf8 Serial number (case-insensitive)
+ * @param[out] device Matching device
+ * @return DUVC_SUCCESS, or DUVC_ERROR_DEVICE_NOT_FOUND if no device from the
+ * last duvc_list_devices() call has that serial
+ *
+ * Constant-time lookup in the index built by duvc_list_devices().
+ */
+duvc_result_t duvc_find_device_by_serial(const char *serial_utf8,
+                                         duvc_device_t **device);
+
+/**
+ * @brief Find devices by USB vendor and product ID
+ * @param vid Vendor ID
+ * @param pid Product ID
+ * @param[out] devices Array of matching devices (free with
+ * duvc_free_device_list())
+ * @param[out] count Number of matching devices (may be 0)
+ * @return DUVC_SUCCESS on success, error code on failure
+ *
+ * Searches the devices from the last duvc_list_devices() call.
+ */
+duvc_result_t duvc_find_devices_by_usb_id(uint16_t vid, uint16_t pid,
+                                          duvc_device_t ***devices,
+                                          size_t *count);
+
 /* ========================================================================
  * Device Change Monitoring
  * ======================================================================== */
@@ -460,6 +585,140 @@ void duvc_close_camera(duvc_connection_t *conn);
  */
 int duvc_camera_is_valid(const duvc_connection_t *conn);
 
+/**
+ * @brief Set the per-operation deadline for a connection
+ * @param conn Camera connection
+ * @param timeout_ms Maximum time to wait for the device in milliseconds
+ * (0 waits indefinitely)
+ * @return DUVC_SUCCESS on success, error code on failure
+ * @note Operations that miss the deadline return DUVC_ERROR_DEVICE_BUSY.
+ * While the timed-out call is still stuck in the driver, further operations
+ * on the same device fail immediately with DUVC_ERROR_DEVICE_BUSY.
+ */
+duvc_result_t duvc_set_operation_timeout(duvc_connection_t *conn,
+                                         uint32_t timeout_ms);
+
+/**
+ * @brief Get the per-operation deadline for a connection
+ * @param conn Camera connection
+ * @param[out] timeout_ms Current deadline in milliseconds (0 = none)
+ * @return DUVC_SUCCESS on success, error code on failure
+ */
+duvc_result_t duvc_get_operation_timeout(const duvc_connection_t *conn,
+                                         uint32_t *timeout_ms);
+
+/* ========================================================================
+ * Retry and Circuit Breaker Policy
+ * ======================================================================== */
+/**
+ * @brief Get the policy applied to newly opened cameras
+ * @param[out] policy Default policy
+ * @return DUVC_SUCCESS on success, error code on failure
+ */
+duvc_result_t duvc_get_default_policy(duvc_policy_t *policy);
+
+/**
+ * @brief Set the policy applied to newly opened cameras
+ * @param policy Policy to use for devices opened from now on
+ * @return DUVC_SUCCESS on success, error code on failure
+ */
+duvc_result_t duvc_set_default_policy(const duvc_policy_t *policy);
+
+/**
+ * @brief Set the retry and circuit breaker policy for a connection's device
+ * @param conn Camera connection
+ * @param policy Policy to apply
+ * @return DUVC_SUCCESS on success, error code on failure
+ * @note The policy belongs to the device and affects every connection to it
+ */
+duvc_result_t duvc_set_connection_policy(duvc_connection_t *conn,
+                                         const duvc_policy_t *policy);
+
+/**
+ * @brief Get the retry and circuit breaker policy for a connection's device
+ * @param conn Camera connection
+ * @param[out] policy Current policy
+ * @return DUVC_SUCCESS on success, error code on failure
+ */
+duvc_result_t duvc_get_connection_policy(const duvc_connection_t *conn,
+                                         duvc_policy_t *policy);
+
+/**
+ * @brief Get retry and circuit breaker counters for a connection's device
+ * @param conn Camera connection
+ * @param[out] stats Policy statistics
+ * @return DUVC_SUCCESS on success, error code on failure
+ */
+duvc_result_t duvc_get_policy_stats(const duvc_connection_t *conn,
+                                    duvc_policy_stats_t *stats);
+
+/**
+ * @brief Export a connection's policy counters as one record
+ * @param conn Camera connection
+ * @param format Output encoding
+ * @param[out] buffer Buffer to receive the encoded record (null-terminated)
+ * @param buffer_size Size of buffer in bytes
+ * @param[out] required_size Required buffer size (including null terminator)
+ * @return DUVC_SUCCESS on success, DUVC_ERROR_BUFFER_TOO_SMALL if buffer too
+ * small
+ * @note The record has the fields of duvc_policy_stats_t, with the breaker
+ * state as a string. MessagePack output may contain zero bytes; its length
+ * is *required_size - 1.
+ */
+duvc_result_t duvc_export_policy_stats(const duvc_connection_t *conn,
+                                       duvc_output_format_t format,
+                                       char *buffer, size_t buffer_size,
+                                       size_t *required_size);
+
+/* ========================================================================
+ * Presets
+ * ======================================================================== */
+/**
+ * @brief Capture a connection's current property values as a stored preset
+ * @param conn Camera connection
+ * @param store_path UTF-8 preset store path, or NULL for the default store
+ * @param name UTF-8 preset name; an existing preset is replaced
+ * @param[out] version Stored preset version (can be NULL)
+ * @return DUVC_SUCCESS on success, error code on failure
+ */
+duvc_result_t duvc_preset_save(duvc_connection_t *conn, const char *store_path,
+                               const char *name, uint32_t *version);
+
+/**
+ * @brief Recall a stored preset on a connection
+ * @param conn Camera connection
+ * @param store_path UTF-8 preset store path, or NULL for the default store
+ * @param name UTF-8 preset name
+ * @param[out] report Recall outcome (can be NULL)
+ * @return DUVC_SUCCESS if every write succeeded, DUVC_ERROR_DEVICE_NOT_FOUND
+ * if the preset is not stored, or the first write error
+ * @note Each connection remembers the values it last wrote, so recalling one
+ * preset after another only writes the properties that differ
+ */
+duvc_result_t duvc_preset_recall(duvc_connection_t *conn,
+                                 const char *store_path, const char *name,
+                                 duvc_preset_recall_report_t *report);
+
+/**
+ * @brief Delete a stored preset
+ * @param store_path UTF-8 preset store path, or NULL for the default store
+ * @param name UTF-8 preset name
+ * @return DUVC_SUCCESS on success, DUVC_ERROR_DEVICE_NOT_FOUND if not stored
+ */
+duvc_result_t duvc_preset_delete(const char *store_path, const char *name);
+
+/**
+ * @brief List stored preset names
+ * @param store_path UTF-8 preset store path, or NULL for the default store
+ * @param[out] buffer Buffer for newline-separated names (can be NULL)
+ * @param buffer_size Size of buffer
+ * @param[out] required Required buffer size including null terminator
+ * @return DUVC_SUCCESS on success, DUVC_ERROR_BUFFER_TOO_SMALL if buffer is
+ * too small
+ */
+duvc_result_t duvc_preset_list(const char *store_path, char *buffer,
+                               size_t buffer_size, size_t *required);
+
 /* ========================================================================
  * Property Access - Single Properties
  * ======================================================================== */
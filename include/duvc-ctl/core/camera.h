@@ -5,20 +5,33 @@
  * @brief RAII camera handle for simplified device management
  */
 
+#include <duvc-ctl/core/device_registry.h>
+#include <duvc-ctl/core/policy.h>
 #include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/settle.h>
 #include <duvc-ctl/core/types.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
 #include <memory>
 
 namespace duvc {
 
 // Forward declaration
-class DeviceConnection;
+class DeviceActor;
+
+/// Default deadline for a single camera operation
+inline constexpr std::chrono::milliseconds DEFAULT_OPERATION_TIMEOUT{5000};
 
 /**
  * @brief RAII camera handle for simplified device management
  *
  * This class provides a high-level interface for camera control,
  * automatically managing device connections and providing a clean API.
+ * Operations are executed on the device's I/O actor thread, which is shared
+ * by every Camera open on the same device. One Camera may be used from
+ * several threads at once; only moving it requires exclusive access.
  */
 class Camera {
 public:
@@ -28,6 +41,12 @@ public:
    */
   explicit Camera(const Device &device);
 
+  /**
+   * @brief Create camera handle for an interned device
+   * @param device Device handle (shared, not copied)
+   */
+  explicit Camera(DeviceHandle device);
+
   /**
    * @brief Create camera handle by device index
    * @param device_index Index from list_devices()
@@ -68,7 +87,55 @@ public:
    * @brief Get the underlying device information
    * @return Device structure
    */
-  const Device &device() const { return device_; }
+  const Device &device() const { return *device_; }
+
+  /**
+   * @brief Get the interned device record
+   * @return Handle shared with every other holder of the same device
+   */
+  const DeviceHandle &handle() const { return device_; }
+
+  /**
+   * @brief Set the deadline for each property operation
+   * @param timeout Maximum time to wait for the device (zero waits
+   * indefinitely)
+   *
+   * An operation that misses its deadline returns ErrorCode::DeviceBusy. If
+   * the driver call is still stuck, later operations on the device fail
+   * immediately with the same error until it returns.
+   */
+  void set_timeout(std::chrono::milliseconds timeout) {
+    timeout_ms_.store(timeout.count(), std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Get the per-operation deadline
+   * @return Current timeout (zero means no deadline)
+   */
+  std::chrono::milliseconds timeout() const {
+    return std::chrono::milliseconds(timeout_ms_.load(std::memory_order_relaxed));
+  }
+
+  /**
+   * @brief Set the retry and circuit breaker policy for the device
+   * @param policy Policy to apply
+   *
+   * The policy and breaker state belong to the device, so the change applies
+   * to every Camera open on it.
+   */
+  void set_policy(const DevicePolicy &policy);
+
+  /**
+   * @brief Get the device's retry and circuit breaker policy
+   * @return Current policy (the default policy for an invalid camera)
+   */
+  DevicePolicy policy() const;
+
+  /**
+   * @brief Get retry and circuit breaker counters for the device
+   * @return Policy statistics
+   */
+  PolicyStats policy_stats() const;
 
   /**
    * @brief Get camera property value
@@ -92,6 +159,54 @@ public:
    */
   Result<PropRange> get_range(CamProp prop);
 
+  /**
+   * @brief Set a camera property and wait for the device to reach it
+   * @param prop Camera property (typically Zoom, Focus, Pan, Tilt)
+   * @param setting New manual setting
+   * @param options Tolerance, deadline and polling intervals
+   * @return Settle outcome with the achieved value, or the write error
+   *
+   * Polls back off from options.initial_interval, so short moves return
+   * quickly. Stalled and TimedOut outcomes are results, not errors.
+   */
+  Result<SettleResult> set_and_wait(CamProp prop, const PropSetting &setting,
+                                    const SettleOptions &options = {});
+
+  /**
+   * @brief Set a camera property and wait without blocking
+   * @param prop Camera property
+   * @param setting New manual setting
+   * @param options Tolerance, deadline and polling intervals
+   * @return Future for the settle outcome
+   *
+   * The write and the polls run on the device's actor thread and the shared
+   * TaskScheduler, so waiting on many cameras takes no extra threads. The
+   * write is not retried by the device policy.
+   */
+  std::future<Result<SettleResult>>
+  set_and_wait_async(CamProp prop, const PropSetting &setting,
+                     const SettleOptions &options = {});
+
+  /**
+   * @brief Move a camera property by a relative amount
+   * @param prop Absolute camera property (Pan, Zoom, Focus, ...)
+   * @param delta Amount to move, in the property's units
+   * @return Result indicating success or error
+   *
+   * The move is emulated: the range is read once, the value is tracked
+   * locally from the last read or nudge, and the target is clamped to the
+   * range, so a nudge costs one device call (none at a range end). The
+   * tracked value is re-read after any other write through this handle,
+   * every 32 nudges, and after a second, which picks up writes made by other
+   * handles or applications.
+   *
+   * The native relative control (PanRelative for Pan, ...) is written
+   * instead only when its range admits delta as a step. Direction-only
+   * controls (-1/0/1) are never used, and a relative write the device
+   * rejects with ErrorCode::InvalidValue falls back to emulation.
+   */
+  Result<void> nudge(CamProp prop, int delta);
+
   /**
    * @brief Get video processing property value
    * @param prop Video property to query
@@ -114,12 +229,78 @@ public:
    */
   Result<PropRange> get_range(VidProp prop);
 
+  /**
+   * @brief Set a video property and wait for the device to reach it
+   * @param prop Video property
+   * @param setting New manual setting
+   * @param options Tolerance, deadline and polling intervals
+   * @return Settle outcome with the achieved value, or the write error
+   */
+  Result<SettleResult> set_and_wait(VidProp prop, const PropSetting &setting,
+                                    const SettleOptions &options = {});
+
+  /**
+   * @brief Set a video property and wait without blocking
+   * @param prop Video property
+   * @param setting New manual setting
+   * @param options Tolerance, deadline and polling intervals
+   * @return Future for the settle outcome
+   */
+  std::future<Result<SettleResult>>
+  set_and_wait_async(VidProp prop, const PropSetting &setting,
+                     const SettleOptions &options = {});
+
+  /**
+   * @brief Move a video property by a relative amount
+   * @param prop Video property
+   * @param delta Amount to move, in the property's units
+   * @return Result indicating success or error
+   *
+   * Video properties have no relative controls, so the move is always
+   * emulated as described for nudge(CamProp, int).
+   */
+  Result<void> nudge(VidProp prop, int delta);
+
+  /**
+   * @brief Count writes made through this handle to a property
+   * @param prop Camera property
+   * @return Number of writes made by set, set_and_wait(_async) and nudge
+   * on the property, successful or not, counted as each write completes
+   *
+   * Lets caches layered on the handle (PresetRecaller) notice writes made
+   * around them.
+   */
+  uint64_t write_count(CamProp prop) const;
+
+  /// @copydoc write_count(CamProp) const
+  uint64_t write_count(VidProp prop) const;
+
 private:
-  Device device_;
-  mutable std::unique_ptr<DeviceConnection> connection_;
+  struct NudgeState;
+  struct WriteCounters;
+
+  DeviceHandle device_;
+  std::shared_ptr<DeviceActor> actor_;
+  /// Per-operation deadline; atomic so threads sharing the handle can change it
+  std::atomic<int64_t> timeout_ms_{DEFAULT_OPERATION_TIMEOUT.count()};
+  /// Ranges and tracked values behind nudge()
+  std::unique_ptr<NudgeState> nudge_;
+  /// Per-property write counts behind write_count() (shared with pending
+  /// set_and_wait_async() writes)
+  std::shared_ptr<WriteCounters> writes_;
+
+  /// Attach to the device's I/O actor (none for an invalid device)
+  void attach_actor();
+
+  /// Write a property without counting the write
+  template <typename Prop> Result<void> write(Prop prop, const PropSetting &setting);
+
+  /// Emulated relative move (call with the nudge state locked)
+  template <typename Prop> Result<void> emulate_nudge(Prop prop, int delta);
 
-  /// Get or create device connection
-  DeviceConnection *get_connection() const;
+  /// Check whether a relative control takes delta as a step (call with the
+  /// nudge state locked)
+  bool relative_admits(CamProp relative, int delta);
 };
 
 /**
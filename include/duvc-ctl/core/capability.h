@@ -8,12 +8,19 @@
 #include "camera.h"
 #include "result.h"
 #include "types.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
-#include <unordered_map>
+#include <optional>
 #include <vector>
 
 namespace duvc {
 
+// Forward declaration
+class DeviceActor;
+
 /**
  * @brief Property capability information
  */
@@ -21,6 +28,7 @@ struct PropertyCapability {
   bool supported = false; ///< Property is supported by device
   PropRange range;        ///< Valid range for property
   PropSetting current;    ///< Current property value
+  bool current_valid = false; ///< current was read successfully
 
   /**
    * @brief Check if property supports automatic mode
@@ -29,8 +37,136 @@ struct PropertyCapability {
   bool supports_auto() const { return range.default_mode == CamMode::Auto; }
 };
 
+/// Number of camera properties (CamProp values are 0..kCamPropCount-1)
+constexpr size_t kCamPropCount = static_cast<size_t>(CamProp::Lamp) + 1;
+
+/// Number of video properties (VidProp values are 0..kVidPropCount-1)
+constexpr size_t kVidPropCount =
+    static_cast<size_t>(VidProp::PowerLineFrequency) + 1;
+
+/**
+ * @brief Set of properties stored as a 64-bit mask
+ * @tparam Prop CamProp or VidProp
+ *
+ * Bit i is set when the property with value i is in the set. Iteration
+ * yields properties in enum order without allocating. Sets compare by value
+ * and combine with |, & and ^; a - b is the properties in a but not in b.
+ */
+template <typename Prop> class PropertySet {
+public:
+  /// Forward iterator over the properties in the set
+  class iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Prop;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Prop *;
+    using reference = Prop;
+
+    iterator() = default;
+
+    Prop operator*() const { return static_cast<Prop>(index_); }
+
+    iterator &operator++() {
+      rest_ &= rest_ - 1;
+      ++index_;
+      skip();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    bool operator==(const iterator &other) const {
+      return rest_ == other.rest_;
+    }
+    bool operator!=(const iterator &other) const { return !(*this == other); }
+
+  private:
+    friend class PropertySet;
+
+    explicit iterator(uint64_t bits) : rest_(bits) { skip(); }
+
+    /// Advance index_ to the lowest remaining bit
+    void skip() {
+      if (!rest_) {
+        index_ = 0;
+        return;
+      }
+      while (!((rest_ >> index_) & 1)) {
+        ++index_;
+      }
+    }
+
+    uint64_t rest_ = 0;
+    int index_ = 0;
+  };
+
+  /// Construct empty set
+  constexpr PropertySet() = default;
+
+  /// Construct from a raw mask
+  constexpr explicit PropertySet(uint64_t bits) : bits_(bits) {}
+
+  /// Get the raw mask
+  constexpr uint64_t bits() const { return bits_; }
+
+  bool contains(Prop prop) const { return (bits_ & bit(prop)) != 0; }
+  void insert(Prop prop) { bits_ |= bit(prop); }
+  void erase(Prop prop) { bits_ &= ~bit(prop); }
+  void clear() { bits_ = 0; }
+  bool empty() const { return bits_ == 0; }
+
+  /// Get the number of properties in the set
+  size_t size() const {
+    size_t count = 0;
+    for (uint64_t bits = bits_; bits; bits &= bits - 1) {
+      ++count;
+    }
+    return count;
+  }
+
+  iterator begin() const { return iterator(bits_); }
+  iterator end() const { return iterator(); }
+
+  bool operator==(PropertySet other) const { return bits_ == other.bits_; }
+  bool operator!=(PropertySet other) const { return bits_ != other.bits_; }
+  PropertySet operator|(PropertySet other) const {
+    return PropertySet(bits_ | other.bits_);
+  }
+  PropertySet operator&(PropertySet other) const {
+    return PropertySet(bits_ & other.bits_);
+  }
+  PropertySet operator^(PropertySet other) const {
+    return PropertySet(bits_ ^ other.bits_);
+  }
+  PropertySet operator-(PropertySet other) const {
+    return PropertySet(bits_ & ~other.bits_);
+  }
+
+private:
+  static uint64_t bit(Prop prop) {
+    auto index = static_cast<unsigned>(prop);
+    return index < 64 ? uint64_t(1) << index : 0;
+  }
+
+  uint64_t bits_ = 0;
+};
+
+using CamPropSet = PropertySet<CamProp>; ///< Set of camera properties
+using VidPropSet = PropertySet<VidProp>; ///< Set of video properties
+
+static_assert(kCamPropCount <= 64 && kVidPropCount <= 64,
+              "property sets hold at most 64 properties");
+
 /**
  * @brief Complete device capability snapshot
+ *
+ * Capabilities are stored in arrays indexed by property value, with the
+ * supported properties kept as a CamPropSet/VidPropSet.
  */
 class DeviceCapabilities {
 public:
@@ -68,15 +204,27 @@ public:
    */
   bool supports_video_property(VidProp prop) const;
 
+  /**
+   * @brief Get the supported camera properties
+   * @return Set of supported camera properties (iterates in enum order)
+   */
+  CamPropSet camera_properties() const { return camera_supported_; }
+
+  /**
+   * @brief Get the supported video properties
+   * @return Set of supported video properties (iterates in enum order)
+   */
+  VidPropSet video_properties() const { return video_supported_; }
+
   /**
    * @brief Get list of supported camera properties
-   * @return Vector of supported camera properties
+   * @return Vector of supported camera properties in enum order
    */
   std::vector<CamProp> supported_camera_properties() const;
 
   /**
    * @brief Get list of supported video properties
-   * @return Vector of supported video properties
+   * @return Vector of supported video properties in enum order
    */
   std::vector<VidProp> supported_video_properties() const;
 
@@ -84,7 +232,7 @@ public:
    * @brief Get the device this capability snapshot is for
    * @return Device reference
    */
-  const Device &device() const { return device_; }
+  const Device &device() const { return *device_; }
 
   /**
    * @brief Check if device is connected and accessible
@@ -99,12 +247,17 @@ public:
   Result<void> refresh();
 
 private:
-  Device device_;
+  DeviceHandle device_;
   bool device_accessible_;
-  std::unordered_map<CamProp, PropertyCapability> camera_capabilities_;
-  std::unordered_map<VidProp, PropertyCapability> video_capabilities_;
+  std::array<PropertyCapability, kCamPropCount> camera_capabilities_{};
+  std::array<PropertyCapability, kVidPropCount> video_capabilities_{};
+  CamPropSet camera_supported_;
+  VidPropSet video_supported_;
+
+  /// Clear all capabilities
+  void clear_capabilities();
 
-  /// Scan all properties and build capability map
+  /// Scan all properties and fill the capability arrays
   void scan_capabilities();
 
   /// Empty capability for unsupported properties
@@ -125,4 +278,102 @@ Result<DeviceCapabilities> get_device_capabilities(const Device &device);
  */
 Result<DeviceCapabilities> get_device_capabilities(int device_index);
 
+/**
+ * @brief Check if a camera property is a relative control
+ * @param prop Camera property
+ * @return true for PanRelative, ZoomRelative and the other controls that
+ * move the device instead of holding a state
+ */
+bool is_relative_property(CamProp prop);
+
+/**
+ * @brief Selects the properties reset_to_defaults() writes
+ */
+struct ResetFilter {
+  bool camera = true; ///< Include camera properties
+  bool video = true;  ///< Include video properties
+  std::vector<CamProp> camera_props; ///< Only these camera properties (empty = all)
+  std::vector<VidProp> video_props;  ///< Only these video properties (empty = all)
+  /// Also write relative controls (PanRelative, ZoomRelative, ...). Their
+  /// "default" is a motion command rather than a state, so they are skipped
+  /// unless asked for.
+  bool include_relative = false;
+};
+
+/**
+ * @brief What reset_to_defaults() did with one property
+ */
+enum class ResetOutcome {
+  Written, ///< Default written
+  Skipped, ///< Already at its default value and mode
+  Failed   ///< Write returned an error
+};
+
+/**
+ * @brief Per-property reset result
+ */
+struct ResetEntry {
+  bool video = false;                     ///< Video (true) or camera property
+  CamProp cam_prop = CamProp::Pan;        ///< Property when video is false
+  VidProp vid_prop = VidProp::Brightness; ///< Property when video is true
+  ResetOutcome outcome = ResetOutcome::Skipped;
+  std::optional<Error> error; ///< Write error when outcome is Failed
+};
+
+/**
+ * @brief Outcome of reset_to_defaults()
+ */
+struct ResetReport {
+  int writes = 0;  ///< Properties written
+  int skipped = 0; ///< Properties already at their defaults
+  int failed = 0;  ///< Writes that returned an error
+  std::vector<ResetEntry> entries; ///< Writes in order, then skipped entries
+};
+
+/**
+ * @brief Reset properties to their defaults using a capability snapshot
+ * @param camera Open camera for the snapshot's device
+ * @param capabilities Snapshot supplying ranges and current values
+ * @param filter Properties to reset
+ * @return Report, or ErrorCode::InvalidArgument if the snapshot is for a
+ * different device
+ *
+ * No ranges are read again. Properties whose snapshot value and mode already
+ * equal the defaults are skipped, so refresh the snapshot first if the device
+ * may have changed since. Properties that default to manual mode are written
+ * before those that default to auto, so auto algorithms (exposure, white
+ * balance, focus) restart once with their dependents already in place.
+ */
+Result<ResetReport> reset_to_defaults(Camera &camera,
+                                      const DeviceCapabilities &capabilities,
+                                      const ResetFilter &filter = {});
+
+/**
+ * @brief Reset properties to their defaults
+ * @param camera Open camera
+ * @param filter Properties to reset
+ * @return Report, or the error if the camera is not connected
+ *
+ * Reads the range and current value of each selected property once through
+ * @p camera, then writes as the snapshot overload does.
+ */
+Result<ResetReport> reset_to_defaults(Camera &camera,
+                                      const ResetFilter &filter = {});
+
+/**
+ * @brief Reset properties of a device actor to their defaults
+ * @param actor Device actor
+ * @param filter Properties to reset
+ * @return Report, or the error if the device cannot be opened
+ */
+Result<ResetReport> reset_to_defaults(std::shared_ptr<DeviceActor> actor,
+                                      const ResetFilter &filter = {});
+
+/**
+ * @brief Convert reset outcome to string
+ * @param outcome Reset outcome
+ * @return Outcome name
+ */
+const char *to_string(ResetOutcome outcome);
+
 } // namespace duvc
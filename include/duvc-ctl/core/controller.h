@@ -0,0 +1,159 @@
+#pragma once
+
+/**
+ * @file controller.h
+ * @brief Closed-loop property controllers driven by external measurements
+ */
+
+#include <duvc-ctl/core/property_access.h>
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/types.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace duvc {
+
+/**
+ * @brief Control law applied by a loop
+ */
+enum class ControlMode {
+  Pid,        ///< Positional PID around the value read when the loop started
+  StepLimited ///< Incremental proportional moves of at most max_step per tick
+};
+
+/**
+ * @brief PID gains (device units per metric unit)
+ *
+ * Use negative gains when raising the property lowers the metric.
+ */
+struct PidGains {
+  double kp = 0.0; ///< Proportional gain
+  double ki = 0.0; ///< Integral gain (per second)
+  double kd = 0.0; ///< Derivative gain (seconds)
+};
+
+/**
+ * @brief Measurement callback for a control loop
+ *
+ * Called on the engine thread once per tick. Return std::nullopt when no new
+ * measurement is available; the tick is then skipped.
+ */
+using MeasurementFeed = std::function<std::optional<double>()>;
+
+/**
+ * @brief Control loop configuration
+ */
+struct ControlLoopConfig {
+  ControlMode mode = ControlMode::Pid;
+  double setpoint = 0.0; ///< Target metric value
+  PidGains gains;        ///< Gains (StepLimited uses kp only)
+  /// |error| at or below which the output is held. Set it to at least half
+  /// the metric change of one property step to avoid hunting between steps.
+  double deadband = 0.0;
+  int max_step = 0; ///< Largest change per tick in device units (0 = no limit)
+  std::chrono::milliseconds period{33}; ///< Loop period
+};
+
+/**
+ * @brief Control loop counters and timing
+ */
+struct ControlLoopStats {
+  uint64_t ticks = 0;               ///< Ticks executed
+  uint64_t missed_measurements = 0; ///< Ticks skipped for lack of a measurement
+  uint64_t writes = 0;              ///< Property writes issued
+  uint64_t coalesced = 0;  ///< Ticks whose quantized output was unchanged
+  uint64_t write_failures = 0;      ///< Writes that returned an error
+  uint64_t overruns = 0;   ///< Periods skipped because a tick ran late
+  double last_measurement = 0.0;    ///< Most recent metric value
+  double last_error = 0.0;          ///< Most recent setpoint - measurement
+  int last_output = 0;              ///< Most recent quantized output
+  std::chrono::microseconds latency_avg{0}; ///< Mean measure-to-write time
+  std::chrono::microseconds latency_max{0}; ///< Worst measure-to-write time
+  std::chrono::microseconds jitter_avg{0};  ///< Mean tick start deviation
+  std::chrono::microseconds jitter_max{0};  ///< Worst tick start deviation
+  std::optional<Error> last_failure;        ///< Most recent write error
+};
+
+/// Identifies a loop within a ControlEngine
+using ControlLoopId = uint64_t;
+
+/**
+ * @brief Runs closed-loop property controllers at a fixed rate
+ *
+ * All loops registered with an engine share one thread. Each tick reads the
+ * measurement, computes the new output, quantizes it to the property's range
+ * and step, and writes it only if the quantized value changed. Thread-safe.
+ */
+class ControlEngine {
+public:
+  ControlEngine();
+
+  /// Stops the engine thread; measurement feeds are not called afterwards
+  ~ControlEngine();
+
+  ControlEngine(const ControlEngine &) = delete;
+  ControlEngine &operator=(const ControlEngine &) = delete;
+
+  /**
+   * @brief Register a control loop
+   * @param target Property to drive
+   * @param measure Measurement feed
+   * @param config Loop configuration
+   * @return Loop identifier, or the error reading the property's range or
+   * current value
+   */
+  Result<ControlLoopId> add_loop(PropertyAccess target, MeasurementFeed measure,
+                                 const ControlLoopConfig &config);
+
+  /**
+   * @brief Unregister a control loop
+   * @param id Loop identifier
+   * @return Success, or ErrorCode::InvalidArgument for an unknown loop
+   *
+   * Waits for a tick of the loop that is in progress to finish.
+   */
+  Result<void> remove_loop(ControlLoopId id);
+
+  /**
+   * @brief Change a loop's setpoint
+   * @param id Loop identifier
+   * @param setpoint New target metric value
+   * @return Success, or ErrorCode::InvalidArgument for an unknown loop
+   */
+  Result<void> set_setpoint(ControlLoopId id, double setpoint);
+
+  /**
+   * @brief Get a loop's counters and timing
+   * @param id Loop identifier
+   * @return Statistics, or ErrorCode::InvalidArgument for an unknown loop
+   */
+  Result<ControlLoopStats> stats(ControlLoopId id) const;
+
+  /// Get the number of registered loops
+  size_t loop_count() const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+  struct Loop;
+
+  void run();
+  void tick(Loop &loop, Clock::time_point now);
+  std::shared_ptr<Loop> find(ControlLoopId id) const;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  std::map<ControlLoopId, std::shared_ptr<Loop>> loops_;
+  ControlLoopId next_id_ = 1;
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+} // namespace duvc
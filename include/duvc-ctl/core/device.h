@@ -35,7 +35,8 @@ bool is_device_connected(const Device &dev);
  * Windows device instance path. This provides unambiguous identification when
  * multiple cameras have identical names due to firmware variations.
  * 
- * @param device_path Wide string containing the device path (case-insensitive)
+ * @param device_path Wide string containing the device path (case-insensitive;
+ * an instance ID of the same device also matches, see same_device_path())
  * @return Device object with matching path
  * @throws std::runtime_error if enumeration fails or device not found
  * 
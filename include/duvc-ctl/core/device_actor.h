@@ -0,0 +1,296 @@
+#pragma once
+
+/**
+ * @file device_actor.h
+ * @brief Per-device I/O actor that owns a device connection on its own thread
+ */
+
+#include <duvc-ctl/core/policy.h>
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/types.h>
+#include <duvc-ctl/platform/interface.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace duvc {
+
+/**
+ * @brief Factory that opens the device connection
+ *
+ * Always invoked on the actor thread, so platform objects created by it
+ * (DirectShow filters, control interfaces) stay bound to that thread.
+ */
+using ConnectionFactory =
+    std::function<Result<std::unique_ptr<IDeviceConnection>>()>;
+
+/**
+ * @brief Properties a device has reported as unsupported
+ *
+ * Lets repeated probes of unsupported properties be answered without a
+ * driver round-trip. The registry shares one cache among the actors for a
+ * device path and drops it with the last of them. It is cleared whenever
+ * the device connection has to be re-established.
+ */
+class UnsupportedPropertyCache {
+public:
+  /// @name Membership (lock-free, any thread)
+  /// @{
+  bool contains(CamProp prop) const { return test(camera_, bit(prop)); }
+  bool contains(VidProp prop) const { return test(video_, bit(prop)); }
+  /// @}
+
+  /// @name Record an unsupported property
+  /// @{
+  void insert(CamProp prop) { set(camera_, bit(prop)); }
+  void insert(VidProp prop) { set(video_, bit(prop)); }
+  /// @}
+
+  /// Forget everything (device reconnected)
+  void clear() {
+    camera_.store(0);
+    video_.store(0);
+    resets_.fetch_add(1);
+  }
+
+  /// Count a probe answered from the cache
+  void record_hit() { hits_.fetch_add(1, std::memory_order_relaxed); }
+
+  uint64_t hits() const { return hits_.load(); }       ///< Answered probes
+  uint64_t inserts() const { return inserts_.load(); } ///< Learned entries
+  uint64_t resets() const { return resets_.load(); }   ///< Clears
+
+private:
+  template <typename E> static uint64_t bit(E prop) {
+    auto index = static_cast<unsigned>(prop);
+    return index < 64 ? uint64_t{1} << index : 0;
+  }
+  static bool test(const std::atomic<uint64_t> &mask, uint64_t b) {
+    return (mask.load(std::memory_order_acquire) & b) != 0;
+  }
+  void set(std::atomic<uint64_t> &mask, uint64_t b) {
+    if (b && (mask.fetch_or(b, std::memory_order_acq_rel) & b) == 0) {
+      inserts_.fetch_add(1);
+    }
+  }
+
+  std::atomic<uint64_t> camera_{0};
+  std::atomic<uint64_t> video_{0};
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> inserts_{0};
+  std::atomic<uint64_t> resets_{0};
+};
+
+/**
+ * @brief Execution counters for a device actor
+ */
+struct DeviceActorStats {
+  uint64_t requests = 0;  ///< Requests executed on the actor thread
+  uint64_t batches = 0;   ///< Wake-ups that drained at least one request
+  uint64_t max_batch = 0; ///< Largest number of requests drained at once
+  uint64_t connects = 0;  ///< Successful connection opens
+  uint64_t timeouts = 0;  ///< Calls that gave up waiting for their deadline
+  uint64_t rejected = 0;  ///< Calls failed fast while the device was hung
+  uint64_t expired = 0;   ///< Requests dropped because their caller gave up
+  uint64_t unsupported_hits = 0;    ///< Probes answered from the cache
+  uint64_t unsupported_learned = 0; ///< Properties learned as unsupported
+  uint64_t unsupported_resets = 0;  ///< Cache clears on reconnect
+};
+
+/**
+ * @brief Dedicated I/O thread owning one device connection
+ *
+ * Every operation is a message pushed onto a lock-free queue and executed on
+ * the actor thread, which initializes its COM apartment once and keeps the
+ * connection (filter and control interfaces) bound for its whole lifetime.
+ * Requests that arrive while the actor is busy are drained together as one
+ * batch on the next wake-up.
+ *
+ * Calls may carry a deadline. When a call times out while the actor is stuck
+ * inside a driver call, the actor is marked unhealthy: further calls fail
+ * immediately with ErrorCode::DeviceBusy until the stuck call returns, and
+ * queued requests whose callers gave up are dropped instead of executed.
+ */
+class DeviceActor {
+public:
+  /// Work item; receives the open connection or the error that prevented it
+  using Task = std::function<void(const Result<IDeviceConnection *> &)>;
+
+  /// Absolute deadline for a queued request
+  using Deadline = std::chrono::steady_clock::time_point;
+
+  /// Deadline of requests that never expire
+  static constexpr Deadline no_deadline() { return Deadline::max(); }
+
+  /**
+   * @brief Start the actor thread
+   * @param factory Opens the connection (called lazily on the actor thread)
+   * @param unsupported Cache of unsupported properties to use (a private one
+   * is created if null)
+   */
+  explicit DeviceActor(
+      ConnectionFactory factory,
+      std::shared_ptr<UnsupportedPropertyCache> unsupported = nullptr);
+
+  /**
+   * @brief Stop the actor
+   *
+   * Runs queued requests, releases the connection and joins the thread. If
+   * the actor is stuck in a driver call, or the last reference is released
+   * by one of its own tasks, the thread is detached instead; it finishes and
+   * releases its resources once the current task returns.
+   */
+  ~DeviceActor();
+
+  // Non-copyable, non-movable (the thread references this)
+  DeviceActor(const DeviceActor &) = delete;
+  DeviceActor &operator=(const DeviceActor &) = delete;
+
+  /**
+   * @brief Queue a task without waiting for it
+   * @param task Work to execute on the actor thread
+   * @param deadline Time after which the task is no longer wanted; an expired
+   * task is invoked with ErrorCode::DeviceBusy instead of the connection
+   */
+  void post(Task task, Deadline deadline = no_deadline());
+
+  /**
+   * @brief Execute an operation on the actor thread and wait for its result
+   * @param fn Operation to run against the connection
+   * @param timeout Maximum time to wait (zero waits indefinitely)
+   * @return Operation result, the connection error if the device could not be
+   * opened, or ErrorCode::DeviceBusy if the device did not respond in time
+   */
+  template <typename T>
+  Result<T> call(std::function<Result<T>(IDeviceConnection &)> fn,
+                 std::chrono::milliseconds timeout = {}) {
+    if (on_actor_thread()) {
+      return invoke(fn, current_connection());
+    }
+    if (!healthy()) {
+      return Result<T>(reject());
+    }
+
+    auto promise = std::make_shared<std::promise<Result<T>>>();
+    auto future = promise->get_future();
+    Deadline deadline = timeout.count() > 0
+                            ? std::chrono::steady_clock::now() + timeout
+                            : no_deadline();
+    post(
+        [promise, fn = std::move(fn)](
+            const Result<IDeviceConnection *> &connection) {
+          promise->set_value(invoke(fn, connection));
+        },
+        deadline);
+
+    if (timeout.count() <= 0 ||
+        future.wait_for(timeout) == std::future_status::ready) {
+      return future.get();
+    }
+    return Result<T>(timed_out(timeout));
+  }
+
+  /// @name Property operations (executed on the actor thread)
+  /// @param timeout Maximum time to wait (zero waits indefinitely)
+  ///
+  /// Properties the device reported as unsupported are answered immediately
+  /// with ErrorCode::PropertyNotSupported until the device reconnects.
+  /// @{
+  Result<PropSetting> get(CamProp prop, std::chrono::milliseconds timeout = {});
+  Result<void> set(CamProp prop, const PropSetting &setting,
+                   std::chrono::milliseconds timeout = {});
+  Result<PropRange> get_range(CamProp prop,
+                              std::chrono::milliseconds timeout = {});
+  Result<PropSetting> get(VidProp prop, std::chrono::milliseconds timeout = {});
+  Result<void> set(VidProp prop, const PropSetting &setting,
+                   std::chrono::milliseconds timeout = {});
+  Result<PropRange> get_range(VidProp prop,
+                              std::chrono::milliseconds timeout = {});
+  /// @}
+
+  /**
+   * @brief Drop the current connection; the next request reopens it
+   *
+   * Also forgets which properties were reported as unsupported.
+   */
+  void reconnect();
+
+  /**
+   * @brief Get the cache of properties reported as unsupported
+   * @return Cache shared by every actor for the device
+   */
+  const UnsupportedPropertyCache &unsupported() const;
+
+  /**
+   * @brief Get the retry and circuit breaker state for this device
+   * @return Policy engine shared by every Camera open on the device
+   */
+  DevicePolicyEngine &policy() { return policy_; }
+
+  /**
+   * @brief Check whether the actor is responsive
+   * @return false while a call that timed out is still stuck on the actor
+   */
+  bool healthy() const;
+
+  /**
+   * @brief Get execution counters
+   * @return Snapshot of actor statistics
+   */
+  DeviceActorStats stats() const;
+
+  /**
+   * @brief Check whether the caller is running on the actor thread
+   * @return true when called from inside a task
+   */
+  bool on_actor_thread() const {
+    return std::this_thread::get_id() == thread_id_;
+  }
+
+private:
+  struct State;
+
+  template <typename T>
+  static Result<T> invoke(const std::function<Result<T>(IDeviceConnection &)> &fn,
+                          const Result<IDeviceConnection *> &connection) {
+    if (!connection.is_ok()) {
+      return Result<T>(connection.error());
+    }
+    try {
+      return fn(*connection.value());
+    } catch (const std::exception &e) {
+      return Result<T>(ErrorCode::SystemError, e.what());
+    }
+  }
+
+  Result<IDeviceConnection *> current_connection() const;
+
+  /// Record a timed-out call and mark the actor hung
+  Error timed_out(std::chrono::milliseconds timeout);
+
+  /// Record a call rejected because the actor is hung
+  Error reject();
+
+  DevicePolicyEngine policy_;
+
+  // Shared with the actor thread so it can outlive a detached hung actor
+  std::shared_ptr<State> state_;
+  std::thread::id thread_id_;
+};
+
+/**
+ * @brief Get the shared actor for a device, starting one if needed
+ * @param device Device to own
+ * @return Actor shared by every Camera open on the same device path
+ *
+ * The actor stops once the last holder releases it.
+ */
+std::shared_ptr<DeviceActor> acquire_device_actor(const Device &device);
+
+} // namespace duvc
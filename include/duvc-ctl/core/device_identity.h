@@ -0,0 +1,166 @@
+#pragma once
+
+/**
+ * @file device_identity.h
+ * @brief Structured device identity parsed from device paths, and a device
+ * index with constant-time lookup
+ */
+
+#include <duvc-ctl/core/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace duvc {
+
+/**
+ * @brief Identity fields parsed from a device path
+ *
+ * Accepts DirectShow interface paths
+ * (\\?\usb#vid_046d&pid_085e&mi_00#7&1a2b3c&0&0000#{guid}\global), device
+ * instance IDs (USB\VID_046D&PID_085E&MI_00\7&1A2B3C&0&0000) and moniker
+ * display names (@device:pnp:\\?\usb#...). Fields that are absent or
+ * malformed are left empty; parsing never fails.
+ *
+ * The key identifies the device instance independent of path form and case,
+ * so an interface path and an instance ID of the same device share it.
+ */
+struct DeviceIdentity {
+  std::wstring bus;      ///< Bus enumerator, lower case ("usb", "swd", ...)
+  std::optional<uint16_t> vid; ///< USB vendor ID
+  std::optional<uint16_t> pid; ///< USB product ID
+  std::optional<uint8_t> interface_number; ///< MI_xx of a composite device
+  std::wstring hardware_id; ///< Hardware ID segment as written (VID_...&PID_...)
+  std::wstring instance;    ///< Instance ID segment as written
+  std::wstring interface_guid; ///< Interface class GUID in braces, lower case
+  std::wstring key;         ///< Case-folded bus\hardware_id\instance
+  uint64_t key_hash = 0;    ///< Hash of key
+  uint64_t serial_hash = 0; ///< Hash of the folded serial (0 if none)
+
+  /**
+   * @brief Check whether the instance segment is a device serial number
+   *
+   * Windows uses the USB serial string as the instance ID when the device
+   * reports one; otherwise it generates an ID containing '&' from the port
+   * location. For an interface of a composite device the serial belongs to
+   * the parent, so it is not visible here.
+   */
+  bool has_serial() const;
+
+  /// Get the serial number (empty if has_serial() is false)
+  std::wstring serial() const;
+
+  /// Get VID and PID as one value (vid << 16 | pid), if both are present
+  std::optional<uint32_t> usb_id() const;
+};
+
+/**
+ * @brief Parse a device path
+ * @param path Device path or instance ID
+ * @return Identity (fields the path does not carry are empty)
+ */
+DeviceIdentity parse_device_identity(const std::wstring &path);
+
+/**
+ * @brief Check whether two device paths name the same device instance
+ * @param a First path
+ * @param b Second path
+ * @return true if their identity keys are equal
+ */
+bool same_device_path(const std::wstring &a, const std::wstring &b);
+
+/**
+ * @brief Hash a string the way DeviceIdentity hashes its keys
+ * @param text Text to hash (case-folded by the caller)
+ * @return 64-bit FNV-1a hash over the code units, stable across runs
+ */
+uint64_t identity_hash(const std::wstring &text);
+
+/**
+ * @brief Hash a device path's identity key without parsing it into fields
+ * @param path Device path or instance ID
+ * @return Same value as parse_device_identity(path).key_hash, computed
+ * without allocating
+ */
+uint64_t device_key_hash(const std::wstring &path);
+
+/**
+ * @brief Devices indexed by path, serial, VID:PID and name
+ *
+ * Built once from an enumeration; every identity is parsed and hashed at
+ * build time, so each lookup hashes only its query. The index is immutable:
+ * rebuild it after devices change.
+ */
+class DeviceIndex {
+public:
+  /// One indexed device
+  struct Entry {
+    Device device;
+    DeviceIdentity identity;
+    size_t position = 0; ///< Position in the list the index was built from
+  };
+
+  DeviceIndex() = default;
+
+  /**
+   * @brief Build index
+   * @param devices Devices to index (of devices with the same identity key,
+   * the first is kept)
+   */
+  explicit DeviceIndex(std::vector<Device> devices);
+
+  /**
+   * @brief Find device by path or instance ID
+   * @param path Path in any form parse_device_identity() accepts
+   * @return Entry, or nullptr if not indexed
+   */
+  const Entry *find_by_path(const std::wstring &path) const;
+
+  /**
+   * @brief Find device by serial number (case-insensitive)
+   * @param serial Serial number
+   * @return First entry with that serial, or nullptr
+   */
+  const Entry *find_by_serial(const std::wstring &serial) const;
+
+  /**
+   * @brief Find devices by USB vendor and product ID
+   * @param vid Vendor ID
+   * @param pid Product ID
+   * @return Matching entries in enumeration order
+   */
+  std::vector<const Entry *> find_by_usb_id(uint16_t vid, uint16_t pid) const;
+
+  /**
+   * @brief Find devices by exact friendly name (case-insensitive)
+   * @param name Friendly name
+   * @return Matching entries in enumeration order
+   */
+  std::vector<const Entry *> find_by_name(const std::wstring &name) const;
+
+  /// Get all entries in enumeration order
+  const std::vector<Entry> &entries() const { return entries_; }
+
+  /// Get number of indexed devices
+  size_t size() const { return entries_.size(); }
+
+private:
+  using Bucket = std::unordered_multimap<uint64_t, size_t>;
+
+  std::vector<const Entry *>
+  collect(const Bucket &bucket, uint64_t hash,
+          const std::function<bool(const Entry &)> &match) const;
+
+  std::vector<Entry> entries_;
+  Bucket by_key_;
+  Bucket by_serial_;
+  Bucket by_name_;
+  std::unordered_map<uint32_t, std::vector<size_t>> by_usb_id_;
+};
+
+} // namespace duvc
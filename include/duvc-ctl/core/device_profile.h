@@ -0,0 +1,201 @@
+#pragma once
+
+/**
+ * @file device_profile.h
+ * @brief Per-model device profiles and quirk database keyed by USB VID/PID
+ */
+
+#include <duvc-ctl/core/capability.h>
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/types.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace duvc {
+
+class IDeviceConnection;
+
+/**
+ * @brief Replacement for fields of a range reported by the device
+ *
+ * Unset fields keep the device's value.
+ */
+struct RangeOverride {
+  std::optional<int> min;
+  std::optional<int> max;
+  std::optional<int> step;
+  std::optional<int> default_val;
+  std::optional<CamMode> default_mode;
+
+  /// Check whether no field is overridden
+  bool empty() const {
+    return !min && !max && !step && !default_val && !default_mode;
+  }
+
+  /**
+   * @brief Apply the override
+   * @param range Range reported by the device
+   * @return Range with overridden fields replaced, or
+   * ErrorCode::InvalidArgument if the result has min greater than max (e.g.
+   * only min is overridden, past the device's max)
+   */
+  Result<PropRange> apply(const PropRange &range) const;
+};
+
+/**
+ * @brief Known behaviour of one camera model
+ *
+ * Connections to a matching device consult the profile. Properties that are
+ * never probed fail with ErrorCode::PropertyNotSupported without a driver
+ * call, ranges are corrected, and paced writes are spaced by at least
+ * write_interval.
+ */
+struct DeviceProfile {
+  uint16_t vid = 0;              ///< USB vendor ID
+  std::optional<uint16_t> pid;   ///< USB product ID (unset matches the vendor)
+  std::string name;              ///< Model name for logs
+
+  /// Complete list of supported camera properties; others are never probed
+  std::optional<CamPropSet> camera_supported;
+  /// Complete list of supported video properties; others are never probed
+  std::optional<VidPropSet> video_supported;
+
+  CamPropSet camera_never_probe; ///< Camera properties that hang the driver
+  VidPropSet video_never_probe;  ///< Video properties that hang the driver
+
+  std::array<RangeOverride, kCamPropCount> camera_ranges{}; ///< By property
+  std::array<RangeOverride, kVidPropCount> video_ranges{};  ///< By property
+
+  /// Minimum time between the end of one paced write and the next
+  std::chrono::milliseconds write_interval{0};
+  CamPropSet camera_paced; ///< Paced camera properties
+  VidPropSet video_paced;  ///< Paced video properties
+  /// (with both paced sets empty, every write is paced)
+
+  /// Check whether the driver may be queried for a property
+  bool probes(CamProp prop) const;
+  bool probes(VidProp prop) const;
+
+  /// Check whether writes of a property are paced
+  bool paces(CamProp prop) const;
+  bool paces(VidProp prop) const;
+
+  /// Get the range override for a property (empty if none)
+  const RangeOverride &range_override(CamProp prop) const;
+  const RangeOverride &range_override(VidProp prop) const;
+};
+
+/**
+ * @brief Parse device profiles from JSON
+ * @param text JSON document: {"profiles": [...]}
+ * @return Profiles, or ErrorCode::InvalidArgument naming the offending entry
+ *
+ * Each profile has "vid" and optionally "pid" (hex strings or numbers),
+ * "name", "supported", "never_probe" and "paced" (property name lists; a
+ * name may carry a cam. or vid. prefix), "ranges" (property name to
+ * {"min", "max", "step", "default", "mode"}) and "write_interval_ms".
+ */
+Result<std::vector<DeviceProfile>> parse_device_profiles(const std::string &text);
+
+/**
+ * @brief Load device profiles from a JSON file
+ * @param path File to read
+ * @return Profiles
+ */
+Result<std::vector<DeviceProfile>>
+load_device_profiles(const std::filesystem::path &path);
+
+/**
+ * @brief Get the profiles compiled into the library
+ * @return Built-in profiles
+ */
+const std::vector<DeviceProfile> &builtin_device_profiles();
+
+/**
+ * @brief Get the default user profile file
+ * @return %APPDATA%\\duvc-ctl\\device_profiles.json on Windows,
+ * $XDG_CONFIG_HOME/duvc-ctl/device_profiles.json (or ~/.config/...) elsewhere
+ */
+std::filesystem::path default_device_profiles_path();
+
+/**
+ * @brief Process-wide device profile database
+ *
+ * Starts with the built-in profiles plus, if present, the user file at
+ * default_device_profiles_path(). Added profiles replace earlier ones for the
+ * same VID/PID. Lookups prefer an exact VID/PID match over a vendor-wide
+ * profile. Profiles are attached when a device's actor starts, so changes
+ * apply to devices opened afterwards. Thread-safe.
+ */
+class DeviceProfileDatabase {
+public:
+  /// Get the process-wide database
+  static DeviceProfileDatabase &instance();
+
+  /**
+   * @brief Find the profile for a model
+   * @param vid USB vendor ID
+   * @param pid USB product ID
+   * @return Profile, or nullptr if the model is unknown
+   */
+  std::shared_ptr<const DeviceProfile> find(uint16_t vid, uint16_t pid) const;
+
+  /**
+   * @brief Find the profile for a device
+   * @param device Device (VID/PID are parsed from its path)
+   * @return Profile, or nullptr if the device is unknown or has no USB IDs
+   */
+  std::shared_ptr<const DeviceProfile> find(const Device &device) const;
+
+  /**
+   * @brief Add or replace a profile
+   * @param profile Profile to add
+   */
+  void add(DeviceProfile profile);
+
+  /**
+   * @brief Load profiles from a JSON file and add them
+   * @param path File to read
+   * @return Number of profiles added
+   */
+  Result<size_t> load(const std::filesystem::path &path);
+
+  /// Get all profiles, built-in first
+  std::vector<DeviceProfile> profiles() const;
+
+  /// Drop added profiles, keeping only the built-in ones
+  void reset();
+
+private:
+  DeviceProfileDatabase();
+
+  struct Table;
+  std::unique_ptr<Table> table_;
+};
+
+/**
+ * @brief Find the profile for a device in the process-wide database
+ * @param device Device to look up
+ * @return Profile, or nullptr if the device is unknown
+ */
+std::shared_ptr<const DeviceProfile> find_device_profile(const Device &device);
+
+/**
+ * @brief Wrap a connection so that it follows a device profile
+ * @param connection Connection to wrap
+ * @param profile Profile to follow (the connection is returned as is if null)
+ * @return Connection applying the profile's probe list, range overrides and
+ * write pacing
+ */
+std::unique_ptr<IDeviceConnection>
+apply_device_profile(std::unique_ptr<IDeviceConnection> connection,
+                     std::shared_ptr<const DeviceProfile> profile);
+
+} // namespace duvc
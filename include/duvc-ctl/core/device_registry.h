@@ -0,0 +1,122 @@
+#pragma once
+
+/**
+ * @file device_registry.h
+ * @brief Interned, immutable device records and cheap device handles
+ */
+
+#include <duvc-ctl/core/device_identity.h>
+#include <duvc-ctl/core/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace duvc {
+
+/**
+ * @brief Immutable device record shared by every handle to it
+ *
+ * Holds the device strings once, with their UTF-8 forms and parsed identity
+ * computed at intern time.
+ */
+struct DeviceRecord {
+  Device device;          ///< Name and path
+  std::string name_utf8;  ///< Name as UTF-8
+  std::string path_utf8;  ///< Path as UTF-8
+  DeviceIdentity identity; ///< Identity parsed from the path
+};
+
+/**
+ * @brief Reference-counted handle to an interned device record
+ *
+ * Copying a handle copies a pointer and a hash. Handles compare equal when
+ * they name the same device instance (same identity key); handles interned
+ * from identical devices share one record, so the common case is a pointer
+ * comparison. A default-constructed handle refers to an empty device.
+ */
+class DeviceHandle {
+public:
+  DeviceHandle() = default;
+
+  /// Get the device (an empty device for a null handle)
+  const Device &device() const;
+  const Device &operator*() const { return device(); }
+  const Device *operator->() const { return &device(); }
+
+  /// Get the record, or nullptr for a null handle
+  const DeviceRecord *record() const { return record_.get(); }
+
+  /// Get the identity key hash (0 for a null handle)
+  uint64_t hash() const { return hash_; }
+
+  /// Get the name as UTF-8
+  const std::string &name_utf8() const;
+
+  /// Get the path as UTF-8
+  const std::string &path_utf8() const;
+
+  /// Check whether the handle refers to a record
+  explicit operator bool() const { return record_ != nullptr; }
+
+  bool operator==(const DeviceHandle &other) const;
+  bool operator!=(const DeviceHandle &other) const { return !(*this == other); }
+
+private:
+  friend class DeviceRegistry;
+
+  DeviceHandle(std::shared_ptr<const DeviceRecord> record, uint64_t hash)
+      : record_(std::move(record)), hash_(hash) {}
+
+  std::shared_ptr<const DeviceRecord> record_;
+  uint64_t hash_ = 0;
+};
+
+/**
+ * @brief Process-wide table of live device records
+ *
+ * Interning a device that has a live record with the same name and path
+ * returns a handle to that record; otherwise a new record is created. A
+ * record is freed with its last handle. Thread-safe.
+ */
+class DeviceRegistry {
+public:
+  /// Get the process-wide registry
+  static DeviceRegistry &instance();
+
+  /**
+   * @brief Intern a device
+   * @param device Device to intern
+   * @return Handle to the shared record
+   */
+  DeviceHandle intern(const Device &device);
+
+  /// Get the number of live records
+  size_t size() const;
+
+private:
+  DeviceRegistry();
+  ~DeviceRegistry();
+
+  struct Table;
+  std::unique_ptr<Table> table_;
+};
+
+/**
+ * @brief Intern a device in the process-wide registry
+ * @param device Device to intern
+ * @return Handle to the shared record
+ */
+DeviceHandle intern_device(const Device &device);
+
+} // namespace duvc
+
+namespace std {
+/// Hash by identity key, consistent with DeviceHandle::operator==
+template <> struct hash<duvc::DeviceHandle> {
+  size_t operator()(const duvc::DeviceHandle &handle) const {
+    return static_cast<size_t>(handle.hash());
+  }
+};
+} // namespace std
@@ -0,0 +1,182 @@
+#pragma once
+
+/**
+ * @file policy.h
+ * @brief Per-device retry and circuit breaker policy
+ */
+
+#include <duvc-ctl/core/result.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
+
+namespace duvc {
+
+/**
+ * @brief Retry behaviour for transient errors
+ */
+struct RetryPolicy {
+  int max_attempts = 3; ///< Total attempts including the first (1 = no retry)
+  std::chrono::milliseconds initial_backoff{20}; ///< Delay before 1st retry
+  std::chrono::milliseconds max_backoff{500};    ///< Upper bound for delays
+  double multiplier = 2.0; ///< Backoff growth factor per retry
+  double jitter = 0.5;     ///< Fraction of each delay that is randomized [0,1]
+};
+
+/**
+ * @brief Circuit breaker thresholds
+ */
+struct CircuitBreakerConfig {
+  int failure_threshold = 5; ///< Consecutive device failures before opening
+  std::chrono::milliseconds open_duration{2000}; ///< Fail-fast period
+  int half_open_probes = 1; ///< Concurrent probe calls allowed when half-open
+};
+
+/**
+ * @brief Combined policy applied to every operation on a device
+ */
+struct DevicePolicy {
+  bool enabled = true; ///< false bypasses retries and the breaker entirely
+  RetryPolicy retry;
+  CircuitBreakerConfig breaker;
+};
+
+/**
+ * @brief Circuit breaker state
+ */
+enum class CircuitState {
+  Closed,  ///< Normal operation
+  Open,    ///< Failing fast until the open period elapses
+  HalfOpen ///< Letting probe calls through to test recovery
+};
+
+/**
+ * @brief Policy counters for a device
+ */
+struct PolicyStats {
+  uint64_t attempts = 0;        ///< Operations sent to the device
+  uint64_t successes = 0;       ///< Attempts that succeeded
+  uint64_t failures = 0;        ///< Attempts that failed with a device error
+  uint64_t retries = 0;         ///< Attempts that were retries
+  uint64_t short_circuited = 0; ///< Calls rejected by the open breaker
+  uint64_t trips = 0;           ///< Times the breaker opened
+  int consecutive_failures = 0; ///< Current failure streak
+  CircuitState state = CircuitState::Closed; ///< Current breaker state
+};
+
+/**
+ * @brief Convert circuit state to string
+ * @param state Circuit state
+ * @return State name
+ */
+const char *to_string(CircuitState state);
+
+/**
+ * @brief Check whether an error is worth retrying
+ * @param error Error returned by a device operation
+ * @return true for busy/in-use devices and timed-out calls
+ *
+ * Device-in-use HRESULTs are reported as ErrorCode::DeviceBusy by the
+ * platform layer, so this covers the retryable subset of is_device_error().
+ */
+bool is_transient_error(const Error &error);
+
+/**
+ * @brief Check whether an error counts against the device's health
+ * @param error Error returned by a device operation
+ * @return false for errors that describe the request rather than the device
+ * (unsupported property, invalid value or argument)
+ */
+bool is_device_failure(const Error &error);
+
+/**
+ * @brief Get the policy applied to newly opened devices
+ * @return Default device policy
+ */
+DevicePolicy default_device_policy();
+
+/**
+ * @brief Set the policy applied to newly opened devices
+ * @param policy Policy to use for devices opened from now on
+ */
+void set_default_device_policy(const DevicePolicy &policy);
+
+/**
+ * @brief Retry and circuit breaker state for one device
+ *
+ * Thread-safe. Operations are executed on the calling thread; backoff sleeps
+ * never block other callers or the device's I/O thread.
+ */
+class DevicePolicyEngine {
+public:
+  /**
+   * @brief Create engine
+   * @param policy Initial policy
+   */
+  explicit DevicePolicyEngine(const DevicePolicy &policy = default_device_policy());
+
+  /**
+   * @brief Run an operation under the retry policy and circuit breaker
+   * @param op Operation to attempt
+   * @return Result of the last attempt, or ErrorCode::DeviceBusy if the
+   * breaker is open
+   */
+  template <typename T> Result<T> run(const std::function<Result<T>()> &op) {
+    for (int attempt = 1;; ++attempt) {
+      if (auto rejected = admit(attempt)) {
+        return Result<T>(*rejected);
+      }
+      Result<T> result = op();
+      if (result.is_ok()) {
+        record_success();
+        return result;
+      }
+      auto delay = record_failure(result.error(), attempt);
+      if (!delay) {
+        return result;
+      }
+      std::this_thread::sleep_for(*delay);
+    }
+  }
+
+  /**
+   * @brief Replace the policy
+   * @param policy New policy (breaker state and counters are kept)
+   */
+  void set_policy(const DevicePolicy &policy);
+
+  /// Get the current policy
+  DevicePolicy policy() const;
+
+  /// Get counters and breaker state
+  PolicyStats stats() const;
+
+  /// Close the breaker and clear the failure streak
+  void reset();
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  /// Admit an attempt; returns the rejection error if the breaker is open
+  std::optional<Error> admit(int attempt);
+  void record_success();
+  /// Record a failed attempt; returns the backoff if it should be retried
+  std::optional<std::chrono::milliseconds> record_failure(const Error &error,
+                                                          int attempt);
+  std::chrono::milliseconds backoff(int retry);
+  void open_circuit();
+
+  mutable std::mutex mutex_;
+  DevicePolicy policy_;
+  PolicyStats stats_;
+  Clock::time_point opened_at_;
+  int probes_in_flight_ = 0;
+  std::mt19937 rng_;
+};
+
+} // namespace duvc
@@ -0,0 +1,292 @@
+#pragma once
+
+/**
+ * @file preset.h
+ * @brief Named property presets with a persistent store and diff-based recall
+ */
+
+#include <duvc-ctl/core/capability.h>
+#include <duvc-ctl/core/property_access.h>
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/types.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace duvc {
+
+// Forward declaration
+class DeviceActor;
+
+/**
+ * @brief One property value stored in a preset
+ */
+struct PresetValue {
+  bool video = false;                      ///< Video (true) or camera property
+  CamProp cam_prop = CamProp::Pan;         ///< Property when video is false
+  VidProp vid_prop = VidProp::Brightness;  ///< Property when video is true
+  PropSetting setting{0, CamMode::Manual}; ///< Value to recall
+};
+
+/**
+ * @brief Named, versioned set of property values
+ */
+struct Preset {
+  std::string name;          ///< Preset name (unique within a store)
+  uint32_t version = 0;      ///< Bumped by PresetStore::put() on every save
+  std::vector<PresetValue> values; ///< Values in recall order
+
+  /// Set a camera property value, replacing any earlier one
+  void set(CamProp prop, const PropSetting &setting);
+
+  /// Set a video property value, replacing any earlier one
+  void set(VidProp prop, const PropSetting &setting);
+};
+
+/**
+ * @brief Encode presets in the compact binary store format
+ * @param presets Presets to encode
+ * @return Encoded bytes
+ */
+std::vector<uint8_t> serialize_presets(const std::vector<Preset> &presets);
+
+/**
+ * @brief Decode presets from the compact binary store format
+ * @param data Bytes produced by serialize_presets()
+ * @return Presets, or ErrorCode::InvalidArgument if malformed
+ */
+Result<std::vector<Preset>> parse_presets(const std::vector<uint8_t> &data);
+
+/**
+ * @brief Get the default preset store location
+ * @return %APPDATA%\\duvc-ctl\\presets.bin on Windows,
+ * $XDG_CONFIG_HOME/duvc-ctl/presets.bin (or ~/.config/...) elsewhere
+ */
+std::filesystem::path default_preset_path();
+
+/**
+ * @brief Presets persisted in a single file
+ *
+ * The store is an in-memory list that load() and save() move to and from
+ * disk. It is not synchronized; share one store per thread or lock around it.
+ */
+class PresetStore {
+public:
+  /**
+   * @brief Create store for a file
+   * @param path Store file (not read until load())
+   */
+  explicit PresetStore(std::filesystem::path path = default_preset_path());
+
+  /**
+   * @brief Replace the in-memory presets with the file's contents
+   * @return Success (a missing file loads as empty), or the read/parse error
+   */
+  Result<void> load();
+
+  /**
+   * @brief Write the presets to the file
+   * @return Success or ErrorCode::SystemError
+   *
+   * Writes a temporary file next to the store and renames it into place, so
+   * an interrupted save never leaves a truncated store behind.
+   */
+  Result<void> save() const;
+
+  /**
+   * @brief Find preset by name
+   * @param name Preset name (case-sensitive)
+   * @return Preset, or nullptr if not stored
+   */
+  const Preset *find(const std::string &name) const;
+
+  /**
+   * @brief Add or replace a preset
+   * @param preset Preset to store; its version is set to one past the
+   * replaced preset's (1 for a new name)
+   * @return Stored preset
+   */
+  const Preset &put(Preset preset);
+
+  /**
+   * @brief Remove preset by name
+   * @param name Preset name
+   * @return true if a preset was removed
+   */
+  bool remove(const std::string &name);
+
+  /// Get the stored presets in insertion order
+  const std::vector<Preset> &presets() const { return presets_; }
+
+  /// Get the store file
+  const std::filesystem::path &path() const { return path_; }
+
+private:
+  std::filesystem::path path_;
+  std::vector<Preset> presets_;
+};
+
+/**
+ * @brief Preset resolved against one device's capabilities
+ *
+ * Each step's setting is already clamped to the device's range, so recall
+ * needs no range queries.
+ */
+struct PresetPlan {
+  /// A write the plan may perform
+  struct Step {
+    PresetValue value; ///< Value to write (clamped to range)
+    PropRange range;   ///< Device range for the property
+  };
+
+  std::string name;      ///< Preset name
+  uint32_t version = 0;  ///< Preset version the plan was compiled from
+  std::vector<Step> steps; ///< Manual-mode values first, auto-mode last
+  std::vector<PresetValue> unsupported; ///< Values the device cannot take
+  int adjusted = 0;      ///< Steps whose value was clamped to the range
+};
+
+/**
+ * @brief Compile a preset against a capability snapshot
+ * @param preset Preset to compile
+ * @param capabilities Snapshot supplying the device's ranges
+ * @return Plan
+ */
+PresetPlan compile_preset(const Preset &preset,
+                          const DeviceCapabilities &capabilities);
+
+/**
+ * @brief Result of one preset recall
+ */
+struct PresetRecallReport {
+  /// What recall did with one plan step
+  struct Entry {
+    PresetValue value;     ///< Value written or skipped
+    ResetOutcome outcome = ResetOutcome::Skipped; ///< Written, Skipped or Failed
+    std::optional<Error> error; ///< Write error when outcome is Failed
+  };
+
+  int writes = 0;      ///< Properties written
+  int skipped = 0;     ///< Properties already holding the preset value
+  int failed = 0;      ///< Writes that returned an error
+  int unsupported = 0; ///< Preset values the device cannot take
+  std::vector<Entry> entries; ///< One per plan step, in write order
+  std::chrono::microseconds compile_time{0}; ///< Range reads and planning
+  std::chrono::microseconds write_time{0};   ///< Current reads and writes
+};
+
+/**
+ * @brief Recalls presets on one device with minimal writes
+ *
+ * The recaller caches each property's range and last known value. A recall
+ * compiles the preset once into a PresetPlan, then writes only the steps
+ * whose cached value differs, and updates the cache from the writes it
+ * makes. Recalling a second preset therefore reads nothing and writes only
+ * what the two presets change. A value written through the recaller's Camera
+ * by anything else (Camera::set(), nudge(), ...) is forgotten automatically;
+ * call invalidate() if another handle or application may have changed the
+ * device.
+ *
+ * Methods are thread-safe; recalls on one recaller are serialized.
+ */
+class PresetRecaller {
+public:
+  /**
+   * @brief Create recaller on a camera
+   * @param camera Camera to use (must outlive the recaller)
+   */
+  explicit PresetRecaller(Camera &camera);
+
+  /**
+   * @brief Create recaller on a camera, seeded from a capability snapshot
+   * @param camera Camera to use (must outlive the recaller)
+   * @param capabilities Snapshot of the same device; its ranges and current
+   * values seed the cache
+   */
+  PresetRecaller(Camera &camera, const DeviceCapabilities &capabilities);
+
+  /**
+   * @brief Create recaller on a device actor
+   * @param actor Device actor (kept alive by the recaller)
+   */
+  explicit PresetRecaller(std::shared_ptr<DeviceActor> actor);
+
+  PresetRecaller(const PresetRecaller &) = delete;
+  PresetRecaller &operator=(const PresetRecaller &) = delete;
+
+  /**
+   * @brief Compile a preset against this device
+   * @param preset Preset to compile
+   * @return Plan (cached by name, and reused while the preset's values are
+   * unchanged)
+   */
+  PresetPlan compile(const Preset &preset);
+
+  /**
+   * @brief Recall a preset
+   * @param preset Preset to recall
+   * @return Report; per-property write errors are in its entries
+   */
+  PresetRecallReport recall(const Preset &preset);
+
+  /**
+   * @brief Recall a compiled plan
+   * @param plan Plan for this device
+   * @return Report; per-property write errors are in its entries
+   */
+  PresetRecallReport recall(const PresetPlan &plan);
+
+  /**
+   * @brief Forget cached values so the next recall reads them again
+   *
+   * Ranges and compiled plans are kept.
+   */
+  void invalidate();
+
+  /**
+   * @brief Capture the device's current values as a preset
+   * @param name Name for the preset
+   * @param filter Properties to capture (relative controls never are)
+   * @return Preset with the current value of every readable property
+   */
+  Preset capture(const std::string &name, const ResetFilter &filter = {});
+
+private:
+  /// Cached range and value of one property
+  struct Slot {
+    bool probed = false; ///< Range has been read
+    PropertyAccess access;
+    PropertyCapability capability;
+    uint64_t writes = 0; ///< Camera write count the current value matches
+  };
+
+  /// Compiled plan and the preset values it was compiled from
+  struct CachedPlan {
+    std::vector<PresetValue> source;
+    PresetPlan plan;
+  };
+
+  using Binder = std::function<PropertyAccess(const PresetValue &)>;
+
+  Slot &slot(const PresetValue &value);
+  uint64_t camera_writes(const PresetValue &value) const;
+  PresetPlan compile_locked(const Preset &preset);
+  PresetRecallReport recall_locked(const PresetPlan &plan);
+
+  Binder bind_;
+  Camera *camera_ = nullptr; ///< Camera whose writes invalidate the cache
+  std::mutex mutex_;
+  std::map<int, Slot> slots_; ///< Keyed by domain and property
+  std::unordered_map<std::string, CachedPlan> plans_;
+};
+
+} // namespace duvc
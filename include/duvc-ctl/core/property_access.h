@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @file property_access.h
+ * @brief Type-erased access to a single device property
+ */
+
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/types.h>
+
+#include <functional>
+#include <memory>
+
+namespace duvc {
+
+// Forward declarations
+class Camera;
+class DeviceActor;
+
+/**
+ * @brief Get/set/range operations bound to one property of one device
+ *
+ * Lets engines that drive a property (controllers, searches) work the same
+ * way on camera and video processing properties, and on any backend.
+ */
+struct PropertyAccess {
+  std::function<Result<PropSetting>()> get;              ///< Read current value
+  std::function<Result<void>(const PropSetting &)> set;  ///< Write new value
+  std::function<Result<PropRange>()> range;              ///< Read valid range
+
+  /// Check that all operations are bound
+  bool is_valid() const { return get && set && range; }
+};
+
+/**
+ * @brief Bind a camera property of a Camera
+ * @param camera Camera to use (must outlive the returned object)
+ * @param prop Camera property
+ * @return Property access through the camera's policy and timeout
+ */
+PropertyAccess property_access(Camera &camera, CamProp prop);
+
+/**
+ * @brief Bind a video processing property of a Camera
+ * @param camera Camera to use (must outlive the returned object)
+ * @param prop Video property
+ * @return Property access through the camera's policy and timeout
+ */
+PropertyAccess property_access(Camera &camera, VidProp prop);
+
+/**
+ * @brief Bind a camera property of a device actor
+ * @param actor Device actor (kept alive by the returned object)
+ * @param prop Camera property
+ * @return Property access that calls the actor directly
+ */
+PropertyAccess property_access(std::shared_ptr<DeviceActor> actor,
+                               CamProp prop);
+
+/**
+ * @brief Bind a video processing property of a device actor
+ * @param actor Device actor (kept alive by the returned object)
+ * @param prop Video property
+ * @return Property access that calls the actor directly
+ */
+PropertyAccess property_access(std::shared_ptr<DeviceActor> actor,
+                               VidProp prop);
+
+} // namespace duvc
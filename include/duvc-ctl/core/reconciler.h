@@ -0,0 +1,245 @@
+#pragma once
+
+/**
+ * @file reconciler.h
+ * @brief Desired-state reconciliation for camera fleets
+ */
+
+#include <duvc-ctl/core/camera.h>
+#include <duvc-ctl/core/preset.h>
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/types.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace duvc {
+
+// Forward declaration
+class DeviceActor;
+
+/**
+ * @brief Selects the devices a desired-state entry applies to
+ */
+struct DeviceSelector {
+  std::wstring path; ///< Exact device path (case-insensitive); empty: use name
+  std::wstring name; ///< Name pattern with * and ? wildcards (case-insensitive)
+
+  /// Check whether a device matches
+  bool matches(const Device &device) const;
+};
+
+/**
+ * @brief Desired property values for the devices one selector matches
+ */
+struct DesiredDeviceState {
+  DeviceSelector selector;
+  std::vector<PresetValue> properties; ///< Values to hold
+};
+
+/**
+ * @brief Desired state of a fleet
+ *
+ * A device takes the properties of every entry that matches it; later
+ * entries override earlier ones for the same property.
+ */
+struct DesiredState {
+  std::vector<DesiredDeviceState> devices;
+  std::chrono::milliseconds interval{60000}; ///< Period of a full sweep
+  double max_ops_per_second = 20.0; ///< Reads plus writes across the fleet
+  int tolerance = 0; ///< Allowed |actual - desired| for manual values
+  /// Deadline for each device call; a device that misses it counts as a
+  /// failure and fails fast until it responds again (zero waits indefinitely)
+  std::chrono::milliseconds timeout = DEFAULT_OPERATION_TIMEOUT;
+
+  /**
+   * @brief Get the desired values for one device
+   * @param device Device to look up
+   * @return Merged values of the matching entries (empty if none match)
+   */
+  std::vector<PresetValue> desired_for(const Device &device) const;
+};
+
+/**
+ * @brief Parse a JSON desired-state document
+ * @param text UTF-8 JSON text
+ * @return Desired state, or ErrorCode::InvalidArgument naming the bad entry
+ *
+ * The document is an object with a "devices" array and optional "interval"
+ * (seconds per sweep), "rate" (operations per second), "timeout" (seconds
+ * per device call) and "tolerance". Each
+ * device entry has "path" or "name" (wildcards allowed) and a "properties"
+ * object mapping property names to an integer, "auto", or an object with
+ * "value" and "mode". Names found in both domains take a "cam." or "vid."
+ * prefix.
+ */
+Result<DesiredState> parse_desired_state(const std::string &text);
+
+/**
+ * @brief Load a JSON desired-state document
+ * @param path File to read
+ * @return Desired state
+ */
+Result<DesiredState> load_desired_state(const std::filesystem::path &path);
+
+/**
+ * @brief A property found away from its desired value
+ */
+struct DriftEvent {
+  Device device;        ///< Device that drifted
+  PresetValue desired;  ///< Desired value
+  std::optional<PropSetting> actual; ///< Value read (none if the read failed)
+  bool corrected = false;            ///< Corrective write succeeded
+  std::optional<Error> error;        ///< Read or write error
+  std::chrono::microseconds latency{0}; ///< From detection to write completion
+};
+
+/**
+ * @brief Outcome of one sweep over the fleet
+ */
+struct SweepReport {
+  size_t devices = 0;  ///< Devices with desired state that were swept
+  size_t reads = 0;    ///< Property reads
+  size_t writes = 0;   ///< Corrective writes
+  size_t drifted = 0;  ///< Properties found away from their desired value
+  size_t failures = 0; ///< Failed reads, writes and device connections
+  /// No read, write or connection failed and every drifted property was
+  /// corrected
+  bool converged = false;
+  std::chrono::microseconds duration{0}; ///< Wall time of the sweep
+  std::vector<DriftEvent> events;        ///< Drift found, in sweep order
+};
+
+/**
+ * @brief Running totals of a reconciler
+ */
+struct ReconcilerStats {
+  uint64_t sweeps = 0;
+  uint64_t reads = 0;
+  uint64_t writes = 0;
+  uint64_t drift_events = 0;
+  uint64_t failures = 0;
+  bool converged = true; ///< The last sweep left no drift behind
+  /// Time from the first drift detected after convergence to the end of the
+  /// sweep that restored it (zero until drift has been seen and fixed)
+  std::chrono::microseconds last_convergence_time{0};
+};
+
+/**
+ * @brief Holds a fleet of cameras at a desired state
+ *
+ * Each sweep reads the desired properties of every matching device in one
+ * batched actor call per device, and writes only the ones that drifted. All
+ * device I/O is paced by a fleet-wide rate limit. In the background, the
+ * devices of a sweep are spread evenly across the sweep interval, so a large
+ * fleet never bursts the USB bus.
+ *
+ * Device actors are kept between sweeps and released once their device
+ * leaves the device list.
+ */
+class Reconciler {
+public:
+  /// Supplies the devices to reconcile
+  using DeviceSource = std::function<std::vector<Device>()>;
+
+  /// Supplies the actor that performs a device's I/O
+  using ActorSource = std::function<std::shared_ptr<DeviceActor>(const Device &)>;
+
+  /// Called for each drift event, on the sweeping thread
+  using DriftCallback = std::function<void(const DriftEvent &)>;
+
+  /// Called after each background sweep, on the sweeping thread
+  using SweepCallback = std::function<void(const SweepReport &)>;
+
+  /**
+   * @brief Create reconciler
+   * @param state Desired state
+   * @param devices Device source (list_devices() by default)
+   * @param actors Actor source (the shared device actor by default)
+   */
+  explicit Reconciler(DesiredState state, DeviceSource devices = nullptr,
+                      ActorSource actors = nullptr);
+
+  /// Stops the background thread
+  ~Reconciler();
+
+  Reconciler(const Reconciler &) = delete;
+  Reconciler &operator=(const Reconciler &) = delete;
+
+  /**
+   * @brief Replace the desired state
+   * @param state New desired state (applies from the next device swept)
+   */
+  void set_desired_state(DesiredState state);
+
+  /**
+   * @brief Sweep every device now
+   * @param on_drift Optional per-event callback
+   * @return Sweep report
+   *
+   * Paced by the rate limit but not spread over the interval.
+   */
+  SweepReport sweep(DriftCallback on_drift = nullptr);
+
+  /**
+   * @brief Start sweeping in the background
+   * @param on_drift Optional per-event callback
+   * @param on_sweep Optional per-sweep callback
+   * @return false if already running
+   */
+  bool start(DriftCallback on_drift = nullptr, SweepCallback on_sweep = nullptr);
+
+  /// Stop background sweeping and wait for the current device to finish
+  void stop();
+
+  /// Check whether background sweeping is running
+  bool running() const;
+
+  /// Get running totals
+  ReconcilerStats stats() const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  /// Reconcile one device; returns false if stopped while pacing
+  bool reconcile_device(const Device &device, SweepReport &report,
+                        const DriftCallback &on_drift);
+  /// Get the actor held for a device, acquiring it on first use
+  std::shared_ptr<DeviceActor> actor_for(const Device &device);
+  /// Release the actors of devices no longer listed
+  void retain_actors(const std::vector<Device> &devices);
+  /// Wait until the rate limit allows ops operations
+  bool pace(size_t ops);
+  /// Wait until a time point; returns false if stopped first
+  bool wait_until(Clock::time_point when);
+  void finish_sweep(SweepReport &report, Clock::time_point start);
+  void run(DriftCallback on_drift, SweepCallback on_sweep);
+  DesiredState desired_state() const;
+
+  DeviceSource devices_;
+  ActorSource actors_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  DesiredState state_;
+  ReconcilerStats stats_;
+  std::optional<Clock::time_point> drift_since_;
+  Clock::time_point next_op_{};
+  /// Held actors by case-folded path
+  std::map<std::wstring, std::shared_ptr<DeviceActor>> held_actors_;
+  bool stopping_ = false;
+  bool running_ = false;
+  std::thread thread_;
+};
+
+} // namespace duvc
@@ -0,0 +1,93 @@
+#pragma once
+
+/**
+ * @file scheduler.h
+ * @brief Shared timer thread for deferred, non-blocking work
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace duvc {
+
+/**
+ * @brief Runs short tasks at scheduled times on a single thread
+ *
+ * Tasks must not block: device I/O belongs on the device's actor thread, with
+ * the completion scheduling the next step. One scheduler can therefore serve
+ * any number of devices. Thread-safe.
+ */
+class TaskScheduler {
+public:
+  using Clock = std::chrono::steady_clock;
+  using Task = std::function<void()>;
+
+  TaskScheduler();
+
+  /// Stops the thread; tasks that have not run yet are discarded
+  ~TaskScheduler();
+
+  TaskScheduler(const TaskScheduler &) = delete;
+  TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+  /**
+   * @brief Run a task at a point in time
+   * @param when Earliest time to run the task (past times run immediately)
+   * @param task Task to run on the scheduler thread
+   *
+   * Tasks due at the same time run in the order they were scheduled.
+   */
+  void schedule(Clock::time_point when, Task task);
+
+  /**
+   * @brief Run a task after a delay
+   * @param delay Delay from now
+   * @param task Task to run on the scheduler thread
+   */
+  void schedule_after(std::chrono::nanoseconds delay, Task task) {
+    schedule(Clock::now() + delay, std::move(task));
+  }
+
+  /// Get the number of tasks waiting to run
+  size_t pending() const;
+
+  /// Check whether the caller is running on the scheduler thread
+  bool on_scheduler_thread() const {
+    return std::this_thread::get_id() == thread_.get_id();
+  }
+
+  /**
+   * @brief Get the process-wide scheduler
+   * @return Scheduler shared by the library's waiting operations
+   */
+  static TaskScheduler &shared();
+
+private:
+  struct Entry {
+    Clock::time_point when;
+    uint64_t sequence;
+    Task task;
+  };
+  struct Later {
+    bool operator()(const Entry &a, const Entry &b) const {
+      return a.when != b.when ? a.when > b.when : a.sequence > b.sequence;
+    }
+  };
+
+  void run();
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  std::priority_queue<Entry, std::vector<Entry>, Later> queue_;
+  uint64_t sequence_ = 0;
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+} // namespace duvc
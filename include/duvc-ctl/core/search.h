@@ -0,0 +1,104 @@
+#pragma once
+
+/**
+ * @file search.h
+ * @brief Score-driven search over a numeric property (autofocus, exposure)
+ */
+
+#include <duvc-ctl/core/property_access.h>
+#include <duvc-ctl/core/result.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace duvc {
+
+/**
+ * @brief Search strategy
+ */
+enum class SearchMethod {
+  CoarseToFine, ///< Evenly spaced sweep, then repeated sweeps around the best
+  GoldenSection ///< Golden-section search (assumes a single peak)
+};
+
+/**
+ * @brief Deferred score computation
+ *
+ * Returned by a ProbeFunction once it has captured what it needs at the
+ * current position (e.g. a frame). It is evaluated while the device already
+ * moves to the next position.
+ */
+using DeferredScore = std::function<double()>;
+
+/**
+ * @brief Capture callback: called with the property at @p value
+ *
+ * Must return quickly once its input is captured; the expensive part goes in
+ * the returned DeferredScore.
+ */
+using ProbeFunction = std::function<DeferredScore(int value)>;
+
+/**
+ * @brief Score callback: called with the property at @p value
+ */
+using ScoreFunction = std::function<double(int value)>;
+
+/**
+ * @brief Search options
+ */
+struct SearchOptions {
+  SearchMethod method = SearchMethod::CoarseToFine;
+  bool maximize = true;         ///< false searches for the lowest score
+  std::optional<int> lower;     ///< Lower bound (default: range minimum)
+  std::optional<int> upper;     ///< Upper bound (default: range maximum)
+  int points_per_pass = 9;      ///< Samples per coarse-to-fine pass (>= 3)
+  int max_evaluations = 64;     ///< Upper bound on scored positions
+  std::chrono::milliseconds settle{0}; ///< Wait after each write before probing
+  bool apply_best = true;       ///< Leave the property at the best value
+};
+
+/**
+ * @brief Search outcome and cost
+ */
+struct SearchResult {
+  int best_value = 0;      ///< Best position found
+  double best_score = 0.0; ///< Score at best_value
+  int evaluations = 0;     ///< Positions scored
+  uint64_t writes = 0;     ///< Property writes issued
+  std::chrono::milliseconds elapsed{0};        ///< Total wall time
+  std::vector<std::pair<int, double>> samples; ///< Scores in evaluation order
+};
+
+/**
+ * @brief Search a property for the best score
+ * @param target Property to move
+ * @param probe Capture callback; scoring overlaps the next move
+ * @param options Search options
+ * @return Search result, or the first device error
+ *
+ * Positions are snapped to the property's step and each is scored at most
+ * once. Within a coarse-to-fine pass the next write is issued while the
+ * previous position's score is being computed, and positions are visited in
+ * the direction that minimizes travel. Golden-section moves depend on the
+ * last comparison and are therefore not overlapped.
+ */
+Result<SearchResult> search_property(const PropertyAccess &target,
+                                     const ProbeFunction &probe,
+                                     const SearchOptions &options = {});
+
+/**
+ * @brief Search a property for the best score (non-overlapped scoring)
+ * @param target Property to move
+ * @param score Score callback, called with the property at each position
+ * @param options Search options
+ * @return Search result, or the first device error
+ */
+Result<SearchResult> search_property(const PropertyAccess &target,
+                                     const ScoreFunction &score,
+                                     const SearchOptions &options = {});
+
+} // namespace duvc
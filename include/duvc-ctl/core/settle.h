@@ -0,0 +1,125 @@
+#pragma once
+
+/**
+ * @file settle.h
+ * @brief Waiting for motorized properties to reach a target value
+ */
+
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/scheduler.h>
+#include <duvc-ctl/core/types.h>
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+
+namespace duvc {
+
+// Forward declaration
+class DeviceActor;
+
+/**
+ * @brief How a settle wait ended
+ */
+enum class SettleStatus {
+  Converged, ///< Value reached the target within tolerance
+  Stalled,   ///< Value stopped changing outside the tolerance
+  TimedOut   ///< Deadline passed while the value was still changing
+};
+
+/**
+ * @brief Settle wait options
+ */
+struct SettleOptions {
+  int tolerance = 0; ///< Allowed |achieved - target|
+  std::chrono::milliseconds deadline{3000};       ///< Give up after this long
+  std::chrono::milliseconds initial_interval{5};  ///< First poll delay
+  std::chrono::milliseconds max_interval{100};    ///< Longest poll delay
+  double backoff = 1.5; ///< Poll delay growth factor while not settled
+  /// Report Stalled once the value has not changed for this long (0 = never)
+  std::chrono::milliseconds stall_timeout{300};
+};
+
+/**
+ * @brief Outcome of a settle wait
+ */
+struct SettleResult {
+  SettleStatus status = SettleStatus::TimedOut;
+  PropSetting achieved{0, CamMode::Manual}; ///< Last value read
+  std::chrono::milliseconds elapsed{0}; ///< Time from start of wait to outcome
+  int polls = 0;                        ///< Reads issued while waiting
+
+  /// Check whether the target was reached
+  bool converged() const { return status == SettleStatus::Converged; }
+};
+
+/**
+ * @brief Non-blocking property read
+ *
+ * Starts a read and calls the completion with its result, typically on the
+ * device's actor thread. The completion must be called exactly once.
+ */
+using AsyncPropertyRead =
+    std::function<void(std::function<void(Result<PropSetting>)>)>;
+
+/**
+ * @brief Bind a non-blocking read of a camera property
+ * @param actor Device actor (kept alive by the returned object)
+ * @param prop Camera property
+ * @param timeout Read deadline (zero waits indefinitely)
+ * @return Read queued on the actor
+ */
+AsyncPropertyRead async_property_read(std::shared_ptr<DeviceActor> actor,
+                                      CamProp prop,
+                                      std::chrono::milliseconds timeout = {});
+
+/**
+ * @brief Bind a non-blocking read of a video processing property
+ * @param actor Device actor (kept alive by the returned object)
+ * @param prop Video property
+ * @param timeout Read deadline (zero waits indefinitely)
+ * @return Read queued on the actor
+ */
+AsyncPropertyRead async_property_read(std::shared_ptr<DeviceActor> actor,
+                                      VidProp prop,
+                                      std::chrono::milliseconds timeout = {});
+
+/**
+ * @brief Poll a property until it settles near a target
+ * @param read Non-blocking read of the property
+ * @param target Target value
+ * @param options Tolerance, deadline and polling intervals
+ * @param scheduler Scheduler driving the polls
+ * @return Future for the settle outcome, or the first non-transient read error
+ *
+ * Polls start at initial_interval and back off towards max_interval, so a
+ * fast move is seen quickly without hammering a slow one. No thread is
+ * blocked while waiting; reads run on the device's actor thread.
+ */
+std::future<Result<SettleResult>>
+wait_for_settle(AsyncPropertyRead read, int target,
+                const SettleOptions &options = {},
+                TaskScheduler &scheduler = TaskScheduler::shared());
+
+/**
+ * @brief Poll a property until it settles near a target (callback form)
+ * @param read Non-blocking read of the property
+ * @param target Target value
+ * @param options Tolerance, deadline and polling intervals
+ * @param done Called once with the outcome, on the scheduler or actor thread
+ * @param scheduler Scheduler driving the polls
+ */
+void wait_for_settle(AsyncPropertyRead read, int target,
+                     const SettleOptions &options,
+                     std::function<void(Result<SettleResult>)> done,
+                     TaskScheduler &scheduler = TaskScheduler::shared());
+
+/**
+ * @brief Convert settle status to string
+ * @param status Settle status
+ * @return Status name
+ */
+const char *to_string(SettleStatus status);
+
+} // namespace duvc
@@ -0,0 +1,205 @@
+#pragma once
+
+/**
+ * @file timeline.h
+ * @brief Time-scheduled cue list playback across cameras
+ */
+
+#include <duvc-ctl/core/preset.h>
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/types.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace duvc {
+
+// Forward declaration
+class DeviceActor;
+
+/**
+ * @brief What a cue writes
+ */
+enum class CueDomain {
+  Camera, ///< Camera control property (CamProp)
+  Video,  ///< Video processing property (VidProp)
+  Preset  ///< Every value of a named preset
+};
+
+/**
+ * @brief One timed property write or preset recall
+ */
+struct Cue {
+  std::chrono::microseconds at{0}; ///< Offset from timeline start
+  std::wstring device;   ///< Device path or name (empty: use device_index)
+  int device_index = -1; ///< Index into the device list when device is empty
+  CueDomain domain = CueDomain::Camera;
+  CamProp cam_prop = CamProp::Pan;        ///< Property when domain is Camera
+  VidProp vid_prop = VidProp::Brightness; ///< Property when domain is Video
+  PropSetting setting{0, CamMode::Manual}; ///< Value to write
+  std::string preset; ///< Preset name when domain is Preset
+};
+
+/**
+ * @brief Parse a JSON cue list
+ * @param text UTF-8 JSON text
+ * @return Cues in file order, or ErrorCode::InvalidArgument naming the bad cue
+ *
+ * The document is an array of cues, or an object with a "cues" array. Each
+ * cue has "time" (seconds from start), "device" (path, name, or list index),
+ * and either "preset" (a preset name) or "property", "value", and optionally
+ * "mode" ("manual" or "auto") and "domain" ("cam" or "vid"; required only for
+ * names found in both domains).
+ */
+Result<std::vector<Cue>> parse_cue_json(const std::string &text);
+
+/**
+ * @brief Parse a compact binary cue list
+ * @param data Bytes produced by serialize_cue_binary()
+ * @return Cues in file order, or ErrorCode::InvalidArgument if malformed
+ */
+Result<std::vector<Cue>> parse_cue_binary(const std::vector<uint8_t> &data);
+
+/**
+ * @brief Encode a cue list in the compact binary format
+ * @param cues Cues to encode
+ * @return Encoded bytes
+ */
+std::vector<uint8_t> serialize_cue_binary(const std::vector<Cue> &cues);
+
+/**
+ * @brief Load a cue file, detecting JSON or binary format
+ * @param path File to read
+ * @return Cues in file order
+ */
+Result<std::vector<Cue>> load_cue_file(const std::filesystem::path &path);
+
+/**
+ * @brief Timeline playback options
+ */
+struct TimelineOptions {
+  /// How early each cue is handed to its device worker. Time zero is this
+  /// long after play() is called, so cues at 0 can fire on time too.
+  std::chrono::milliseconds lead{20};
+  /// Final window before a cue fires in which the worker busy-waits instead
+  /// of sleeping, to avoid timer granularity
+  std::chrono::microseconds spin{1500};
+  /// Deadline for opening each device in prepare()
+  std::chrono::milliseconds open_timeout{5000};
+  /// Deadline for each cue's write, counted from the time the cue is due. A
+  /// write still pending after it is reported as timed out.
+  std::chrono::milliseconds write_timeout{5000};
+};
+
+/**
+ * @brief Planned versus actual timing of one fired cue
+ */
+struct CueReport {
+  size_t index = 0;                       ///< Position in the cue list
+  std::chrono::microseconds planned{0};   ///< Scheduled offset
+  std::chrono::microseconds fired{0};     ///< Offset when the write started
+  std::chrono::microseconds completed{0}; ///< Offset when the write returned
+  std::optional<Error> error;             ///< Write error, if any
+
+  /// Get how late the write started (negative if early)
+  std::chrono::microseconds lateness() const { return fired - planned; }
+};
+
+/**
+ * @brief Outcome of a timeline run
+ */
+struct TimelineReport {
+  std::vector<CueReport> cues; ///< Fired cues in planned order
+  size_t failures = 0; ///< Cues whose write returned an error or timed out
+  size_t timed_out = 0; ///< Cues whose device missed the write deadline
+  std::chrono::microseconds lateness_avg{0}; ///< Mean start lateness
+  std::chrono::microseconds lateness_max{0}; ///< Worst start lateness
+  bool cancelled = false; ///< cancel() stopped the run before the last cue
+};
+
+/**
+ * @brief Plays a cue list against a set of devices
+ *
+ * prepare() resolves every cue to a device and property, opens each device
+ * once and checks that the properties are supported, so nothing is looked up
+ * while the timeline runs. A preset cue is compiled against its device by a
+ * PresetRecaller, and fires as the plan's writes in order. play() then hands
+ * each cue to its device's actor thread shortly before it is due; the actor
+ * waits out the remainder and writes, so a slow device never delays cues on
+ * other devices.
+ */
+class TimelinePlayer {
+public:
+  /// Supplies the actor that performs a device's writes
+  using ActorSource = std::function<std::shared_ptr<DeviceActor>(const Device &)>;
+
+  /// Called once per fired cue, on the device's actor thread
+  using CueCallback = std::function<void(const CueReport &)>;
+
+  /**
+   * @brief Create player
+   * @param cues Cue list (any order)
+   * @param options Timing options
+   */
+  explicit TimelinePlayer(std::vector<Cue> cues, TimelineOptions options = {});
+
+  ~TimelinePlayer();
+
+  TimelinePlayer(const TimelinePlayer &) = delete;
+  TimelinePlayer &operator=(const TimelinePlayer &) = delete;
+
+  /**
+   * @brief Resolve cues and open their devices
+   * @param devices Devices that cues may refer to
+   * @param source Actor for each device (the shared device actor by default)
+   * @param presets Presets that preset cues may name
+   * @return Success, or the first resolution, connection or support error
+   */
+  Result<void> prepare(const std::vector<Device> &devices,
+                       ActorSource source = nullptr,
+                       const std::vector<Preset> &presets = {});
+
+  /**
+   * @brief Run the timeline to completion
+   * @param on_cue Optional per-cue callback
+   * @return Timing report, or ErrorCode::InvalidArgument if not prepared
+   *
+   * Blocks until every cue has fired or cancel() is called. A device that
+   * hangs delays the return by at most TimelineOptions::write_timeout past
+   * its last cue; its unfinished cues count as timed out.
+   */
+  Result<TimelineReport> play(CueCallback on_cue = nullptr);
+
+  /// Stop a running play() before its remaining cues fire. Thread-safe.
+  void cancel();
+
+  /// Get the number of distinct devices the prepared cues use
+  size_t device_count() const { return actors_.size(); }
+
+  /// Get the cue list
+  const std::vector<Cue> &cues() const { return cues_; }
+
+private:
+  struct Prepared;
+  struct Run;
+
+  std::vector<Cue> cues_;
+  TimelineOptions options_;
+  std::vector<std::shared_ptr<DeviceActor>> actors_;
+  std::vector<Prepared> prepared_; ///< One per cue, in planned order
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool cancelled_ = false;
+  std::shared_ptr<Run> run_; ///< State shared with the current run's tasks
+};
+
+} // namespace duvc
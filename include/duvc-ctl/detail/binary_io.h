@@ -0,0 +1,127 @@
+#pragma once
+
+/**
+ * @file binary_io.h
+ * @brief Little-endian encoding helpers for the binary file formats
+ *
+ * @internal This header contains implementation details and should not be used
+ * directly. Traces, binary cue files and the preset store share these helpers.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace duvc::detail {
+
+/**
+ * @brief Append the low bytes of a value, least significant first
+ * @param out Buffer to append to
+ * @param value Value to encode
+ * @param bytes Number of bytes to write (1-8)
+ */
+inline void put(std::vector<uint8_t> &out, uint64_t value, int bytes) {
+  for (int i = 0; i < bytes; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+/**
+ * @brief Append a u16 length-prefixed string
+ * @param out Buffer to append to
+ * @param text Bytes to write; truncated to 65535
+ */
+inline void put_string(std::vector<uint8_t> &out, const std::string &text) {
+  size_t length = std::min<size_t>(text.size(), 0xFFFF);
+  put(out, length, 2);
+  out.insert(out.end(), text.begin(),
+             text.begin() + static_cast<std::ptrdiff_t>(length));
+}
+
+/**
+ * @brief Check whether data starts with a format's magic bytes
+ * @param data Encoded data
+ * @param magic Magic bytes (including the version byte)
+ */
+template <size_t N>
+bool has_magic(const std::vector<uint8_t> &data, const char (&magic)[N]) {
+  return data.size() >= N &&
+         std::equal(std::begin(magic), std::end(magic), data.begin(),
+                    [](char a, uint8_t b) { return static_cast<uint8_t>(a) == b; });
+}
+
+/**
+ * @brief Bounds-checked little-endian reader over a byte buffer
+ *
+ * @internal Every read returns false, without consuming anything, if the
+ * buffer is too short.
+ */
+class Reader {
+public:
+  /**
+   * @brief Create reader
+   * @param data Buffer (must outlive the reader)
+   * @param pos Offset of the first byte to read, e.g. past the magic
+   */
+  explicit Reader(const std::vector<uint8_t> &data, size_t pos = 0)
+      : data_(data), pos_(std::min(pos, data.size())) {}
+
+  /// Read an unsigned value of the given width
+  bool get(uint64_t &value, int bytes) {
+    if (remaining() < static_cast<size_t>(bytes)) {
+      return false;
+    }
+    value = 0;
+    for (int i = 0; i < bytes; ++i) {
+      value |= static_cast<uint64_t>(data_[pos_++]) << (8 * i);
+    }
+    return true;
+  }
+
+  /// Read a signed 32-bit value
+  bool get_int(int &value) {
+    uint64_t raw;
+    if (!get(raw, 4)) {
+      return false;
+    }
+    value = static_cast<int32_t>(static_cast<uint32_t>(raw));
+    return true;
+  }
+
+  /// Read length raw bytes
+  bool get_bytes(std::string &out, size_t length) {
+    if (remaining() < length) {
+      return false;
+    }
+    out.assign(data_.begin() + static_cast<std::ptrdiff_t>(pos_),
+               data_.begin() + static_cast<std::ptrdiff_t>(pos_ + length));
+    pos_ += length;
+    return true;
+  }
+
+  /// Read a string written by put_string()
+  bool get_string(std::string &out) {
+    size_t start = pos_;
+    uint64_t length;
+    if (!get(length, 2) || !get_bytes(out, static_cast<size_t>(length))) {
+      pos_ = start;
+      return false;
+    }
+    return true;
+  }
+
+  /// Get the number of unread bytes
+  size_t remaining() const { return data_.size() - pos_; }
+
+  /// Check whether every byte has been read
+  bool at_end() const { return pos_ == data_.size(); }
+
+private:
+  const std::vector<uint8_t> &data_;
+  size_t pos_;
+};
+
+} // namespace duvc::detail
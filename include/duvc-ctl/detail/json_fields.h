@@ -0,0 +1,53 @@
+#pragma once
+
+/**
+ * @file json_fields.h
+ * @brief Field helpers shared by the JSON configuration parsers
+ *
+ * @internal This header contains implementation details and should not be used
+ * directly. Device profiles, desired states and fake scenarios parse property
+ * names and integers the same way through these helpers.
+ */
+
+#include <duvc-ctl/core/types.h>
+#include <duvc-ctl/utils/json.h>
+
+#include <optional>
+#include <string>
+
+namespace duvc::detail {
+
+/**
+ * @brief Check for an ASCII prefix, ignoring case
+ * @param s Text to check
+ * @param prefix Lowercase prefix
+ * @return true if s is longer than prefix and starts with it
+ */
+bool starts_with_ignore_case(const std::string &s, const char *prefix);
+
+/**
+ * @brief Check whether a JSON value is a number that fits in an int
+ * @param value Value to check
+ * @return true for whole numbers within the int32 range
+ */
+bool is_integer(const JsonValue &value);
+
+/**
+ * @brief A property from either domain
+ */
+struct NamedProperty {
+  bool video = false;                     ///< Video (true) or camera property
+  CamProp cam_prop = CamProp::Pan;        ///< Property when video is false
+  VidProp vid_prop = VidProp::Brightness; ///< Property when video is true
+};
+
+/**
+ * @brief Resolve a property name, with an optional cam./vid. domain prefix
+ * @param key Property name as written in the file
+ * @param error Set to a description when the name is unknown or ambiguous
+ * @return Property, or nullopt on error
+ */
+std::optional<NamedProperty> resolve_property(const std::string &key,
+                                              std::string &error);
+
+} // namespace duvc::detail
@@ -0,0 +1,101 @@
+#pragma once
+
+/**
+ * @file mpsc_queue.h
+ * @brief Lock-free multi-producer single-consumer intrusive queue
+ *
+ * @internal This header contains implementation details and should not be used
+ * directly.
+ */
+
+#include <atomic>
+
+namespace duvc::detail {
+
+/**
+ * @brief Intrusive link embedded in every queued element
+ *
+ * @internal Elements derive from this node; the queue never allocates.
+ */
+struct mpsc_node {
+  std::atomic<mpsc_node *> next{nullptr};
+};
+
+/**
+ * @brief Unbounded lock-free MPSC queue (Vyukov intrusive design)
+ *
+ * @internal push() is wait-free and may be called from any thread. pop() and
+ * empty() must only be called from the single consumer thread. Elements are
+ * returned in FIFO order. The queue does not own its elements.
+ */
+class mpsc_queue {
+public:
+  mpsc_queue() noexcept : head_(&stub_), tail_(&stub_) {}
+
+  // Non-copyable, non-movable (nodes point into stub_)
+  mpsc_queue(const mpsc_queue &) = delete;
+  mpsc_queue &operator=(const mpsc_queue &) = delete;
+
+  /**
+   * @brief Enqueue an element (any thread)
+   * @param node Element to enqueue; must stay alive until popped
+   */
+  void push(mpsc_node *node) noexcept {
+    node->next.store(nullptr, std::memory_order_relaxed);
+    mpsc_node *prev = head_.exchange(node, std::memory_order_seq_cst);
+    prev->next.store(node, std::memory_order_release);
+  }
+
+  /**
+   * @brief Dequeue the oldest element (consumer thread only)
+   * @return Element, or nullptr if empty or a push is still being linked
+   */
+  mpsc_node *pop() noexcept {
+    mpsc_node *tail = tail_;
+    mpsc_node *next = tail->next.load(std::memory_order_acquire);
+
+    if (tail == &stub_) {
+      if (!next) {
+        return nullptr;
+      }
+      tail_ = next;
+      tail = next;
+      next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next) {
+      tail_ = next;
+      return tail;
+    }
+
+    if (tail != head_.load(std::memory_order_acquire)) {
+      return nullptr; // producer between exchange and link
+    }
+
+    push(&stub_);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next) {
+      tail_ = next;
+      return tail;
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Check whether nothing is queued or in flight (consumer thread only)
+   * @return true if no push has been started since the last successful pop
+   */
+  bool empty() const noexcept {
+    // Fully drained state is head == tail == stub with no successor
+    return tail_ == &stub_ &&
+           head_.load(std::memory_order_seq_cst) == &stub_ &&
+           stub_.next.load(std::memory_order_acquire) == nullptr;
+  }
+
+private:
+  std::atomic<mpsc_node *> head_;
+  mpsc_node *tail_;
+  mpsc_node stub_;
+};
+
+} // namespace duvc::detail
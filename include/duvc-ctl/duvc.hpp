@@ -14,17 +14,36 @@
 // Core functionality
 #include <duvc-ctl/core/camera.h>
 #include <duvc-ctl/core/capability.h>
+#include <duvc-ctl/core/controller.h>
 #include <duvc-ctl/core/device.h>
+#include <duvc-ctl/core/device_identity.h>
+#include <duvc-ctl/core/device_profile.h>
+#include <duvc-ctl/core/device_registry.h>
+#include <duvc-ctl/core/policy.h>
+#include <duvc-ctl/core/preset.h>
+#include <duvc-ctl/core/property_access.h>
+#include <duvc-ctl/core/reconciler.h>
 #include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/scheduler.h>
+#include <duvc-ctl/core/search.h>
+#include <duvc-ctl/core/settle.h>
+#include <duvc-ctl/core/timeline.h>
 #include <duvc-ctl/core/types.h>
 
 // Utility functions
 #include <duvc-ctl/utils/error_decoder.h>
+#include <duvc-ctl/utils/event_queue.h>
+#include <duvc-ctl/utils/json.h>
 #include <duvc-ctl/utils/logging.h>
+#include <duvc-ctl/utils/serializer.h>
 #include <duvc-ctl/utils/string_conversion.h>
+#include <duvc-ctl/utils/utf8.h>
 
 // Platform interface (advanced users)
 #include <duvc-ctl/platform/interface.h>
+#include <duvc-ctl/platform/trace.h>
+#include <duvc-ctl/platform/chaos.h>
+#include <duvc-ctl/platform/fake.h>
 
 // Vendor extensions
 #include <duvc-ctl/vendor/constants.h>
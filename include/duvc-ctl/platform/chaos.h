@@ -0,0 +1,197 @@
+#pragma once
+
+/**
+ * @file chaos.h
+ * @brief Fault injection for the platform interface
+ *
+ * A chaos platform wraps another platform (native, replay or simulated) and
+ * makes its devices misbehave on purpose: calls fail, stall or hang, and
+ * devices disappear, come back or flap. Decisions are drawn from seeded
+ * random streams, one per connection, so a run can be reproduced. Used to
+ * test how the library behaves when devices fail mid-operation.
+ */
+
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/types.h>
+#include <duvc-ctl/platform/interface.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace duvc {
+
+/**
+ * @brief What to inject and how often
+ *
+ * Rates are probabilities per call in [0, 1]. All rates default to zero, so
+ * a default configuration passes every call through unchanged.
+ */
+struct ChaosConfig {
+  uint64_t seed = 0; ///< Seed of every random stream
+
+  double error_rate = 0.0; ///< Calls failing with one of errors
+  /// Error codes injected failures draw from
+  std::vector<ErrorCode> errors{ErrorCode::DeviceBusy, ErrorCode::SystemError};
+
+  std::chrono::microseconds latency{0}; ///< Added to every call
+  double spike_rate = 0.0;              ///< Calls delayed by spike_latency
+  std::chrono::microseconds spike_latency{std::chrono::milliseconds(50)};
+
+  double hang_rate = 0.0; ///< Calls stalled for hang_duration, then run
+  std::chrono::milliseconds hang_duration{std::chrono::seconds(2)};
+
+  double removal_rate = 0.0; ///< Calls that unplug the device first
+  /// How long an unplugged device stays away
+  std::chrono::milliseconds removal_duration{std::chrono::milliseconds(200)};
+
+  /// Devices alternate between present and absent every half period (zero
+  /// disables flapping); each device has its own phase
+  std::chrono::milliseconds flap_period{0};
+};
+
+/**
+ * @brief Counters of a chaos controller
+ */
+struct ChaosStats {
+  uint64_t calls = 0;          ///< Calls seen
+  uint64_t errors = 0;         ///< Injected failures
+  uint64_t spikes = 0;         ///< Injected latency spikes
+  uint64_t hangs = 0;          ///< Injected hangs
+  uint64_t removals = 0;       ///< Injected device removals
+  uint64_t absent_calls = 0;   ///< Calls failed because the device was absent
+  uint64_t opens = 0;          ///< Connections opened through the layer
+  uint64_t open_connections = 0; ///< Connections currently alive
+};
+
+/**
+ * @brief Shared state of a chaos layer
+ *
+ * Holds the configuration, which devices are unplugged, and the counters.
+ * Shared by chaos platforms and their connections; thread-safe.
+ */
+class ChaosController {
+public:
+  /// Create controller
+  explicit ChaosController(ChaosConfig config = {});
+
+  /// Get the configuration
+  ChaosConfig config() const;
+
+  /**
+   * @brief Replace the configuration
+   * @param config New configuration (connections opened earlier keep their
+   * random streams)
+   */
+  void set_config(ChaosConfig config);
+
+  /**
+   * @brief Unplug a device
+   * @param device Device to remove
+   * @param duration How long it stays away (zero until restore())
+   */
+  void remove(const Device &device, std::chrono::milliseconds duration = {});
+
+  /// Plug a removed device back in
+  void restore(const Device &device);
+
+  /// Check whether a device is currently present
+  bool present(const Device &device) const;
+
+  /// Get the counters
+  ChaosStats stats() const;
+
+  /**
+   * @brief Decide the fate of one call
+   * @param device Device the call is made on
+   * @param rng Random stream of the caller
+   * @return Error to fail the call with, if any
+   *
+   * Applies latency, spikes and hangs by sleeping, and may unplug the device.
+   * Used by chaos platforms and connections.
+   */
+  std::optional<Error> inject(const Device &device, std::mt19937_64 &rng);
+
+  /**
+   * @brief Create a random stream
+   * @param device Device the stream is for
+   * @return Stream seeded from the configured seed, the device and the
+   * number of streams created for it so far
+   */
+  std::mt19937_64 stream(const Device &device);
+
+  /// Count a connection opened through the layer
+  void connection_opened();
+
+  /// Count a connection closed
+  void connection_closed();
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  bool present_locked(const std::wstring &key, uint64_t hash,
+                      Clock::time_point now) const;
+
+  mutable std::mutex mutex_;
+  std::shared_ptr<const ChaosConfig> config_;
+  Clock::time_point epoch_;
+  /// Removed devices by identity key: time they return (max while removed
+  /// until restore())
+  std::unordered_map<std::wstring, Clock::time_point> removed_;
+  std::unordered_map<std::wstring, uint64_t> streams_; ///< Streams per device
+
+  std::atomic<uint64_t> calls_{0};
+  std::atomic<uint64_t> errors_{0};
+  std::atomic<uint64_t> spikes_{0};
+  std::atomic<uint64_t> hangs_{0};
+  std::atomic<uint64_t> removals_{0};
+  std::atomic<uint64_t> absent_calls_{0};
+  std::atomic<uint64_t> opens_{0};
+  std::atomic<uint64_t> open_connections_{0};
+};
+
+/**
+ * @brief Wrap a platform so that it misbehaves
+ * @param inner Platform to wrap
+ * @param controller Chaos state and configuration
+ * @return Chaos platform (its connections misbehave too)
+ *
+ * Absent devices are left out of list_devices(), reported disconnected, fail
+ * to open with ErrorCode::DeviceNotFound, and make open connections invalid.
+ */
+std::unique_ptr<IPlatformInterface>
+make_chaos_platform(std::unique_ptr<IPlatformInterface> inner,
+                    std::shared_ptr<ChaosController> controller);
+
+/**
+ * @brief Wrap a connection so that it misbehaves
+ * @param inner Connection to wrap
+ * @param device Device the connection is open on
+ * @param controller Chaos state and configuration
+ * @return Chaos connection
+ */
+std::unique_ptr<IDeviceConnection>
+make_chaos_connection(std::unique_ptr<IDeviceConnection> inner,
+                      const Device &device,
+                      std::shared_ptr<ChaosController> controller);
+
+/**
+ * @brief Inject faults into every platform created through
+ * create_platform_interface()
+ * @param controller Chaos state (null restores the native backend)
+ * @param inner Factory of the platform to wrap (empty wraps the native one)
+ *
+ * To inject faults into a replay or a test platform, pass its factory, e.g.
+ * [trace] { return make_replay_platform(trace); }.
+ */
+void install_chaos(std::shared_ptr<ChaosController> controller,
+                   PlatformFactory inner = {});
+
+} // namespace duvc
@@ -0,0 +1,186 @@
+#pragma once
+
+/**
+ * @file fake.h
+ * @brief In-memory fake camera backend
+ *
+ * A fake backend answers the platform interface from cameras described in a
+ * scenario: which devices are plugged in, which controls each one has, their
+ * ranges and starting values, and how slowly the device answers. Written
+ * values are kept, so applications can be run and benchmarked end to end
+ * without cameras, on any operating system. Scenarios are JSON documents:
+ *
+ * @code{.json}
+ * {
+ *   "devices": [
+ *     {
+ *       "name": "Fake PTZ Camera",
+ *       "path": "fake://ptz",
+ *       "latency_us": 200,
+ *       "motor_speed": 1.5,
+ *       "camera": {
+ *         "Pan":  {"min": -180, "max": 180, "default": 0},
+ *         "Zoom": {"min": 100, "max": 500, "default": 100, "value": 150}
+ *       },
+ *       "video": {
+ *         "Brightness":   {"min": 0, "max": 255, "default": 128},
+ *         "WhiteBalance": {"min": 2800, "max": 6500, "step": 10,
+ *                          "default": 4600, "mode": "auto"}
+ *       }
+ *     }
+ *   ]
+ * }
+ * @endcode
+ *
+ * Controls take "min", "max" (required), "step" (default 1), "default"
+ * (default min), "mode" (default "manual"), "value" (starting value, default
+ * "default") and "read_only". A device without "path" gets "fake://<index>".
+ */
+
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/types.h>
+#include <duvc-ctl/platform/interface.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace duvc {
+
+/**
+ * @brief One control of a fake device
+ */
+struct FakeControl {
+  PropRange range{};      ///< Reported range; manual writes outside it fail
+  PropSetting value{};    ///< Starting value
+  bool read_only = false; ///< Writes fail with PermissionDenied
+};
+
+/**
+ * @brief One fake camera
+ */
+struct FakeDevice {
+  Device device;                         ///< Name and path it enumerates as
+  std::map<CamProp, FakeControl> camera; ///< Camera controls it has
+  std::map<VidProp, FakeControl> video;  ///< Video controls it has
+  std::chrono::microseconds latency{0};  ///< Added to every call
+  /// Units per millisecond the absolute Pan, Tilt, Roll, Zoom, Focus and
+  /// Iris controls move at after a write; reads report the position on the
+  /// way. Zero moves instantly.
+  double motor_speed = 0.0;
+};
+
+/**
+ * @brief Devices a fake backend starts with
+ */
+struct FakeScenario {
+  std::vector<FakeDevice> devices; ///< Plugged-in cameras, in enumeration order
+};
+
+/**
+ * @brief Parse a fake scenario from JSON text
+ * @param text Scenario document (format in the file description)
+ * @return Scenario, or InvalidArgument naming the offending entry
+ */
+Result<FakeScenario> parse_fake_scenario(const std::string &text);
+
+/**
+ * @brief Load a fake scenario from a JSON file
+ * @param path Scenario file
+ * @return Scenario, or InvalidArgument if it cannot be read or parsed
+ */
+Result<FakeScenario> load_fake_scenario(const std::filesystem::path &path);
+
+/**
+ * @brief Scenario compiled into the library
+ * @return A PTZ camera (motorized pan/tilt/zoom, relative controls, auto
+ *         exposure and focus) and a fixed webcam, both with the usual video
+ *         controls
+ */
+const FakeScenario &builtin_fake_scenario();
+
+/**
+ * @brief Counters of a fake backend
+ */
+struct FakeStats {
+  uint64_t calls = 0;            ///< Property calls (including failed ones)
+  uint64_t writes = 0;           ///< Successful writes
+  uint64_t opens = 0;            ///< Connections opened
+  uint64_t open_connections = 0; ///< Connections currently alive
+};
+
+/**
+ * @brief State of a fake backend, shared by every platform made from it
+ *
+ * Thread-safe. Each device has its own lock, so calls on different devices
+ * never contend.
+ */
+class FakeBackend {
+public:
+  /**
+   * @brief Create backend with every scenario device plugged in
+   * @param scenario Devices and controls
+   */
+  explicit FakeBackend(FakeScenario scenario = builtin_fake_scenario());
+  ~FakeBackend();
+
+  FakeBackend(const FakeBackend &) = delete;
+  FakeBackend &operator=(const FakeBackend &) = delete;
+
+  /// Get the plugged-in devices, in scenario order
+  std::vector<Device> devices() const;
+
+  /// Check whether a device is plugged in
+  bool connected(const Device &device) const;
+
+  /**
+   * @brief Unplug or replug a device
+   * @param device Scenario device
+   * @param connected New state; connections stay open and fail while unplugged
+   * @return false if the device is not in the scenario
+   */
+  bool set_connected(const Device &device, bool connected);
+
+  /// Restore starting values, finish moves and plug every device back in
+  void reset();
+
+  /// Get the counters
+  FakeStats stats() const;
+
+private:
+  struct DeviceState;
+  friend class FakeConnection;
+  friend class FakePlatform;
+
+  std::shared_ptr<DeviceState> find(const Device &device) const;
+
+  std::vector<std::shared_ptr<DeviceState>> devices_;
+  std::atomic<uint64_t> calls_{0};
+  std::atomic<uint64_t> writes_{0};
+  std::atomic<uint64_t> opens_{0};
+  std::atomic<uint64_t> open_connections_{0};
+};
+
+/**
+ * @brief Create a platform interface served by a fake backend
+ * @param backend Backend whose devices it enumerates and opens
+ * @return Platform interface (cheap; make as many as needed)
+ */
+std::unique_ptr<IPlatformInterface>
+make_fake_platform(std::shared_ptr<FakeBackend> backend);
+
+/**
+ * @brief Serve create_platform_interface() from a fake backend
+ * @param backend Backend to install, or nullptr to restore the native backend
+ *
+ * Device enumeration (list_devices(), is_device_connected()) follows the
+ * installed backend too, so cameras can be found and opened by name.
+ */
+void install_fake_backend(std::shared_ptr<FakeBackend> backend);
+
+} // namespace duvc
@@ -7,7 +7,9 @@
 
 #include <duvc-ctl/core/result.h>
 #include <duvc-ctl/core/types.h>
+#include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace duvc {
@@ -101,10 +103,51 @@ public:
   virtual Result<PropRange> get_video_property_range(VidProp prop) = 0;
 };
 
+/**
+ * @brief Factory producing a platform interface
+ */
+using PlatformFactory = std::function<std::unique_ptr<IPlatformInterface>()>;
+
 /**
  * @brief Get platform-specific interface implementation
- * @return Platform interface instance
+ * @return Platform interface instance (the installed factory's, if any)
  */
 std::unique_ptr<IPlatformInterface> create_platform_interface();
 
+/**
+ * @brief Get the operating system's platform interface
+ * @return DirectShow interface on Windows, V4L2 on Linux, nullptr elsewhere
+ *
+ * Ignores any installed factory, so decorators can wrap the native backend.
+ * Setting the environment variable DUVC_BACKEND=fake before first use
+ * replaces it with a fake backend (see fake.h) holding the scenario file
+ * named by DUVC_FAKE_SCENARIO, or the built-in scenario.
+ */
+std::unique_ptr<IPlatformInterface> create_native_platform_interface();
+
+/**
+ * @brief Name of the backend create_native_platform_interface() returns
+ * @return "directshow", "v4l2", "fake" or "none"
+ */
+std::string native_platform_backend();
+
+/**
+ * @brief Replace the backend returned by create_platform_interface()
+ * @param factory Factory to use, or empty to restore the native backend
+ *
+ * Device actors open their connection through create_platform_interface(),
+ * so the factory applies to devices opened afterwards.
+ */
+void set_platform_interface_factory(PlatformFactory factory);
+
+/**
+ * @brief Check whether devices come from somewhere other than the OS API
+ * @return true if a factory is installed or DUVC_BACKEND selects the fake
+ *         backend
+ *
+ * list_devices() and is_device_connected() ask create_platform_interface()
+ * instead of DirectShow while this holds.
+ */
+bool platform_interface_overridden();
+
 } // namespace duvc
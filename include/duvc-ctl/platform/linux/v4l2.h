@@ -0,0 +1,31 @@
+#pragma once
+
+/**
+ * @file v4l2.h
+ * @brief Video4Linux2 platform backend
+ */
+
+#ifdef __linux__
+
+#include <duvc-ctl/platform/interface.h>
+
+#include <memory>
+
+namespace duvc {
+
+/**
+ * @brief Create the V4L2 platform interface
+ * @return Interface over the /dev/video* nodes that capture video
+ *
+ * Devices are named by the driver's card name and identified by their node
+ * path. Properties map to the matching V4L2 controls (Zoom to
+ * V4L2_CID_ZOOM_ABSOLUTE, WhiteBalance to V4L2_CID_WHITE_BALANCE_TEMPERATURE,
+ * ...) and auto modes to their companion controls (V4L2_CID_EXPOSURE_AUTO,
+ * V4L2_CID_FOCUS_AUTO, ...). Values are in V4L2 units, so Exposure counts
+ * 100 us steps rather than DirectShow's log2 seconds.
+ */
+std::unique_ptr<IPlatformInterface> create_v4l2_platform_interface();
+
+} // namespace duvc
+
+#endif // __linux__
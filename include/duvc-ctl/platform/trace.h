@@ -0,0 +1,215 @@
+#pragma once
+
+/**
+ * @file trace.h
+ * @brief Recording and deterministic replay of device interaction traces
+ *
+ * A recording platform logs every platform and connection call with its
+ * arguments, result and measured latency. A replay platform answers the same
+ * calls from a trace, sleeping for the recorded latency (optionally scaled),
+ * so traces captured on real hardware can drive benchmarks and regression
+ * tests on machines without cameras.
+ */
+
+#include <duvc-ctl/core/result.h>
+#include <duvc-ctl/core/types.h>
+#include <duvc-ctl/platform/interface.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace duvc {
+
+/**
+ * @brief Traced call
+ */
+enum class TraceOp : uint8_t {
+  ListDevices,            ///< IPlatformInterface::list_devices
+  IsDeviceConnected,      ///< IPlatformInterface::is_device_connected
+  CreateConnection,       ///< IPlatformInterface::create_connection
+  GetCameraProperty,      ///< IDeviceConnection::get_camera_property
+  SetCameraProperty,      ///< IDeviceConnection::set_camera_property
+  GetCameraPropertyRange, ///< IDeviceConnection::get_camera_property_range
+  GetVideoProperty,       ///< IDeviceConnection::get_video_property
+  SetVideoProperty,       ///< IDeviceConnection::set_video_property
+  GetVideoPropertyRange   ///< IDeviceConnection::get_video_property_range
+};
+
+/**
+ * @brief Convert trace operation to string
+ * @param op Operation
+ * @return Operation name
+ */
+const char *to_string(TraceOp op);
+
+/**
+ * @brief One recorded call
+ *
+ * Only the fields the operation uses are meaningful: argument for set
+ * calls, and on success setting, range, connected or listed for the
+ * corresponding queries.
+ */
+struct TraceEvent {
+  TraceOp op = TraceOp::ListDevices;
+  uint32_t device = 0;   ///< Index into Trace::devices (not for ListDevices)
+  uint8_t property = 0;  ///< CamProp or VidProp value
+  PropSetting argument{0, CamMode::Manual}; ///< Value written
+  ErrorCode error = ErrorCode::Success;     ///< Outcome
+  std::string message;                      ///< Error message
+  PropSetting setting{0, CamMode::Manual};  ///< Value read
+  PropRange range;                          ///< Range read
+  bool connected = false;                   ///< Connection state read
+  std::vector<uint32_t> listed;             ///< Devices listed (indices)
+  std::chrono::microseconds latency{0};     ///< Measured call duration
+};
+
+/**
+ * @brief Recorded calls and the devices they refer to
+ */
+struct Trace {
+  std::vector<Device> devices;   ///< Devices, in order of first appearance
+  std::vector<TraceEvent> events; ///< Calls in completion order
+};
+
+/**
+ * @brief Encode a trace in the compact binary trace format
+ * @param trace Trace to encode
+ * @return Encoded bytes
+ */
+std::vector<uint8_t> serialize_trace(const Trace &trace);
+
+/**
+ * @brief Decode a trace from the compact binary trace format
+ * @param data Bytes produced by serialize_trace()
+ * @return Trace, or ErrorCode::InvalidArgument if malformed
+ */
+Result<Trace> parse_trace(const std::vector<uint8_t> &data);
+
+/**
+ * @brief Write a trace file
+ * @param trace Trace to write
+ * @param path File to write
+ * @return Success or ErrorCode::SystemError
+ */
+Result<void> save_trace(const Trace &trace, const std::filesystem::path &path);
+
+/**
+ * @brief Read a trace file
+ * @param path File to read
+ * @return Trace
+ */
+Result<Trace> load_trace(const std::filesystem::path &path);
+
+/**
+ * @brief Thread-safe sink for recorded calls
+ *
+ * Shared by a recording platform and every connection it opens.
+ */
+class TraceRecorder {
+public:
+  /**
+   * @brief Append a call
+   * @param device Device the call was made on
+   * @param event Call (its device index is assigned here)
+   */
+  void record(const Device &device, TraceEvent event);
+
+  /**
+   * @brief Append a list_devices call
+   * @param devices Devices returned (ignored if the call failed)
+   * @param event Call (its listed indices are assigned here)
+   */
+  void record_list(const std::vector<Device> &devices, TraceEvent event);
+
+  /// Copy the calls recorded so far
+  Trace snapshot() const;
+
+  /// Get the number of recorded calls
+  size_t size() const;
+
+  /// Drop all recorded calls
+  void clear();
+
+private:
+  uint32_t device_index(const Device &device);
+
+  mutable std::mutex mutex_;
+  Trace trace_;
+  std::unordered_map<std::wstring, uint32_t> index_;
+};
+
+/**
+ * @brief Wrap a platform so that its calls are recorded
+ * @param inner Platform to record
+ * @param recorder Recorder receiving calls
+ * @return Recording platform (its connections record too)
+ */
+std::unique_ptr<IPlatformInterface>
+make_recording_platform(std::unique_ptr<IPlatformInterface> inner,
+                        std::shared_ptr<TraceRecorder> recorder);
+
+/**
+ * @brief Wrap a connection so that its calls are recorded
+ * @param inner Connection to record
+ * @param device Device the connection is open on
+ * @param recorder Recorder receiving calls
+ * @return Recording connection
+ */
+std::unique_ptr<IDeviceConnection>
+make_recording_connection(std::unique_ptr<IDeviceConnection> inner,
+                          const Device &device,
+                          std::shared_ptr<TraceRecorder> recorder);
+
+/**
+ * @brief Replay options
+ */
+struct ReplayOptions {
+  /// Multiplier for recorded latencies (0 answers immediately)
+  double time_scale = 1.0;
+  /// Start a call's responses over once they run out (otherwise the last
+  /// response repeats)
+  bool loop = true;
+};
+
+/**
+ * @brief Create a platform answering from a trace
+ * @param trace Trace to replay
+ * @param options Replay options
+ * @return Replay platform
+ *
+ * Each device and call (operation and property) replays its own recorded
+ * responses in order, so the answers do not depend on how calls to
+ * different devices or properties interleave. Devices are matched by
+ * identity key, so any path form of a recorded device works. Calls never
+ * recorded fail with ErrorCode::PropertyNotSupported (ErrorCode::DeviceNotFound
+ * for unknown devices). Connections of one platform share its position in
+ * the trace; separate platforms replay independently.
+ */
+std::unique_ptr<IPlatformInterface>
+make_replay_platform(std::shared_ptr<const Trace> trace,
+                     ReplayOptions options = {});
+
+/**
+ * @brief Record every call made through create_platform_interface()
+ * @param recorder Recorder receiving calls (null restores the native backend)
+ */
+void install_trace_recorder(std::shared_ptr<TraceRecorder> recorder);
+
+/**
+ * @brief Answer every call made through create_platform_interface() from a
+ * trace
+ * @param trace Trace to replay (null restores the native backend)
+ * @param options Replay options
+ *
+ * Every platform created this way shares one position in the trace.
+ */
+void install_trace_replay(std::shared_ptr<const Trace> trace,
+                          ReplayOptions options = {});
+
+} // namespace duvc
@@ -10,6 +10,7 @@
   #include <dshow.h>
   #include <ks.h>
   #include <ksproxy.h>
+  #include <duvc-ctl/core/device_registry.h>
   #include <duvc-ctl/core/result.h>
   #include <duvc-ctl/core/types.h>
   #include <duvc-ctl/detail/com_helpers.h>
@@ -97,7 +98,7 @@
                                     uint32_t property_id, const T &value);
 
   private:
-    Device device_;
+    DeviceHandle device_;
     detail::com_ptr<IBaseFilter> basefilter_;  // keeps DLL loaded
     // Helper to get property set interface on-demand
     detail::com_ptr<IKsPropertySet> get_property_set() const;
@@ -0,0 +1,302 @@
+#pragma once
+
+/**
+ * @file event_queue.h
+ * @brief Lock-free event queue and batching dispatcher
+ *
+ * Lets threads hand events (log records, hotplug notifications) to a
+ * consumer without taking a lock or waiting on it. Producers push onto a
+ * lock-free queue; a single dispatcher thread drains it and delivers events
+ * in batches, so a consumer with expensive entry costs (e.g. taking the
+ * Python GIL) pays them once per batch instead of once per event.
+ */
+
+#include <duvc-ctl/detail/mpsc_queue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace duvc {
+
+/**
+ * @brief Bounded multi-producer, single-consumer event queue
+ *
+ * A value-owning wrapper around detail::mpsc_queue. push() is lock-free and
+ * never blocks: it fails once capacity events are queued. drain() and
+ * empty() must only be called from one consumer thread. Events come out in
+ * push order.
+ */
+template <typename T> class EventQueue {
+public:
+  /// Create queue holding at most capacity events
+  explicit EventQueue(size_t capacity = 65536) : capacity_(capacity) {}
+
+  ~EventQueue() {
+    while (detail::mpsc_node *node = queue_.pop()) {
+      delete static_cast<Node *>(node);
+    }
+  }
+
+  EventQueue(const EventQueue &) = delete;
+  EventQueue &operator=(const EventQueue &) = delete;
+
+  /**
+   * @brief Queue an event
+   * @param value Event
+   * @return false if the queue was full (the event is dropped and counted)
+   */
+  bool push(T value) {
+    if (size_.fetch_add(1, std::memory_order_relaxed) >= capacity_) {
+      size_.fetch_sub(1, std::memory_order_relaxed);
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    queue_.push(new Node(std::move(value)));
+    return true;
+  }
+
+  /**
+   * @brief Take the queued events (consumer thread only)
+   * @param out Receives the events, oldest first (appended)
+   * @return Number of events taken
+   *
+   * Stops early at an event whose push is still in progress; it is taken by
+   * a later drain().
+   */
+  size_t drain(std::vector<T> &out) {
+    size_t taken = 0;
+    while (detail::mpsc_node *node = queue_.pop()) {
+      std::unique_ptr<Node> owned(static_cast<Node *>(node));
+      out.push_back(std::move(owned->value));
+      ++taken;
+    }
+    size_.fetch_sub(taken, std::memory_order_relaxed);
+    return taken;
+  }
+
+  /// Check whether nothing is queued or being pushed (consumer thread only)
+  bool empty() const { return queue_.empty(); }
+
+  /// Events rejected because the queue was full
+  uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  struct Node : detail::mpsc_node {
+    explicit Node(T v) : value(std::move(v)) {}
+    T value;
+  };
+
+  const size_t capacity_;
+  detail::mpsc_queue queue_;
+  std::atomic<size_t> size_{0};
+  std::atomic<uint64_t> dropped_{0};
+};
+
+/**
+ * @brief Batch dispatcher settings
+ */
+struct DispatchOptions {
+  size_t capacity = 65536; ///< Events queued before posts are dropped
+  size_t max_batch = 1024; ///< Largest batch handed to the sink
+  /// Longest a posted event waits before delivery is attempted
+  std::chrono::milliseconds flush_interval{20};
+};
+
+/**
+ * @brief Counters of a batch dispatcher
+ */
+struct DispatchStats {
+  uint64_t posted = 0;    ///< Events accepted by post()
+  uint64_t dropped = 0;   ///< Events rejected because the queue was full
+  uint64_t delivered = 0; ///< Events handed to the sink
+  uint64_t batches = 0;   ///< Sink invocations
+  uint64_t max_batch = 0; ///< Largest batch delivered
+};
+
+/**
+ * @brief Delivers posted events to a sink in batches on its own thread
+ *
+ * post() never waits on the sink and can be called from any thread,
+ * including while holding locks the sink needs. The sink runs on the
+ * dispatcher thread with up to max_batch events at a time, oldest first.
+ */
+template <typename T> class BatchDispatcher {
+public:
+  /// Receives one batch of events
+  using Sink = std::function<void(std::vector<T> &batch)>;
+
+  /**
+   * @brief Create dispatcher and start its thread
+   * @param sink Batch consumer
+   * @param options Queue and batching settings
+   */
+  explicit BatchDispatcher(Sink sink, DispatchOptions options = {})
+      : sink_(std::move(sink)), options_(options), queue_(options.capacity) {
+    if (options_.max_batch == 0) {
+      options_.max_batch = 1;
+    }
+    thread_ = std::thread(&BatchDispatcher::run, this);
+  }
+
+  /// Deliver what is queued, then stop (never destroy it from its own sink)
+  ~BatchDispatcher() { stop(); }
+
+  BatchDispatcher(const BatchDispatcher &) = delete;
+  BatchDispatcher &operator=(const BatchDispatcher &) = delete;
+
+  /**
+   * @brief Queue an event for delivery
+   * @param value Event
+   * @return false if dropped because the queue was full or stopped
+   */
+  bool post(T value) {
+    if (stopping_.load(std::memory_order_acquire) ||
+        !queue_.push(std::move(value))) {
+      return false;
+    }
+    posted_.fetch_add(1, std::memory_order_release);
+    // Only a post that finds the thread idle wakes it; the lock is taken
+    // just then, and the thread never holds it while running the sink
+    // (seq_cst pairs with the thread's store before it checks the queue)
+    if (waiting_.exchange(false)) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      wake_cv_.notify_one();
+    }
+    return true;
+  }
+
+  /**
+   * @brief Wait until every event posted so far has been delivered
+   * @param timeout Longest time to wait
+   * @return false on timeout (or when called from the sink)
+   */
+  bool flush(std::chrono::milliseconds timeout) {
+    if (on_thread()) {
+      return false;
+    }
+    uint64_t target = posted_.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(mutex_);
+    flush_requested_ = true;
+    wake_cv_.notify_one();
+    return done_cv_.wait_for(lock, timeout, [&] {
+      return delivered_.load(std::memory_order_acquire) >= target;
+    });
+  }
+
+  /**
+   * @brief Deliver what is queued and stop the thread (idempotent)
+   *
+   * Returns once the thread has exited. Called from the sink, it only
+   * requests the stop: the thread exits after the current batch and the
+   * next stop() from another thread (or the destructor) joins it.
+   */
+  void stop() {
+    if (!stopping_.exchange(true)) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      wake_cv_.notify_one();
+    }
+    if (!on_thread()) {
+      join();
+    }
+  }
+
+  /// Get the counters
+  DispatchStats stats() const {
+    DispatchStats stats;
+    stats.posted = posted_.load();
+    stats.dropped = queue_.dropped();
+    stats.delivered = delivered_.load();
+    stats.batches = batches_.load();
+    stats.max_batch = max_batch_.load();
+    return stats;
+  }
+
+private:
+  bool on_thread() const {
+    return std::this_thread::get_id() == thread_id_.load(std::memory_order_acquire);
+  }
+
+  void join() {
+    std::lock_guard<std::mutex> lock(join_mutex_);
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  void run() {
+    thread_id_.store(std::this_thread::get_id(), std::memory_order_release);
+    std::vector<T> pending;
+    size_t next = 0;
+    for (;;) {
+      if (next == pending.size()) {
+        pending.clear();
+        next = 0;
+        queue_.drain(pending);
+      }
+      if (next == pending.size()) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (stopping_.load() && queue_.empty()) {
+          break;
+        }
+        waiting_.store(true);
+        if (queue_.empty() && !flush_requested_) {
+          wake_cv_.wait_for(lock, options_.flush_interval);
+        }
+        waiting_.store(false, std::memory_order_release);
+        flush_requested_ = false;
+        continue;
+      }
+
+      size_t count = std::min(options_.max_batch, pending.size() - next);
+      std::vector<T> batch(std::make_move_iterator(pending.begin() + next),
+                           std::make_move_iterator(pending.begin() + next + count));
+      next += count;
+      try {
+        sink_(batch);
+      } catch (...) {
+        // A throwing sink loses its batch but keeps the dispatcher alive
+      }
+
+      batches_.fetch_add(1);
+      uint64_t seen = max_batch_.load();
+      while (count > seen && !max_batch_.compare_exchange_weak(seen, count)) {
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        delivered_.fetch_add(count, std::memory_order_release);
+      }
+      done_cv_.notify_all();
+    }
+  }
+
+  Sink sink_;
+  DispatchOptions options_;
+  EventQueue<T> queue_;
+
+  std::mutex mutex_;
+  std::condition_variable wake_cv_;
+  std::condition_variable done_cv_;
+  std::atomic<bool> waiting_{false};
+  std::atomic<bool> stopping_{false};
+  bool flush_requested_ = false;
+
+  std::atomic<uint64_t> posted_{0};
+  std::atomic<uint64_t> delivered_{0};
+  std::atomic<uint64_t> batches_{0};
+  std::atomic<uint64_t> max_batch_{0};
+  std::atomic<std::thread::id> thread_id_{}; ///< Set by the thread itself
+  std::mutex join_mutex_; ///< Serializes joins from concurrent stop() calls
+  std::thread thread_;
+};
+
+} // namespace duvc
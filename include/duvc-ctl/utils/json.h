@@ -0,0 +1,84 @@
+#pragma once
+
+/**
+ * @file json.h
+ * @brief Minimal JSON reader for configuration and cue files
+ */
+
+#include <duvc-ctl/core/result.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace duvc {
+
+/**
+ * @brief Parsed JSON value
+ *
+ * Read-only document tree produced by parse_json(). Object members keep their
+ * file order. Numbers are stored as double.
+ */
+class JsonValue {
+public:
+  /// Value kind
+  enum class Type { Null, Bool, Number, String, Array, Object };
+
+  using Array = std::vector<JsonValue>;
+  using Object = std::vector<std::pair<std::string, JsonValue>>;
+
+  /// Construct null value
+  JsonValue() = default;
+
+  /// Get value kind
+  Type type() const { return type_; }
+
+  bool is_null() const { return type_ == Type::Null; }
+  bool is_bool() const { return type_ == Type::Bool; }
+  bool is_number() const { return type_ == Type::Number; }
+  bool is_string() const { return type_ == Type::String; }
+  bool is_array() const { return type_ == Type::Array; }
+  bool is_object() const { return type_ == Type::Object; }
+
+  /// Get boolean (false unless is_bool())
+  bool as_bool() const { return bool_; }
+
+  /// Get number (0 unless is_number())
+  double as_number() const { return number_; }
+
+  /// Get string (empty unless is_string()); UTF-8 encoded
+  const std::string &as_string() const { return string_; }
+
+  /// Get array elements (empty unless is_array())
+  const Array &as_array() const { return array_; }
+
+  /// Get object members (empty unless is_object())
+  const Object &as_object() const { return object_; }
+
+  /**
+   * @brief Look up an object member
+   * @param key Member name
+   * @return Member value, or nullptr if absent or not an object
+   */
+  const JsonValue *find(const std::string &key) const;
+
+private:
+  friend class JsonParser;
+
+  Type type_ = Type::Null;
+  bool bool_ = false;
+  double number_ = 0.0;
+  std::string string_;
+  Array array_;
+  Object object_;
+};
+
+/**
+ * @brief Parse a JSON document
+ * @param text UTF-8 JSON text
+ * @return Parsed value, or ErrorCode::InvalidArgument with the offset of the
+ * first syntax error
+ */
+Result<JsonValue> parse_json(const std::string &text);
+
+} // namespace duvc
@@ -39,6 +39,9 @@ using LogCallback =
 /**
  * @brief Set global log callback
  * @param callback Callback function (nullptr to disable logging)
+ *
+ * The callback is invoked without any library lock held, possibly from
+ * several threads at once, and may itself log.
  */
 void set_log_callback(LogCallback callback);
 
@@ -54,6 +57,15 @@ void set_log_level(LogLevel level);
  */
 LogLevel get_log_level();
 
+/**
+ * @brief Check whether a level passes the minimum log level
+ * @param level Log level
+ * @return true if records at this level are delivered
+ *
+ * Lock-free; lets callers skip building messages that would be dropped.
+ */
+bool log_enabled(LogLevel level);
+
 /**
  * @brief Log a message
  * @param level Log level
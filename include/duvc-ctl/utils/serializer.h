@@ -0,0 +1,209 @@
+#pragma once
+
+/**
+ * @file serializer.h
+ * @brief Streaming writer for JSON, JSON Lines, CSV and MessagePack output
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace duvc {
+
+/**
+ * @brief Output encoding of a Serializer
+ */
+enum class SerialFormat {
+  Json,       ///< Compact JSON; top-level values are concatenated as written
+  JsonLines,  ///< JSON with a newline after every top-level value
+  Csv,        ///< One row per top-level value under a shared header
+  MessagePack ///< Top-level values concatenated (a MessagePack stream)
+};
+
+/**
+ * @brief Streaming structured-data writer
+ *
+ * Values are encoded straight into one growable UTF-8 byte buffer: wide
+ * strings are transcoded in place, numbers are formatted without locale, and
+ * nothing is built up as an intermediate document. Calls describe a value
+ * tree (begin_object(), key(), value(), end_object(), ...) and must be
+ * balanced; each completed top-level value is one record.
+ *
+ * CSV flattens each record into one row. Object members become columns named
+ * by their key path ("controls.cam"), an array inside a record becomes a
+ * single cell with its scalars joined by ';', and null is an empty cell. The
+ * header is the union of every record's columns, in order of first
+ * appearance; a record leaves the columns it lacks empty. A column first seen
+ * after the header has been taken or cleared cannot be added and is listed in
+ * dropped_columns() instead.
+ *
+ * MessagePack uses the smallest encoding for every integer, string, array
+ * and map; container sizes are patched in when the container ends.
+ *
+ * A serializer is not thread-safe; use one per thread.
+ */
+class Serializer {
+public:
+  /// Create a serializer writing the given format
+  explicit Serializer(SerialFormat format = SerialFormat::Json);
+
+  /// Get output format
+  SerialFormat format() const { return format_; }
+
+  /// Start an object; members are written as key() then a value
+  Serializer &begin_object();
+
+  /// End the innermost object
+  Serializer &end_object();
+
+  /// Start an array
+  Serializer &begin_array();
+
+  /// End the innermost array
+  Serializer &end_array();
+
+  /// Write an object member name (UTF-8)
+  Serializer &key(std::string_view name);
+
+  /// Write an object member name
+  Serializer &key(std::wstring_view name);
+
+  /// Write a UTF-8 string
+  Serializer &value(std::string_view text);
+
+  /// Write a wide string, transcoded to UTF-8
+  Serializer &value(std::wstring_view text);
+
+  /// Write a UTF-8 string
+  Serializer &value(const char *text) { return value(std::string_view(text)); }
+
+  /// Write a wide string, transcoded to UTF-8
+  Serializer &value(const wchar_t *text) {
+    return value(std::wstring_view(text));
+  }
+
+  /// Write a boolean
+  Serializer &value(bool flag);
+
+  /// Write a number (JSON and CSV write non-finite values as null)
+  Serializer &value(double number);
+
+  /// Write an integer
+  template <typename T>
+  std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                   Serializer &>
+  value(T number) {
+    if constexpr (std::is_signed_v<T>) {
+      return write_int(static_cast<int64_t>(number));
+    } else {
+      return write_uint(static_cast<uint64_t>(number));
+    }
+  }
+
+  /// Write null
+  Serializer &null();
+
+  /// Write an object member: key(name) then value(v)
+  template <typename Key, typename Value>
+  Serializer &field(const Key &name, const Value &v) {
+    key(name);
+    return value(v);
+  }
+
+  /// Get encoded bytes written so far
+  const std::string &buffer() const { return out_; }
+
+  /// Get number of encoded bytes written so far
+  size_t size() const { return out_.size(); }
+
+  /// Move the encoded bytes out, leaving the buffer empty
+  std::string take();
+
+  /**
+   * @brief Discard buffered bytes
+   *
+   * The CSV header is not repeated by later records; use a new serializer
+   * to start an independent document.
+   */
+  void clear();
+
+  /**
+   * @brief Get CSV columns whose cells were dropped
+   * @return Key paths first seen after the header had left the buffer
+   */
+  const std::vector<std::string> &dropped_columns() const {
+    return dropped_columns_;
+  }
+
+private:
+  enum class Frame : uint8_t { Object, Array };
+
+  struct Scope {
+    Frame frame;
+    uint32_t count = 0;  ///< Members or elements written
+    size_t header = 0;   ///< MessagePack: offset of the size placeholder
+    size_t path = 0;     ///< CSV: column path length at this depth
+  };
+
+  bool csv() const { return format_ == SerialFormat::Csv; }
+  bool msgpack() const { return format_ == SerialFormat::MessagePack; }
+
+  Serializer &write_int(int64_t number);
+  Serializer &write_uint(uint64_t number);
+
+  void begin(Frame frame);
+  void end(Frame frame);
+
+  // Separators and record bookkeeping around one value
+  void before_value();
+  void after_value();
+
+  // JSON
+  void json_string(const char *text, size_t length);
+  void json_wide(std::wstring_view text);
+
+  // MessagePack
+  void pack_byte(uint8_t byte) { out_.push_back(static_cast<char>(byte)); }
+  void pack_be(uint64_t bits, int bytes);
+  void pack_str_header(size_t length);
+  void pack_container_end(const Scope &scope);
+
+  // CSV
+  std::string &cell();
+  void csv_scalar(std::string_view text);
+  void csv_wide(std::wstring_view text);
+  void csv_begin_record();
+  void csv_end_record();
+  void csv_write_header();
+  void csv_extend_header();
+  void csv_append_quoted(std::string &target, std::string_view text);
+
+  SerialFormat format_;
+  std::string out_;
+  std::vector<Scope> scopes_;
+
+  // CSV state: current key path, cells of the record being written
+  std::string path_;
+  bool joining_ = false;
+  size_t join_depth_ = 0; ///< Scope depth of the array joined into a cell
+  size_t join_items_ = 0;
+  std::string *join_target_ = nullptr;
+  bool header_written_ = false;
+  bool header_buffered_ = false; ///< Header and every row since are in out_
+  size_t header_columns_ = 0;    ///< Columns in the written header
+  std::vector<size_t> row_ends_; ///< Offset past the header and each row
+  std::vector<std::string> dropped_columns_;
+  std::vector<std::string> columns_;
+  std::unordered_map<std::string, size_t> column_index_;
+  std::vector<std::string> cells_;
+  std::vector<bool> filled_;
+  size_t next_column_ = 0; ///< Expected column of the next cell (fast path)
+  std::string scratch_;
+};
+
+} // namespace duvc
@@ -6,6 +6,7 @@
  */
 
 #include <duvc-ctl/core/types.h>
+#include <optional>
 #include <string>
 
 namespace duvc {
@@ -54,24 +55,31 @@ const wchar_t *to_wstring(CamMode mode);
 
 /**
  * @brief Converts a wide string (UTF-16 on Windows) to a UTF-8 string
- * @param wstr Wide string to convert (UTF-16 encoded on Windows)
- * @return UTF-8 encoded string
- */
-std::string to_utf8(const std::wstring &wstr);
-
-/**
- * @brief Converts a wide string (UTF-16 on Windows) to a UTF-8 string
- * @param wstr Wide string to convert (UTF-16 encoded on Windows)
- * @return UTF-8 encoded string
+ * @param wstr Wide string to convert (UTF-16 on Windows, UTF-32 elsewhere)
+ * @return UTF-8 encoded string; unpaired surrogates become U+FFFD
  */
 std::string to_utf8(const std::wstring &wstr);
 
 /**
  * @brief Converts a UTF-8 string to a wide string (UTF-16 on Windows)
  * @param str UTF-8 encoded string to convert
- * @return Wide string (UTF-16 encoded on Windows)
+ * @return Wide string (UTF-16 on Windows, UTF-32 elsewhere); invalid
+ *         sequences become U+FFFD
  */
 std::wstring to_wstring(const std::string &str);
 
+/**
+ * @brief Look up a camera property by name
+ * @param name Property name as returned by to_string() (case-insensitive)
+ * @return Camera property, or std::nullopt if the name is unknown
+ */
+std::optional<CamProp> cam_prop_from_string(const std::string &name);
+
+/**
+ * @brief Look up a video property by name
+ * @param name Property name as returned by to_string() (case-insensitive)
+ * @return Video property, or std::nullopt if the name is unknown
+ */
+std::optional<VidProp> vid_prop_from_string(const std::string &name);
 
 } // namespace duvc
@@ -0,0 +1,52 @@
+#pragma once
+
+/**
+ * @file utf8.h
+ * @brief Wide string (UTF-16/UTF-32) <-> UTF-8 transcoding into caller buffers
+ *
+ * wchar_t holds UTF-16 on Windows and UTF-32 elsewhere; both are handled.
+ * Runs of ASCII are converted a block at a time (SSE2 where available).
+ * Malformed input never fails: unpaired surrogates, out-of-range code points
+ * and invalid UTF-8 sequences each become U+FFFD, so the length and write
+ * functions always agree.
+ */
+
+#include <cstddef>
+
+namespace duvc {
+
+/**
+ * @brief Get the number of UTF-8 bytes needed for a wide string
+ * @param text Wide characters (need not be null-terminated)
+ * @param length Number of wide characters
+ * @return Encoded size in bytes, excluding any terminator
+ */
+size_t utf8_length(const wchar_t *text, size_t length);
+
+/**
+ * @brief Encode a wide string as UTF-8
+ * @param text Wide characters (need not be null-terminated)
+ * @param length Number of wide characters
+ * @param out Output buffer with room for utf8_length(text, length) bytes
+ * @return Number of bytes written (no terminator is written)
+ */
+size_t encode_utf8(const wchar_t *text, size_t length, char *out);
+
+/**
+ * @brief Get the number of wide characters needed for a UTF-8 string
+ * @param text UTF-8 bytes (need not be null-terminated)
+ * @param length Number of bytes
+ * @return Decoded size in wide characters, excluding any terminator
+ */
+size_t wide_length(const char *text, size_t length);
+
+/**
+ * @brief Decode a UTF-8 string into wide characters
+ * @param text UTF-8 bytes (need not be null-terminated)
+ * @param length Number of bytes
+ * @param out Output buffer with room for wide_length(text, length) characters
+ * @return Number of wide characters written (no terminator is written)
+ */
+size_t decode_utf8(const char *text, size_t length, wchar_t *out);
+
+} // namespace duvc
@@ -14,11 +14,16 @@
 #include "duvc-ctl/core/camera.h"
 #include "duvc-ctl/core/capability.h"
 #include "duvc-ctl/core/device.h"
+#include "duvc-ctl/core/device_identity.h"
+#include "duvc-ctl/core/device_registry.h"
+#include "duvc-ctl/core/preset.h"
 #include "duvc-ctl/core/result.h"
 #include "duvc-ctl/core/types.h"
 #include "duvc-ctl/utils/error_decoder.h"
 #include "duvc-ctl/utils/logging.h"
+#include "duvc-ctl/utils/serializer.h"
 #include "duvc-ctl/utils/string_conversion.h"
+#include "duvc-ctl/utils/utf8.h"
 #ifdef _WIN32
 #include "duvc-ctl/platform/windows/connection_pool.h"
 #endif
@@ -26,6 +31,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cstring>
+#include <filesystem>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -67,15 +73,43 @@ duvc_device_change_callback g_device_change_callback = nullptr;
 void *g_device_change_user_data = nullptr;
 std::mutex g_device_change_mutex;
 
-/** @brief Device storage for C API lifetime management */
-std::vector<std::unique_ptr<duvc::Device>> g_device_storage;
+/** @brief Device storage for C API lifetime management; a duvc_device_t
+ * points at the interned record a stored handle keeps alive */
+std::vector<duvc::DeviceHandle> g_device_storage;
 std::mutex g_device_storage_mutex;
 
+/** @brief Index over the last duvc_list_devices() result (positions refer to
+ * g_device_storage; guarded by g_device_storage_mutex) */
+duvc::DeviceIndex g_device_index;
+
 /** @brief Camera connections storage for C API lifetime management */
-std::unordered_map<duvc_connection_t *, std::unique_ptr<duvc::Camera>>
+std::unordered_map<duvc_connection_t *, std::shared_ptr<duvc::Camera>>
     g_connections;
 std::mutex g_connection_mutex;
 
+/**
+ * @brief Look up a connection handle
+ * @param conn Connection handle
+ * @return Camera kept alive for the duration of the call, or nullptr
+ *
+ * The registry lock is released before the caller talks to the device, so a
+ * slow or hung camera cannot block operations on other connections.
+ */
+std::shared_ptr<duvc::Camera> find_connection(const duvc_connection_t *conn) {
+  std::lock_guard<std::mutex> lock(g_connection_mutex);
+  auto it = g_connections.find(const_cast<duvc_connection_t *>(conn));
+  return it != g_connections.end() ? it->second : nullptr;
+}
+
+/** @brief Preset recaller per connection, created on first recall */
+struct ConnectionPresets {
+  std::shared_ptr<duvc::Camera> camera; ///< Keeps the recaller's camera alive
+  std::unique_ptr<duvc::PresetRecaller> recaller;
+};
+std::unordered_map<duvc_connection_t *, std::shared_ptr<ConnectionPresets>>
+    g_preset_recallers;
+std::mutex g_preset_mutex;
+
 /** @brief Capabilities storage for C API */
 std::vector<std::unique_ptr<duvc::DeviceCapabilities>> g_capabilities_storage;
 std::mutex g_capabilities_mutex;
@@ -104,19 +138,33 @@ duvc_result_t copy_string_to_buffer(const std::string &cpp_str, char *buffer,
 
 /**
  * @brief Convert wide string to UTF-8 with buffer management
+ *
+ * Encodes straight into the caller's buffer without a temporary string.
  */
 duvc_result_t copy_wstring_to_buffer(const std::wstring &wide_str, char *buffer,
                                      size_t buffer_size,
                                      size_t *required_size) {
-  try {
-    std::string utf8_str = duvc::to_utf8(wide_str);
-    return copy_string_to_buffer(utf8_str, buffer, buffer_size, required_size);
-  } catch (const std::exception &e) {
-    g_last_error_details = std::string("String conversion failed: ") + e.what();
-    if (required_size)
-      *required_size = 0;
-    return DUVC_ERROR_SYSTEM_ERROR;
+  size_t needed = duvc::utf8_length(wide_str.data(), wide_str.size()) + 1;
+  if (required_size)
+    *required_size = needed;
+
+  if (!buffer || buffer_size < needed) {
+    return DUVC_ERROR_BUFFER_TOO_SMALL;
   }
+
+  buffer[duvc::encode_utf8(wide_str.data(), wide_str.size(), buffer)] = '\0';
+  return DUVC_SUCCESS;
+}
+
+/** @brief Get the C handle for an interned device */
+duvc_device_t *to_c_device(const duvc::DeviceHandle &handle) {
+  return reinterpret_cast<duvc_device_t *>(
+      const_cast<duvc::DeviceRecord *>(handle.record()));
+}
+
+/** @brief Get the interned record behind a C device handle */
+const duvc::DeviceRecord *device_record(const duvc_device_t *device) {
+  return reinterpret_cast<const duvc::DeviceRecord *>(device);
 }
 
 /**
@@ -223,6 +271,62 @@ duvc_prop_range_t convert_prop_range_to_c(const duvc::PropRange &range) {
   return c_range;
 }
 
+duvc::DevicePolicy convert_policy_from_c(const duvc_policy_t &policy) {
+  duvc::DevicePolicy cpp_policy;
+  cpp_policy.enabled = policy.enabled != 0;
+  cpp_policy.retry.max_attempts = static_cast<int>(policy.max_attempts);
+  cpp_policy.retry.initial_backoff =
+      std::chrono::milliseconds(policy.initial_backoff_ms);
+  cpp_policy.retry.max_backoff = std::chrono::milliseconds(policy.max_backoff_ms);
+  cpp_policy.retry.multiplier = policy.backoff_multiplier;
+  cpp_policy.retry.jitter = policy.jitter;
+  cpp_policy.breaker.failure_threshold =
+      static_cast<int>(policy.failure_threshold);
+  cpp_policy.breaker.open_duration =
+      std::chrono::milliseconds(policy.open_duration_ms);
+  cpp_policy.breaker.half_open_probes =
+      static_cast<int>(policy.half_open_probes);
+  return cpp_policy;
+}
+
+duvc_policy_t convert_policy_to_c(const duvc::DevicePolicy &policy) {
+  duvc_policy_t c_policy;
+  c_policy.enabled = policy.enabled ? 1 : 0;
+  c_policy.max_attempts = static_cast<uint32_t>(policy.retry.max_attempts);
+  c_policy.initial_backoff_ms =
+      static_cast<uint32_t>(policy.retry.initial_backoff.count());
+  c_policy.max_backoff_ms =
+      static_cast<uint32_t>(policy.retry.max_backoff.count());
+  c_policy.backoff_multiplier = policy.retry.multiplier;
+  c_policy.jitter = policy.retry.jitter;
+  c_policy.failure_threshold =
+      static_cast<uint32_t>(policy.breaker.failure_threshold);
+  c_policy.open_duration_ms =
+      static_cast<uint32_t>(policy.breaker.open_duration.count());
+  c_policy.half_open_probes =
+      static_cast<uint32_t>(policy.breaker.half_open_probes);
+  return c_policy;
+}
+
+/**
+ * @brief Validate a C policy before applying it
+ */
+bool validate_policy(const duvc_policy_t &policy) {
+  if (policy.max_attempts < 1 || policy.failure_threshold < 1 ||
+      policy.half_open_probes < 1) {
+    g_last_error_details =
+        "Policy attempts, failure threshold and probes must be >= 1";
+    return false;
+  }
+  if (policy.backoff_multiplier < 1.0 || policy.jitter < 0.0 ||
+      policy.jitter > 1.0) {
+    g_last_error_details =
+        "Policy multiplier must be >= 1 and jitter within [0, 1]";
+    return false;
+  }
+  return true;
+}
+
 } // anonymous namespace
 
 extern "C" {
@@ -274,6 +378,7 @@ duvc_result_t duvc_initialize(void) {
 
     // Clear storage containers
     g_device_storage.clear();
+    g_device_index = duvc::DeviceIndex();
     g_connections.clear();
     g_capabilities_storage.clear();
 
@@ -310,6 +415,7 @@ void duvc_shutdown(void) {
     {
       std::lock_guard<std::mutex> dev_lock(g_device_storage_mutex);
       g_device_storage.clear();
+      g_device_index = duvc::DeviceIndex();
     }
 
     // Clear capabilities storage
@@ -520,9 +626,11 @@ duvc_result_t duvc_list_devices(duvc_device_t ***devices, size_t *count) {
 
     // Clear previous device storage
     g_device_storage.clear();
+    g_device_index = duvc::DeviceIndex();
 
     // Get devices from C++ core
     auto device_list = duvc::list_devices();
+    g_device_index = duvc::DeviceIndex(device_list);
 
     // Allocate C device array
     duvc_device_t **c_devices = static_cast<duvc_device_t **>(
@@ -534,10 +642,8 @@ duvc_result_t duvc_list_devices(duvc_device_t ***devices, size_t *count) {
 
     // Store devices and create C pointers
     for (size_t i = 0; i < device_list.size(); ++i) {
-      auto stored_device =
-          std::make_unique<duvc::Device>(std::move(device_list[i]));
-      c_devices[i] = reinterpret_cast<duvc_device_t *>(stored_device.get());
-      g_device_storage.push_back(std::move(stored_device));
+      g_device_storage.push_back(duvc::intern_device(device_list[i]));
+      c_devices[i] = to_c_device(g_device_storage.back());
     }
 
     *devices = c_devices;
@@ -571,9 +677,8 @@ duvc_result_t duvc_find_device_by_path(const char *device_path_utf8,
     
     // Store device and return pointer
     std::lock_guard<std::mutex> lock(g_device_storage_mutex);
-    auto stored_device = std::make_unique<duvc::Device>(std::move(found_device));
-    *device = reinterpret_cast<duvc_device_t *>(stored_device.get());
-    g_device_storage.push_back(std::move(stored_device));
+    g_device_storage.push_back(duvc::intern_device(found_device));
+    *device = to_c_device(g_device_storage.back());
     
     return DUVC_SUCCESS;
     
@@ -607,8 +712,7 @@ duvc_result_t duvc_is_device_connected(const duvc_device_t *device,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     bool is_connected = duvc::is_device_connected(*cpp_device);
     *connected = is_connected ? 1 : 0;
     return DUVC_SUCCESS;
@@ -633,10 +737,8 @@ duvc_result_t duvc_get_device_name(const duvc_device_t *device, char *buffer,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
-    return copy_wstring_to_buffer(cpp_device->name, buffer, buffer_size,
-                                  required);
+    return copy_string_to_buffer(device_record(device)->name_utf8, buffer,
+                                 buffer_size, required);
   } catch (const std::exception &e) {
     g_last_error_details =
         std::string("Failed to get device name: ") + e.what();
@@ -654,10 +756,8 @@ duvc_result_t duvc_get_device_path(const duvc_device_t *device, char *buffer,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
-    return copy_wstring_to_buffer(cpp_device->path, buffer, buffer_size,
-                                  required);
+    return copy_string_to_buffer(device_record(device)->path_utf8, buffer,
+                                 buffer_size, required);
   } catch (const std::exception &e) {
     g_last_error_details =
         std::string("Failed to get device path: ") + e.what();
@@ -675,8 +775,7 @@ duvc_result_t duvc_get_device_id(const duvc_device_t *device, char *buffer,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     // Use path as device ID if available, otherwise use name
     const std::wstring &id_str =
         cpp_device->path.empty() ? cpp_device->name : cpp_device->path;
@@ -696,8 +795,7 @@ duvc_result_t duvc_device_is_valid(const duvc_device_t *device, int *valid) {
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     *valid = cpp_device->is_valid() ? 1 : 0;
     return DUVC_SUCCESS;
   } catch (const std::exception &e) {
@@ -707,6 +805,119 @@ duvc_result_t duvc_device_is_valid(const duvc_device_t *device, int *valid) {
   }
 }
 
+duvc_result_t duvc_get_device_identity(const duvc_device_t *device,
+                                       duvc_device_identity_t *identity) {
+  if (!device || !identity)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  try {
+    const duvc::DeviceIdentity &parsed = device_record(device)->identity;
+
+    std::memset(identity, 0, sizeof(*identity));
+    std::string bus = duvc::to_utf8(parsed.bus);
+    std::strncpy(identity->bus, bus.c_str(), sizeof(identity->bus) - 1);
+    identity->has_usb_ids = parsed.usb_id() ? 1 : 0;
+    identity->vid = parsed.vid.value_or(0);
+    identity->pid = parsed.pid.value_or(0);
+    identity->interface_number =
+        parsed.interface_number ? *parsed.interface_number : -1;
+    identity->has_serial = parsed.has_serial() ? 1 : 0;
+    std::string guid = duvc::to_utf8(parsed.interface_guid);
+    std::strncpy(identity->interface_guid, guid.c_str(),
+                 sizeof(identity->interface_guid) - 1);
+    identity->key_hash = parsed.key_hash;
+    return DUVC_SUCCESS;
+  } catch (const std::exception &e) {
+    g_last_error_details =
+        std::string("Failed to get device identity: ") + e.what();
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+}
+
+duvc_result_t duvc_get_device_serial(const duvc_device_t *device, char *buffer,
+                                     size_t buffer_size, size_t *required) {
+  if (!device)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  try {
+    return copy_wstring_to_buffer(device_record(device)->identity.serial(),
+                                  buffer, buffer_size, required);
+  } catch (const std::exception &e) {
+    g_last_error_details =
+        std::string("Failed to get device serial: ") + e.what();
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+}
+
+duvc_result_t duvc_find_device_by_serial(const char *serial_utf8,
+                                         duvc_device_t **device) {
+  if (!serial_utf8 || !device)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  try {
+    std::lock_guard<std::mutex> lock(g_device_storage_mutex);
+    const auto *entry =
+        g_device_index.find_by_serial(duvc::to_wstring(std::string(serial_utf8)));
+    if (!entry) {
+      g_last_error_details =
+          std::string("No listed device has serial ") + serial_utf8;
+      return DUVC_ERROR_DEVICE_NOT_FOUND;
+    }
+    *device = to_c_device(g_device_storage[entry->position]);
+    return DUVC_SUCCESS;
+  } catch (const std::exception &e) {
+    g_last_error_details =
+        std::string("Failed to find device by serial: ") + e.what();
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+}
+
+duvc_result_t duvc_find_devices_by_usb_id(uint16_t vid, uint16_t pid,
+                                          duvc_device_t ***devices,
+                                          size_t *count) {
+  if (!devices || !count)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  try {
+    std::lock_guard<std::mutex> lock(g_device_storage_mutex);
+    auto found = g_device_index.find_by_usb_id(vid, pid);
+
+    duvc_device_t **c_devices = static_cast<duvc_device_t **>(
+        std::malloc(found.size() * sizeof(duvc_device_t *)));
+    if (!c_devices && !found.empty()) {
+      g_last_error_details = "Failed to allocate memory for device list";
+      return DUVC_ERROR_SYSTEM_ERROR;
+    }
+    for (size_t i = 0; i < found.size(); ++i) {
+      c_devices[i] = to_c_device(g_device_storage[found[i]->position]);
+    }
+
+    *devices = c_devices;
+    *count = found.size();
+    return DUVC_SUCCESS;
+  } catch (const std::exception &e) {
+    g_last_error_details =
+        std::string("Failed to find devices by USB ID: ") + e.what();
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+}
+
 /* ========================================================================
  * Device Change Monitoring
  * ======================================================================== */
@@ -789,7 +1000,7 @@ duvc_result_t duvc_open_camera_by_index(int device_index,
 
     std::lock_guard<std::mutex> conn_lock(g_connection_mutex);
     auto camera_ptr =
-        std::make_unique<duvc::Camera>(std::move(cam_result).value());
+        std::make_shared<duvc::Camera>(std::move(cam_result).value());
     duvc_connection_t *handle =
         reinterpret_cast<duvc_connection_t *>(camera_ptr.get());
     g_connections[handle] = std::move(camera_ptr);
@@ -813,8 +1024,7 @@ duvc_result_t duvc_open_camera(const duvc_device_t *device,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     auto cam_result = duvc::open_camera(*cpp_device);
     if (!cam_result.is_ok()) {
       return handle_cpp_result(cam_result);
@@ -822,7 +1032,7 @@ duvc_result_t duvc_open_camera(const duvc_device_t *device,
 
     std::lock_guard<std::mutex> lock(g_connection_mutex);
     auto camera_ptr =
-        std::make_unique<duvc::Camera>(std::move(cam_result).value());
+        std::make_shared<duvc::Camera>(std::move(cam_result).value());
     duvc_connection_t *handle =
         reinterpret_cast<duvc_connection_t *>(camera_ptr.get());
     g_connections[handle] = std::move(camera_ptr);
@@ -841,11 +1051,21 @@ void duvc_close_camera(duvc_connection_t *conn) {
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it != g_connections.end()) {
-      g_connections.erase(it);
+    std::shared_ptr<duvc::Camera> camera;
+    {
+      std::lock_guard<std::mutex> lock(g_connection_mutex);
+      auto it = g_connections.find(conn);
+      if (it != g_connections.end()) {
+        camera = std::move(it->second);
+        g_connections.erase(it);
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(g_preset_mutex);
+      g_preset_recallers.erase(conn);
     }
+    // Released outside the lock; the device actor may still be draining
+    camera.reset();
   } catch (...) {
     // Ignore exceptions during cleanup
   }
@@ -857,17 +1077,338 @@ int duvc_camera_is_valid(const duvc_connection_t *conn) {
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(const_cast<duvc_connection_t *>(conn));
-    if (it == g_connections.end()) {
-      return 0;
-    }
-    return it->second->is_valid() ? 1 : 0;
+    auto camera = find_connection(conn);
+    return camera && camera->is_valid() ? 1 : 0;
   } catch (...) {
     return 0;
   }
 }
 
+duvc_result_t duvc_set_operation_timeout(duvc_connection_t *conn,
+                                         uint32_t timeout_ms) {
+  if (!conn)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  auto camera = find_connection(conn);
+  if (!camera) {
+    g_last_error_details = "Invalid connection handle";
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  }
+  camera->set_timeout(std::chrono::milliseconds(timeout_ms));
+  return DUVC_SUCCESS;
+}
+
+duvc_result_t duvc_get_operation_timeout(const duvc_connection_t *conn,
+                                         uint32_t *timeout_ms) {
+  if (!conn || !timeout_ms)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  auto camera = find_connection(conn);
+  if (!camera) {
+    g_last_error_details = "Invalid connection handle";
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  }
+  *timeout_ms = static_cast<uint32_t>(camera->timeout().count());
+  return DUVC_SUCCESS;
+}
+
+/* ========================================================================
+ * Retry and Circuit Breaker Policy
+ * ======================================================================== */
+
+duvc_result_t duvc_get_default_policy(duvc_policy_t *policy) {
+  if (!policy)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+
+  *policy = convert_policy_to_c(duvc::default_device_policy());
+  return DUVC_SUCCESS;
+}
+
+duvc_result_t duvc_set_default_policy(const duvc_policy_t *policy) {
+  if (!policy)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!validate_policy(*policy))
+    return DUVC_ERROR_INVALID_ARGUMENT;
+
+  duvc::set_default_device_policy(convert_policy_from_c(*policy));
+  return DUVC_SUCCESS;
+}
+
+duvc_result_t duvc_set_connection_policy(duvc_connection_t *conn,
+                                         const duvc_policy_t *policy) {
+  if (!conn || !policy)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+  if (!validate_policy(*policy))
+    return DUVC_ERROR_INVALID_ARGUMENT;
+
+  auto camera = find_connection(conn);
+  if (!camera) {
+    g_last_error_details = "Invalid connection handle";
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  }
+  camera->set_policy(convert_policy_from_c(*policy));
+  return DUVC_SUCCESS;
+}
+
+duvc_result_t duvc_get_connection_policy(const duvc_connection_t *conn,
+                                         duvc_policy_t *policy) {
+  if (!conn || !policy)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  auto camera = find_connection(conn);
+  if (!camera) {
+    g_last_error_details = "Invalid connection handle";
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  }
+  *policy = convert_policy_to_c(camera->policy());
+  return DUVC_SUCCESS;
+}
+
+duvc_result_t duvc_get_policy_stats(const duvc_connection_t *conn,
+                                    duvc_policy_stats_t *stats) {
+  if (!conn || !stats)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  auto camera = find_connection(conn);
+  if (!camera) {
+    g_last_error_details = "Invalid connection handle";
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  }
+
+  duvc::PolicyStats cpp_stats = camera->policy_stats();
+  stats->attempts = cpp_stats.attempts;
+  stats->successes = cpp_stats.successes;
+  stats->failures = cpp_stats.failures;
+  stats->retries = cpp_stats.retries;
+  stats->short_circuited = cpp_stats.short_circuited;
+  stats->trips = cpp_stats.trips;
+  stats->consecutive_failures =
+      static_cast<uint32_t>(cpp_stats.consecutive_failures);
+  stats->state = static_cast<duvc_circuit_state_t>(cpp_stats.state);
+  return DUVC_SUCCESS;
+}
+
+duvc_result_t duvc_export_policy_stats(const duvc_connection_t *conn,
+                                       duvc_output_format_t format,
+                                       char *buffer, size_t buffer_size,
+                                       size_t *required_size) {
+  if (!conn || format < DUVC_FORMAT_JSON || format > DUVC_FORMAT_MSGPACK)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  auto camera = find_connection(conn);
+  if (!camera) {
+    g_last_error_details = "Invalid connection handle";
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  }
+
+  static const duvc::SerialFormat formats[] = {
+      duvc::SerialFormat::Json, duvc::SerialFormat::JsonLines,
+      duvc::SerialFormat::Csv, duvc::SerialFormat::MessagePack};
+  duvc::PolicyStats cpp_stats = camera->policy_stats();
+  duvc::Serializer out(formats[format]);
+  out.begin_object()
+      .field("attempts", cpp_stats.attempts)
+      .field("successes", cpp_stats.successes)
+      .field("failures", cpp_stats.failures)
+      .field("retries", cpp_stats.retries)
+      .field("short_circuited", cpp_stats.short_circuited)
+      .field("trips", cpp_stats.trips)
+      .field("consecutive_failures", cpp_stats.consecutive_failures)
+      .field("state", duvc::to_string(cpp_stats.state))
+      .end_object();
+  return copy_string_to_buffer(out.buffer(), buffer, buffer_size,
+                               required_size);
+}
+
+/* ========================================================================
+ * Presets
+ * ======================================================================== */
+
+namespace {
+
+/**
+ * @brief Open the preset store named by a C path
+ * @param store_path UTF-8 path, or nullptr for the default store
+ * @param[out] store Loaded store
+ * @return DUVC_SUCCESS or the load error
+ */
+duvc_result_t load_preset_store(const char *store_path,
+                                std::unique_ptr<duvc::PresetStore> &store) {
+  store = std::make_unique<duvc::PresetStore>(
+      store_path ? std::filesystem::u8path(store_path)
+                 : duvc::default_preset_path());
+  auto loaded = store->load();
+  if (!loaded.is_ok()) {
+    g_last_error_details = loaded.error().description();
+    return convert_error_code(loaded.error().code());
+  }
+  return DUVC_SUCCESS;
+}
+
+/// Get the connection's preset recaller, creating it on first use
+std::shared_ptr<ConnectionPresets> find_presets(duvc_connection_t *conn) {
+  auto camera = find_connection(conn);
+  if (!camera) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(g_preset_mutex);
+  auto &entry = g_preset_recallers[conn];
+  if (!entry || entry->camera != camera) {
+    entry = std::make_shared<ConnectionPresets>();
+    entry->camera = camera;
+    entry->recaller = std::make_unique<duvc::PresetRecaller>(*camera);
+  }
+  return entry;
+}
+
+} // namespace
+
+duvc_result_t duvc_preset_save(duvc_connection_t *conn, const char *store_path,
+                               const char *name, uint32_t *version) {
+  if (!conn || !name)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  try {
+    auto presets = find_presets(conn);
+    if (!presets) {
+      g_last_error_details = "Invalid connection handle";
+      return DUVC_ERROR_INVALID_ARGUMENT;
+    }
+    std::unique_ptr<duvc::PresetStore> store;
+    duvc_result_t loaded = load_preset_store(store_path, store);
+    if (loaded != DUVC_SUCCESS)
+      return loaded;
+
+    const auto &stored = store->put(presets->recaller->capture(name));
+    if (version)
+      *version = stored.version;
+    return handle_cpp_result(store->save());
+  } catch (const std::exception &e) {
+    g_last_error_details = std::string("Failed to save preset: ") + e.what();
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+}
+
+duvc_result_t duvc_preset_recall(duvc_connection_t *conn,
+                                 const char *store_path, const char *name,
+                                 duvc_preset_recall_report_t *report) {
+  if (!conn || !name)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+  if (!g_initialized.load()) {
+    g_last_error_details = "Library not initialized";
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+
+  try {
+    auto presets = find_presets(conn);
+    if (!presets) {
+      g_last_error_details = "Invalid connection handle";
+      return DUVC_ERROR_INVALID_ARGUMENT;
+    }
+    std::unique_ptr<duvc::PresetStore> store;
+    duvc_result_t loaded = load_preset_store(store_path, store);
+    if (loaded != DUVC_SUCCESS)
+      return loaded;
+
+    const duvc::Preset *preset = store->find(name);
+    if (!preset) {
+      g_last_error_details = std::string("Preset not found: ") + name;
+      return DUVC_ERROR_DEVICE_NOT_FOUND;
+    }
+
+    auto recalled = presets->recaller->recall(*preset);
+    if (report) {
+      report->writes = recalled.writes;
+      report->skipped = recalled.skipped;
+      report->failed = recalled.failed;
+      report->unsupported = recalled.unsupported;
+      report->compile_us =
+          static_cast<uint64_t>(recalled.compile_time.count());
+      report->write_us = static_cast<uint64_t>(recalled.write_time.count());
+    }
+    for (const auto &entry : recalled.entries) {
+      if (entry.error) {
+        g_last_error_details = entry.error->description();
+        return convert_error_code(entry.error->code());
+      }
+    }
+    g_last_error_details.clear();
+    return DUVC_SUCCESS;
+  } catch (const std::exception &e) {
+    g_last_error_details = std::string("Failed to recall preset: ") + e.what();
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+}
+
+duvc_result_t duvc_preset_delete(const char *store_path, const char *name) {
+  if (!name)
+    return DUVC_ERROR_INVALID_ARGUMENT;
+
+  try {
+    std::unique_ptr<duvc::PresetStore> store;
+    duvc_result_t loaded = load_preset_store(store_path, store);
+    if (loaded != DUVC_SUCCESS)
+      return loaded;
+    if (!store->remove(name)) {
+      g_last_error_details = std::string("Preset not found: ") + name;
+      return DUVC_ERROR_DEVICE_NOT_FOUND;
+    }
+    return handle_cpp_result(store->save());
+  } catch (const std::exception &e) {
+    g_last_error_details = std::string("Failed to delete preset: ") + e.what();
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+}
+
+duvc_result_t duvc_preset_list(const char *store_path, char *buffer,
+                               size_t buffer_size, size_t *required) {
+  try {
+    std::unique_ptr<duvc::PresetStore> store;
+    duvc_result_t loaded = load_preset_store(store_path, store);
+    if (loaded != DUVC_SUCCESS)
+      return loaded;
+
+    std::string names;
+    for (const auto &preset : store->presets()) {
+      if (!names.empty())
+        names += '\n';
+      names += preset.name;
+    }
+    return copy_string_to_buffer(names, buffer, buffer_size, required);
+  } catch (const std::exception &e) {
+    g_last_error_details = std::string("Failed to list presets: ") + e.what();
+    return DUVC_ERROR_SYSTEM_ERROR;
+  }
+}
+
 /* ========================================================================
  * Property Access - Single Properties
  * ======================================================================== */
@@ -883,14 +1424,13 @@ duvc_result_t duvc_get_camera_property(duvc_connection_t *conn,
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it == g_connections.end()) {
+    auto camera = find_connection(conn);
+    if (!camera) {
       g_last_error_details = "Invalid connection handle";
       return DUVC_ERROR_INVALID_ARGUMENT;
     }
 
-    auto result = it->second->get(convert_cam_prop(prop));
+    auto result = camera->get(convert_cam_prop(prop));
     if (!result.is_ok()) {
       return handle_cpp_result(result);
     }
@@ -915,15 +1455,14 @@ duvc_result_t duvc_set_camera_property(duvc_connection_t *conn,
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it == g_connections.end()) {
+    auto camera = find_connection(conn);
+    if (!camera) {
       g_last_error_details = "Invalid connection handle";
       return DUVC_ERROR_INVALID_ARGUMENT;
     }
 
     duvc::PropSetting cpp_setting = convert_prop_setting_from_c(*setting);
-    auto result = it->second->set(convert_cam_prop(prop), cpp_setting);
+    auto result = camera->set(convert_cam_prop(prop), cpp_setting);
     return handle_cpp_result(result);
   } catch (const std::exception &e) {
     g_last_error_details =
@@ -943,14 +1482,13 @@ duvc_result_t duvc_get_camera_property_range(duvc_connection_t *conn,
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it == g_connections.end()) {
+    auto camera = find_connection(conn);
+    if (!camera) {
       g_last_error_details = "Invalid connection handle";
       return DUVC_ERROR_INVALID_ARGUMENT;
     }
 
-    auto result = it->second->get_range(convert_cam_prop(prop));
+    auto result = camera->get_range(convert_cam_prop(prop));
     if (!result.is_ok()) {
       return handle_cpp_result(result);
     }
@@ -975,14 +1513,13 @@ duvc_result_t duvc_get_video_property(duvc_connection_t *conn,
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it == g_connections.end()) {
+    auto camera = find_connection(conn);
+    if (!camera) {
       g_last_error_details = "Invalid connection handle";
       return DUVC_ERROR_INVALID_ARGUMENT;
     }
 
-    auto result = it->second->get(convert_vid_prop(prop));
+    auto result = camera->get(convert_vid_prop(prop));
     if (!result.is_ok()) {
       return handle_cpp_result(result);
     }
@@ -1007,15 +1544,14 @@ duvc_result_t duvc_set_video_property(duvc_connection_t *conn,
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it == g_connections.end()) {
+    auto camera = find_connection(conn);
+    if (!camera) {
       g_last_error_details = "Invalid connection handle";
       return DUVC_ERROR_INVALID_ARGUMENT;
     }
 
     duvc::PropSetting cpp_setting = convert_prop_setting_from_c(*setting);
-    auto result = it->second->set(convert_vid_prop(prop), cpp_setting);
+    auto result = camera->set(convert_vid_prop(prop), cpp_setting);
     return handle_cpp_result(result);
   } catch (const std::exception &e) {
     g_last_error_details =
@@ -1035,14 +1571,13 @@ duvc_result_t duvc_get_video_property_range(duvc_connection_t *conn,
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it == g_connections.end()) {
+    auto camera = find_connection(conn);
+    if (!camera) {
       g_last_error_details = "Invalid connection handle";
       return DUVC_ERROR_INVALID_ARGUMENT;
     }
 
-    auto result = it->second->get_range(convert_vid_prop(prop));
+    auto result = camera->get_range(convert_vid_prop(prop));
     if (!result.is_ok()) {
       return handle_cpp_result(result);
     }
@@ -1072,14 +1607,12 @@ duvc_result_t duvc_get_multiple_camera_properties(duvc_connection_t *conn,
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it == g_connections.end()) {
+    auto camera = find_connection(conn);
+    if (!camera) {
       g_last_error_details = "Invalid connection handle";
       return DUVC_ERROR_INVALID_ARGUMENT;
     }
 
-    duvc::Camera *camera = it->second.get();
     for (size_t i = 0; i < count; ++i) {
       auto result = camera->get(convert_cam_prop(props[i]));
       if (!result.is_ok()) {
@@ -1109,14 +1642,12 @@ duvc_result_t duvc_set_multiple_camera_properties(
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it == g_connections.end()) {
+    auto camera = find_connection(conn);
+    if (!camera) {
       g_last_error_details = "Invalid connection handle";
       return DUVC_ERROR_INVALID_ARGUMENT;
     }
 
-    duvc::Camera *camera = it->second.get();
     for (size_t i = 0; i < count; ++i) {
       duvc::PropSetting cpp_setting = convert_prop_setting_from_c(settings[i]);
       auto result = camera->set(convert_cam_prop(props[i]), cpp_setting);
@@ -1147,14 +1678,12 @@ duvc_result_t duvc_get_multiple_video_properties(duvc_connection_t *conn,
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it == g_connections.end()) {
+    auto camera = find_connection(conn);
+    if (!camera) {
       g_last_error_details = "Invalid connection handle";
       return DUVC_ERROR_INVALID_ARGUMENT;
     }
 
-    duvc::Camera *camera = it->second.get();
     for (size_t i = 0; i < count; ++i) {
       auto result = camera->get(convert_vid_prop(props[i]));
       if (!result.is_ok()) {
@@ -1184,14 +1713,12 @@ duvc_result_t duvc_set_multiple_video_properties(
   }
 
   try {
-    std::lock_guard<std::mutex> lock(g_connection_mutex);
-    auto it = g_connections.find(conn);
-    if (it == g_connections.end()) {
+    auto camera = find_connection(conn);
+    if (!camera) {
       g_last_error_details = "Invalid connection handle";
       return DUVC_ERROR_INVALID_ARGUMENT;
     }
 
-    duvc::Camera *camera = it->second.get();
     for (size_t i = 0; i < count; ++i) {
       duvc::PropSetting cpp_setting = convert_prop_setting_from_c(settings[i]);
       auto result = camera->set(convert_vid_prop(props[i]), cpp_setting);
@@ -1225,8 +1752,7 @@ duvc_result_t duvc_quick_get_camera_property(const duvc_device_t *device,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     auto cam_result = duvc::open_camera(*cpp_device);
     if (!cam_result.is_ok()) {
       return handle_cpp_result(cam_result);
@@ -1259,8 +1785,7 @@ duvc_quick_set_camera_property(const duvc_device_t *device,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     auto cam_result = duvc::open_camera(*cpp_device);
     if (!cam_result.is_ok()) {
       return handle_cpp_result(cam_result);
@@ -1288,8 +1813,7 @@ duvc_result_t duvc_quick_get_camera_property_range(const duvc_device_t *device,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     auto cam_result = duvc::open_camera(*cpp_device);
     if (!cam_result.is_ok()) {
       return handle_cpp_result(cam_result);
@@ -1321,8 +1845,7 @@ duvc_result_t duvc_quick_get_video_property(const duvc_device_t *device,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     auto cam_result = duvc::open_camera(*cpp_device);
     if (!cam_result.is_ok()) {
       return handle_cpp_result(cam_result);
@@ -1354,8 +1877,7 @@ duvc_quick_set_video_property(const duvc_device_t *device, duvc_vid_prop_t prop,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     auto cam_result = duvc::open_camera(*cpp_device);
     if (!cam_result.is_ok()) {
       return handle_cpp_result(cam_result);
@@ -1383,8 +1905,7 @@ duvc_result_t duvc_quick_get_video_property_range(const duvc_device_t *device,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     auto cam_result = duvc::open_camera(*cpp_device);
     if (!cam_result.is_ok()) {
       return handle_cpp_result(cam_result);
@@ -1419,8 +1940,7 @@ duvc_result_t duvc_get_device_capabilities(const duvc_device_t *device,
   }
 
   try {
-    const duvc::Device *cpp_device =
-        reinterpret_cast<const duvc::Device *>(device);
+    const duvc::Device *cpp_device = &device_record(device)->device;
     auto result = duvc::get_device_capabilities(*cpp_device);
     if (!result.is_ok()) {
       return handle_cpp_result(result);
@@ -1658,17 +2178,16 @@ duvc_get_supported_camera_properties(const duvc_device_capabilities_t *caps,
   try {
     const duvc::DeviceCapabilities *cpp_caps =
         reinterpret_cast<const duvc::DeviceCapabilities *>(caps);
-    auto supported_props = cpp_caps->supported_camera_properties();
+    auto supported_props = cpp_caps->camera_properties();
 
     *actual_count = supported_props.size();
 
-    if (!props || max_count < supported_props.size()) {
+    if (!props || max_count < *actual_count) {
       return DUVC_ERROR_BUFFER_TOO_SMALL;
     }
 
-    for (size_t i = 0; i < supported_props.size(); ++i) {
-      props[i] =
-          static_cast<duvc_cam_prop_t>(static_cast<int>(supported_props[i]));
+    for (auto prop : supported_props) {
+      *props++ = static_cast<duvc_cam_prop_t>(static_cast<int>(prop));
     }
 
     return DUVC_SUCCESS;
@@ -1693,17 +2212,16 @@ duvc_get_supported_video_properties(const duvc_device_capabilities_t *caps,
   try {
     const duvc::DeviceCapabilities *cpp_caps =
         reinterpret_cast<const duvc::DeviceCapabilities *>(caps);
-    auto supported_props = cpp_caps->supported_video_properties();
+    auto supported_props = cpp_caps->video_properties();
 
     *actual_count = supported_props.size();
 
-    if (!props || max_count < supported_props.size()) {
+    if (!props || max_count < *actual_count) {
       return DUVC_ERROR_BUFFER_TOO_SMALL;
     }
 
-    for (size_t i = 0; i < supported_props.size(); ++i) {
-      props[i] =
-          static_cast<duvc_vid_prop_t>(static_cast<int>(supported_props[i]));
+    for (auto prop : supported_props) {
+      *props++ = static_cast<duvc_vid_prop_t>(static_cast<int>(prop));
     }
 
     return DUVC_SUCCESS;
@@ -5,126 +5,439 @@
 
 #include <duvc-ctl/core/camera.h>
 #include <duvc-ctl/core/device.h>
-#include <duvc-ctl/platform/windows/connection_pool.h>
+#include <duvc-ctl/core/device_actor.h>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <type_traits>
 
 namespace duvc {
 
-Camera::Camera(const Device &device) : device_(device), connection_(nullptr) {}
+namespace {
+
+/// Tracked values are re-read after this many emulated nudges...
+constexpr uint32_t kNudgeResyncWrites = 32;
+/// ...or once they are this old
+constexpr std::chrono::milliseconds kNudgeResyncInterval{1000};
+
+/// Native relative control of an absolute camera property
+std::optional<CamProp> relative_control(CamProp prop) {
+  switch (prop) {
+  case CamProp::Pan:
+    return CamProp::PanRelative;
+  case CamProp::Tilt:
+    return CamProp::TiltRelative;
+  case CamProp::Roll:
+    return CamProp::RollRelative;
+  case CamProp::Zoom:
+    return CamProp::ZoomRelative;
+  case CamProp::Exposure:
+    return CamProp::ExposureRelative;
+  case CamProp::Iris:
+    return CamProp::IrisRelative;
+  case CamProp::Focus:
+    return CamProp::FocusRelative;
+  case CamProp::DigitalZoom:
+    return CamProp::DigitalZoomRelative;
+  default:
+    return std::nullopt;
+  }
+}
+
+bool is_relative_control(CamProp prop) {
+  switch (prop) {
+  case CamProp::PanRelative:
+  case CamProp::TiltRelative:
+  case CamProp::RollRelative:
+  case CamProp::ZoomRelative:
+  case CamProp::ExposureRelative:
+  case CamProp::IrisRelative:
+  case CamProp::FocusRelative:
+  case CamProp::PanTiltRelative:
+  case CamProp::DigitalZoomRelative:
+    return true;
+  default:
+    return false;
+  }
+}
+
+} // namespace
+
+/// Ranges and locally tracked values behind Camera::nudge()
+struct Camera::NudgeState {
+  /// Emulated relative moves of one property
+  struct Tracked {
+    std::optional<PropRange> range;
+    std::optional<int> value; ///< Last value read or written
+    uint64_t seen = 0;        ///< write_count() that value accounts for
+    uint32_t writes = 0;      ///< Nudges since value was read
+    std::chrono::steady_clock::time_point synced;
+  };
+
+  Tracked &tracked(CamProp prop) { return camera[prop]; }
+  Tracked &tracked(VidProp prop) { return video[prop]; }
+
+  std::mutex mutex;
+  std::map<CamProp, Tracked> camera;
+  std::map<VidProp, Tracked> video;
+  std::set<CamProp> no_relative; ///< Relative controls the device rejected
+};
 
-Camera::Camera(int device_index) : connection_(nullptr) {
+/// Per-property write counts behind Camera::write_count()
+struct Camera::WriteCounters {
+  std::atomic<uint64_t> camera[static_cast<int>(CamProp::Lamp) + 1] = {};
+  std::atomic<uint64_t> video[static_cast<int>(VidProp::PowerLineFrequency) + 1] = {};
+
+  std::atomic<uint64_t> &of(CamProp prop) { return camera[static_cast<int>(prop)]; }
+  std::atomic<uint64_t> &of(VidProp prop) { return video[static_cast<int>(prop)]; }
+
+  /// Count a completed write; returns the new count
+  template <typename Prop> uint64_t bump(Prop prop) {
+    return of(prop).fetch_add(1, std::memory_order_acq_rel) + 1;
+  }
+};
+
+Camera::Camera(const Device &device) : device_(intern_device(device)) {
+  attach_actor();
+}
+
+Camera::Camera(DeviceHandle device) : device_(std::move(device)) {
+  attach_actor();
+}
+
+Camera::Camera(int device_index) {
   auto devices = list_devices();
   if (device_index >= 0 && device_index < static_cast<int>(devices.size())) {
-    device_ = devices[device_index];
+    device_ = intern_device(devices[device_index]);
   }
   // Invalid index results in invalid camera (device_ will be empty)
+  attach_actor();
 }
 
-Camera::Camera(const std::wstring &device_path) : connection_(nullptr) {
-  device_ = find_device_by_path(device_path);
+Camera::Camera(const std::wstring &device_path) {
+  device_ = intern_device(find_device_by_path(device_path));
   
   // Validate device was found and has valid identifiers
-  if (!device_.is_valid()) {
+  if (!device_->is_valid()) {
     throw std::runtime_error(
         "Device found by path but failed validation");
   }
+  attach_actor();
 }
 
 Camera::~Camera() = default;
 
-Camera::Camera(Camera &&) noexcept = default;
-Camera &Camera::operator=(Camera &&) noexcept = default;
+Camera::Camera(Camera &&other) noexcept
+    : device_(std::move(other.device_)), actor_(std::move(other.actor_)),
+      timeout_ms_(other.timeout_ms_.load()), nudge_(std::move(other.nudge_)),
+      writes_(std::move(other.writes_)) {}
+
+Camera &Camera::operator=(Camera &&other) noexcept {
+  device_ = std::move(other.device_);
+  actor_ = std::move(other.actor_);
+  timeout_ms_.store(other.timeout_ms_.load());
+  nudge_ = std::move(other.nudge_);
+  writes_ = std::move(other.writes_);
+  return *this;
+}
 
 bool Camera::is_valid() const {
-  return device_.is_valid() && is_device_connected(device_);
+  return device_->is_valid() && is_device_connected(*device_);
 }
 
-DeviceConnection *Camera::get_connection() const {
-  if (!connection_) {
-    connection_ = std::make_unique<DeviceConnection>(device_);
+void Camera::attach_actor() {
+  if (device_->is_valid()) {
+    actor_ = acquire_device_actor(*device_);
+    nudge_ = std::make_unique<NudgeState>();
+    writes_ = std::make_shared<WriteCounters>();
   }
-  return connection_.get();
 }
 
-Result<PropSetting> Camera::get(CamProp prop) {
-  auto *conn = get_connection();
-  if (!conn || !conn->is_valid()) {
-    return Err<PropSetting>(ErrorCode::DeviceNotFound, "Device not connected");
+void Camera::set_policy(const DevicePolicy &policy) {
+  if (actor_) {
+    actor_->policy().set_policy(policy);
   }
+}
+
+DevicePolicy Camera::policy() const {
+  return actor_ ? actor_->policy().policy() : default_device_policy();
+}
+
+PolicyStats Camera::policy_stats() const {
+  return actor_ ? actor_->policy().stats() : PolicyStats{};
+}
 
-  PropSetting setting;
-  if (conn->get(prop, setting)) {
-    return Ok(setting);
+Result<PropSetting> Camera::get(CamProp prop) {
+  if (!actor_) {
+    return Err<PropSetting>(ErrorCode::DeviceNotFound, "Device not connected");
   }
-  return Err<PropSetting>(ErrorCode::PropertyNotSupported,
-                          "Failed to get camera property");
+  return actor_->policy().run<PropSetting>(
+      [&] { return actor_->get(prop, timeout()); });
 }
 
 Result<void> Camera::set(CamProp prop, const PropSetting &setting) {
-  auto *conn = get_connection();
-  if (!conn || !conn->is_valid()) {
+  if (!actor_) {
     return Err<void>(ErrorCode::DeviceNotFound, "Device not connected");
   }
-
-  if (conn->set(prop, setting)) {
-    return Ok();
-  }
-  return Err<void>(ErrorCode::PropertyNotSupported,
-                   "Failed to set camera property");
+  auto result = write(prop, setting);
+  // Counted once the write is done, so a value read meanwhile is stale
+  writes_->bump(prop);
+  return result;
 }
 
 Result<PropRange> Camera::get_range(CamProp prop) {
-  auto *conn = get_connection();
-  if (!conn || !conn->is_valid()) {
+  if (!actor_) {
     return Err<PropRange>(ErrorCode::DeviceNotFound, "Device not connected");
   }
-
-  PropRange range;
-  if (conn->get_range(prop, range)) {
-    return Ok(range);
-  }
-  return Err<PropRange>(ErrorCode::PropertyNotSupported,
-                        "Failed to get camera property range");
+  return actor_->policy().run<PropRange>(
+      [&] { return actor_->get_range(prop, timeout()); });
 }
 
 Result<PropSetting> Camera::get(VidProp prop) {
-  auto *conn = get_connection();
-  if (!conn || !conn->is_valid()) {
+  if (!actor_) {
     return Err<PropSetting>(ErrorCode::DeviceNotFound, "Device not connected");
   }
+  return actor_->policy().run<PropSetting>(
+      [&] { return actor_->get(prop, timeout()); });
+}
 
-  PropSetting setting;
-  if (conn->get(prop, setting)) {
-    return Ok(setting);
+Result<void> Camera::set(VidProp prop, const PropSetting &setting) {
+  if (!actor_) {
+    return Err<void>(ErrorCode::DeviceNotFound, "Device not connected");
   }
-  return Err<PropSetting>(ErrorCode::PropertyNotSupported,
-                          "Failed to get video property");
+  auto result = write(prop, setting);
+  // Counted once the write is done, so a value read meanwhile is stale
+  writes_->bump(prop);
+  return result;
 }
 
-Result<void> Camera::set(VidProp prop, const PropSetting &setting) {
-  auto *conn = get_connection();
-  if (!conn || !conn->is_valid()) {
+Result<PropRange> Camera::get_range(VidProp prop) {
+  if (!actor_) {
+    return Err<PropRange>(ErrorCode::DeviceNotFound, "Device not connected");
+  }
+  return actor_->policy().run<PropRange>(
+      [&] { return actor_->get_range(prop, timeout()); });
+}
+
+template <typename Prop>
+Result<void> Camera::write(Prop prop, const PropSetting &setting) {
+  return actor_->policy().run<void>(
+      [&] { return actor_->set(prop, setting, timeout()); });
+}
+
+template <typename Prop> Result<void> Camera::emulate_nudge(Prop prop, int delta) {
+  NudgeState::Tracked &tracked = nudge_->tracked(prop);
+  if (!tracked.range) {
+    auto range = get_range(prop);
+    if (!range.is_ok()) {
+      return Result<void>(range.error());
+    }
+    tracked.range = range.value();
+  }
+  // Any write through this handle since the value was tracked (set() in any
+  // mode, set_and_wait_async(), a relative-control move) makes it stale
+  uint64_t before = write_count(prop);
+  auto now = std::chrono::steady_clock::now();
+  if (!tracked.value || tracked.seen != before ||
+      tracked.writes >= kNudgeResyncWrites ||
+      now - tracked.synced >= kNudgeResyncInterval) {
+    auto current = get(prop);
+    if (!current.is_ok()) {
+      tracked.value.reset();
+      return Result<void>(current.error());
+    }
+    tracked.value = current.value().value;
+    tracked.seen = before;
+    tracked.writes = 0;
+    tracked.synced = now;
+  }
+
+  const PropRange &range = *tracked.range;
+  int64_t wanted = std::clamp<int64_t>(static_cast<int64_t>(*tracked.value) + delta,
+                                       range.min, range.max);
+  int target = range.clamp(static_cast<int>(wanted));
+  if (target == *tracked.value) {
+    return Ok(); // Already at the end of the range
+  }
+  auto written = write(prop, PropSetting(target, CamMode::Manual));
+  uint64_t after = writes_->bump(prop);
+  if (!written.is_ok() || after != before + 1) {
+    tracked.value.reset(); // Failed, or raced with another write
+    return written;
+  }
+  tracked.value = target;
+  tracked.seen = after;
+  ++tracked.writes;
+  return written;
+}
+
+bool Camera::relative_admits(CamProp relative, int delta) {
+  if (nudge_->no_relative.count(relative)) {
+    return false;
+  }
+  NudgeState::Tracked &tracked = nudge_->tracked(relative);
+  if (!tracked.range) {
+    auto range = get_range(relative);
+    if (!range.is_ok()) {
+      if (range.error().code() == ErrorCode::PropertyNotSupported) {
+        nudge_->no_relative.insert(relative);
+      }
+      return false;
+    }
+    tracked.range = range.value();
+  }
+  // A direction-only control (-1/0/1) starts a continuous move rather than
+  // stepping by the value written
+  const PropRange &range = *tracked.range;
+  return range.max > 1 && delta >= range.min && delta <= range.max;
+}
+
+Result<void> Camera::nudge(CamProp prop, int delta) {
+  if (!actor_) {
     return Err<void>(ErrorCode::DeviceNotFound, "Device not connected");
   }
+  if (is_relative_control(prop)) {
+    return Err<void>(ErrorCode::InvalidArgument,
+                     "nudge() takes the absolute property, not its relative control");
+  }
+  if (delta == 0) {
+    return Ok();
+  }
+
+  std::lock_guard<std::mutex> lock(nudge_->mutex);
+  auto relative = relative_control(prop);
+  if (relative && relative_admits(*relative, delta)) {
+    auto moved = write(*relative, PropSetting(delta, CamMode::Manual));
+    ErrorCode code = moved.is_ok() ? ErrorCode::Success : moved.error().code();
+    if (code == ErrorCode::PropertyNotSupported) {
+      nudge_->no_relative.insert(*relative);
+    } else if (code != ErrorCode::InvalidValue) {
+      writes_->bump(prop); // The device moved on its own
+      return moved;
+    }
+  }
+  return emulate_nudge(prop, delta);
+}
 
-  if (conn->set(prop, setting)) {
+Result<void> Camera::nudge(VidProp prop, int delta) {
+  if (!actor_) {
+    return Err<void>(ErrorCode::DeviceNotFound, "Device not connected");
+  }
+  if (delta == 0) {
     return Ok();
   }
-  return Err<void>(ErrorCode::PropertyNotSupported,
-                   "Failed to set video property");
+  std::lock_guard<std::mutex> lock(nudge_->mutex);
+  return emulate_nudge(prop, delta);
 }
 
-Result<PropRange> Camera::get_range(VidProp prop) {
-  auto *conn = get_connection();
-  if (!conn || !conn->is_valid()) {
-    return Err<PropRange>(ErrorCode::DeviceNotFound, "Device not connected");
+namespace {
+
+std::future<Result<SettleResult>> ready(Result<SettleResult> result) {
+  std::promise<Result<SettleResult>> promise;
+  promise.set_value(std::move(result));
+  return promise.get_future();
+}
+
+/// Write on the actor thread, then start the settle wait from there;
+/// counted() runs once the write is done
+template <typename Prop, typename Counted>
+std::future<Result<SettleResult>>
+write_and_settle(const std::shared_ptr<DeviceActor> &actor, Prop prop,
+                 const PropSetting &setting, const SettleOptions &options,
+                 std::chrono::milliseconds timeout, Counted counted) {
+  auto promise = std::make_shared<std::promise<Result<SettleResult>>>();
+  auto future = promise->get_future();
+  auto deadline = timeout.count() > 0
+                      ? std::chrono::steady_clock::now() + timeout
+                      : DeviceActor::no_deadline();
+  AsyncPropertyRead read = async_property_read(actor, prop, timeout);
+
+  actor->post(
+      [promise, prop, setting, options, read, counted](
+          const Result<IDeviceConnection *> &connection) {
+        Result<void> written = connection.is_ok()
+                                   ? Result<void>(Ok())
+                                   : Result<void>(connection.error());
+        if (written.is_ok()) {
+          if constexpr (std::is_same_v<Prop, CamProp>) {
+            written = connection.value()->set_camera_property(prop, setting);
+          } else {
+            written = connection.value()->set_video_property(prop, setting);
+          }
+          counted();
+        }
+        if (!written.is_ok()) {
+          promise->set_value(Result<SettleResult>(written.error()));
+          return;
+        }
+        wait_for_settle(read, setting.value, options,
+                        [promise](Result<SettleResult> result) {
+                          promise->set_value(std::move(result));
+                        });
+      },
+      deadline);
+  return future;
+}
+
+} // namespace
+
+Result<SettleResult> Camera::set_and_wait(CamProp prop,
+                                          const PropSetting &setting,
+                                          const SettleOptions &options) {
+  auto written = set(prop, setting);
+  if (!written.is_ok()) {
+    return Result<SettleResult>(written.error());
   }
+  return wait_for_settle(async_property_read(actor_, prop, timeout()),
+                         setting.value, options)
+      .get();
+}
+
+std::future<Result<SettleResult>>
+Camera::set_and_wait_async(CamProp prop, const PropSetting &setting,
+                           const SettleOptions &options) {
+  if (!actor_) {
+    return ready(Err<SettleResult>(ErrorCode::DeviceNotFound,
+                                   "Device not connected"));
+  }
+  std::shared_ptr<WriteCounters> writes = writes_;
+  return write_and_settle(actor_, prop, setting, options, timeout(),
+                          [writes, prop] { writes->bump(prop); });
+}
 
-  PropRange range;
-  if (conn->get_range(prop, range)) {
-    return Ok(range);
+Result<SettleResult> Camera::set_and_wait(VidProp prop,
+                                          const PropSetting &setting,
+                                          const SettleOptions &options) {
+  auto written = set(prop, setting);
+  if (!written.is_ok()) {
+    return Result<SettleResult>(written.error());
   }
-  return Err<PropRange>(ErrorCode::PropertyNotSupported,
-                        "Failed to get video property range");
+  return wait_for_settle(async_property_read(actor_, prop, timeout()),
+                         setting.value, options)
+      .get();
+}
+
+std::future<Result<SettleResult>>
+Camera::set_and_wait_async(VidProp prop, const PropSetting &setting,
+                           const SettleOptions &options) {
+  if (!actor_) {
+    return ready(Err<SettleResult>(ErrorCode::DeviceNotFound,
+                                   "Device not connected"));
+  }
+  std::shared_ptr<WriteCounters> writes = writes_;
+  return write_and_settle(actor_, prop, setting, options, timeout(),
+                          [writes, prop] { writes->bump(prop); });
+}
+
+uint64_t Camera::write_count(CamProp prop) const {
+  return writes_ ? writes_->of(prop).load(std::memory_order_acquire) : 0;
+}
+
+uint64_t Camera::write_count(VidProp prop) const {
+  return writes_ ? writes_->of(prop).load(std::memory_order_acquire) : 0;
 }
 
 Result<Camera> open_camera(int device_index) {
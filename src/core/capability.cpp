@@ -6,27 +6,39 @@
 #include <duvc-ctl/core/camera.h>
 #include <duvc-ctl/core/capability.h>
 #include <duvc-ctl/core/device.h>
+#include <duvc-ctl/core/device_actor.h>
+#include <duvc-ctl/core/property_access.h>
 #include <duvc-ctl/core/result.h>
 
 #include <duvc-ctl/utils/logging.h>
 #include <duvc-ctl/utils/string_conversion.h>
 
+#include <algorithm>
+#include <cwctype>
+#include <functional>
+
 namespace duvc {
 
 // Static empty capability for unsupported properties
 const PropertyCapability DeviceCapabilities::empty_capability_ = {};
 
 DeviceCapabilities::DeviceCapabilities(const Device &device)
-    : device_(device), device_accessible_(false) {
-  device_accessible_ = is_device_connected(device_);
+    : device_(intern_device(device)), device_accessible_(false) {
+  device_accessible_ = is_device_connected(*device_);
   if (device_accessible_) {
     scan_capabilities();
   }
 }
 
+void DeviceCapabilities::clear_capabilities() {
+  camera_capabilities_.fill(PropertyCapability{});
+  video_capabilities_.fill(PropertyCapability{});
+  camera_supported_.clear();
+  video_supported_.clear();
+}
+
 void DeviceCapabilities::scan_capabilities() {
-  camera_capabilities_.clear();
-  video_capabilities_.clear();
+  clear_capabilities();
 
   // Create camera instance for property access
   Camera camera(device_);
@@ -37,7 +49,7 @@ void DeviceCapabilities::scan_capabilities() {
   }
 
   // Scan all camera properties
-  for (int i = 0; i <= static_cast<int>(CamProp::Lamp); ++i) {
+  for (size_t i = 0; i < kCamPropCount; ++i) {
     CamProp prop = static_cast<CamProp>(i);
     PropertyCapability capability;
 
@@ -51,17 +63,19 @@ void DeviceCapabilities::scan_capabilities() {
       auto current_result = camera.get(prop);
       if (current_result.is_ok()) {
         capability.current = current_result.value();
+        capability.current_valid = true;
       } else {
         DUVC_LOG_WARNING("Failed to get current camera property value for " +
                          std::string(to_string(prop)));
       }
 
-      camera_capabilities_[prop] = capability;
+      camera_capabilities_[i] = capability;
+      camera_supported_.insert(prop);
     }
   }
 
   // Scan all video properties
-  for (int i = 0; i <= static_cast<int>(VidProp::PowerLineFrequency); ++i) {
+  for (size_t i = 0; i < kVidPropCount; ++i) {
     VidProp prop = static_cast<VidProp>(i);
     PropertyCapability capability;
 
@@ -75,64 +89,55 @@ void DeviceCapabilities::scan_capabilities() {
       auto current_result = camera.get(prop);
       if (current_result.is_ok()) {
         capability.current = current_result.value();
+        capability.current_valid = true;
       } else {
         DUVC_LOG_WARNING("Failed to get current video property value for " +
                          std::string(to_string(prop)));
       }
 
-      video_capabilities_[prop] = capability;
+      video_capabilities_[i] = capability;
+      video_supported_.insert(prop);
     }
   }
 }
 
 const PropertyCapability &
 DeviceCapabilities::get_camera_capability(CamProp prop) const {
-  auto it = camera_capabilities_.find(prop);
-  return it != camera_capabilities_.end() ? it->second : empty_capability_;
+  auto index = static_cast<size_t>(prop);
+  return index < kCamPropCount ? camera_capabilities_[index]
+                               : empty_capability_;
 }
 
 const PropertyCapability &
 DeviceCapabilities::get_video_capability(VidProp prop) const {
-  auto it = video_capabilities_.find(prop);
-  return it != video_capabilities_.end() ? it->second : empty_capability_;
+  auto index = static_cast<size_t>(prop);
+  return index < kVidPropCount ? video_capabilities_[index]
+                               : empty_capability_;
 }
 
 bool DeviceCapabilities::supports_camera_property(CamProp prop) const {
-  return get_camera_capability(prop).supported;
+  return camera_supported_.contains(prop);
 }
 
 bool DeviceCapabilities::supports_video_property(VidProp prop) const {
-  return get_video_capability(prop).supported;
+  return video_supported_.contains(prop);
 }
 
 std::vector<CamProp> DeviceCapabilities::supported_camera_properties() const {
-  std::vector<CamProp> props;
-  for (const auto &pair : camera_capabilities_) {
-    if (pair.second.supported) {
-      props.push_back(pair.first);
-    }
-  }
-  return props;
+  return std::vector<CamProp>(camera_supported_.begin(),
+                              camera_supported_.end());
 }
 
 std::vector<VidProp> DeviceCapabilities::supported_video_properties() const {
-  std::vector<VidProp> props;
-  for (const auto &pair : video_capabilities_) {
-    if (pair.second.supported) {
-      props.push_back(pair.first);
-    }
-  }
-  return props;
+  return std::vector<VidProp>(video_supported_.begin(), video_supported_.end());
 }
 
 Result<void> DeviceCapabilities::refresh() {
-  device_accessible_ = is_device_connected(device_);
+  device_accessible_ = is_device_connected(*device_);
   if (!device_accessible_) {
     return Err<void>(ErrorCode::DeviceNotFound, "Device not connected");
   }
 
-  camera_capabilities_.clear();
-  video_capabilities_.clear();
   scan_capabilities();
   return Ok();
 }
@@ -194,4 +199,233 @@ Result<DeviceCapabilities> get_device_capabilities(int device_index) {
   return get_device_capabilities(devices[device_index]);
 }
 
+// ============================================================================
+// Reset to defaults
+// ============================================================================
+
+bool is_relative_property(CamProp prop) {
+  switch (prop) {
+  case CamProp::PanRelative:
+  case CamProp::TiltRelative:
+  case CamProp::RollRelative:
+  case CamProp::ZoomRelative:
+  case CamProp::ExposureRelative:
+  case CamProp::IrisRelative:
+  case CamProp::FocusRelative:
+  case CamProp::PanTiltRelative:
+  case CamProp::DigitalZoomRelative:
+    return true;
+  default:
+    return false;
+  }
+}
+
+namespace {
+
+template <typename Prop>
+bool selected(Prop prop, const std::vector<Prop> &only) {
+  return only.empty() || std::find(only.begin(), only.end(), prop) != only.end();
+}
+
+/// A property to reset: its capability and how to write it
+struct ResetItem {
+  ResetEntry entry;
+  PropertyCapability capability;
+  std::function<Result<void>(const PropSetting &)> write;
+};
+
+bool at_default(const PropertyCapability &capability) {
+  const PropRange &range = capability.range;
+  return capability.current_valid &&
+         capability.current.mode == range.default_mode &&
+         (range.default_mode == CamMode::Auto ||
+          capability.current.value == range.default_val);
+}
+
+/// Collect the selected properties; a lookup returns false to leave one out
+template <typename CamLookup, typename VidLookup>
+std::vector<ResetItem> collect(const ResetFilter &filter, CamLookup cam_capability,
+                               VidLookup vid_capability) {
+  std::vector<ResetItem> items;
+  if (filter.camera) {
+    for (int i = 0; i <= static_cast<int>(CamProp::Lamp); ++i) {
+      auto prop = static_cast<CamProp>(i);
+      if (!selected(prop, filter.camera_props) ||
+          (is_relative_property(prop) && !filter.include_relative)) {
+        continue;
+      }
+      ResetItem item;
+      if (cam_capability(prop, item)) {
+        item.entry.cam_prop = prop;
+        items.push_back(std::move(item));
+      }
+    }
+  }
+  if (filter.video) {
+    for (int i = 0; i <= static_cast<int>(VidProp::PowerLineFrequency); ++i) {
+      auto prop = static_cast<VidProp>(i);
+      if (!selected(prop, filter.video_props)) {
+        continue;
+      }
+      ResetItem item;
+      if (vid_capability(prop, item)) {
+        item.entry.video = true;
+        item.entry.vid_prop = prop;
+        items.push_back(std::move(item));
+      }
+    }
+  }
+  return items;
+}
+
+/// Read range and current value through a property binding
+bool scan_into(const PropertyAccess &access, ResetItem &item) {
+  auto range = access.range();
+  if (!range.is_ok()) {
+    return false;
+  }
+  item.capability.supported = true;
+  item.capability.range = range.value();
+  auto current = access.get();
+  if (current.is_ok()) {
+    item.capability.current = current.value();
+    item.capability.current_valid = true;
+  }
+  item.write = access.set;
+  return true;
+}
+
+ResetReport apply_reset(std::vector<ResetItem> items) {
+  ResetReport report;
+  std::vector<ResetEntry> skipped;
+
+  // Manual defaults first, auto defaults last: an auto algorithm switched
+  // back on then starts with its dependent controls already settled, instead
+  // of being knocked out of auto by a later manual write
+  std::stable_partition(items.begin(), items.end(), [](const ResetItem &item) {
+    return item.capability.range.default_mode != CamMode::Auto;
+  });
+
+  for (auto &item : items) {
+    if (at_default(item.capability)) {
+      item.entry.outcome = ResetOutcome::Skipped;
+      skipped.push_back(std::move(item.entry));
+      continue;
+    }
+    const PropRange &range = item.capability.range;
+    auto written = item.write(PropSetting(range.default_val, range.default_mode));
+    if (written.is_ok()) {
+      item.entry.outcome = ResetOutcome::Written;
+      ++report.writes;
+    } else {
+      item.entry.outcome = ResetOutcome::Failed;
+      item.entry.error = written.error();
+      ++report.failed;
+    }
+    report.entries.push_back(std::move(item.entry));
+  }
+
+  report.skipped = static_cast<int>(skipped.size());
+  for (auto &entry : skipped) {
+    report.entries.push_back(std::move(entry));
+  }
+  DUVC_LOG_DEBUG("Reset to defaults: " + std::to_string(report.writes) +
+                 " written, " + std::to_string(report.skipped) + " skipped, " +
+                 std::to_string(report.failed) + " failed");
+  return report;
+}
+
+std::wstring lowercase_path(const Device &device) {
+  std::wstring key = device.path;
+  std::transform(key.begin(), key.end(), key.begin(),
+                 [](wchar_t c) { return static_cast<wchar_t>(std::towlower(c)); });
+  return key;
+}
+
+} // namespace
+
+Result<ResetReport> reset_to_defaults(Camera &camera,
+                                      const DeviceCapabilities &capabilities,
+                                      const ResetFilter &filter) {
+  if (lowercase_path(camera.device()) != lowercase_path(capabilities.device())) {
+    return Err<ResetReport>(ErrorCode::InvalidArgument,
+                            "Capability snapshot is for a different device");
+  }
+
+  auto items = collect(
+      filter,
+      [&](CamProp prop, ResetItem &item) {
+        const auto &capability = capabilities.get_camera_capability(prop);
+        if (!capability.supported) {
+          return false;
+        }
+        item.capability = capability;
+        item.write = [&camera, prop](const PropSetting &s) {
+          return camera.set(prop, s);
+        };
+        return true;
+      },
+      [&](VidProp prop, ResetItem &item) {
+        const auto &capability = capabilities.get_video_capability(prop);
+        if (!capability.supported) {
+          return false;
+        }
+        item.capability = capability;
+        item.write = [&camera, prop](const PropSetting &s) {
+          return camera.set(prop, s);
+        };
+        return true;
+      });
+  return Ok(apply_reset(std::move(items)));
+}
+
+Result<ResetReport> reset_to_defaults(Camera &camera, const ResetFilter &filter) {
+  if (!camera.is_valid()) {
+    return Err<ResetReport>(ErrorCode::DeviceNotFound, "Camera not connected");
+  }
+  auto items = collect(
+      filter,
+      [&](CamProp prop, ResetItem &item) {
+        return scan_into(property_access(camera, prop), item);
+      },
+      [&](VidProp prop, ResetItem &item) {
+        return scan_into(property_access(camera, prop), item);
+      });
+  return Ok(apply_reset(std::move(items)));
+}
+
+Result<ResetReport> reset_to_defaults(std::shared_ptr<DeviceActor> actor,
+                                      const ResetFilter &filter) {
+  if (!actor) {
+    return Err<ResetReport>(ErrorCode::InvalidArgument, "No device actor");
+  }
+  auto opened = actor->call<bool>(
+      [](IDeviceConnection &) { return Ok(true); });
+  if (!opened.is_ok()) {
+    return Result<ResetReport>(opened.error());
+  }
+  auto items = collect(
+      filter,
+      [&](CamProp prop, ResetItem &item) {
+        return scan_into(property_access(actor, prop), item);
+      },
+      [&](VidProp prop, ResetItem &item) {
+        return scan_into(property_access(actor, prop), item);
+      });
+  return Ok(apply_reset(std::move(items)));
+}
+
+const char *to_string(ResetOutcome outcome) {
+  switch (outcome) {
+  case ResetOutcome::Written:
+    return "Written";
+  case ResetOutcome::Skipped:
+    return "Skipped";
+  case ResetOutcome::Failed:
+    return "Failed";
+  default:
+    return "Unknown";
+  }
+}
+
 } // namespace duvc
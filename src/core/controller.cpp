@@ -0,0 +1,294 @@
+/**
+ * @file controller.cpp
+ * @brief Closed-loop property controller engine implementation
+ */
+
+#include <duvc-ctl/core/controller.h>
+#include <duvc-ctl/utils/logging.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace duvc {
+
+/// Registered loop; controller state is touched only by the engine thread
+struct ControlEngine::Loop {
+  PropertyAccess target;
+  MeasurementFeed measure;
+  ControlLoopConfig config;
+  PropRange range;
+
+  // Held for the duration of a tick so remove_loop() can wait it out
+  std::mutex tick_mutex;
+  bool removed = false;
+
+  // Shared with callers
+  mutable std::mutex stats_mutex;
+  double setpoint = 0.0;
+  ControlLoopStats stats;
+
+  // Controller state
+  double base = 0.0;   ///< Value read when the loop started (Pid)
+  double output = 0.0; ///< Unquantized output
+  double integral = 0.0;
+  double prev_error = 0.0;
+  bool have_prev = false;
+  int written = 0; ///< Last value written to (or read from) the device
+  Clock::time_point due;
+  Clock::time_point last_measured;
+  uint64_t samples = 0;
+  std::chrono::microseconds latency_total{0};
+  std::chrono::microseconds jitter_total{0};
+};
+
+ControlEngine::ControlEngine() : thread_([this] { run(); }) {}
+
+ControlEngine::~ControlEngine() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+}
+
+Result<ControlLoopId> ControlEngine::add_loop(PropertyAccess target,
+                                              MeasurementFeed measure,
+                                              const ControlLoopConfig &config) {
+  if (!target.is_valid()) {
+    return Err<ControlLoopId>(ErrorCode::InvalidArgument,
+                              "Control target is not bound to a property");
+  }
+  if (!measure) {
+    return Err<ControlLoopId>(ErrorCode::InvalidArgument,
+                              "Measurement feed is required");
+  }
+  if (config.period.count() <= 0) {
+    return Err<ControlLoopId>(ErrorCode::InvalidArgument,
+                              "Control period must be positive");
+  }
+  if (config.max_step < 0 || config.deadband < 0.0) {
+    return Err<ControlLoopId>(ErrorCode::InvalidArgument,
+                              "max_step and deadband must not be negative");
+  }
+
+  auto range = target.range();
+  if (!range.is_ok()) {
+    return Result<ControlLoopId>(range.error());
+  }
+  auto current = target.get();
+  if (!current.is_ok()) {
+    return Result<ControlLoopId>(current.error());
+  }
+
+  auto loop = std::make_shared<Loop>();
+  loop->target = std::move(target);
+  loop->measure = std::move(measure);
+  loop->config = config;
+  loop->range = range.value();
+  loop->setpoint = config.setpoint;
+  loop->written = current.value().value;
+  loop->base = loop->output = static_cast<double>(loop->written);
+  loop->stats.last_output = loop->written;
+  loop->due = Clock::now();
+
+  ControlLoopId id;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    id = next_id_++;
+    loops_[id] = std::move(loop);
+  }
+  cv_.notify_all();
+  return Ok(id);
+}
+
+Result<void> ControlEngine::remove_loop(ControlLoopId id) {
+  std::shared_ptr<Loop> loop;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = loops_.find(id);
+    if (it == loops_.end()) {
+      return Err<void>(ErrorCode::InvalidArgument, "Unknown control loop");
+    }
+    loop = std::move(it->second);
+    loops_.erase(it);
+  }
+  std::lock_guard<std::mutex> tick_lock(loop->tick_mutex);
+  loop->removed = true;
+  return Ok();
+}
+
+Result<void> ControlEngine::set_setpoint(ControlLoopId id, double setpoint) {
+  auto loop = find(id);
+  if (!loop) {
+    return Err<void>(ErrorCode::InvalidArgument, "Unknown control loop");
+  }
+  std::lock_guard<std::mutex> lock(loop->stats_mutex);
+  loop->setpoint = setpoint;
+  return Ok();
+}
+
+Result<ControlLoopStats> ControlEngine::stats(ControlLoopId id) const {
+  auto loop = find(id);
+  if (!loop) {
+    return Err<ControlLoopStats>(ErrorCode::InvalidArgument,
+                                 "Unknown control loop");
+  }
+  std::lock_guard<std::mutex> lock(loop->stats_mutex);
+  return Ok(loop->stats);
+}
+
+size_t ControlEngine::loop_count() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return loops_.size();
+}
+
+std::shared_ptr<ControlEngine::Loop> ControlEngine::find(ControlLoopId id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = loops_.find(id);
+  return it == loops_.end() ? nullptr : it->second;
+}
+
+void ControlEngine::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stop_) {
+    if (loops_.empty()) {
+      cv_.wait(lock, [this] { return stop_ || !loops_.empty(); });
+      continue;
+    }
+
+    auto next = std::min_element(
+        loops_.begin(), loops_.end(),
+        [](const auto &a, const auto &b) { return a.second->due < b.second->due; });
+    auto now = Clock::now();
+    if (next->second->due > now) {
+      // Woken early by add_loop() or stop; re-evaluate either way
+      cv_.wait_until(lock, next->second->due);
+      continue;
+    }
+
+    auto loop = next->second;
+    lock.unlock();
+    {
+      std::lock_guard<std::mutex> tick_lock(loop->tick_mutex);
+      if (!loop->removed) {
+        tick(*loop, now);
+      }
+    }
+    lock.lock();
+  }
+}
+
+void ControlEngine::tick(Loop &loop, Clock::time_point now) {
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  const auto &cfg = loop.config;
+  auto jitter = duration_cast<microseconds>(now - loop.due);
+
+  // Schedule the next tick on the fixed grid, skipping periods we missed
+  loop.due += cfg.period;
+  uint64_t overruns = 0;
+  if (loop.due <= now) {
+    auto behind = (now - loop.due) / cfg.period + 1;
+    overruns = static_cast<uint64_t>(behind);
+    loop.due += cfg.period * behind;
+  }
+
+  double setpoint;
+  {
+    std::lock_guard<std::mutex> lock(loop.stats_mutex);
+    setpoint = loop.setpoint;
+  }
+
+  std::optional<double> measurement;
+  try {
+    measurement = loop.measure();
+  } catch (const std::exception &e) {
+    DUVC_LOG_ERROR(std::string("Control loop measurement threw: ") + e.what());
+  } catch (...) {
+    DUVC_LOG_ERROR("Control loop measurement threw unknown exception");
+  }
+
+  if (!measurement) {
+    std::lock_guard<std::mutex> lock(loop.stats_mutex);
+    ++loop.stats.ticks;
+    ++loop.stats.missed_measurements;
+    loop.stats.overruns += overruns;
+    return;
+  }
+
+  double dt = std::chrono::duration<double>(cfg.period).count();
+  if (loop.have_prev) {
+    dt = std::max(1e-6, std::chrono::duration<double>(now - loop.last_measured).count());
+  }
+  loop.last_measured = now;
+
+  double error = setpoint - *measurement;
+  const double lo = static_cast<double>(loop.range.min);
+  const double hi = static_cast<double>(loop.range.max);
+
+  if (std::fabs(error) > cfg.deadband) {
+    double target;
+    if (cfg.mode == ControlMode::StepLimited) {
+      target = loop.output + cfg.gains.kp * error;
+    } else {
+      double derivative = loop.have_prev ? (error - loop.prev_error) / dt : 0.0;
+      loop.integral += error * dt;
+      target = loop.base + cfg.gains.kp * error + cfg.gains.ki * loop.integral +
+               cfg.gains.kd * derivative;
+      // Anti-windup: don't keep integrating while pinned at a limit
+      if ((target > hi && cfg.gains.ki * error > 0.0) ||
+          (target < lo && cfg.gains.ki * error < 0.0)) {
+        loop.integral -= error * dt;
+      }
+    }
+    if (cfg.max_step > 0) {
+      target = std::clamp(target, loop.output - cfg.max_step,
+                          loop.output + cfg.max_step);
+    }
+    loop.output = std::clamp(target, lo, hi);
+  }
+  loop.prev_error = error;
+  loop.have_prev = true;
+
+  int quantized = loop.range.clamp(static_cast<int>(std::lround(loop.output)));
+  bool write = quantized != loop.written;
+  std::optional<Error> failure;
+  if (write) {
+    auto result = loop.target.set(PropSetting(quantized, CamMode::Manual));
+    if (result.is_ok()) {
+      loop.written = quantized;
+    } else {
+      failure = result.error();
+    }
+  }
+  auto latency = duration_cast<microseconds>(Clock::now() - now);
+
+  ++loop.samples;
+  loop.latency_total += latency;
+  loop.jitter_total += jitter;
+
+  std::lock_guard<std::mutex> lock(loop.stats_mutex);
+  auto &s = loop.stats;
+  ++s.ticks;
+  s.overruns += overruns;
+  s.last_measurement = *measurement;
+  s.last_error = error;
+  s.last_output = loop.written;
+  if (!write) {
+    ++s.coalesced;
+  } else {
+    ++s.writes;
+    if (failure) {
+      ++s.write_failures;
+      s.last_failure = std::move(failure);
+    }
+  }
+  s.latency_max = std::max(s.latency_max, latency);
+  s.jitter_max = std::max(s.jitter_max, jitter);
+  s.latency_avg = loop.latency_total / static_cast<long long>(loop.samples);
+  s.jitter_avg = loop.jitter_total / static_cast<long long>(loop.samples);
+}
+
+} // namespace duvc
@@ -4,7 +4,56 @@
  */
 
 #include <duvc-ctl/core/device.h>
+#include <duvc-ctl/core/device_identity.h>
 #include <duvc-ctl/detail/com_helpers.h>
+#include <duvc-ctl/platform/interface.h>
+
+#include <stdexcept>
+
+namespace duvc {
+
+namespace {
+
+// Enumeration through create_platform_interface(): every backend other than
+// DirectShow (V4L2, fake, trace replay, installed factories)
+
+std::vector<Device> platform_list_devices() {
+  auto platform = create_platform_interface();
+  if (!platform) {
+    return {};
+  }
+  auto devices = platform->list_devices();
+  if (!devices.is_ok()) {
+    throw std::runtime_error(devices.error().description());
+  }
+  return std::move(devices).value();
+}
+
+bool platform_is_device_connected(const Device &dev) {
+  auto platform = create_platform_interface();
+  if (!platform) {
+    return false;
+  }
+  auto connected = platform->is_device_connected(dev);
+  return connected.is_ok() && connected.value();
+}
+
+Device platform_find_device_by_path(const std::wstring &device_path) {
+  if (device_path.empty()) {
+    throw std::runtime_error("Device path cannot be empty");
+  }
+  for (auto &device : platform_list_devices()) {
+    if (same_device_path(device.path, device_path)) {
+      return device;
+    }
+  }
+  throw std::runtime_error(
+      "Device with specified path not found. Ensure the device is connected and the path is valid.");
+}
+
+} // namespace
+
+} // namespace duvc
 
 #ifdef _WIN32
 #include <comdef.h>
@@ -141,13 +190,13 @@ std::wstring read_device_path(IMoniker *mon) {
 // ONLY use device path to verify
 bool is_same_device(const Device &d, const std::wstring & /*name*/,
                     const std::wstring &path) {
-  if (d.path.empty() || path.empty())
-    return false;
-
-  return _wcsicmp(d.path.c_str(), path.c_str()) == 0;
+  return same_device_path(d.path, path);
 }
 
 std::vector<Device> list_devices() {
+  if (platform_interface_overridden()) {
+    return platform_list_devices();
+  }
   com_apartment com;
   std::vector<Device> out;
   
@@ -177,6 +226,9 @@ std::vector<Device> list_devices() {
 }
 
 bool is_device_connected(const Device &dev) {
+  if (platform_interface_overridden()) {
+    return platform_is_device_connected(dev);
+  }
   try {
     // First try: Check if device still exists in enumeration
     com_apartment com;
@@ -210,6 +262,9 @@ bool is_device_connected(const Device &dev) {
 }
 
 Device duvc::find_device_by_path(const std::wstring &device_path) {
+    if (platform_interface_overridden()) {
+        return platform_find_device_by_path(device_path);
+    }
     if (device_path.empty()) {
         throw std::runtime_error("Device path cannot be empty");
     }
@@ -238,7 +293,7 @@ Device duvc::find_device_by_path(const std::wstring &device_path) {
                 dpath.erase(pos + 1);
         }
         std::wstring fname = read_friendly_name(mon.get());
-        if (_wcsicmp(dpath.c_str(), device_path.c_str()) == 0) {
+        if (same_device_path(dpath, device_path)) {
             Device result;
             result.name = std::move(fname);
             result.path = std::move(dpath);
@@ -253,12 +308,19 @@ Device duvc::find_device_by_path(const std::wstring &device_path) {
 
 #else // _WIN32
 
-// Non-Windows stubs
 namespace duvc {
 
-std::vector<Device> list_devices() { return {}; }
+std::vector<Device> list_devices() { return platform_list_devices(); }
+
+bool is_device_connected(const Device &dev) {
+  return platform_is_device_connected(dev);
+}
+
+Device find_device_by_path(const std::wstring &device_path) {
+  return platform_find_device_by_path(device_path);
+}
 
-bool is_device_connected(const Device &) { return false; }
+// Hotplug notifications are not implemented outside Windows
 
 void register_device_change_callback(DeviceChangeCallback) {}
 
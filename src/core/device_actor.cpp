@@ -0,0 +1,493 @@
+/**
+ * @file device_actor.cpp
+ * @brief Per-device I/O actor implementation
+ */
+
+#include <duvc-ctl/core/device_actor.h>
+#include <duvc-ctl/core/device_profile.h>
+#include <duvc-ctl/detail/mpsc_queue.h>
+#include <duvc-ctl/utils/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cwctype>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <duvc-ctl/detail/com_helpers.h>
+#endif
+
+namespace duvc {
+
+/// Queued message (intrusive node + task)
+struct ActorRequest : detail::mpsc_node {
+  DeviceActor::Task task;
+  DeviceActor::Deadline deadline;
+};
+
+/**
+ * @brief Actor state shared between the handle and its thread
+ *
+ * Owned jointly so that a thread detached while stuck in a driver call keeps
+ * everything it touches alive until it exits.
+ */
+struct DeviceActor::State {
+  State(ConnectionFactory f, std::shared_ptr<UnsupportedPropertyCache> u)
+      : factory(std::move(f)), unsupported(std::move(u)) {}
+
+  ~State() {
+    // Requests left behind by a detached actor are never run
+    while (auto *node = queue.pop()) {
+      delete static_cast<ActorRequest *>(node);
+    }
+  }
+
+  void run();
+  void wake();
+  void ensure_connected();
+  Result<IDeviceConnection *> current_connection() const;
+
+  ConnectionFactory factory;
+  std::shared_ptr<UnsupportedPropertyCache> unsupported;
+  detail::mpsc_queue queue;
+  std::thread thread;
+
+  // Parking for the idle actor thread
+  std::mutex wake_mutex;
+  std::condition_variable wake_cv;
+  std::atomic<bool> parked{false};
+  std::atomic<bool> stop{false};
+  std::atomic<bool> reconnect_requested{false};
+
+  // Hang detection: sequence number of the request being executed (0 when
+  // idle) and of the one that was executing when a caller timed out
+  std::atomic<uint64_t> running{0};
+  std::atomic<uint64_t> stalled{0};
+
+  // Owned and touched only by the actor thread
+  std::unique_ptr<IDeviceConnection> connection;
+  std::optional<Error> open_error;
+
+  // Counters
+  std::atomic<uint64_t> requests{0};
+  std::atomic<uint64_t> batches{0};
+  std::atomic<uint64_t> max_batch{0};
+  std::atomic<uint64_t> connects{0};
+  std::atomic<uint64_t> timeouts{0};
+  std::atomic<uint64_t> rejected{0};
+  std::atomic<uint64_t> expired{0};
+};
+
+void DeviceActor::State::wake() {
+  // Pairs with the parked store in run(): either the actor sees the new
+  // request before sleeping, or we see it parked and signal it.
+  if (parked.load()) {
+    std::lock_guard<std::mutex> lock(wake_mutex);
+    wake_cv.notify_one();
+  }
+}
+
+Result<IDeviceConnection *> DeviceActor::State::current_connection() const {
+  if (connection && connection->is_valid()) {
+    return Ok(connection.get());
+  }
+  if (open_error) {
+    return Result<IDeviceConnection *>(*open_error);
+  }
+  return Err<IDeviceConnection *>(ErrorCode::DeviceNotFound,
+                                  "Device not connected");
+}
+
+void DeviceActor::State::ensure_connected() {
+  if (reconnect_requested.exchange(false)) {
+    connection.reset(); // cache already cleared by reconnect()
+  }
+  if (connection && connection->is_valid()) {
+    return;
+  }
+
+  if (connection) {
+    // Device went away underneath us; whatever comes back behind the same
+    // path may be different hardware
+    connection.reset();
+    unsupported->clear();
+  }
+  if (!factory) {
+    open_error = Error(ErrorCode::NotImplemented, "No connection factory");
+    return;
+  }
+
+  try {
+    auto result = factory();
+    if (result.is_ok() && result.value()) {
+      connection = std::move(result).value();
+      open_error.reset();
+      connects.fetch_add(1);
+    } else if (result.is_error()) {
+      open_error = result.error();
+    } else {
+      open_error = Error(ErrorCode::DeviceNotFound, "Device not connected");
+    }
+  } catch (const std::exception &e) {
+    open_error = Error(ErrorCode::SystemError, e.what());
+  }
+}
+
+void DeviceActor::State::run() {
+#ifdef _WIN32
+  // One apartment for the lifetime of the actor; connections opened below
+  // nest inside it instead of initializing COM per call.
+  std::unique_ptr<detail::com_apartment> apartment;
+  try {
+    apartment = std::make_unique<detail::com_apartment>();
+  } catch (const std::exception &e) {
+    DUVC_LOG_ERROR(std::string("Device actor COM init failed: ") + e.what());
+  }
+#endif
+
+  std::vector<ActorRequest *> batch;
+  for (;;) {
+    while (auto *node = queue.pop()) {
+      batch.push_back(static_cast<ActorRequest *>(node));
+    }
+
+    if (batch.empty()) {
+      if (!queue.empty()) {
+        std::this_thread::yield(); // a producer is mid-push
+        continue;
+      }
+      if (stop.load()) {
+        break;
+      }
+      if (reconnect_requested.exchange(false)) {
+        connection.reset();
+      }
+
+      std::unique_lock<std::mutex> lock(wake_mutex);
+      parked.store(true);
+      wake_cv.wait(lock, [this] {
+        return !queue.empty() || stop.load() || reconnect_requested.load();
+      });
+      parked.store(false);
+      continue;
+    }
+
+    batches.fetch_add(1);
+    uint64_t size = batch.size();
+    if (size > max_batch.load()) {
+      max_batch.store(size);
+    }
+
+    bool connected = false;
+    for (auto *request : batch) {
+      if (std::chrono::steady_clock::now() > request->deadline) {
+        // Caller already gave up; don't touch the device on its behalf
+        expired.fetch_add(1);
+        try {
+          request->task(Err<IDeviceConnection *>(
+              ErrorCode::DeviceBusy, "Request expired before execution"));
+        } catch (...) {
+        }
+        delete request;
+        continue;
+      }
+
+      running.store(requests.fetch_add(1) + 1);
+      if (!connected) {
+        ensure_connected();
+        connected = true;
+      }
+      try {
+        request->task(current_connection());
+      } catch (const std::exception &e) {
+        DUVC_LOG_ERROR(std::string("Device actor task threw: ") + e.what());
+      } catch (...) {
+        DUVC_LOG_ERROR("Device actor task threw unknown exception");
+      }
+      running.store(0);
+      delete request;
+    }
+    batch.clear();
+  }
+
+  // Release platform objects on the thread (and apartment) that created them
+  connection.reset();
+}
+
+// ============================================================================
+// DeviceActor
+// ============================================================================
+
+DeviceActor::DeviceActor(ConnectionFactory factory,
+                         std::shared_ptr<UnsupportedPropertyCache> unsupported)
+    : state_(std::make_shared<State>(
+          std::move(factory),
+          unsupported ? std::move(unsupported)
+                      : std::make_shared<UnsupportedPropertyCache>())) {
+  state_->thread = std::thread([state = state_] { state->run(); });
+  thread_id_ = state_->thread.get_id();
+}
+
+DeviceActor::~DeviceActor() {
+  state_->stop.store(true);
+  {
+    std::lock_guard<std::mutex> lock(state_->wake_mutex);
+    state_->wake_cv.notify_one();
+  }
+  if (!state_->thread.joinable()) {
+    return;
+  }
+  if (on_actor_thread()) {
+    // Last reference dropped by one of our own tasks (e.g. a completion
+    // callback); the thread drains and exits on its own
+    state_->thread.detach();
+  } else if (healthy()) {
+    state_->thread.join();
+  } else {
+    DUVC_LOG_WARNING("Device actor is hung; detaching its thread");
+    state_->thread.detach();
+  }
+}
+
+void DeviceActor::post(Task task, Deadline deadline) {
+  auto *request = new ActorRequest();
+  request->task = std::move(task);
+  request->deadline = deadline;
+  state_->queue.push(request);
+  state_->wake();
+}
+
+void DeviceActor::reconnect() {
+  // Cleared here rather than on the actor thread so that callers checking
+  // the cache never see entries from the connection being dropped
+  state_->unsupported->clear();
+  state_->reconnect_requested.store(true);
+  state_->wake();
+}
+
+const UnsupportedPropertyCache &DeviceActor::unsupported() const {
+  return *state_->unsupported;
+}
+
+bool DeviceActor::healthy() const {
+  uint64_t stalled = state_->stalled.load();
+  return stalled == 0 || stalled != state_->running.load();
+}
+
+Result<IDeviceConnection *> DeviceActor::current_connection() const {
+  return state_->current_connection();
+}
+
+Error DeviceActor::timed_out(std::chrono::milliseconds timeout) {
+  state_->timeouts.fetch_add(1);
+  // Only a request that is actually executing can be stuck in the driver
+  uint64_t running = state_->running.load();
+  if (running != 0) {
+    state_->stalled.store(running);
+  }
+  return Error(ErrorCode::DeviceBusy, "Device operation timed out after " +
+                                          std::to_string(timeout.count()) +
+                                          " ms");
+}
+
+Error DeviceActor::reject() {
+  state_->rejected.fetch_add(1);
+  return Error(ErrorCode::DeviceBusy,
+               "Device is not responding (previous operation still pending)");
+}
+
+DeviceActorStats DeviceActor::stats() const {
+  DeviceActorStats s;
+  s.requests = state_->requests.load();
+  s.batches = state_->batches.load();
+  s.max_batch = state_->max_batch.load();
+  s.connects = state_->connects.load();
+  s.timeouts = state_->timeouts.load();
+  s.rejected = state_->rejected.load();
+  s.expired = state_->expired.load();
+  s.unsupported_hits = state_->unsupported->hits();
+  s.unsupported_learned = state_->unsupported->inserts();
+  s.unsupported_resets = state_->unsupported->resets();
+  return s;
+}
+
+namespace {
+
+/// Answer a property already known to be unsupported without queueing
+template <typename T, typename P>
+std::optional<Result<T>> cached_unsupported(UnsupportedPropertyCache &cache,
+                                            P prop) {
+  if (!cache.contains(prop)) {
+    return std::nullopt;
+  }
+  cache.record_hit();
+  return Result<T>(Error(ErrorCode::PropertyNotSupported));
+}
+
+/// Remember a PropertyNotSupported answer (runs on the actor thread)
+template <typename T, typename P>
+Result<T> learn_unsupported(UnsupportedPropertyCache &cache, P prop,
+                            Result<T> result) {
+  if (result.is_error() &&
+      result.error().code() == ErrorCode::PropertyNotSupported) {
+    cache.insert(prop);
+  }
+  return result;
+}
+
+} // namespace
+
+Result<PropSetting> DeviceActor::get(CamProp prop,
+                                     std::chrono::milliseconds timeout) {
+  auto &cache = *state_->unsupported;
+  if (auto hit = cached_unsupported<PropSetting>(cache, prop)) {
+    return std::move(*hit);
+  }
+  return call<PropSetting>(
+      [&cache, prop](IDeviceConnection &c) {
+        return learn_unsupported(cache, prop, c.get_camera_property(prop));
+      },
+      timeout);
+}
+
+Result<void> DeviceActor::set(CamProp prop, const PropSetting &setting,
+                              std::chrono::milliseconds timeout) {
+  // Set failures are not learned: drivers reject some modes but not others
+  if (auto hit = cached_unsupported<void>(*state_->unsupported, prop)) {
+    return std::move(*hit);
+  }
+  return call<void>(
+      [prop, setting](IDeviceConnection &c) {
+        return c.set_camera_property(prop, setting);
+      },
+      timeout);
+}
+
+Result<PropRange> DeviceActor::get_range(CamProp prop,
+                                         std::chrono::milliseconds timeout) {
+  auto &cache = *state_->unsupported;
+  if (auto hit = cached_unsupported<PropRange>(cache, prop)) {
+    return std::move(*hit);
+  }
+  return call<PropRange>(
+      [&cache, prop](IDeviceConnection &c) {
+        return learn_unsupported(cache, prop, c.get_camera_property_range(prop));
+      },
+      timeout);
+}
+
+Result<PropSetting> DeviceActor::get(VidProp prop,
+                                     std::chrono::milliseconds timeout) {
+  auto &cache = *state_->unsupported;
+  if (auto hit = cached_unsupported<PropSetting>(cache, prop)) {
+    return std::move(*hit);
+  }
+  return call<PropSetting>(
+      [&cache, prop](IDeviceConnection &c) {
+        return learn_unsupported(cache, prop, c.get_video_property(prop));
+      },
+      timeout);
+}
+
+Result<void> DeviceActor::set(VidProp prop, const PropSetting &setting,
+                              std::chrono::milliseconds timeout) {
+  // Set failures are not learned: drivers reject some modes but not others
+  if (auto hit = cached_unsupported<void>(*state_->unsupported, prop)) {
+    return std::move(*hit);
+  }
+  return call<void>(
+      [prop, setting](IDeviceConnection &c) {
+        return c.set_video_property(prop, setting);
+      },
+      timeout);
+}
+
+Result<PropRange> DeviceActor::get_range(VidProp prop,
+                                         std::chrono::milliseconds timeout) {
+  auto &cache = *state_->unsupported;
+  if (auto hit = cached_unsupported<PropRange>(cache, prop)) {
+    return std::move(*hit);
+  }
+  return call<PropRange>(
+      [&cache, prop](IDeviceConnection &c) {
+        return learn_unsupported(cache, prop, c.get_video_property_range(prop));
+      },
+      timeout);
+}
+
+// ============================================================================
+// Actor registry
+// ============================================================================
+
+namespace {
+
+std::mutex g_actor_registry_mutex;
+std::unordered_map<std::wstring, std::weak_ptr<DeviceActor>> g_actor_registry;
+// Owned by the actors; an entry lives only as long as a device's actors do
+std::unordered_map<std::wstring, std::weak_ptr<UnsupportedPropertyCache>>
+    g_unsupported_caches;
+
+/// Device paths are case-insensitive on Windows
+std::wstring registry_key(const Device &device) {
+  std::wstring key = device.path.empty() ? device.name : device.path;
+  std::transform(key.begin(), key.end(), key.begin(),
+                 [](wchar_t c) { return static_cast<wchar_t>(std::towlower(c)); });
+  return key;
+}
+
+} // namespace
+
+std::shared_ptr<DeviceActor> acquire_device_actor(const Device &device) {
+  std::wstring key = registry_key(device);
+
+  std::lock_guard<std::mutex> lock(g_actor_registry_mutex);
+  auto it = g_actor_registry.find(key);
+  if (it != g_actor_registry.end()) {
+    if (auto actor = it->second.lock()) {
+      return actor;
+    }
+  }
+
+  // Drop entries whose actors have already stopped
+  for (auto entry = g_actor_registry.begin(); entry != g_actor_registry.end();) {
+    entry = entry->second.expired() ? g_actor_registry.erase(entry)
+                                    : std::next(entry);
+  }
+  for (auto entry = g_unsupported_caches.begin();
+       entry != g_unsupported_caches.end();) {
+    entry = entry->second.expired() ? g_unsupported_caches.erase(entry)
+                                    : std::next(entry);
+  }
+
+  // A detached hung actor may still hold the previous cache
+  auto unsupported = g_unsupported_caches[key].lock();
+  if (!unsupported) {
+    unsupported = std::make_shared<UnsupportedPropertyCache>();
+    g_unsupported_caches[key] = unsupported;
+  }
+
+  auto actor = std::make_shared<DeviceActor>(
+      [device]() -> Result<std::unique_ptr<IDeviceConnection>> {
+        auto platform = create_platform_interface();
+        if (!platform) {
+          return Err<std::unique_ptr<IDeviceConnection>>(
+              ErrorCode::NotImplemented,
+              "No platform backend available for device connections");
+        }
+        auto connection = platform->create_connection(device);
+        if (!connection.is_ok()) {
+          return connection;
+        }
+        return Ok(apply_device_profile(std::move(connection).value(),
+                                       find_device_profile(device)));
+      },
+      unsupported);
+  g_actor_registry[key] = actor;
+  return actor;
+}
+
+} // namespace duvc
@@ -0,0 +1,324 @@
+/**
+ * @file device_identity.cpp
+ * @brief Device path parsing and indexed device lookup
+ */
+
+#include <duvc-ctl/core/device_identity.h>
+
+#include <algorithm>
+#include <cwctype>
+#include <string_view>
+
+namespace duvc {
+
+namespace {
+
+std::wstring fold(std::wstring text) {
+  for (auto &c : text) {
+    c = static_cast<wchar_t>(std::towlower(c));
+  }
+  return text;
+}
+
+bool starts_with_folded(std::wstring_view text, const wchar_t *prefix) {
+  size_t n = std::char_traits<wchar_t>::length(prefix);
+  if (text.size() < n) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (std::towlower(text[i]) != static_cast<std::wint_t>(prefix[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<std::wstring> split(const std::wstring &text, wchar_t separator) {
+  std::vector<std::wstring> parts;
+  size_t start = 0;
+  while (true) {
+    size_t end = text.find(separator, start);
+    parts.push_back(text.substr(start, end - start));
+    if (end == std::wstring::npos) {
+      return parts;
+    }
+    start = end + 1;
+  }
+}
+
+/// Parse exactly digits hex digits following a "TAG_" prefix
+template <typename T>
+std::optional<T> parse_tagged_hex(const std::wstring &token, const wchar_t *tag,
+                                  size_t digits) {
+  size_t n = std::char_traits<wchar_t>::length(tag);
+  if (token.size() != n + digits || !starts_with_folded(token, tag)) {
+    return std::nullopt;
+  }
+  unsigned value = 0;
+  for (size_t i = n; i < token.size(); ++i) {
+    wchar_t c = token[i];
+    unsigned digit;
+    if (c >= L'0' && c <= L'9') {
+      digit = static_cast<unsigned>(c - L'0');
+    } else if (c >= L'a' && c <= L'f') {
+      digit = static_cast<unsigned>(c - L'a' + 10);
+    } else if (c >= L'A' && c <= L'F') {
+      digit = static_cast<unsigned>(c - L'A' + 10);
+    } else {
+      return std::nullopt;
+    }
+    value = value * 16 + digit;
+  }
+  return static_cast<T>(value);
+}
+
+void parse_hardware_id(DeviceIdentity &identity) {
+  for (const auto &token : split(identity.hardware_id, L'&')) {
+    if (auto vid = parse_tagged_hex<uint16_t>(token, L"vid_", 4)) {
+      identity.vid = vid;
+    } else if (auto pid = parse_tagged_hex<uint16_t>(token, L"pid_", 4)) {
+      identity.pid = pid;
+    } else if (auto mi = parse_tagged_hex<uint8_t>(token, L"mi_", 2)) {
+      identity.interface_number = mi;
+    }
+  }
+}
+
+} // namespace
+
+uint64_t identity_hash(const std::wstring &text) {
+  uint64_t hash = 1469598103934665603ull;
+  for (wchar_t c : text) {
+    hash ^= static_cast<uint32_t>(c);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+namespace {
+
+/// identity_hash() fed in pieces, folding as it goes
+struct FoldingHasher {
+  uint64_t hash = 1469598103934665603ull;
+
+  void add(wchar_t c) {
+    hash ^= static_cast<uint32_t>(c);
+    hash *= 1099511628211ull;
+  }
+  void add_folded(std::wstring_view text, wchar_t separator = L'#') {
+    for (wchar_t c : text) {
+      add(c == separator ? L'#' : static_cast<wchar_t>(std::towlower(c)));
+    }
+  }
+};
+
+} // namespace
+
+uint64_t device_key_hash(const std::wstring &path) {
+  // Mirrors the key construction in parse_device_identity() over views
+  std::wstring_view text(path);
+  size_t end = text.find_last_not_of(std::wstring_view(L"\r\n \t\0", 5));
+  text = text.substr(0, end == std::wstring_view::npos ? 0 : end + 1);
+  if (starts_with_folded(text, L"@device:")) {
+    size_t colon = text.find(L':', 8);
+    text = colon == std::wstring_view::npos ? std::wstring_view()
+                                            : text.substr(colon + 1);
+  }
+
+  bool interface_path = starts_with_folded(text, L"\\\\?\\") ||
+                        starts_with_folded(text, L"\\\\.\\");
+  std::wstring_view body = interface_path ? text.substr(4) : text;
+  wchar_t separator = interface_path ? L'#' : L'\\';
+  size_t segments =
+      static_cast<size_t>(std::count(body.begin(), body.end(), separator)) + 1;
+  if (interface_path && segments >= 4) {
+    body = body.substr(0, body.rfind(separator)); // drop the interface GUID
+    --segments;
+  }
+
+  FoldingHasher hasher;
+  size_t first = body.find(separator);
+  size_t second = first == std::wstring_view::npos
+                      ? std::wstring_view::npos
+                      : body.find(separator, first + 1);
+  if (segments < 3 || first == 0 || second == first + 1) {
+    hasher.add_folded(text);
+    return hasher.hash;
+  }
+  hasher.add_folded(body.substr(0, first));
+  hasher.add(L'\\');
+  hasher.add_folded(body.substr(first + 1, second - first - 1));
+  hasher.add(L'\\');
+  hasher.add_folded(body.substr(second + 1), separator);
+  return hasher.hash;
+}
+
+bool DeviceIdentity::has_serial() const {
+  return bus == L"usb" && !instance.empty() &&
+         instance.find(L'&') == std::wstring::npos;
+}
+
+std::wstring DeviceIdentity::serial() const {
+  return has_serial() ? instance : std::wstring();
+}
+
+std::optional<uint32_t> DeviceIdentity::usb_id() const {
+  if (!vid || !pid) {
+    return std::nullopt;
+  }
+  return (static_cast<uint32_t>(*vid) << 16) | *pid;
+}
+
+DeviceIdentity parse_device_identity(const std::wstring &path) {
+  DeviceIdentity identity;
+
+  std::wstring text = path;
+  size_t end = text.find_last_not_of(std::wstring(L"\r\n \t\0", 5));
+  text.erase(end == std::wstring::npos ? 0 : end + 1);
+
+  // Moniker display name: @device:<type>:<path>
+  if (starts_with_folded(text, L"@device:")) {
+    size_t colon = text.find(L':', 8);
+    text = colon == std::wstring::npos ? std::wstring() : text.substr(colon + 1);
+  }
+
+  std::vector<std::wstring> segments;
+  if (starts_with_folded(text, L"\\\\?\\") || starts_with_folded(text, L"\\\\.\\")) {
+    // Interface path: bus#hardware_id#instance#{guid}[\reference]
+    segments = split(text.substr(4), L'#');
+    if (segments.size() >= 4) {
+      std::wstring guid = segments.back();
+      guid = guid.substr(0, guid.find(L'\\'));
+      if (!guid.empty() && guid.front() == L'{' && guid.back() == L'}') {
+        identity.interface_guid = fold(guid);
+      }
+      segments.pop_back();
+    }
+  } else {
+    // Instance ID: BUS\HARDWARE_ID\INSTANCE
+    segments = split(text, L'\\');
+  }
+
+  if (segments.size() < 3 || segments[0].empty() || segments[1].empty()) {
+    identity.key = fold(text);
+    identity.key_hash = identity_hash(identity.key);
+    return identity;
+  }
+
+  identity.bus = fold(segments[0]);
+  identity.hardware_id = segments[1];
+  for (size_t i = 2; i < segments.size(); ++i) {
+    identity.instance += (i > 2 ? L"#" : L"") + segments[i];
+  }
+  parse_hardware_id(identity);
+
+  identity.key = identity.bus + L"\\" + fold(identity.hardware_id) + L"\\" +
+                 fold(identity.instance);
+  identity.key_hash = identity_hash(identity.key);
+  if (identity.has_serial()) {
+    identity.serial_hash = identity_hash(fold(identity.instance));
+  }
+  return identity;
+}
+
+bool same_device_path(const std::wstring &a, const std::wstring &b) {
+  if (a.empty() || b.empty()) {
+    return false;
+  }
+  return parse_device_identity(a).key == parse_device_identity(b).key;
+}
+
+// ============================================================================
+// DeviceIndex
+// ============================================================================
+
+DeviceIndex::DeviceIndex(std::vector<Device> devices) {
+  entries_.reserve(devices.size());
+  by_key_.reserve(devices.size());
+  for (size_t i = 0; i < devices.size(); ++i) {
+    Entry entry;
+    entry.identity = parse_device_identity(devices[i].path);
+    entry.position = i;
+    bool has_key = !entry.identity.key.empty();
+    if (has_key &&
+        !collect(by_key_, entry.identity.key_hash, [&](const Entry &e) {
+           return e.identity.key == entry.identity.key;
+         }).empty()) {
+      continue;
+    }
+    entry.device = std::move(devices[i]);
+
+    size_t slot = entries_.size();
+    if (has_key) {
+      by_key_.emplace(entry.identity.key_hash, slot);
+    }
+    if (entry.identity.has_serial()) {
+      by_serial_.emplace(entry.identity.serial_hash, slot);
+    }
+    by_name_.emplace(identity_hash(fold(entry.device.name)), slot);
+    if (auto id = entry.identity.usb_id()) {
+      by_usb_id_[*id].push_back(slot);
+    }
+    entries_.push_back(std::move(entry));
+  }
+}
+
+std::vector<const DeviceIndex::Entry *>
+DeviceIndex::collect(const Bucket &bucket, uint64_t hash,
+                     const std::function<bool(const Entry &)> &match) const {
+  std::vector<size_t> slots;
+  auto range = bucket.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (match(entries_[it->second])) {
+      slots.push_back(it->second);
+    }
+  }
+  std::sort(slots.begin(), slots.end());
+
+  std::vector<const Entry *> found;
+  found.reserve(slots.size());
+  for (size_t slot : slots) {
+    found.push_back(&entries_[slot]);
+  }
+  return found;
+}
+
+const DeviceIndex::Entry *
+DeviceIndex::find_by_path(const std::wstring &path) const {
+  DeviceIdentity query = parse_device_identity(path);
+  auto found = collect(by_key_, query.key_hash, [&](const Entry &e) {
+    return e.identity.key == query.key;
+  });
+  return found.empty() ? nullptr : found.front();
+}
+
+const DeviceIndex::Entry *
+DeviceIndex::find_by_serial(const std::wstring &serial) const {
+  std::wstring folded = fold(serial);
+  auto found = collect(by_serial_, identity_hash(folded), [&](const Entry &e) {
+    return fold(e.identity.instance) == folded;
+  });
+  return found.empty() ? nullptr : found.front();
+}
+
+std::vector<const DeviceIndex::Entry *>
+DeviceIndex::find_by_usb_id(uint16_t vid, uint16_t pid) const {
+  std::vector<const Entry *> found;
+  auto it = by_usb_id_.find((static_cast<uint32_t>(vid) << 16) | pid);
+  if (it != by_usb_id_.end()) {
+    for (size_t slot : it->second) {
+      found.push_back(&entries_[slot]);
+    }
+  }
+  return found;
+}
+
+std::vector<const DeviceIndex::Entry *>
+DeviceIndex::find_by_name(const std::wstring &name) const {
+  std::wstring folded = fold(name);
+  return collect(by_name_, identity_hash(folded), [&](const Entry &e) {
+    return fold(e.device.name) == folded;
+  });
+}
+
+} // namespace duvc
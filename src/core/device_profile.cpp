@@ -0,0 +1,546 @@
+/**
+ * @file device_profile.cpp
+ * @brief Device profile database and profile-aware connections
+ */
+
+#include <duvc-ctl/core/device_identity.h>
+#include <duvc-ctl/detail/json_fields.h>
+#include <duvc-ctl/core/device_profile.h>
+#include <duvc-ctl/platform/interface.h>
+#include <duvc-ctl/utils/json.h>
+#include <duvc-ctl/utils/logging.h>
+#include <duvc-ctl/utils/string_conversion.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+namespace duvc {
+
+namespace {
+
+using detail::is_integer;
+using detail::resolve_property;
+using detail::starts_with_ignore_case;
+
+/**
+ * Profiles compiled into the library, in the same format as the user file.
+ *
+ * Every entry must cite where its quirk comes from (vendor errata or a
+ * reproducible report) in a comment here. None is confirmed yet; suspected
+ * quirks belong in the user profile file until they are.
+ */
+const char *const kBuiltinProfiles = R"({
+  "profiles": []
+})";
+
+const RangeOverride &empty_override() {
+  static const RangeOverride none;
+  return none;
+}
+
+// ============================================================================
+// JSON profile format
+// ============================================================================
+
+Result<std::vector<DeviceProfile>> profile_error(const std::string &where,
+                                                 const std::string &message) {
+  return Err<std::vector<DeviceProfile>>(ErrorCode::InvalidArgument,
+                                         where + ": " + message);
+}
+
+/// Parse a list of property names into camera and video sets
+bool parse_property_list(const JsonValue &json, CamPropSet &camera,
+                         VidPropSet &video, std::string &error) {
+  if (!json.is_array()) {
+    error = "expected an array of property names";
+    return false;
+  }
+  for (const auto &item : json.as_array()) {
+    if (!item.is_string()) {
+      error = "expected an array of property names";
+      return false;
+    }
+    auto property = resolve_property(item.as_string(), error);
+    if (!property) {
+      return false;
+    }
+    if (property->video) {
+      video.insert(property->vid_prop);
+    } else {
+      camera.insert(property->cam_prop);
+    }
+  }
+  return true;
+}
+
+/// Parse a USB ID: hex string ("046D", "0x046d") or number
+bool parse_usb_id(const JsonValue &json, uint16_t &id) {
+  if (is_integer(json)) {
+    if (json.as_number() < 0 || json.as_number() > 0xFFFF) {
+      return false;
+    }
+    id = static_cast<uint16_t>(json.as_number());
+    return true;
+  }
+  if (!json.is_string()) {
+    return false;
+  }
+  std::string text = json.as_string();
+  if (starts_with_ignore_case(text, "0x")) {
+    text = text.substr(2);
+  }
+  if (text.empty() || text.size() > 4 ||
+      !std::all_of(text.begin(), text.end(), [](char c) {
+        return std::isxdigit(static_cast<unsigned char>(c)) != 0;
+      })) {
+    return false;
+  }
+  id = static_cast<uint16_t>(std::stoul(text, nullptr, 16));
+  return true;
+}
+
+/// Parse {"min", "max", "step", "default", "mode"}
+bool parse_range_override(const JsonValue &json, RangeOverride &range,
+                          std::string &error) {
+  if (!json.is_object()) {
+    error = "expected an object";
+    return false;
+  }
+  const std::pair<const char *, std::optional<int> *> fields[] = {
+      {"min", &range.min},
+      {"max", &range.max},
+      {"step", &range.step},
+      {"default", &range.default_val}};
+  for (const auto &field : fields) {
+    if (const JsonValue *value = json.find(field.first)) {
+      if (!is_integer(*value)) {
+        error = "\"" + std::string(field.first) + "\" must be an integer";
+        return false;
+      }
+      *field.second = static_cast<int>(value->as_number());
+    }
+  }
+  if (const JsonValue *mode = json.find("mode")) {
+    if (mode->is_string() && mode->as_string() == "auto") {
+      range.default_mode = CamMode::Auto;
+    } else if (mode->is_string() && mode->as_string() == "manual") {
+      range.default_mode = CamMode::Manual;
+    } else {
+      error = "\"mode\" must be \"auto\" or \"manual\"";
+      return false;
+    }
+  }
+  if (range.min && range.max && *range.min > *range.max) {
+    error = "\"min\" is greater than \"max\"";
+    return false;
+  }
+  return true;
+}
+
+// ============================================================================
+// Profile-aware connection
+// ============================================================================
+
+/// Connection decorator applying a device profile (actor thread only)
+class ProfiledConnection : public IDeviceConnection {
+public:
+  ProfiledConnection(std::unique_ptr<IDeviceConnection> inner,
+                     std::shared_ptr<const DeviceProfile> profile)
+      : inner_(std::move(inner)), profile_(std::move(profile)) {}
+
+  bool is_valid() const override { return inner_->is_valid(); }
+
+  Result<PropSetting> get_camera_property(CamProp prop) override {
+    if (!profile_->probes(prop)) {
+      return not_probed<PropSetting>();
+    }
+    return inner_->get_camera_property(prop);
+  }
+
+  Result<void> set_camera_property(CamProp prop,
+                                   const PropSetting &setting) override {
+    if (!profile_->probes(prop)) {
+      return not_probed<void>();
+    }
+    return paced(profile_->paces(prop),
+                 [&] { return inner_->set_camera_property(prop, setting); });
+  }
+
+  Result<PropRange> get_camera_property_range(CamProp prop) override {
+    if (!profile_->probes(prop)) {
+      return not_probed<PropRange>();
+    }
+    return corrected(inner_->get_camera_property_range(prop),
+                     profile_->range_override(prop));
+  }
+
+  Result<PropSetting> get_video_property(VidProp prop) override {
+    if (!profile_->probes(prop)) {
+      return not_probed<PropSetting>();
+    }
+    return inner_->get_video_property(prop);
+  }
+
+  Result<void> set_video_property(VidProp prop,
+                                  const PropSetting &setting) override {
+    if (!profile_->probes(prop)) {
+      return not_probed<void>();
+    }
+    return paced(profile_->paces(prop),
+                 [&] { return inner_->set_video_property(prop, setting); });
+  }
+
+  Result<PropRange> get_video_property_range(VidProp prop) override {
+    if (!profile_->probes(prop)) {
+      return not_probed<PropRange>();
+    }
+    return corrected(inner_->get_video_property_range(prop),
+                     profile_->range_override(prop));
+  }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  template <typename T> Result<T> not_probed() const {
+    return Err<T>(ErrorCode::PropertyNotSupported,
+                  "Not supported by " + profile_->name + " (device profile)");
+  }
+
+  static Result<PropRange> corrected(Result<PropRange> range,
+                                     const RangeOverride &override_) {
+    if (range.is_ok() && !override_.empty()) {
+      return override_.apply(range.value());
+    }
+    return range;
+  }
+
+  template <typename Write> Result<void> paced(bool pace, Write write) {
+    if (!pace || profile_->write_interval.count() <= 0) {
+      return write();
+    }
+    std::this_thread::sleep_until(next_write_);
+    auto result = write();
+    next_write_ = Clock::now() + profile_->write_interval;
+    return result;
+  }
+
+  std::unique_ptr<IDeviceConnection> inner_;
+  std::shared_ptr<const DeviceProfile> profile_;
+  Clock::time_point next_write_{};
+};
+
+} // namespace
+
+Result<PropRange> RangeOverride::apply(const PropRange &range) const {
+  PropRange result = range;
+  result.min = min.value_or(range.min);
+  result.max = max.value_or(range.max);
+  result.step = step.value_or(range.step);
+  result.default_val = default_val.value_or(range.default_val);
+  result.default_mode = default_mode.value_or(range.default_mode);
+  if (result.min > result.max) {
+    return Err<PropRange>(ErrorCode::InvalidArgument,
+                          "Range override gives min " +
+                              std::to_string(result.min) + " above max " +
+                              std::to_string(result.max));
+  }
+  return Ok(result);
+}
+
+bool DeviceProfile::probes(CamProp prop) const {
+  return !camera_never_probe.contains(prop) &&
+         (!camera_supported || camera_supported->contains(prop));
+}
+
+bool DeviceProfile::probes(VidProp prop) const {
+  return !video_never_probe.contains(prop) &&
+         (!video_supported || video_supported->contains(prop));
+}
+
+bool DeviceProfile::paces(CamProp prop) const {
+  return (camera_paced.empty() && video_paced.empty()) ||
+         camera_paced.contains(prop);
+}
+
+bool DeviceProfile::paces(VidProp prop) const {
+  return (camera_paced.empty() && video_paced.empty()) ||
+         video_paced.contains(prop);
+}
+
+const RangeOverride &DeviceProfile::range_override(CamProp prop) const {
+  auto index = static_cast<size_t>(prop);
+  return index < kCamPropCount ? camera_ranges[index] : empty_override();
+}
+
+const RangeOverride &DeviceProfile::range_override(VidProp prop) const {
+  auto index = static_cast<size_t>(prop);
+  return index < kVidPropCount ? video_ranges[index] : empty_override();
+}
+
+Result<std::vector<DeviceProfile>> parse_device_profiles(const std::string &text) {
+  auto document = parse_json(text);
+  if (!document.is_ok()) {
+    return Result<std::vector<DeviceProfile>>(document.error());
+  }
+  const JsonValue *entries = document.value().find("profiles");
+  if (!entries || !entries->is_array()) {
+    return profile_error("Device profiles", "\"profiles\" array is required");
+  }
+
+  std::vector<DeviceProfile> profiles;
+  for (size_t i = 0; i < entries->as_array().size(); ++i) {
+    const JsonValue &entry = entries->as_array()[i];
+    std::string where = "Profile " + std::to_string(i);
+    if (!entry.is_object()) {
+      return profile_error(where, "expected an object");
+    }
+
+    DeviceProfile profile;
+    const JsonValue *vid = entry.find("vid");
+    if (!vid || !parse_usb_id(*vid, profile.vid)) {
+      return profile_error(where, "\"vid\" must be a 16-bit USB vendor ID");
+    }
+    if (const JsonValue *pid = entry.find("pid")) {
+      uint16_t id = 0;
+      if (!parse_usb_id(*pid, id)) {
+        return profile_error(where, "\"pid\" must be a 16-bit USB product ID");
+      }
+      profile.pid = id;
+    }
+    if (const JsonValue *name = entry.find("name")) {
+      if (!name->is_string()) {
+        return profile_error(where, "\"name\" must be a string");
+      }
+      profile.name = name->as_string();
+    }
+    if (profile.name.empty()) {
+      char id[16];
+      std::snprintf(id, sizeof(id), "%04X:%04X", profile.vid,
+                    profile.pid.value_or(0));
+      profile.name = profile.pid ? id : std::string(id, 4) + ":*";
+    }
+
+    std::string error;
+    if (const JsonValue *supported = entry.find("supported")) {
+      CamPropSet camera;
+      VidPropSet video;
+      if (!parse_property_list(*supported, camera, video, error)) {
+        return profile_error(where + " \"supported\"", error);
+      }
+      profile.camera_supported = camera;
+      profile.video_supported = video;
+    }
+    if (const JsonValue *never = entry.find("never_probe")) {
+      if (!parse_property_list(*never, profile.camera_never_probe,
+                               profile.video_never_probe, error)) {
+        return profile_error(where + " \"never_probe\"", error);
+      }
+    }
+    if (const JsonValue *paced = entry.find("paced")) {
+      if (!parse_property_list(*paced, profile.camera_paced,
+                               profile.video_paced, error)) {
+        return profile_error(where + " \"paced\"", error);
+      }
+    }
+    if (const JsonValue *interval = entry.find("write_interval_ms")) {
+      if (!is_integer(*interval) || interval->as_number() < 0) {
+        return profile_error(where,
+                             "\"write_interval_ms\" must be a non-negative integer");
+      }
+      profile.write_interval =
+          std::chrono::milliseconds(static_cast<int>(interval->as_number()));
+    }
+    if (const JsonValue *ranges = entry.find("ranges")) {
+      if (!ranges->is_object()) {
+        return profile_error(where, "\"ranges\" must be an object");
+      }
+      for (const auto &member : ranges->as_object()) {
+        std::string range_where = where + " range \"" + member.first + "\"";
+        auto property = resolve_property(member.first, error);
+        if (!property) {
+          return profile_error(range_where, error);
+        }
+        RangeOverride &range =
+            property->video
+                ? profile.video_ranges[static_cast<size_t>(property->vid_prop)]
+                : profile.camera_ranges[static_cast<size_t>(property->cam_prop)];
+        if (!parse_range_override(member.second, range, error)) {
+          return profile_error(range_where, error);
+        }
+      }
+    }
+    profiles.push_back(std::move(profile));
+  }
+  return Ok(std::move(profiles));
+}
+
+Result<std::vector<DeviceProfile>>
+load_device_profiles(const std::filesystem::path &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return Err<std::vector<DeviceProfile>>(
+        ErrorCode::InvalidArgument,
+        "Cannot open device profiles: " + path.u8string());
+  }
+  std::string text((std::istreambuf_iterator<char>(file)),
+                   std::istreambuf_iterator<char>());
+  return parse_device_profiles(text);
+}
+
+const std::vector<DeviceProfile> &builtin_device_profiles() {
+  static const std::vector<DeviceProfile> profiles = [] {
+    auto parsed = parse_device_profiles(kBuiltinProfiles);
+    if (!parsed.is_ok()) {
+      DUVC_LOG_ERROR("Built-in device profiles are invalid: " +
+                     parsed.error().description());
+      return std::vector<DeviceProfile>();
+    }
+    return parsed.value();
+  }();
+  return profiles;
+}
+
+std::filesystem::path default_device_profiles_path() {
+#ifdef _WIN32
+  if (const wchar_t *appdata = _wgetenv(L"APPDATA")) {
+    return std::filesystem::path(appdata) / L"duvc-ctl" /
+           L"device_profiles.json";
+  }
+#else
+  if (const char *config = std::getenv("XDG_CONFIG_HOME")) {
+    return std::filesystem::path(config) / "duvc-ctl" / "device_profiles.json";
+  }
+  if (const char *home = std::getenv("HOME")) {
+    return std::filesystem::path(home) / ".config" / "duvc-ctl" /
+           "device_profiles.json";
+  }
+#endif
+  return std::filesystem::path("duvc-device-profiles.json");
+}
+
+// ============================================================================
+// DeviceProfileDatabase
+// ============================================================================
+
+struct DeviceProfileDatabase::Table {
+  mutable std::mutex mutex;
+  /// Later entries take precedence
+  std::vector<std::shared_ptr<const DeviceProfile>> profiles;
+
+  void add(DeviceProfile profile) {
+    profiles.erase(std::remove_if(profiles.begin(), profiles.end(),
+                                  [&](const auto &p) {
+                                    return p->vid == profile.vid &&
+                                           p->pid == profile.pid;
+                                  }),
+                   profiles.end());
+    profiles.push_back(std::make_shared<const DeviceProfile>(std::move(profile)));
+  }
+};
+
+DeviceProfileDatabase::DeviceProfileDatabase() : table_(std::make_unique<Table>()) {
+  reset();
+
+  std::error_code ec;
+  auto path = default_device_profiles_path();
+  if (std::filesystem::exists(path, ec)) {
+    auto loaded = load(path);
+    if (!loaded.is_ok()) {
+      DUVC_LOG_WARNING("Ignoring device profiles: " +
+                       loaded.error().description());
+    }
+  }
+}
+
+DeviceProfileDatabase &DeviceProfileDatabase::instance() {
+  // Never destroyed: actors may look profiles up during static destruction
+  static DeviceProfileDatabase *database = new DeviceProfileDatabase();
+  return *database;
+}
+
+std::shared_ptr<const DeviceProfile>
+DeviceProfileDatabase::find(uint16_t vid, uint16_t pid) const {
+  std::lock_guard<std::mutex> lock(table_->mutex);
+  std::shared_ptr<const DeviceProfile> vendor;
+  for (auto it = table_->profiles.rbegin(); it != table_->profiles.rend(); ++it) {
+    const auto &profile = *it;
+    if (profile->vid != vid) {
+      continue;
+    }
+    if (profile->pid == pid) {
+      return profile;
+    }
+    if (!profile->pid && !vendor) {
+      vendor = profile;
+    }
+  }
+  return vendor;
+}
+
+std::shared_ptr<const DeviceProfile>
+DeviceProfileDatabase::find(const Device &device) const {
+  DeviceIdentity identity = parse_device_identity(device.path);
+  if (!identity.vid || !identity.pid) {
+    return nullptr;
+  }
+  return find(*identity.vid, *identity.pid);
+}
+
+void DeviceProfileDatabase::add(DeviceProfile profile) {
+  std::lock_guard<std::mutex> lock(table_->mutex);
+  table_->add(std::move(profile));
+}
+
+Result<size_t> DeviceProfileDatabase::load(const std::filesystem::path &path) {
+  auto loaded = load_device_profiles(path);
+  if (!loaded.is_ok()) {
+    return Result<size_t>(loaded.error());
+  }
+  std::vector<DeviceProfile> profiles = std::move(loaded).value();
+  std::lock_guard<std::mutex> lock(table_->mutex);
+  for (auto &profile : profiles) {
+    table_->add(std::move(profile));
+  }
+  return Ok(profiles.size());
+}
+
+std::vector<DeviceProfile> DeviceProfileDatabase::profiles() const {
+  std::lock_guard<std::mutex> lock(table_->mutex);
+  std::vector<DeviceProfile> result;
+  result.reserve(table_->profiles.size());
+  for (const auto &profile : table_->profiles) {
+    result.push_back(*profile);
+  }
+  return result;
+}
+
+void DeviceProfileDatabase::reset() {
+  std::lock_guard<std::mutex> lock(table_->mutex);
+  table_->profiles.clear();
+  for (const auto &profile : builtin_device_profiles()) {
+    table_->add(profile);
+  }
+}
+
+std::shared_ptr<const DeviceProfile> find_device_profile(const Device &device) {
+  return DeviceProfileDatabase::instance().find(device);
+}
+
+std::unique_ptr<IDeviceConnection>
+apply_device_profile(std::unique_ptr<IDeviceConnection> connection,
+                     std::shared_ptr<const DeviceProfile> profile) {
+  if (!connection || !profile) {
+    return connection;
+  }
+  return std::make_unique<ProfiledConnection>(std::move(connection),
+                                              std::move(profile));
+}
+
+} // namespace duvc
@@ -0,0 +1,120 @@
+/**
+ * @file device_registry.cpp
+ * @brief Device record interning implementation
+ */
+
+#include <duvc-ctl/core/device_registry.h>
+#include <duvc-ctl/utils/string_conversion.h>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace duvc {
+
+namespace {
+
+const Device &empty_device() {
+  static const Device device;
+  return device;
+}
+
+const std::string &empty_string() {
+  static const std::string text;
+  return text;
+}
+
+} // namespace
+
+const Device &DeviceHandle::device() const {
+  return record_ ? record_->device : empty_device();
+}
+
+const std::string &DeviceHandle::name_utf8() const {
+  return record_ ? record_->name_utf8 : empty_string();
+}
+
+const std::string &DeviceHandle::path_utf8() const {
+  return record_ ? record_->path_utf8 : empty_string();
+}
+
+bool DeviceHandle::operator==(const DeviceHandle &other) const {
+  if (record_ == other.record_) {
+    return true;
+  }
+  if (!record_ || !other.record_ || hash_ != other.hash_) {
+    return false;
+  }
+  return record_->identity.key == other.record_->identity.key;
+}
+
+// ============================================================================
+// DeviceRegistry
+// ============================================================================
+
+struct DeviceRegistry::Table {
+  mutable std::mutex mutex;
+  std::unordered_map<uint64_t, std::vector<std::weak_ptr<const DeviceRecord>>>
+      records; ///< Keyed by identity key hash
+};
+
+DeviceRegistry::DeviceRegistry() : table_(std::make_unique<Table>()) {}
+
+DeviceRegistry::~DeviceRegistry() = default;
+
+DeviceRegistry &DeviceRegistry::instance() {
+  // Never destroyed: handles may outlive static destruction order
+  static DeviceRegistry *registry = new DeviceRegistry();
+  return *registry;
+}
+
+DeviceHandle DeviceRegistry::intern(const Device &device) {
+  DeviceIdentity identity = parse_device_identity(device.path);
+  uint64_t hash = identity.key_hash;
+
+  std::lock_guard<std::mutex> lock(table_->mutex);
+  auto &bucket = table_->records[hash];
+  bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                              [](const std::weak_ptr<const DeviceRecord> &r) {
+                                return r.expired();
+                              }),
+               bucket.end());
+  for (const auto &weak : bucket) {
+    auto record = weak.lock();
+    if (record && record->device.path == device.path &&
+        record->device.name == device.name) {
+      return DeviceHandle(std::move(record), hash);
+    }
+  }
+
+  auto record = std::make_shared<DeviceRecord>();
+  record->device = device;
+  record->name_utf8 = to_utf8(device.name);
+  record->path_utf8 = to_utf8(device.path);
+  record->identity = std::move(identity);
+  bucket.push_back(record);
+  return DeviceHandle(std::move(record), hash);
+}
+
+size_t DeviceRegistry::size() const {
+  std::lock_guard<std::mutex> lock(table_->mutex);
+  size_t live = 0;
+  for (auto it = table_->records.begin(); it != table_->records.end();) {
+    auto &bucket = it->second;
+    bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                                [](const std::weak_ptr<const DeviceRecord> &r) {
+                                  return r.expired();
+                                }),
+                 bucket.end());
+    live += bucket.size();
+    it = bucket.empty() ? table_->records.erase(it) : std::next(it);
+  }
+  return live;
+}
+
+DeviceHandle intern_device(const Device &device) {
+  return DeviceRegistry::instance().intern(device);
+}
+
+} // namespace duvc
@@ -0,0 +1,186 @@
+/**
+ * @file policy.cpp
+ * @brief Per-device retry and circuit breaker policy implementation
+ */
+
+#include <duvc-ctl/core/policy.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace duvc {
+
+namespace {
+
+std::mutex g_default_policy_mutex;
+DevicePolicy g_default_policy;
+
+} // namespace
+
+const char *to_string(CircuitState state) {
+  switch (state) {
+  case CircuitState::Closed:
+    return "Closed";
+  case CircuitState::Open:
+    return "Open";
+  case CircuitState::HalfOpen:
+    return "HalfOpen";
+  default:
+    return "Unknown";
+  }
+}
+
+bool is_transient_error(const Error &error) {
+  return error.code() == ErrorCode::DeviceBusy;
+}
+
+bool is_device_failure(const Error &error) {
+  switch (error.code()) {
+  case ErrorCode::PropertyNotSupported:
+  case ErrorCode::InvalidValue:
+  case ErrorCode::InvalidArgument:
+  case ErrorCode::NotImplemented:
+    return false;
+  default:
+    return true;
+  }
+}
+
+DevicePolicy default_device_policy() {
+  std::lock_guard<std::mutex> lock(g_default_policy_mutex);
+  return g_default_policy;
+}
+
+void set_default_device_policy(const DevicePolicy &policy) {
+  std::lock_guard<std::mutex> lock(g_default_policy_mutex);
+  g_default_policy = policy;
+}
+
+// ============================================================================
+// DevicePolicyEngine
+// ============================================================================
+
+DevicePolicyEngine::DevicePolicyEngine(const DevicePolicy &policy)
+    : policy_(policy), rng_(std::random_device{}()) {}
+
+void DevicePolicyEngine::set_policy(const DevicePolicy &policy) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  policy_ = policy;
+}
+
+DevicePolicy DevicePolicyEngine::policy() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return policy_;
+}
+
+PolicyStats DevicePolicyEngine::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+void DevicePolicyEngine::reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.state = CircuitState::Closed;
+  stats_.consecutive_failures = 0;
+  probes_in_flight_ = 0;
+}
+
+std::optional<Error> DevicePolicyEngine::admit(int attempt) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (policy_.enabled) {
+    if (stats_.state == CircuitState::Open &&
+        Clock::now() - opened_at_ >= policy_.breaker.open_duration) {
+      stats_.state = CircuitState::HalfOpen;
+      probes_in_flight_ = 0;
+    }
+
+    bool reject = stats_.state == CircuitState::Open;
+    if (stats_.state == CircuitState::HalfOpen) {
+      reject = probes_in_flight_ >= std::max(1, policy_.breaker.half_open_probes);
+      if (!reject) {
+        ++probes_in_flight_;
+      }
+    }
+    if (reject) {
+      ++stats_.short_circuited;
+      return Error(ErrorCode::DeviceBusy,
+                   "Circuit breaker open after " +
+                       std::to_string(stats_.consecutive_failures) +
+                       " consecutive device failures");
+    }
+  }
+
+  ++stats_.attempts;
+  if (attempt > 1) {
+    ++stats_.retries;
+  }
+  return std::nullopt;
+}
+
+void DevicePolicyEngine::record_success() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++stats_.successes;
+  stats_.consecutive_failures = 0;
+  if (stats_.state == CircuitState::HalfOpen) {
+    stats_.state = CircuitState::Closed;
+    probes_in_flight_ = 0;
+  }
+}
+
+std::optional<std::chrono::milliseconds>
+DevicePolicyEngine::record_failure(const Error &error, int attempt) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!policy_.enabled) {
+    return std::nullopt;
+  }
+
+  bool probe = stats_.state == CircuitState::HalfOpen;
+  if (!is_device_failure(error)) {
+    // The device answered; the request itself was rejected
+    stats_.consecutive_failures = 0;
+    if (probe) {
+      stats_.state = CircuitState::Closed;
+      probes_in_flight_ = 0;
+    }
+    return std::nullopt;
+  }
+
+  ++stats_.failures;
+  ++stats_.consecutive_failures;
+  if (probe ||
+      (stats_.state == CircuitState::Closed &&
+       stats_.consecutive_failures >= policy_.breaker.failure_threshold)) {
+    open_circuit();
+    return std::nullopt;
+  }
+
+  if (!is_transient_error(error) || attempt >= policy_.retry.max_attempts) {
+    return std::nullopt;
+  }
+  return backoff(attempt);
+}
+
+void DevicePolicyEngine::open_circuit() {
+  if (stats_.state != CircuitState::Open) {
+    ++stats_.trips;
+  }
+  stats_.state = CircuitState::Open;
+  opened_at_ = Clock::now();
+  probes_in_flight_ = 0;
+}
+
+std::chrono::milliseconds DevicePolicyEngine::backoff(int retry) {
+  const auto &r = policy_.retry;
+  double base = static_cast<double>(r.initial_backoff.count()) *
+                std::pow(std::max(1.0, r.multiplier), retry - 1);
+  base = std::min(base, static_cast<double>(r.max_backoff.count()));
+
+  double jitter = std::clamp(r.jitter, 0.0, 1.0);
+  std::uniform_real_distribution<double> spread(0.0, base * jitter);
+  double delay = base * (1.0 - jitter) + (jitter > 0.0 ? spread(rng_) : 0.0);
+  return std::chrono::milliseconds(static_cast<long long>(delay));
+}
+
+} // namespace duvc
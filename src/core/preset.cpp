@@ -0,0 +1,536 @@
+/**
+ * @file preset.cpp
+ * @brief Preset store and diff-based recall implementation
+ */
+
+#include <duvc-ctl/core/camera.h>
+#include <duvc-ctl/core/device_actor.h>
+#include <duvc-ctl/detail/binary_io.h>
+#include <duvc-ctl/core/preset.h>
+#include <duvc-ctl/utils/logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+
+namespace duvc {
+
+void Preset::set(CamProp prop, const PropSetting &setting) {
+  for (auto &value : values) {
+    if (!value.video && value.cam_prop == prop) {
+      value.setting = setting;
+      return;
+    }
+  }
+  PresetValue value;
+  value.cam_prop = prop;
+  value.setting = setting;
+  values.push_back(value);
+}
+
+void Preset::set(VidProp prop, const PropSetting &setting) {
+  for (auto &value : values) {
+    if (value.video && value.vid_prop == prop) {
+      value.setting = setting;
+      return;
+    }
+  }
+  PresetValue value;
+  value.video = true;
+  value.vid_prop = prop;
+  value.setting = setting;
+  values.push_back(value);
+}
+
+// ============================================================================
+// Binary store format
+// ============================================================================
+
+namespace {
+
+using detail::has_magic;
+using detail::put;
+using detail::put_string;
+using detail::Reader;
+
+// "DUVCPST" + version byte, u32 count, then per preset (little-endian):
+// u16 name_length, name (UTF-8), u32 version, u32 value_count, then per
+// value: u8 domain (0 camera, 1 video), u8 property, u8 mode, i32 value
+
+constexpr char store_magic[] = {'D', 'U', 'V', 'C', 'P', 'S', 'T', 1};
+
+Result<std::vector<Preset>> store_error(const std::string &message) {
+  return Err<std::vector<Preset>>(ErrorCode::InvalidArgument,
+                                  "Invalid preset store: " + message);
+}
+
+} // namespace
+
+std::vector<uint8_t> serialize_presets(const std::vector<Preset> &presets) {
+  std::vector<uint8_t> out(std::begin(store_magic), std::end(store_magic));
+  put(out, presets.size(), 4);
+  for (const auto &preset : presets) {
+    put_string(out, preset.name);
+    put(out, preset.version, 4);
+    put(out, preset.values.size(), 4);
+    for (const auto &value : preset.values) {
+      put(out, value.video ? 1 : 0, 1);
+      put(out,
+          value.video ? static_cast<uint8_t>(value.vid_prop)
+                      : static_cast<uint8_t>(value.cam_prop),
+          1);
+      put(out, static_cast<uint8_t>(value.setting.mode), 1);
+      put(out, static_cast<uint32_t>(value.setting.value), 4);
+    }
+  }
+  return out;
+}
+
+Result<std::vector<Preset>> parse_presets(const std::vector<uint8_t> &data) {
+  if (!has_magic(data, store_magic)) {
+    return store_error("bad header");
+  }
+  Reader reader(data, sizeof(store_magic));
+
+  uint64_t count;
+  if (!reader.get(count, 4)) {
+    return store_error("truncated");
+  }
+  std::vector<Preset> presets;
+  for (uint64_t i = 0; i < count; ++i) {
+    Preset preset;
+    uint64_t version, values;
+    if (!reader.get_string(preset.name) ||
+        !reader.get(version, 4) || !reader.get(values, 4)) {
+      return store_error("truncated preset " + std::to_string(i));
+    }
+    preset.version = static_cast<uint32_t>(version);
+    for (uint64_t j = 0; j < values; ++j) {
+      uint64_t domain, prop, mode, raw;
+      if (!reader.get(domain, 1) || !reader.get(prop, 1) ||
+          !reader.get(mode, 1) || !reader.get(raw, 4)) {
+        return store_error("truncated preset '" + preset.name + "'");
+      }
+      PresetValue value;
+      if (domain == 0 && prop <= static_cast<uint8_t>(CamProp::Lamp)) {
+        value.cam_prop = static_cast<CamProp>(prop);
+      } else if (domain == 1 &&
+                 prop <= static_cast<uint8_t>(VidProp::PowerLineFrequency)) {
+        value.video = true;
+        value.vid_prop = static_cast<VidProp>(prop);
+      } else {
+        return store_error("invalid property in preset '" + preset.name + "'");
+      }
+      if (mode > static_cast<uint8_t>(CamMode::Manual)) {
+        return store_error("invalid mode in preset '" + preset.name + "'");
+      }
+      value.setting = PropSetting(static_cast<int32_t>(static_cast<uint32_t>(raw)),
+                                  static_cast<CamMode>(mode));
+      preset.values.push_back(value);
+    }
+    presets.push_back(std::move(preset));
+  }
+  if (!reader.at_end()) {
+    return store_error("trailing data");
+  }
+  return Ok(std::move(presets));
+}
+
+// ============================================================================
+// Preset store
+// ============================================================================
+
+std::filesystem::path default_preset_path() {
+#ifdef _WIN32
+  if (const wchar_t *appdata = _wgetenv(L"APPDATA")) {
+    return std::filesystem::path(appdata) / L"duvc-ctl" / L"presets.bin";
+  }
+#else
+  if (const char *config = std::getenv("XDG_CONFIG_HOME")) {
+    return std::filesystem::path(config) / "duvc-ctl" / "presets.bin";
+  }
+  if (const char *home = std::getenv("HOME")) {
+    return std::filesystem::path(home) / ".config" / "duvc-ctl" / "presets.bin";
+  }
+#endif
+  return std::filesystem::path("duvc-presets.bin");
+}
+
+PresetStore::PresetStore(std::filesystem::path path) : path_(std::move(path)) {}
+
+Result<void> PresetStore::load() {
+  std::error_code ec;
+  if (!std::filesystem::exists(path_, ec)) {
+    presets_.clear();
+    return Ok();
+  }
+  std::ifstream file(path_, std::ios::binary);
+  if (!file) {
+    return Err<void>(ErrorCode::SystemError,
+                     "Cannot open preset store: " + path_.u8string());
+  }
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+  auto parsed = parse_presets(data);
+  if (!parsed.is_ok()) {
+    return Err<void>(parsed.error().code(), parsed.error().message());
+  }
+  presets_ = std::move(parsed).value();
+  return Ok();
+}
+
+Result<void> PresetStore::save() const {
+  std::error_code ec;
+  if (path_.has_parent_path()) {
+    std::filesystem::create_directories(path_.parent_path(), ec);
+  }
+
+  auto temp = path_;
+  temp += ".tmp";
+  {
+    std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+    auto data = serialize_presets(presets_);
+    file.write(reinterpret_cast<const char *>(data.data()),
+               static_cast<std::streamsize>(data.size()));
+    if (!file.flush()) {
+      return Err<void>(ErrorCode::SystemError,
+                       "Cannot write preset store: " + temp.u8string());
+    }
+  }
+  std::filesystem::rename(temp, path_, ec);
+  if (ec) {
+    std::filesystem::remove(temp, ec);
+    return Err<void>(ErrorCode::SystemError,
+                     "Cannot replace preset store: " + path_.u8string());
+  }
+  return Ok();
+}
+
+const Preset *PresetStore::find(const std::string &name) const {
+  for (const auto &preset : presets_) {
+    if (preset.name == name) {
+      return &preset;
+    }
+  }
+  return nullptr;
+}
+
+const Preset &PresetStore::put(Preset preset) {
+  for (auto &stored : presets_) {
+    if (stored.name == preset.name) {
+      preset.version = stored.version + 1;
+      stored = std::move(preset);
+      return stored;
+    }
+  }
+  preset.version = 1;
+  presets_.push_back(std::move(preset));
+  return presets_.back();
+}
+
+bool PresetStore::remove(const std::string &name) {
+  auto it = std::find_if(presets_.begin(), presets_.end(),
+                         [&](const Preset &p) { return p.name == name; });
+  if (it == presets_.end()) {
+    return false;
+  }
+  presets_.erase(it);
+  return true;
+}
+
+// ============================================================================
+// Compile and recall
+// ============================================================================
+
+namespace {
+
+/// Build a plan; lookup returns the property's capability or nullptr
+template <typename Lookup>
+PresetPlan build_plan(const Preset &preset, Lookup lookup) {
+  PresetPlan plan;
+  plan.name = preset.name;
+  plan.version = preset.version;
+  for (const auto &value : preset.values) {
+    // Relative controls start motion rather than hold a value
+    if (!value.video && is_relative_property(value.cam_prop)) {
+      plan.unsupported.push_back(value);
+      continue;
+    }
+    const PropertyCapability *capability = lookup(value);
+    if (!capability || !capability->supported) {
+      plan.unsupported.push_back(value);
+      continue;
+    }
+    PresetPlan::Step step{value, capability->range};
+    if (value.setting.mode == CamMode::Manual) {
+      int clamped = capability->range.clamp(value.setting.value);
+      if (clamped != value.setting.value) {
+        step.value.setting.value = clamped;
+        ++plan.adjusted;
+      }
+    }
+    plan.steps.push_back(step);
+  }
+
+  // Same ordering as reset_to_defaults(): manual writes settle before any
+  // auto algorithm is switched on
+  std::stable_partition(plan.steps.begin(), plan.steps.end(),
+                        [](const PresetPlan::Step &step) {
+                          return step.value.setting.mode != CamMode::Auto;
+                        });
+  return plan;
+}
+
+/// Check whether a cached value already satisfies a target setting
+bool holds(const PropertyCapability &capability, const PropSetting &target) {
+  return capability.current_valid && capability.current.mode == target.mode &&
+         (target.mode == CamMode::Auto || capability.current.value == target.value);
+}
+
+bool same_values(const std::vector<PresetValue> &a,
+                 const std::vector<PresetValue> &b) {
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                    [](const PresetValue &x, const PresetValue &y) {
+                      return x.video == y.video &&
+                             (x.video ? x.vid_prop == y.vid_prop
+                                      : x.cam_prop == y.cam_prop) &&
+                             x.setting.value == y.setting.value &&
+                             x.setting.mode == y.setting.mode;
+                    });
+}
+
+int slot_key(const PresetValue &value) {
+  return value.video ? 0x100 + static_cast<int>(value.vid_prop)
+                     : static_cast<int>(value.cam_prop);
+}
+
+std::chrono::microseconds since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+}
+
+} // namespace
+
+PresetPlan compile_preset(const Preset &preset,
+                          const DeviceCapabilities &capabilities) {
+  return build_plan(preset, [&](const PresetValue &value) {
+    return value.video ? &capabilities.get_video_capability(value.vid_prop)
+                       : &capabilities.get_camera_capability(value.cam_prop);
+  });
+}
+
+PresetRecaller::PresetRecaller(Camera &camera)
+    : bind_([&camera](const PresetValue &value) {
+        return value.video ? property_access(camera, value.vid_prop)
+                           : property_access(camera, value.cam_prop);
+      }),
+      camera_(&camera) {}
+
+PresetRecaller::PresetRecaller(Camera &camera,
+                               const DeviceCapabilities &capabilities)
+    : PresetRecaller(camera) {
+  PresetValue value;
+  for (int i = 0; i <= static_cast<int>(CamProp::Lamp); ++i) {
+    value.cam_prop = static_cast<CamProp>(i);
+    Slot &s = slot(value);
+    s.capability = capabilities.get_camera_capability(value.cam_prop);
+    s.probed = true;
+    s.writes = camera_writes(value);
+  }
+  value.video = true;
+  for (int i = 0; i <= static_cast<int>(VidProp::PowerLineFrequency); ++i) {
+    value.vid_prop = static_cast<VidProp>(i);
+    Slot &s = slot(value);
+    s.capability = capabilities.get_video_capability(value.vid_prop);
+    s.probed = true;
+    s.writes = camera_writes(value);
+  }
+}
+
+PresetRecaller::PresetRecaller(std::shared_ptr<DeviceActor> actor)
+    : bind_([actor](const PresetValue &value) {
+        return value.video ? property_access(actor, value.vid_prop)
+                           : property_access(actor, value.cam_prop);
+      }) {}
+
+PresetRecaller::Slot &PresetRecaller::slot(const PresetValue &value) {
+  Slot &s = slots_[slot_key(value)];
+  if (!s.access.is_valid()) {
+    s.access = bind_(value);
+  }
+  return s;
+}
+
+uint64_t PresetRecaller::camera_writes(const PresetValue &value) const {
+  if (!camera_) {
+    return 0;
+  }
+  return value.video ? camera_->write_count(value.vid_prop)
+                     : camera_->write_count(value.cam_prop);
+}
+
+PresetPlan PresetRecaller::compile(const Preset &preset) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return compile_locked(preset);
+}
+
+PresetPlan PresetRecaller::compile_locked(const Preset &preset) {
+  // Keyed by content rather than version: versions restart when a name is
+  // removed and re-added, and presets from different stores share names
+  auto cached = plans_.find(preset.name);
+  if (cached != plans_.end() &&
+      same_values(cached->second.source, preset.values)) {
+    PresetPlan plan = cached->second.plan;
+    plan.version = preset.version;
+    return plan;
+  }
+
+  bool transient = false;
+  PropertyCapability unavailable;
+  auto plan = build_plan(preset, [&](const PresetValue &value) {
+    Slot &s = slot(value);
+    if (!s.probed) {
+      auto range = s.access.range();
+      if (!range.is_ok() &&
+          range.error().code() != ErrorCode::PropertyNotSupported) {
+        // Timeouts and busy devices say nothing about support; ask again
+        transient = true;
+        return &unavailable;
+      }
+      s.probed = true;
+      s.capability.supported = range.is_ok();
+      if (range.is_ok()) {
+        s.capability.range = range.value();
+      }
+    }
+    return &s.capability;
+  });
+  if (!transient) {
+    plans_[preset.name] = CachedPlan{preset.values, plan};
+  }
+  return plan;
+}
+
+PresetRecallReport PresetRecaller::recall(const Preset &preset) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto start = std::chrono::steady_clock::now();
+  auto plan = compile_locked(preset);
+  auto compile_time = since(start);
+  auto report = recall_locked(plan);
+  report.compile_time = compile_time;
+  return report;
+}
+
+PresetRecallReport PresetRecaller::recall(const PresetPlan &plan) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return recall_locked(plan);
+}
+
+PresetRecallReport PresetRecaller::recall_locked(const PresetPlan &plan) {
+  PresetRecallReport report;
+  report.unsupported = static_cast<int>(plan.unsupported.size());
+  auto start = std::chrono::steady_clock::now();
+
+  for (const auto &step : plan.steps) {
+    PresetRecallReport::Entry entry;
+    entry.value = step.value;
+    Slot &s = slot(step.value);
+
+    // A write made through the camera since the value was cached makes it
+    // unknown. An unknown value is written rather than read first: the write
+    // costs the same round trip and leaves the cache known either way.
+    uint64_t writes = camera_writes(step.value);
+    if (writes != s.writes) {
+      s.capability.current_valid = false;
+    }
+    if (holds(s.capability, step.value.setting)) {
+      entry.outcome = ResetOutcome::Skipped;
+      ++report.skipped;
+    } else {
+      auto written = s.access.set(step.value.setting);
+      if (written.is_ok()) {
+        entry.outcome = ResetOutcome::Written;
+        s.capability.current = step.value.setting;
+        s.capability.current_valid = true;
+        s.writes = camera_ ? writes + 1 : 0; // count this write as seen
+        ++report.writes;
+      } else {
+        entry.outcome = ResetOutcome::Failed;
+        entry.error = written.error();
+        s.capability.current_valid = false;
+        ++report.failed;
+      }
+    }
+    report.entries.push_back(std::move(entry));
+  }
+
+  report.write_time = since(start);
+  DUVC_LOG_DEBUG("Recalled preset '" + plan.name + "': " +
+                 std::to_string(report.writes) + " written, " +
+                 std::to_string(report.skipped) + " skipped, " +
+                 std::to_string(report.failed) + " failed in " +
+                 std::to_string(report.write_time.count()) + " us");
+  return report;
+}
+
+void PresetRecaller::invalidate() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &entry : slots_) {
+    entry.second.capability.current_valid = false;
+  }
+}
+
+Preset PresetRecaller::capture(const std::string &name,
+                               const ResetFilter &filter) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Preset preset;
+  preset.name = name;
+
+  auto read = [&](const PresetValue &value) {
+    Slot &s = slot(value);
+    if (s.probed && !s.capability.supported) {
+      return;
+    }
+    uint64_t writes = camera_writes(value);
+    auto current = s.access.get();
+    if (!current.is_ok()) {
+      return;
+    }
+    s.capability.current = current.value();
+    s.capability.current_valid = true;
+    s.writes = writes;
+    PresetValue captured = value;
+    captured.setting = current.value();
+    preset.values.push_back(captured);
+  };
+
+  PresetValue value;
+  if (filter.camera) {
+    for (int i = 0; i <= static_cast<int>(CamProp::Lamp); ++i) {
+      value.cam_prop = static_cast<CamProp>(i);
+      bool wanted = filter.camera_props.empty() ||
+                    std::find(filter.camera_props.begin(),
+                              filter.camera_props.end(),
+                              value.cam_prop) != filter.camera_props.end();
+      if (wanted && !is_relative_property(value.cam_prop)) {
+        read(value);
+      }
+    }
+  }
+  if (filter.video) {
+    value.video = true;
+    for (int i = 0; i <= static_cast<int>(VidProp::PowerLineFrequency); ++i) {
+      value.vid_prop = static_cast<VidProp>(i);
+      if (filter.video_props.empty() ||
+          std::find(filter.video_props.begin(), filter.video_props.end(),
+                    value.vid_prop) != filter.video_props.end()) {
+        read(value);
+      }
+    }
+  }
+  return preset;
+}
+
+} // namespace duvc
@@ -0,0 +1,58 @@
+/**
+ * @file property_access.cpp
+ * @brief Property access bindings for cameras and device actors
+ */
+
+#include <duvc-ctl/core/camera.h>
+#include <duvc-ctl/core/device_actor.h>
+#include <duvc-ctl/core/property_access.h>
+
+namespace duvc {
+
+namespace {
+
+template <typename Prop>
+PropertyAccess bind_camera(Camera &camera, Prop prop) {
+  Camera *cam = &camera;
+  PropertyAccess access;
+  access.get = [cam, prop] { return cam->get(prop); };
+  access.set = [cam, prop](const PropSetting &s) { return cam->set(prop, s); };
+  access.range = [cam, prop] { return cam->get_range(prop); };
+  return access;
+}
+
+template <typename Prop>
+PropertyAccess bind_actor(std::shared_ptr<DeviceActor> actor, Prop prop) {
+  PropertyAccess access;
+  if (!actor) {
+    return access;
+  }
+  access.get = [actor, prop] { return actor->get(prop); };
+  access.set = [actor, prop](const PropSetting &s) {
+    return actor->set(prop, s);
+  };
+  access.range = [actor, prop] { return actor->get_range(prop); };
+  return access;
+}
+
+} // namespace
+
+PropertyAccess property_access(Camera &camera, CamProp prop) {
+  return bind_camera(camera, prop);
+}
+
+PropertyAccess property_access(Camera &camera, VidProp prop) {
+  return bind_camera(camera, prop);
+}
+
+PropertyAccess property_access(std::shared_ptr<DeviceActor> actor,
+                               CamProp prop) {
+  return bind_actor(std::move(actor), prop);
+}
+
+PropertyAccess property_access(std::shared_ptr<DeviceActor> actor,
+                               VidProp prop) {
+  return bind_actor(std::move(actor), prop);
+}
+
+} // namespace duvc
@@ -0,0 +1,560 @@
+/**
+ * @file reconciler.cpp
+ * @brief Desired-state reconciliation implementation
+ */
+
+#include <duvc-ctl/core/device.h>
+#include <duvc-ctl/core/device_actor.h>
+#include <duvc-ctl/core/reconciler.h>
+#include <duvc-ctl/detail/json_fields.h>
+#include <duvc-ctl/platform/interface.h>
+#include <duvc-ctl/utils/json.h>
+#include <duvc-ctl/utils/logging.h>
+#include <duvc-ctl/utils/string_conversion.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cwctype>
+#include <fstream>
+#include <iterator>
+#include <set>
+
+namespace duvc {
+
+namespace {
+
+using detail::is_integer;
+
+wchar_t fold(wchar_t c) { return static_cast<wchar_t>(std::towlower(c)); }
+
+bool equals_ignore_case(const std::wstring &a, const std::wstring &b) {
+  return a.size() == b.size() &&
+         std::equal(a.begin(), a.end(), b.begin(),
+                    [](wchar_t x, wchar_t y) { return fold(x) == fold(y); });
+}
+
+/// Key of a device's held actor; paths are case-insensitive
+std::wstring actor_key(const Device &device) {
+  std::wstring key = device.path.empty() ? device.name : device.path;
+  std::transform(key.begin(), key.end(), key.begin(), fold);
+  return key;
+}
+
+/// Case-insensitive match with * (any run) and ? (any one character)
+bool wildcard_match(const std::wstring &pattern, const std::wstring &text) {
+  size_t p = 0, t = 0;
+  size_t star = std::wstring::npos, resume = 0;
+  while (t < text.size()) {
+    if (p < pattern.size() &&
+        (pattern[p] == L'?' || fold(pattern[p]) == fold(text[t]))) {
+      ++p;
+      ++t;
+    } else if (p < pattern.size() && pattern[p] == L'*') {
+      star = p++;
+      resume = t;
+    } else if (star != std::wstring::npos) {
+      p = star + 1;
+      t = ++resume;
+    } else {
+      return false;
+    }
+  }
+  while (p < pattern.size() && pattern[p] == L'*') {
+    ++p;
+  }
+  return p == pattern.size();
+}
+
+bool same_property(const PresetValue &a, const PresetValue &b) {
+  return a.video == b.video &&
+         (a.video ? a.vid_prop == b.vid_prop : a.cam_prop == b.cam_prop);
+}
+
+std::string describe(const PresetValue &value) {
+  return value.video ? to_string(value.vid_prop) : to_string(value.cam_prop);
+}
+
+// ============================================================================
+// JSON desired-state format
+// ============================================================================
+
+Result<DesiredState> state_error(const std::string &where,
+                                 const std::string &message) {
+  return Err<DesiredState>(ErrorCode::InvalidArgument, where + ": " + message);
+}
+
+/// Resolve a property name into a value slot for it
+std::optional<PresetValue> resolve_property(const std::string &key,
+                                            std::string &error) {
+  auto property = detail::resolve_property(key, error);
+  if (!property) {
+    return std::nullopt;
+  }
+  PresetValue value;
+  value.video = property->video;
+  value.cam_prop = property->cam_prop;
+  value.vid_prop = property->vid_prop;
+  return value;
+}
+
+/// Parse a property value: integer, "auto", or {"value", "mode"}
+bool parse_setting(const JsonValue &json, PropSetting &setting) {
+  if (is_integer(json)) {
+    setting = PropSetting(static_cast<int>(json.as_number()), CamMode::Manual);
+    return true;
+  }
+  if (json.is_string()) {
+    std::string s = json.as_string();
+    std::transform(s.begin(), s.end(), s.begin(),
+                   [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+    if (s == "auto") {
+      setting = PropSetting(0, CamMode::Auto);
+      return true;
+    }
+    return false;
+  }
+  if (!json.is_object()) {
+    return false;
+  }
+  setting = PropSetting(0, CamMode::Manual);
+  if (const JsonValue *mode = json.find("mode")) {
+    if (!mode->is_string()) {
+      return false;
+    }
+    if (mode->as_string() == "auto") {
+      setting.mode = CamMode::Auto;
+    } else if (mode->as_string() != "manual") {
+      return false;
+    }
+  }
+  const JsonValue *value = json.find("value");
+  if (value) {
+    if (!is_integer(*value)) {
+      return false;
+    }
+    setting.value = static_cast<int>(value->as_number());
+  }
+  return value || setting.mode == CamMode::Auto;
+}
+
+} // namespace
+
+bool DeviceSelector::matches(const Device &device) const {
+  if (!path.empty()) {
+    return equals_ignore_case(path, device.path);
+  }
+  return !name.empty() && wildcard_match(name, device.name);
+}
+
+std::vector<PresetValue> DesiredState::desired_for(const Device &device) const {
+  std::vector<PresetValue> merged;
+  for (const auto &entry : devices) {
+    if (!entry.selector.matches(device)) {
+      continue;
+    }
+    for (const auto &value : entry.properties) {
+      auto existing = std::find_if(merged.begin(), merged.end(),
+                                   [&](const PresetValue &v) {
+                                     return same_property(v, value);
+                                   });
+      if (existing != merged.end()) {
+        *existing = value;
+      } else {
+        merged.push_back(value);
+      }
+    }
+  }
+  return merged;
+}
+
+Result<DesiredState> parse_desired_state(const std::string &text) {
+  auto document = parse_json(text);
+  if (!document.is_ok()) {
+    return Result<DesiredState>(document.error());
+  }
+  const JsonValue &root = document.value();
+  if (!root.is_object()) {
+    return state_error("Desired state", "expected an object");
+  }
+
+  DesiredState state;
+  if (const JsonValue *interval = root.find("interval")) {
+    if (!interval->is_number() || !(interval->as_number() > 0) ||
+        !std::isfinite(interval->as_number())) {
+      return state_error("\"interval\"", "must be a positive number of seconds");
+    }
+    state.interval = std::chrono::milliseconds(
+        std::max<long long>(1, std::llround(interval->as_number() * 1000.0)));
+  }
+  if (const JsonValue *rate = root.find("rate")) {
+    if (!rate->is_number() || !(rate->as_number() > 0) ||
+        !std::isfinite(rate->as_number())) {
+      return state_error("\"rate\"", "must be a positive number");
+    }
+    state.max_ops_per_second = rate->as_number();
+  }
+  if (const JsonValue *timeout = root.find("timeout")) {
+    if (!timeout->is_number() || !(timeout->as_number() > 0) ||
+        !std::isfinite(timeout->as_number())) {
+      return state_error("\"timeout\"", "must be a positive number of seconds");
+    }
+    state.timeout = std::chrono::milliseconds(std::max<long long>(
+        1, std::llround(std::min(timeout->as_number(), 86400.0) * 1000.0)));
+  }
+  if (const JsonValue *tolerance = root.find("tolerance")) {
+    if (!is_integer(*tolerance) || tolerance->as_number() < 0) {
+      return state_error("\"tolerance\"", "must be a non-negative integer");
+    }
+    state.tolerance = static_cast<int>(tolerance->as_number());
+  }
+
+  const JsonValue *devices = root.find("devices");
+  if (!devices || !devices->is_array()) {
+    return state_error("Desired state", "\"devices\" array is required");
+  }
+  const auto &entries = devices->as_array();
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const JsonValue &entry = entries[i];
+    std::string where = "Device " + std::to_string(i);
+    if (!entry.is_object()) {
+      return state_error(where, "expected an object");
+    }
+
+    DesiredDeviceState desired;
+    const JsonValue *path = entry.find("path");
+    const JsonValue *name = entry.find("name");
+    if (path && path->is_string() && !path->as_string().empty()) {
+      desired.selector.path = to_wstring(path->as_string());
+    } else if (name && name->is_string() && !name->as_string().empty()) {
+      desired.selector.name = to_wstring(name->as_string());
+    } else {
+      return state_error(where, "\"path\" or \"name\" is required");
+    }
+
+    const JsonValue *properties = entry.find("properties");
+    if (!properties || !properties->is_object()) {
+      return state_error(where, "\"properties\" object is required");
+    }
+    for (const auto &member : properties->as_object()) {
+      std::string error;
+      auto value = resolve_property(member.first, error);
+      if (!value) {
+        return state_error(where, error);
+      }
+      if (!parse_setting(member.second, value->setting)) {
+        return state_error(where, "\"" + member.first +
+                                      "\" must be an integer, \"auto\", or "
+                                      "{\"value\", \"mode\"}");
+      }
+      desired.properties.push_back(*value);
+    }
+    state.devices.push_back(std::move(desired));
+  }
+  return Ok(std::move(state));
+}
+
+Result<DesiredState> load_desired_state(const std::filesystem::path &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return Err<DesiredState>(ErrorCode::InvalidArgument,
+                             "Cannot open desired state: " + path.u8string());
+  }
+  std::string text((std::istreambuf_iterator<char>(file)),
+                   std::istreambuf_iterator<char>());
+  return parse_desired_state(text);
+}
+
+// ============================================================================
+// Reconciler
+// ============================================================================
+
+Reconciler::Reconciler(DesiredState state, DeviceSource devices,
+                       ActorSource actors)
+    : devices_(devices ? std::move(devices) : [] { return list_devices(); }),
+      actors_(actors ? std::move(actors) : acquire_device_actor),
+      state_(std::move(state)) {}
+
+Reconciler::~Reconciler() { stop(); }
+
+void Reconciler::set_desired_state(DesiredState state) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  state_ = std::move(state);
+}
+
+DesiredState Reconciler::desired_state() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return state_;
+}
+
+bool Reconciler::wait_until(Clock::time_point when) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait_until(lock, when, [&] { return stopping_; });
+  return !stopping_;
+}
+
+bool Reconciler::pace(size_t ops) {
+  Clock::time_point slot;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto per_op = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / std::max(state_.max_ops_per_second, 1e-3)));
+    slot = std::max(Clock::now(), next_op_);
+    next_op_ = slot + per_op * static_cast<Clock::duration::rep>(ops);
+  }
+  return wait_until(slot);
+}
+
+bool Reconciler::reconcile_device(const Device &device, SweepReport &report,
+                                  const DriftCallback &on_drift) {
+  std::vector<PresetValue> desired;
+  int tolerance;
+  std::chrono::milliseconds timeout;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    desired = state_.desired_for(device);
+    tolerance = state_.tolerance;
+    timeout = state_.timeout;
+  }
+  if (desired.empty()) {
+    return true;
+  }
+  ++report.devices;
+
+  auto actor = actor_for(device);
+  if (!actor) {
+    ++report.failures;
+    return true;
+  }
+
+  // One actor hop reads every desired property of the device
+  if (!pace(desired.size())) {
+    return false;
+  }
+  // The task owns its copy: after a timeout it may still run on the actor
+  // thread once this function has returned
+  using Reads = std::vector<Result<PropSetting>>;
+  auto read = actor->call<Reads>(
+      [desired](IDeviceConnection &connection) {
+        Reads reads;
+        reads.reserve(desired.size());
+        for (const auto &value : desired) {
+          reads.push_back(value.video
+                               ? connection.get_video_property(value.vid_prop)
+                               : connection.get_camera_property(value.cam_prop));
+        }
+        return Ok(std::move(reads));
+      },
+      timeout);
+  if (!read.is_ok()) {
+    DUVC_LOG_DEBUG("Reconcile: cannot reach " + to_utf8(device.name) + ": " +
+                   read.error().description());
+    ++report.failures;
+    return true;
+  }
+  const Reads &actual = read.value();
+  report.reads += desired.size();
+
+  for (size_t i = 0; i < desired.size(); ++i) {
+    const PresetValue &want = desired[i];
+    const Result<PropSetting> &got = actual[i];
+    auto detected = Clock::now();
+
+    DriftEvent event;
+    if (got.is_ok()) {
+      const PropSetting &have = got.value();
+      bool in_place = have.mode == want.setting.mode &&
+                      (want.setting.mode == CamMode::Auto ||
+                       std::abs(have.value - want.setting.value) <= tolerance);
+      if (in_place) {
+        continue;
+      }
+      event.actual = have;
+    } else if (got.error().code() == ErrorCode::PropertyNotSupported) {
+      continue; // Nothing to hold on this device
+    } else {
+      // Unknown state counts as drift; writing restores it either way
+      event.error = got.error();
+    }
+
+    event.device = device;
+    event.desired = want;
+    ++report.drifted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!drift_since_) {
+        drift_since_ = detected;
+      }
+    }
+
+    if (!pace(1)) {
+      return false;
+    }
+    auto written = want.video ? actor->set(want.vid_prop, want.setting, timeout)
+                              : actor->set(want.cam_prop, want.setting, timeout);
+    event.latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - detected);
+    if (written.is_ok()) {
+      event.corrected = true;
+      event.error.reset();
+      ++report.writes;
+    } else {
+      event.error = written.error();
+      ++report.failures;
+    }
+    DUVC_LOG_DEBUG("Reconcile: " + to_utf8(device.name) + " " +
+                   describe(want) + (event.corrected ? " corrected" : " failed"));
+    if (on_drift) {
+      on_drift(event);
+    }
+    report.events.push_back(std::move(event));
+  }
+  return true;
+}
+
+void Reconciler::finish_sweep(SweepReport &report, Clock::time_point start) {
+  auto end = Clock::now();
+  report.duration =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+  report.converged =
+      report.failures == 0 &&
+      std::all_of(report.events.begin(), report.events.end(),
+                  [](const DriftEvent &e) { return e.corrected; });
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++stats_.sweeps;
+  stats_.reads += report.reads;
+  stats_.writes += report.writes;
+  stats_.drift_events += report.drifted;
+  stats_.failures += report.failures;
+  stats_.converged = report.converged;
+  if (report.converged && drift_since_) {
+    stats_.last_convergence_time =
+        std::chrono::duration_cast<std::chrono::microseconds>(end - *drift_since_);
+    drift_since_.reset();
+  }
+}
+
+std::shared_ptr<DeviceActor> Reconciler::actor_for(const Device &device) {
+  std::wstring key = actor_key(device);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto held = held_actors_.find(key);
+    if (held != held_actors_.end()) {
+      return held->second;
+    }
+  }
+  auto actor = actors_(device);
+  if (actor) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    held_actors_.emplace(key, actor);
+  }
+  return actor;
+}
+
+void Reconciler::retain_actors(const std::vector<Device> &devices) {
+  std::set<std::wstring> keys;
+  for (const auto &device : devices) {
+    keys.insert(actor_key(device));
+  }
+  std::vector<std::shared_ptr<DeviceActor>> released;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = held_actors_.begin(); it != held_actors_.end();) {
+      if (keys.count(it->first)) {
+        ++it;
+      } else {
+        released.push_back(std::move(it->second));
+        it = held_actors_.erase(it);
+      }
+    }
+  }
+  // Actors are stopped outside the lock
+}
+
+SweepReport Reconciler::sweep(DriftCallback on_drift) {
+  SweepReport report;
+  auto start = Clock::now();
+  auto devices = devices_();
+  retain_actors(devices);
+  for (const auto &device : devices) {
+    if (!reconcile_device(device, report, on_drift)) {
+      break;
+    }
+  }
+  finish_sweep(report, start);
+  return report;
+}
+
+bool Reconciler::start(DriftCallback on_drift, SweepCallback on_sweep) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (running_) {
+    return false;
+  }
+  running_ = true;
+  stopping_ = false;
+  thread_ = std::thread(&Reconciler::run, this, std::move(on_drift),
+                        std::move(on_sweep));
+  return true;
+}
+
+void Reconciler::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+      return;
+    }
+    stopping_ = true;
+  }
+  cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  running_ = false;
+  stopping_ = false;
+}
+
+bool Reconciler::running() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return running_;
+}
+
+ReconcilerStats Reconciler::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+void Reconciler::run(DriftCallback on_drift, SweepCallback on_sweep) {
+  auto sweep_start = Clock::now();
+  while (true) {
+    auto interval = desired_state().interval;
+    auto devices = devices_();
+    retain_actors(devices);
+
+    // Device i starts at i/N of the interval, so I/O is spread evenly
+    SweepReport report;
+    bool stopped = false;
+    for (size_t i = 0; i < devices.size() && !stopped; ++i) {
+      auto offset = interval * static_cast<long long>(i) /
+                    static_cast<long long>(devices.size());
+      stopped = !wait_until(sweep_start + offset) ||
+                !reconcile_device(devices[i], report, on_drift);
+    }
+    if (stopped) {
+      return;
+    }
+    finish_sweep(report, sweep_start);
+    if (on_sweep) {
+      on_sweep(report);
+    }
+
+    // Keep the period fixed; a sweep that overran starts the next one now
+    sweep_start = std::max(sweep_start + interval, Clock::now());
+    if (!wait_until(sweep_start)) {
+      return;
+    }
+  }
+}
+
+} // namespace duvc
@@ -0,0 +1,73 @@
+/**
+ * @file scheduler.cpp
+ * @brief Shared timer thread implementation
+ */
+
+#include <duvc-ctl/core/scheduler.h>
+#include <duvc-ctl/utils/logging.h>
+
+namespace duvc {
+
+TaskScheduler::TaskScheduler() : thread_([this] { run(); }) {}
+
+TaskScheduler::~TaskScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+}
+
+void TaskScheduler::schedule(Clock::time_point when, Task task) {
+  bool earliest;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    earliest = queue_.empty() || when < queue_.top().when;
+    queue_.push(Entry{when, sequence_++, std::move(task)});
+  }
+  if (earliest) {
+    cv_.notify_one();
+  }
+}
+
+size_t TaskScheduler::pending() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queue_.size();
+}
+
+TaskScheduler &TaskScheduler::shared() {
+  static TaskScheduler scheduler;
+  return scheduler;
+}
+
+void TaskScheduler::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stop_) {
+    if (queue_.empty()) {
+      cv_.wait(lock);
+      continue;
+    }
+    auto when = queue_.top().when;
+    if (when > Clock::now()) {
+      cv_.wait_until(lock, when);
+      continue;
+    }
+
+    // priority_queue::top() is const; the entry is popped right after
+    Task task = std::move(const_cast<Entry &>(queue_.top()).task);
+    queue_.pop();
+    lock.unlock();
+    try {
+      task();
+    } catch (const std::exception &e) {
+      DUVC_LOG_ERROR(std::string("Scheduled task threw: ") + e.what());
+    } catch (...) {
+      DUVC_LOG_ERROR("Scheduled task threw unknown exception");
+    }
+    task = nullptr; // release captures outside the lock
+    lock.lock();
+  }
+}
+
+} // namespace duvc
@@ -0,0 +1,310 @@
+/**
+ * @file search.cpp
+ * @brief Score-driven property search implementation
+ */
+
+#include <duvc-ctl/core/search.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <future>
+#include <map>
+#include <thread>
+
+namespace duvc {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// One search run; positions are handled as indices on the step grid
+class Searcher {
+public:
+  Searcher(const PropertyAccess &target, const ProbeFunction &probe,
+           const SearchOptions &options)
+      : target_(target), probe_(probe), options_(options) {}
+
+  Result<SearchResult> run();
+
+private:
+  int value_at(int index) const { return lo_ + index * step_; }
+  bool budget_left() const {
+    return result_.evaluations < options_.max_evaluations;
+  }
+  bool scored(int index) const { return scores_.count(index) != 0; }
+  bool better(double a, double b) const;
+  int best_index() const;
+
+  Result<void> move_to(int index);
+  Result<void> sweep(std::vector<int> indices);
+  Result<void> evaluate(int index);
+  void record(int index, double score);
+
+  Result<void> coarse_to_fine();
+  Result<void> golden_section();
+
+  const PropertyAccess &target_;
+  const ProbeFunction &probe_;
+  const SearchOptions &options_;
+
+  int lo_ = 0;
+  int step_ = 1;
+  int last_ = 0; ///< Highest grid index
+  std::optional<int> position_;
+  std::map<int, double> scores_;
+  SearchResult result_;
+};
+
+bool Searcher::better(double a, double b) const {
+  if (std::isnan(b)) {
+    return !std::isnan(a);
+  }
+  if (std::isnan(a)) {
+    return false;
+  }
+  return options_.maximize ? a > b : a < b;
+}
+
+int Searcher::best_index() const {
+  auto best = scores_.begin();
+  for (auto it = scores_.begin(); it != scores_.end(); ++it) {
+    if (better(it->second, best->second)) {
+      best = it;
+    }
+  }
+  return best->first;
+}
+
+Result<void> Searcher::move_to(int index) {
+  if (position_ == index) {
+    return Ok();
+  }
+  auto result = target_.set(PropSetting(value_at(index), CamMode::Manual));
+  ++result_.writes;
+  if (!result.is_ok()) {
+    position_.reset();
+    return result;
+  }
+  position_ = index;
+  if (options_.settle.count() > 0) {
+    std::this_thread::sleep_for(options_.settle);
+  }
+  return Ok();
+}
+
+void Searcher::record(int index, double score) {
+  scores_[index] = score;
+  ++result_.evaluations;
+  result_.samples.emplace_back(value_at(index), score);
+}
+
+Result<void> Searcher::evaluate(int index) {
+  if (scored(index)) {
+    return Ok();
+  }
+  auto moved = move_to(index);
+  if (!moved.is_ok()) {
+    return moved;
+  }
+  DeferredScore score = probe_(value_at(index));
+  record(index, score ? score() : std::nan(""));
+  return Ok();
+}
+
+Result<void> Searcher::sweep(std::vector<int> indices) {
+  indices.erase(std::remove_if(indices.begin(), indices.end(),
+                               [this](int i) { return scored(i); }),
+                indices.end());
+  auto budget = static_cast<size_t>(options_.max_evaluations - result_.evaluations);
+  if (indices.size() > budget) {
+    indices.resize(budget);
+  }
+  if (indices.empty()) {
+    return Ok();
+  }
+
+  auto moved = move_to(indices.front());
+  if (!moved.is_ok()) {
+    return moved;
+  }
+  for (size_t i = 0; i < indices.size(); ++i) {
+    DeferredScore score = probe_(value_at(indices[i]));
+
+    // Move on while this position is scored; only one write is in flight
+    std::future<Result<void>> next;
+    if (i + 1 < indices.size()) {
+      int index = indices[i + 1];
+      next = std::async(std::launch::async, [this, index] { return move_to(index); });
+    }
+    double value = score ? score() : std::nan("");
+    record(indices[i], value);
+
+    if (next.valid()) {
+      auto result = next.get();
+      if (!result.is_ok()) {
+        return result;
+      }
+    }
+  }
+  return Ok();
+}
+
+Result<void> Searcher::coarse_to_fine() {
+  int points = options_.points_per_pass;
+  int a = 0;
+  int b = last_;
+  for (;;) {
+    std::vector<int> candidates;
+    bool final_pass = b - a + 1 <= points;
+    if (final_pass) {
+      for (int i = a; i <= b; ++i) {
+        candidates.push_back(i);
+      }
+    } else {
+      for (int k = 0; k < points; ++k) {
+        int i = a + static_cast<int>(std::lround(
+                        static_cast<double>(k) * (b - a) / (points - 1)));
+        if (candidates.empty() || candidates.back() != i) {
+          candidates.push_back(i);
+        }
+      }
+    }
+
+    // Start from the end nearest the current position
+    if (position_ && std::abs(*position_ - b) < std::abs(*position_ - a)) {
+      std::reverse(candidates.begin(), candidates.end());
+    }
+    auto swept = sweep(std::move(candidates));
+    if (!swept.is_ok()) {
+      return swept;
+    }
+    if (final_pass || !budget_left()) {
+      return Ok();
+    }
+
+    // Narrow to the interior between the best sample's neighbours
+    int spacing = (b - a + points - 2) / (points - 1);
+    int best = best_index();
+    a = std::max(0, best - spacing + 1);
+    b = std::min(last_, best + spacing - 1);
+  }
+}
+
+Result<void> Searcher::golden_section() {
+  const double inv_phi = (std::sqrt(5.0) - 1.0) / 2.0;
+  int a = 0;
+  int b = last_;
+  while (b - a > 3 && budget_left()) {
+    int width = b - a;
+    int c = a + static_cast<int>(std::lround(width * (1.0 - inv_phi)));
+    int d = a + static_cast<int>(std::lround(width * inv_phi));
+    if (d <= c) {
+      d = c + 1;
+    }
+
+    // Earlier samples are reused from the cache
+    auto evaluated = evaluate(c);
+    if (evaluated.is_ok() && budget_left()) {
+      evaluated = evaluate(d);
+    }
+    if (!evaluated.is_ok()) {
+      return evaluated;
+    }
+    if (!scored(d)) {
+      break; // out of budget
+    }
+    if (better(scores_[c], scores_[d])) {
+      b = d;
+    } else {
+      a = c;
+    }
+  }
+
+  std::vector<int> remaining;
+  for (int i = a; i <= b; ++i) {
+    remaining.push_back(i);
+  }
+  return sweep(std::move(remaining));
+}
+
+Result<SearchResult> Searcher::run() {
+  auto start = Clock::now();
+
+  if (!target_.is_valid() || !probe_) {
+    return Err<SearchResult>(ErrorCode::InvalidArgument,
+                             "Search needs a bound property and a probe");
+  }
+  if (options_.points_per_pass < 3 || options_.max_evaluations < 1) {
+    return Err<SearchResult>(
+        ErrorCode::InvalidArgument,
+        "points_per_pass must be >= 3 and max_evaluations >= 1");
+  }
+
+  auto range = target_.range();
+  if (!range.is_ok()) {
+    return Result<SearchResult>(range.error());
+  }
+  const PropRange &r = range.value();
+  int lo = r.clamp(options_.lower.value_or(r.min));
+  int hi = r.clamp(options_.upper.value_or(r.max));
+  if (lo > hi) {
+    return Err<SearchResult>(ErrorCode::InvalidArgument,
+                             "Search bounds are empty");
+  }
+  lo_ = lo;
+  step_ = std::max(1, r.step);
+  last_ = (hi - lo) / step_;
+
+  auto current = target_.get();
+  if (current.is_ok()) {
+    int offset = current.value().value - lo_;
+    if (offset >= 0 && offset % step_ == 0 && offset / step_ <= last_) {
+      position_ = offset / step_;
+    }
+  }
+
+  auto searched = options_.method == SearchMethod::GoldenSection
+                      ? golden_section()
+                      : coarse_to_fine();
+  if (!searched.is_ok()) {
+    return Result<SearchResult>(searched.error());
+  }
+
+  int best = best_index();
+  result_.best_value = value_at(best);
+  result_.best_score = scores_[best];
+  if (options_.apply_best) {
+    auto applied = move_to(best);
+    if (!applied.is_ok()) {
+      return Result<SearchResult>(applied.error());
+    }
+  }
+  result_.elapsed =
+      std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+  return Ok(std::move(result_));
+}
+
+} // namespace
+
+Result<SearchResult> search_property(const PropertyAccess &target,
+                                     const ProbeFunction &probe,
+                                     const SearchOptions &options) {
+  return Searcher(target, probe, options).run();
+}
+
+Result<SearchResult> search_property(const PropertyAccess &target,
+                                     const ScoreFunction &score,
+                                     const SearchOptions &options) {
+  if (!score) {
+    return Err<SearchResult>(ErrorCode::InvalidArgument,
+                             "Search needs a score function");
+  }
+  ProbeFunction probe = [&score](int value) -> DeferredScore {
+    double s = score(value);
+    return [s] { return s; };
+  };
+  return Searcher(target, probe, options).run();
+}
+
+} // namespace duvc
@@ -0,0 +1,234 @@
+/**
+ * @file settle.cpp
+ * @brief Settle wait implementation
+ */
+
+#include <duvc-ctl/core/device_actor.h>
+#include <duvc-ctl/core/policy.h>
+#include <duvc-ctl/core/settle.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <type_traits>
+
+namespace duvc {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Done = std::function<void(Result<SettleResult>)>;
+
+/// One settle wait; kept alive by whichever poll or read is outstanding
+class SettleWait : public std::enable_shared_from_this<SettleWait> {
+public:
+  SettleWait(AsyncPropertyRead read, int target, const SettleOptions &options,
+             Done done, TaskScheduler &scheduler)
+      : read_(std::move(read)), target_(target), options_(options),
+        done_(std::move(done)), scheduler_(scheduler), start_(Clock::now()),
+        last_change_(start_), interval_(options.initial_interval) {}
+
+  void start() {
+    // Watchdog for a read that never completes (hung device); the grace
+    // period lets a final on-time poll report first
+    std::weak_ptr<SettleWait> weak = shared_from_this();
+    scheduler_.schedule(start_ + options_.deadline + options_.max_interval,
+                        [weak] {
+                          if (auto self = weak.lock()) {
+                            self->expire();
+                          }
+                        });
+    poll();
+  }
+
+private:
+  void poll() {
+    if (finished_.load()) {
+      return;
+    }
+    auto self = shared_from_this();
+    try {
+      read_([self](Result<PropSetting> value) { self->on_read(std::move(value)); });
+    } catch (const std::exception &e) {
+      finish(Err<SettleResult>(ErrorCode::SystemError, e.what()));
+    }
+  }
+
+  void on_read(Result<PropSetting> value) {
+    if (finished_.load()) {
+      return;
+    }
+    auto now = Clock::now();
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++result_.polls;
+
+    if (value.is_ok()) {
+      const PropSetting &setting = value.value();
+      if (!have_value_ || setting.value != result_.achieved.value) {
+        last_change_ = now;
+      }
+      have_value_ = true;
+      result_.achieved = setting;
+
+      if (std::abs(setting.value - target_) <= options_.tolerance) {
+        lock.unlock();
+        finish_with(SettleStatus::Converged, now);
+        return;
+      }
+      if (options_.stall_timeout.count() > 0 &&
+          now - last_change_ >= options_.stall_timeout) {
+        lock.unlock();
+        finish_with(SettleStatus::Stalled, now);
+        return;
+      }
+    } else if (!is_transient_error(value.error())) {
+      lock.unlock();
+      finish(Result<SettleResult>(value.error()));
+      return;
+    }
+
+    auto deadline = start_ + options_.deadline;
+    if (now >= deadline) {
+      lock.unlock();
+      finish_with(SettleStatus::TimedOut, now);
+      return;
+    }
+
+    auto delay = interval_;
+    interval_ = std::min(
+        options_.max_interval,
+        std::chrono::milliseconds(static_cast<long long>(
+            static_cast<double>(interval_.count()) * std::max(1.0, options_.backoff) + 0.5)));
+    lock.unlock();
+
+    auto self = shared_from_this();
+    scheduler_.schedule(std::min(now + delay, deadline), [self] { self->poll(); });
+  }
+
+  void expire() {
+    if (!finished_.load()) {
+      finish_with(SettleStatus::TimedOut, Clock::now());
+    }
+  }
+
+  void finish_with(SettleStatus status, Clock::time_point now) {
+    SettleResult result;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      result = result_;
+    }
+    result.status = status;
+    result.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - start_);
+    finish(Ok(std::move(result)));
+  }
+
+  void finish(Result<SettleResult> result) {
+    if (finished_.exchange(true)) {
+      return;
+    }
+    done_(std::move(result));
+  }
+
+  AsyncPropertyRead read_;
+  int target_;
+  SettleOptions options_;
+  Done done_;
+  TaskScheduler &scheduler_;
+  Clock::time_point start_;
+
+  std::atomic<bool> finished_{false};
+  std::mutex mutex_;
+  Clock::time_point last_change_;
+  std::chrono::milliseconds interval_;
+  bool have_value_ = false;
+  SettleResult result_;
+};
+
+template <typename Prop>
+AsyncPropertyRead bind_read(std::shared_ptr<DeviceActor> actor, Prop prop,
+                            std::chrono::milliseconds timeout) {
+  return [actor, prop, timeout](std::function<void(Result<PropSetting>)> done) {
+    auto deadline = timeout.count() > 0 ? Clock::now() + timeout
+                                        : DeviceActor::no_deadline();
+    actor->post(
+        [prop, done](const Result<IDeviceConnection *> &connection) {
+          if (!connection.is_ok()) {
+            done(Result<PropSetting>(connection.error()));
+            return;
+          }
+          if constexpr (std::is_same_v<Prop, CamProp>) {
+            done(connection.value()->get_camera_property(prop));
+          } else {
+            done(connection.value()->get_video_property(prop));
+          }
+        },
+        deadline);
+  };
+}
+
+} // namespace
+
+AsyncPropertyRead async_property_read(std::shared_ptr<DeviceActor> actor,
+                                      CamProp prop,
+                                      std::chrono::milliseconds timeout) {
+  return bind_read(std::move(actor), prop, timeout);
+}
+
+AsyncPropertyRead async_property_read(std::shared_ptr<DeviceActor> actor,
+                                      VidProp prop,
+                                      std::chrono::milliseconds timeout) {
+  return bind_read(std::move(actor), prop, timeout);
+}
+
+void wait_for_settle(AsyncPropertyRead read, int target,
+                     const SettleOptions &options, Done done,
+                     TaskScheduler &scheduler) {
+  if (!read || !done) {
+    if (done) {
+      done(Err<SettleResult>(ErrorCode::InvalidArgument,
+                             "Settle wait needs a property read"));
+    }
+    return;
+  }
+  if (options.tolerance < 0 || options.deadline.count() < 0 ||
+      options.initial_interval.count() <= 0 ||
+      options.max_interval < options.initial_interval) {
+    done(Err<SettleResult>(ErrorCode::InvalidArgument,
+                           "Invalid settle options"));
+    return;
+  }
+  std::make_shared<SettleWait>(std::move(read), target, options,
+                               std::move(done), scheduler)
+      ->start();
+}
+
+std::future<Result<SettleResult>> wait_for_settle(AsyncPropertyRead read,
+                                                  int target,
+                                                  const SettleOptions &options,
+                                                  TaskScheduler &scheduler) {
+  auto promise = std::make_shared<std::promise<Result<SettleResult>>>();
+  auto future = promise->get_future();
+  wait_for_settle(
+      std::move(read), target, options,
+      [promise](Result<SettleResult> result) {
+        promise->set_value(std::move(result));
+      },
+      scheduler);
+  return future;
+}
+
+const char *to_string(SettleStatus status) {
+  switch (status) {
+  case SettleStatus::Converged:
+    return "Converged";
+  case SettleStatus::Stalled:
+    return "Stalled";
+  case SettleStatus::TimedOut:
+    return "TimedOut";
+  default:
+    return "Unknown";
+  }
+}
+
+} // namespace duvc
@@ -0,0 +1,692 @@
+/**
+ * @file timeline.cpp
+ * @brief Cue list parsing and timeline playback implementation
+ */
+
+#include <duvc-ctl/core/device_actor.h>
+#include <duvc-ctl/detail/binary_io.h>
+#include <duvc-ctl/core/timeline.h>
+#include <duvc-ctl/platform/interface.h>
+#include <duvc-ctl/utils/json.h>
+#include <duvc-ctl/utils/logging.h>
+#include <duvc-ctl/utils/string_conversion.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cwctype>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <timeapi.h>
+#endif
+
+namespace duvc {
+
+namespace {
+
+using detail::has_magic;
+using detail::put;
+using detail::put_string;
+using detail::Reader;
+
+using Clock = std::chrono::steady_clock;
+
+// ============================================================================
+// JSON cue format
+// ============================================================================
+
+Result<std::vector<Cue>> cue_error(size_t index, const std::string &message) {
+  return Err<std::vector<Cue>>(ErrorCode::InvalidArgument,
+                               "Cue " + std::to_string(index) + ": " + message);
+}
+
+/// Convert an integral JSON number to int, saturating at the int range
+int saturate_to_int(double value) {
+  if (value >= static_cast<double>(std::numeric_limits<int>::max())) {
+    return std::numeric_limits<int>::max();
+  }
+  if (value <= static_cast<double>(std::numeric_limits<int>::min())) {
+    return std::numeric_limits<int>::min();
+  }
+  return static_cast<int>(value);
+}
+
+/// Largest cue offset, in microseconds, that fits a chrono::microseconds
+constexpr double max_offset_us = 9e18;
+
+bool equals_ignore_case(const std::string &a, const char *b) {
+  return a.size() == std::char_traits<char>::length(b) &&
+         std::equal(a.begin(), a.end(), b, [](char x, char y) {
+           return std::tolower(static_cast<unsigned char>(x)) ==
+                  std::tolower(static_cast<unsigned char>(y));
+         });
+}
+
+Result<std::vector<Cue>> parse_cue_array(const JsonValue::Array &entries) {
+  std::vector<Cue> cues;
+  cues.reserve(entries.size());
+
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const JsonValue &entry = entries[i];
+    if (!entry.is_object()) {
+      return cue_error(i, "expected an object");
+    }
+    Cue cue;
+
+    const JsonValue *time = entry.find("time");
+    if (!time || !time->is_number() || time->as_number() < 0 ||
+        !std::isfinite(time->as_number())) {
+      return cue_error(i, "\"time\" must be a non-negative number of seconds");
+    }
+    cue.at = std::chrono::microseconds(static_cast<long long>(
+        std::llround(std::min(time->as_number() * 1e6, max_offset_us))));
+
+    const JsonValue *device = entry.find("device");
+    if (device && device->is_string() && !device->as_string().empty()) {
+      cue.device = to_wstring(device->as_string());
+    } else if (device && device->is_number() && device->as_number() >= 0 &&
+               device->as_number() == std::floor(device->as_number())) {
+      cue.device_index = saturate_to_int(device->as_number());
+    } else {
+      return cue_error(i, "\"device\" must be a path, name or index");
+    }
+
+    const JsonValue *property = entry.find("property");
+    if (const JsonValue *preset = entry.find("preset")) {
+      if (!preset->is_string() || preset->as_string().empty()) {
+        return cue_error(i, "\"preset\" must be a preset name");
+      }
+      if (property || entry.find("value")) {
+        return cue_error(i, "a preset cue takes no \"property\" or \"value\"");
+      }
+      cue.domain = CueDomain::Preset;
+      cue.preset = preset->as_string();
+      cues.push_back(std::move(cue));
+      continue;
+    }
+    if (!property || !property->is_string()) {
+      return cue_error(i, "\"property\" or \"preset\" is required");
+    }
+    const std::string &name = property->as_string();
+    auto cam = cam_prop_from_string(name);
+    auto vid = vid_prop_from_string(name);
+
+    const JsonValue *domain = entry.find("domain");
+    if (domain) {
+      const std::string d = domain->is_string() ? domain->as_string() : "";
+      if (equals_ignore_case(d, "cam") || equals_ignore_case(d, "camera")) {
+        vid.reset();
+      } else if (equals_ignore_case(d, "vid") || equals_ignore_case(d, "video")) {
+        cam.reset();
+      } else {
+        return cue_error(i, "\"domain\" must be \"cam\" or \"vid\"");
+      }
+    }
+    if (cam && vid) {
+      return cue_error(i, "\"" + name + "\" exists in both domains; set \"domain\"");
+    }
+    if (cam) {
+      cue.domain = CueDomain::Camera;
+      cue.cam_prop = *cam;
+    } else if (vid) {
+      cue.domain = CueDomain::Video;
+      cue.vid_prop = *vid;
+    } else {
+      return cue_error(i, "unknown property \"" + name + "\"");
+    }
+
+    const JsonValue *value = entry.find("value");
+    if (!value || !value->is_number() ||
+        value->as_number() != std::floor(value->as_number())) {
+      return cue_error(i, "\"value\" must be an integer");
+    }
+    cue.setting.value = saturate_to_int(value->as_number());
+
+    const JsonValue *mode = entry.find("mode");
+    if (mode) {
+      const std::string m = mode->is_string() ? mode->as_string() : "";
+      if (equals_ignore_case(m, "auto")) {
+        cue.setting.mode = CamMode::Auto;
+      } else if (!equals_ignore_case(m, "manual")) {
+        return cue_error(i, "\"mode\" must be \"manual\" or \"auto\"");
+      }
+    }
+    cues.push_back(std::move(cue));
+  }
+  return Ok(std::move(cues));
+}
+
+// ============================================================================
+// Binary cue format
+// ============================================================================
+//
+// "DUVCCUE" + version byte, u32 count, then per cue (little-endian):
+// i64 offset_us, i32 device_index, u8 domain, u8 property, u8 mode,
+// i32 value, u16 device_length, device (UTF-8), and for a preset cue
+// u16 name_length, name (UTF-8)
+
+constexpr char binary_magic[] = {'D', 'U', 'V', 'C', 'C', 'U', 'E', 1};
+
+// ============================================================================
+// Device resolution
+// ============================================================================
+
+std::wstring lowercase(std::wstring s) {
+  std::transform(s.begin(), s.end(), s.begin(),
+                 [](wchar_t c) { return static_cast<wchar_t>(std::towlower(c)); });
+  return s;
+}
+
+/// Find a cue's device by index, then path, then unique name
+Result<size_t> resolve_device(const Cue &cue, const std::vector<Device> &devices) {
+  if (cue.device.empty()) {
+    if (cue.device_index < 0 ||
+        static_cast<size_t>(cue.device_index) >= devices.size()) {
+      return Err<size_t>(ErrorCode::DeviceNotFound,
+                         "No device at index " + std::to_string(cue.device_index));
+    }
+    return Ok(static_cast<size_t>(cue.device_index));
+  }
+
+  std::wstring wanted = lowercase(cue.device);
+  for (size_t i = 0; i < devices.size(); ++i) {
+    if (!devices[i].path.empty() && lowercase(devices[i].path) == wanted) {
+      return Ok(i);
+    }
+  }
+  std::optional<size_t> match;
+  for (size_t i = 0; i < devices.size(); ++i) {
+    if (lowercase(devices[i].name) == wanted) {
+      if (match) {
+        return Err<size_t>(ErrorCode::InvalidArgument,
+                           "Device name is ambiguous: " + to_utf8(cue.device));
+      }
+      match = i;
+    }
+  }
+  if (!match) {
+    return Err<size_t>(ErrorCode::DeviceNotFound,
+                       "No device matches " + to_utf8(cue.device));
+  }
+  return Ok(*match);
+}
+
+std::string describe(const Cue &cue) {
+  switch (cue.domain) {
+  case CueDomain::Camera:
+    return to_string(cue.cam_prop);
+  case CueDomain::Video:
+    return to_string(cue.vid_prop);
+  default:
+    return "preset \"" + cue.preset + "\"";
+  }
+}
+
+/// Sleep until shortly before a time point, then close in on it with
+/// shrinking sleeps, yielding only for the last few microseconds
+void wait_precisely(Clock::time_point when, std::chrono::microseconds spin) {
+  constexpr std::chrono::microseconds yield_window{100};
+  auto coarse = when - spin;
+  if (Clock::now() < coarse) {
+    std::this_thread::sleep_until(coarse);
+  }
+  for (auto left = when - Clock::now(); left > yield_window;
+       left = when - Clock::now()) {
+    std::this_thread::sleep_for(left / 2);
+  }
+  while (Clock::now() < when) {
+    std::this_thread::yield();
+  }
+}
+
+} // namespace
+
+// ============================================================================
+// Cue files
+// ============================================================================
+
+Result<std::vector<Cue>> parse_cue_json(const std::string &text) {
+  auto document = parse_json(text);
+  if (!document.is_ok()) {
+    return Result<std::vector<Cue>>(document.error());
+  }
+  const JsonValue &root = document.value();
+  if (root.is_array()) {
+    return parse_cue_array(root.as_array());
+  }
+  const JsonValue *cues = root.find("cues");
+  if (!cues || !cues->is_array()) {
+    return Err<std::vector<Cue>>(ErrorCode::InvalidArgument,
+                                 "Cue file must contain a \"cues\" array");
+  }
+  return parse_cue_array(cues->as_array());
+}
+
+std::vector<uint8_t> serialize_cue_binary(const std::vector<Cue> &cues) {
+  std::vector<uint8_t> out(std::begin(binary_magic), std::end(binary_magic));
+  put(out, cues.size(), 4);
+  for (const auto &cue : cues) {
+    put(out, static_cast<uint64_t>(cue.at.count()), 8);
+    put(out, static_cast<uint32_t>(cue.device_index), 4);
+    put(out, static_cast<uint8_t>(cue.domain), 1);
+    put(out,
+        cue.domain == CueDomain::Camera ? static_cast<uint8_t>(cue.cam_prop)
+                                        : static_cast<uint8_t>(cue.vid_prop),
+        1);
+    put(out, static_cast<uint8_t>(cue.setting.mode), 1);
+    put(out, static_cast<uint32_t>(cue.setting.value), 4);
+    put_string(out, to_utf8(cue.device));
+    if (cue.domain == CueDomain::Preset) {
+      put_string(out, cue.preset);
+    }
+  }
+  return out;
+}
+
+Result<std::vector<Cue>> parse_cue_binary(const std::vector<uint8_t> &data) {
+  if (!has_magic(data, binary_magic)) {
+    return Err<std::vector<Cue>>(ErrorCode::InvalidArgument,
+                                 "Not a binary cue file");
+  }
+  Reader reader(data, sizeof(binary_magic));
+
+  uint64_t count;
+  if (!reader.get(count, 4)) {
+    return Err<std::vector<Cue>>(ErrorCode::InvalidArgument,
+                                 "Truncated binary cue file");
+  }
+  std::vector<Cue> cues;
+  cues.reserve(std::min<uint64_t>(count, reader.remaining() / 21));
+  for (uint64_t i = 0; i < count; ++i) {
+    uint64_t at, index, domain, prop, mode, value;
+    std::string device;
+    if (!reader.get(at, 8) || !reader.get(index, 4) || !reader.get(domain, 1) ||
+        !reader.get(prop, 1) || !reader.get(mode, 1) || !reader.get(value, 4) ||
+        !reader.get_string(device)) {
+      return cue_error(i, "truncated entry");
+    }
+
+    Cue cue;
+    cue.at = std::chrono::microseconds(static_cast<int64_t>(at));
+    cue.device_index = static_cast<int32_t>(static_cast<uint32_t>(index));
+    cue.device = to_wstring(device);
+    if (domain == static_cast<uint8_t>(CueDomain::Camera) &&
+        prop <= static_cast<uint8_t>(CamProp::Lamp)) {
+      cue.domain = CueDomain::Camera;
+      cue.cam_prop = static_cast<CamProp>(prop);
+    } else if (domain == static_cast<uint8_t>(CueDomain::Video) &&
+               prop <= static_cast<uint8_t>(VidProp::PowerLineFrequency)) {
+      cue.domain = CueDomain::Video;
+      cue.vid_prop = static_cast<VidProp>(prop);
+    } else if (domain == static_cast<uint8_t>(CueDomain::Preset)) {
+      cue.domain = CueDomain::Preset;
+      if (!reader.get_string(cue.preset)) {
+        return cue_error(i, "truncated entry");
+      }
+    } else {
+      return cue_error(i, "invalid property");
+    }
+    if (mode > static_cast<uint8_t>(CamMode::Manual) || cue.at.count() < 0) {
+      return cue_error(i, "invalid entry");
+    }
+    cue.setting = PropSetting(static_cast<int32_t>(static_cast<uint32_t>(value)),
+                              static_cast<CamMode>(mode));
+    cues.push_back(std::move(cue));
+  }
+  if (!reader.at_end()) {
+    return Err<std::vector<Cue>>(ErrorCode::InvalidArgument,
+                                 "Trailing data in binary cue file");
+  }
+  return Ok(std::move(cues));
+}
+
+Result<std::vector<Cue>> load_cue_file(const std::filesystem::path &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return Err<std::vector<Cue>>(ErrorCode::InvalidArgument,
+                                 "Cannot open cue file: " + path.u8string());
+  }
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+  if (has_magic(data, binary_magic)) {
+    return parse_cue_binary(data);
+  }
+  return parse_cue_json(std::string(data.begin(), data.end()));
+}
+
+// ============================================================================
+// Playback
+// ============================================================================
+
+/// A cue bound to its device and property
+struct TimelinePlayer::Prepared {
+  size_t index;
+  std::chrono::microseconds at;
+  std::shared_ptr<DeviceActor> actor;
+  std::function<Result<void>(IDeviceConnection &)> write;
+};
+
+TimelinePlayer::TimelinePlayer(std::vector<Cue> cues, TimelineOptions options)
+    : cues_(std::move(cues)), options_(options) {}
+
+TimelinePlayer::~TimelinePlayer() = default;
+
+Result<void> TimelinePlayer::prepare(const std::vector<Device> &devices,
+                                     ActorSource source,
+                                     const std::vector<Preset> &presets) {
+  if (options_.lead.count() < 0 || options_.spin.count() < 0) {
+    return Err<void>(ErrorCode::InvalidArgument,
+                     "Timeline lead and spin must not be negative");
+  }
+  if (!source) {
+    source = acquire_device_actor;
+  }
+
+  std::vector<std::shared_ptr<DeviceActor>> actors;
+  std::map<size_t, size_t> actor_of_device; // device index -> actors slot
+  std::vector<std::vector<size_t>> cues_of_actor;
+  std::vector<Prepared> prepared;
+  prepared.reserve(cues_.size());
+  // Preset cues to compile once their devices are open: cue, actors slot,
+  // preset
+  std::vector<std::tuple<size_t, size_t, const Preset *>> preset_cues;
+
+  for (size_t i = 0; i < cues_.size(); ++i) {
+    const Cue &cue = cues_[i];
+    auto device = resolve_device(cue, devices);
+    if (!device.is_ok()) {
+      return Err<void>(device.error().code(), "Cue " + std::to_string(i) +
+                                                  ": " +
+                                                  device.error().message());
+    }
+
+    auto slot = actor_of_device.find(device.value());
+    if (slot == actor_of_device.end()) {
+      auto actor = source(devices[device.value()]);
+      if (!actor) {
+        return Err<void>(ErrorCode::DeviceNotFound,
+                         "No actor for device " +
+                             to_utf8(devices[device.value()].name));
+      }
+      slot = actor_of_device.emplace(device.value(), actors.size()).first;
+      actors.push_back(std::move(actor));
+      cues_of_actor.emplace_back();
+    }
+    cues_of_actor[slot->second].push_back(i);
+
+    Prepared p{i, cue.at, actors[slot->second], nullptr};
+    if (cue.domain == CueDomain::Preset) {
+      auto preset = std::find_if(presets.begin(), presets.end(),
+                                 [&](const Preset &x) { return x.name == cue.preset; });
+      if (preset == presets.end()) {
+        return Err<void>(ErrorCode::InvalidArgument,
+                         "Cue " + std::to_string(i) + ": no preset named \"" +
+                             cue.preset + "\"");
+      }
+      preset_cues.emplace_back(i, slot->second, &*preset);
+    } else if (cue.domain == CueDomain::Camera) {
+      p.write = [prop = cue.cam_prop, setting = cue.setting](IDeviceConnection &c) {
+        return c.set_camera_property(prop, setting);
+      };
+    } else {
+      p.write = [prop = cue.vid_prop, setting = cue.setting](IDeviceConnection &c) {
+        return c.set_video_property(prop, setting);
+      };
+    }
+    prepared.push_back(std::move(p));
+  }
+
+  // Open every device in parallel and check each cue's property against the
+  // device's range, so problems surface before the show rather than during it
+  std::vector<std::future<Result<void>>> checks;
+  for (size_t a = 0; a < actors.size(); ++a) {
+    auto promise = std::make_shared<std::promise<Result<void>>>();
+    checks.push_back(promise->get_future());
+    std::vector<Cue> cues;
+    for (size_t i : cues_of_actor[a]) {
+      cues.push_back(cues_[i]);
+    }
+    actors[a]->post(
+        [promise, cues = std::move(cues), indices = cues_of_actor[a]](
+            const Result<IDeviceConnection *> &connection) {
+          if (!connection.is_ok()) {
+            promise->set_value(Result<void>(connection.error()));
+            return;
+          }
+          IDeviceConnection &c = *connection.value();
+          for (size_t k = 0; k < cues.size(); ++k) {
+            const Cue &cue = cues[k];
+            if (cue.domain == CueDomain::Preset) {
+              continue; // Compiled against the device's ranges below
+            }
+            auto range = cue.domain == CueDomain::Camera
+                             ? c.get_camera_property_range(cue.cam_prop)
+                             : c.get_video_property_range(cue.vid_prop);
+            std::string where = "Cue " + std::to_string(indices[k]) + ": ";
+            if (!range.is_ok()) {
+              if (range.error().code() == ErrorCode::PropertyNotSupported) {
+                promise->set_value(Err<void>(ErrorCode::PropertyNotSupported,
+                                             where + describe(cue) +
+                                                 " is not supported"));
+                return;
+              }
+              continue; // range unavailable; let the write decide
+            }
+            if (cue.setting.mode == CamMode::Manual &&
+                !range.value().is_valid(cue.setting.value)) {
+              promise->set_value(Err<void>(
+                  ErrorCode::InvalidValue,
+                  where + describe(cue) + " value " +
+                      std::to_string(cue.setting.value) + " is out of range"));
+              return;
+            }
+          }
+          promise->set_value(Ok());
+        },
+        Clock::now() + options_.open_timeout);
+  }
+
+  auto deadline = Clock::now() + options_.open_timeout;
+  for (auto &check : checks) {
+    if (check.wait_until(deadline) != std::future_status::ready) {
+      return Err<void>(ErrorCode::DeviceBusy,
+                       "Timed out opening timeline devices");
+    }
+    auto result = check.get();
+    if (!result.is_ok()) {
+      return result;
+    }
+  }
+
+  // One recaller per device shares its range reads across presets
+  std::vector<std::unique_ptr<PresetRecaller>> recallers(actors.size());
+  for (const auto &[i, slot, preset] : preset_cues) {
+    if (!recallers[slot]) {
+      recallers[slot] = std::make_unique<PresetRecaller>(actors[slot]);
+    }
+    PresetPlan plan = recallers[slot]->compile(*preset);
+    if (plan.steps.empty()) {
+      return Err<void>(ErrorCode::PropertyNotSupported,
+                       "Cue " + std::to_string(i) + ": " + describe(cues_[i]) +
+                           " has no value the device supports");
+    }
+    std::vector<PresetValue> values;
+    values.reserve(plan.steps.size());
+    for (const auto &step : plan.steps) {
+      values.push_back(step.value);
+    }
+    // Every step is written: the cue must leave the device at the preset
+    // whatever happened since prepare()
+    prepared[i].write = [values = std::move(values)](IDeviceConnection &c) {
+      Result<void> first;
+      for (const auto &v : values) {
+        auto written = v.video ? c.set_video_property(v.vid_prop, v.setting)
+                               : c.set_camera_property(v.cam_prop, v.setting);
+        if (!written.is_ok() && first.is_ok()) {
+          first = written;
+        }
+      }
+      return first;
+    };
+  }
+
+  std::stable_sort(prepared.begin(), prepared.end(),
+                   [](const Prepared &a, const Prepared &b) { return a.at < b.at; });
+  actors_ = std::move(actors);
+  prepared_ = std::move(prepared);
+  DUVC_LOG_INFO("Timeline prepared: " + std::to_string(prepared_.size()) +
+                " cues on " + std::to_string(actors_.size()) + " devices");
+  return Ok();
+}
+
+/// State shared between play() and the cue tasks it posts. Tasks hold their
+/// own reference, so one that finishes after play() gave up on it is harmless.
+struct TimelinePlayer::Run {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::optional<CueReport>> reports;
+  size_t outstanding = 0;
+  std::atomic<bool> cancelled{false};
+};
+
+Result<TimelineReport> TimelinePlayer::play(CueCallback on_cue) {
+  if (prepared_.size() != cues_.size()) {
+    return Err<TimelineReport>(ErrorCode::InvalidArgument,
+                               "Timeline has not been prepared");
+  }
+
+#ifdef _WIN32
+  // Default scheduler granularity is ~15.6 ms; request 1 ms for the run
+  timeBeginPeriod(1);
+#endif
+
+  auto run = std::make_shared<Run>();
+  run->reports.resize(prepared_.size());
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = false;
+    run_ = run;
+  }
+
+  const auto start = Clock::now() + options_.lead;
+  const auto spin = options_.spin;
+  auto offset = [start](Clock::time_point t) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(t - start);
+  };
+  auto give_up = start; // when play() stops waiting for posted writes
+
+  for (size_t slot = 0; slot < prepared_.size(); ++slot) {
+    const Prepared &p = prepared_[slot];
+    const auto due = start + p.at;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (cv_.wait_until(lock, due - options_.lead, [this] { return cancelled_; })) {
+        break;
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(run->mutex);
+      ++run->outstanding;
+    }
+    const auto deadline = due + options_.write_timeout;
+    give_up = std::max(give_up, deadline);
+    p.actor->post(
+        [run, slot, due, spin, offset, on_cue, index = p.index, at = p.at,
+         write = p.write](const Result<IDeviceConnection *> &connection) {
+          if (!run->cancelled) {
+            wait_precisely(due, spin);
+          }
+          std::optional<CueReport> report;
+          if (!run->cancelled) {
+            CueReport r;
+            r.index = index;
+            r.planned = at;
+            r.fired = offset(Clock::now());
+            auto written = connection.is_ok() ? write(*connection.value())
+                                              : Result<void>(connection.error());
+            r.completed = offset(Clock::now());
+            if (!written.is_ok()) {
+              r.error = written.error();
+            }
+            DUVC_LOG_DEBUG("Cue " + std::to_string(r.index) + " planned " +
+                           std::to_string(r.planned.count()) + " us, fired " +
+                           std::to_string(r.fired.count()) + " us (" +
+                           std::to_string(r.lateness().count()) + " us late)");
+            if (on_cue) {
+              on_cue(r);
+            }
+            report = std::move(r);
+          }
+          std::lock_guard<std::mutex> lock(run->mutex);
+          run->reports[slot] = std::move(report);
+          if (--run->outstanding == 0) {
+            run->cv.notify_all();
+          }
+        },
+        deadline);
+  }
+
+  TimelineReport report;
+  {
+    std::unique_lock<std::mutex> lock(run->mutex);
+    run->cv.wait_until(lock, give_up, [&] { return run->outstanding == 0; });
+    // Writes still pending belong to hung devices; stop any that have not
+    // started yet from firing late
+    run->cancelled = true;
+    for (auto &r : run->reports) {
+      if (r) {
+        report.cues.push_back(std::move(*r));
+      }
+    }
+    report.timed_out = run->outstanding;
+  }
+
+#ifdef _WIN32
+  timeEndPeriod(1);
+#endif
+
+  report.cancelled =
+      report.cues.size() + report.timed_out < prepared_.size();
+  report.failures = report.timed_out;
+  long long total = 0;
+  for (const auto &cue : report.cues) {
+    if (cue.error) {
+      ++report.failures;
+    }
+    total += cue.lateness().count();
+    report.lateness_max = std::max(report.lateness_max, cue.lateness());
+  }
+  if (!report.cues.empty()) {
+    report.lateness_avg = std::chrono::microseconds(
+        total / static_cast<long long>(report.cues.size()));
+  }
+  DUVC_LOG_INFO("Timeline finished: " + std::to_string(report.cues.size()) +
+                " cues fired, " + std::to_string(report.failures) +
+                " failed, lateness avg " +
+                std::to_string(report.lateness_avg.count()) + " us, max " +
+                std::to_string(report.lateness_max.count()) + " us");
+  return Ok(std::move(report));
+}
+
+void TimelinePlayer::cancel() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    if (run_) {
+      run_->cancelled = true;
+    }
+  }
+  cv_.notify_all();
+}
+
+} // namespace duvc
@@ -13,6 +13,10 @@
 #include <duvc-ctl/utils/error_decoder.h>
 #include <duvc-ctl/utils/logging.h>
 
+#ifndef VFW_E_DEVICE_IN_USE
+#define VFW_E_DEVICE_IN_USE 0x80040228L
+#endif
+
 namespace duvc::detail {
 
 // DirectShow property mapping implementation
@@ -327,12 +331,14 @@ com_ptr<IBaseFilter> DirectShowFilter::create_filter(const Device &device) {
  */
 class DirectShowDeviceConnection : public IDeviceConnection {
 public:
-  explicit DirectShowDeviceConnection(const Device &device) : filter_(device) {}
+  explicit DirectShowDeviceConnection(const Device &device)
+      : filter_(device), cam_ctrl_(filter_.get_camera_control()),
+        vid_proc_(filter_.get_video_proc_amp()) {}
 
   bool is_valid() const override { return filter_.is_valid(); }
 
   Result<PropSetting> get_camera_property(CamProp prop) override {
-    auto cam_ctrl = filter_.get_camera_control();
+    auto &cam_ctrl = cam_ctrl_;
     if (!cam_ctrl) {
       return Err<PropSetting>(ErrorCode::PropertyNotSupported,
                               "Camera control not available");
@@ -348,8 +354,7 @@ public:
     HRESULT hr = cam_ctrl->Get(prop_id, &value, &flags);
 
     if (FAILED(hr)) {
-      return Err<PropSetting>(ErrorCode::SystemError,
-                              "Failed to get camera property");
+      return hresult_error<PropSetting>(hr, "Failed to get camera property");
     }
 
     PropSetting setting;
@@ -361,7 +366,7 @@ public:
 
   Result<void> set_camera_property(CamProp prop,
                                   const PropSetting &setting) override {
-    auto cam_ctrl = filter_.get_camera_control();
+    auto &cam_ctrl = cam_ctrl_;
     if (!cam_ctrl) {
       return Err<void>(ErrorCode::PropertyNotSupported,
                       "Camera control not available");
@@ -378,14 +383,14 @@ public:
         cam_ctrl->Set(prop_id, static_cast<long>(setting.value), flags);
 
     if (FAILED(hr)) {
-      return Err<void>(ErrorCode::SystemError, "Failed to set camera property");
+      return hresult_error<void>(hr, "Failed to set camera property");
     }
 
     return Ok();
   }
 
   Result<PropRange> get_camera_property_range(CamProp prop) override {
-    auto cam_ctrl = filter_.get_camera_control();
+    auto &cam_ctrl = cam_ctrl_;
     if (!cam_ctrl) {
       return Err<PropRange>(ErrorCode::PropertyNotSupported,
                             "Camera control not available");
@@ -402,8 +407,7 @@ public:
         cam_ctrl->GetRange(prop_id, &min, &max, &step, &default_val, &flags);
 
     if (FAILED(hr)) {
-      return Err<PropRange>(ErrorCode::SystemError,
-                            "Failed to get camera property range");
+      return hresult_error<PropRange>(hr, "Failed to get camera property range");
     }
 
     PropRange range;
@@ -418,7 +422,7 @@ public:
   }
 
   Result<PropSetting> get_video_property(VidProp prop) override {
-    auto vid_proc = filter_.get_video_proc_amp();
+    auto &vid_proc = vid_proc_;
     if (!vid_proc) {
       return Err<PropSetting>(ErrorCode::PropertyNotSupported,
                               "Video processing not available");
@@ -434,8 +438,7 @@ public:
     HRESULT hr = vid_proc->Get(prop_id, &value, &flags);
 
     if (FAILED(hr)) {
-      return Err<PropSetting>(ErrorCode::SystemError,
-                              "Failed to get video property");
+      return hresult_error<PropSetting>(hr, "Failed to get video property");
     }
 
     PropSetting setting;
@@ -447,7 +450,7 @@ public:
 
   Result<void> set_video_property(VidProp prop,
                                   const PropSetting &setting) override {
-    auto vid_proc = filter_.get_video_proc_amp();
+    auto &vid_proc = vid_proc_;
     if (!vid_proc) {
       return Err<void>(ErrorCode::PropertyNotSupported,
                       "Video processing not available");
@@ -465,14 +468,14 @@ public:
         vid_proc->Set(prop_id, static_cast<long>(setting.value), flags);
 
     if (FAILED(hr)) {
-      return Err<void>(ErrorCode::SystemError, "Failed to set video property");
+      return hresult_error<void>(hr, "Failed to set video property");
     }
 
     return Ok();
   }
 
   Result<PropRange> get_video_property_range(VidProp prop) override {
-    auto vid_proc = filter_.get_video_proc_amp();
+    auto &vid_proc = vid_proc_;
     if (!vid_proc) {
       return Err<PropRange>(ErrorCode::PropertyNotSupported,
                             "Video processing not available");
@@ -489,8 +492,7 @@ public:
         vid_proc->GetRange(prop_id, &min, &max, &step, &default_val, &flags);
 
     if (FAILED(hr)) {
-      return Err<PropRange>(ErrorCode::SystemError,
-                            "Failed to get video property range");
+      return hresult_error<PropRange>(hr, "Failed to get video property range");
     }
 
     PropRange range;
@@ -505,7 +507,44 @@ public:
   }
 
 private:
+  /**
+   * @brief Map a failed control HRESULT to the closest library error code
+   *
+   * Drivers report unsupported controls through several codes; only errors
+   * that really concern the device are reported as device errors.
+   */
+  static ErrorCode classify_hresult(HRESULT hr) {
+    switch (hr) {
+    case E_PROP_ID_UNSUPPORTED: // == HRESULT_FROM_WIN32(ERROR_NOT_FOUND)
+    case E_PROP_SET_UNSUPPORTED:
+    case E_NOTIMPL:
+    case HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED):
+      return ErrorCode::PropertyNotSupported;
+    case E_INVALIDARG:
+      return ErrorCode::InvalidValue;
+    case E_ACCESSDENIED:
+      return ErrorCode::PermissionDenied;
+    case VFW_E_DEVICE_IN_USE:
+    case HRESULT_FROM_WIN32(ERROR_DEVICE_IN_USE):
+      return ErrorCode::DeviceBusy;
+    case HRESULT_FROM_WIN32(ERROR_DEVICE_NOT_CONNECTED):
+    case HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND):
+      return ErrorCode::DeviceNotFound;
+    default:
+      return ErrorCode::SystemError;
+    }
+  }
+
+  template <typename T>
+  static Result<T> hresult_error(HRESULT hr, const char *what) {
+    return Err<T>(classify_hresult(hr),
+                  std::string(what) + ": " + decode_hresult(hr));
+  }
+
   DirectShowFilter filter_;
+  // Bound once on the owning thread and reused for every call
+  com_ptr<IAMCameraControl> cam_ctrl_;
+  com_ptr<IAMVideoProcAmp> vid_proc_;
 };
 
 std::unique_ptr<IDeviceConnection>
@@ -0,0 +1,59 @@
+/**
+ * @file json_fields.cpp
+ * @brief Field helpers shared by the JSON configuration parsers
+ */
+
+#include <duvc-ctl/detail/json_fields.h>
+#include <duvc-ctl/utils/string_conversion.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+namespace duvc::detail {
+
+bool starts_with_ignore_case(const std::string &s, const char *prefix) {
+  size_t n = std::char_traits<char>::length(prefix);
+  return s.size() > n &&
+         std::equal(s.begin(), s.begin() + static_cast<std::ptrdiff_t>(n),
+                    prefix, [](char x, char y) {
+                      return std::tolower(static_cast<unsigned char>(x)) == y;
+                    });
+}
+
+bool is_integer(const JsonValue &value) {
+  return value.is_number() && value.as_number() == std::floor(value.as_number()) &&
+         std::abs(value.as_number()) <= 2147483647.0;
+}
+
+std::optional<NamedProperty> resolve_property(const std::string &key,
+                                              std::string &error) {
+  std::string name = key;
+  bool only_cam = false, only_vid = false;
+  if (starts_with_ignore_case(name, "cam.")) {
+    only_cam = true;
+    name = name.substr(4);
+  } else if (starts_with_ignore_case(name, "vid.")) {
+    only_vid = true;
+    name = name.substr(4);
+  }
+  auto cam = only_vid ? std::nullopt : cam_prop_from_string(name);
+  auto vid = only_cam ? std::nullopt : vid_prop_from_string(name);
+  if (cam && vid) {
+    error = "\"" + key + "\" exists in both domains; prefix it with cam. or vid.";
+    return std::nullopt;
+  }
+  NamedProperty property;
+  if (cam) {
+    property.cam_prop = *cam;
+  } else if (vid) {
+    property.video = true;
+    property.vid_prop = *vid;
+  } else {
+    error = "unknown property \"" + key + "\"";
+    return std::nullopt;
+  }
+  return property;
+}
+
+} // namespace duvc::detail
@@ -0,0 +1,335 @@
+/**
+ * @file chaos.cpp
+ * @brief Fault injection platform implementation
+ */
+
+#include <duvc-ctl/core/device_identity.h>
+#include <duvc-ctl/platform/chaos.h>
+
+#include <thread>
+
+namespace duvc {
+
+namespace {
+
+/// Key under which a device is tracked
+std::wstring device_key(const Device &device) {
+  DeviceIdentity identity = parse_device_identity(device.path);
+  return identity.key.empty() ? device.path : identity.key;
+}
+
+bool draw(std::mt19937_64 &rng, double rate) {
+  return rate > 0.0 &&
+         std::uniform_real_distribution<double>(0.0, 1.0)(rng) < rate;
+}
+
+Error absent_error() {
+  return Error(ErrorCode::DeviceNotFound, "Device removed (injected)");
+}
+
+class ChaosConnection : public IDeviceConnection {
+public:
+  ChaosConnection(std::unique_ptr<IDeviceConnection> inner, Device device,
+                  std::shared_ptr<ChaosController> controller)
+      : inner_(std::move(inner)), device_(std::move(device)),
+        controller_(std::move(controller)), rng_(controller_->stream(device_)) {
+    controller_->connection_opened();
+  }
+
+  ~ChaosConnection() override { controller_->connection_closed(); }
+
+  bool is_valid() const override {
+    return controller_->present(device_) && inner_->is_valid();
+  }
+
+  Result<PropSetting> get_camera_property(CamProp prop) override {
+    if (auto fault = controller_->inject(device_, rng_)) {
+      return Result<PropSetting>(*fault);
+    }
+    return inner_->get_camera_property(prop);
+  }
+
+  Result<void> set_camera_property(CamProp prop,
+                                   const PropSetting &setting) override {
+    if (auto fault = controller_->inject(device_, rng_)) {
+      return Result<void>(*fault);
+    }
+    return inner_->set_camera_property(prop, setting);
+  }
+
+  Result<PropRange> get_camera_property_range(CamProp prop) override {
+    if (auto fault = controller_->inject(device_, rng_)) {
+      return Result<PropRange>(*fault);
+    }
+    return inner_->get_camera_property_range(prop);
+  }
+
+  Result<PropSetting> get_video_property(VidProp prop) override {
+    if (auto fault = controller_->inject(device_, rng_)) {
+      return Result<PropSetting>(*fault);
+    }
+    return inner_->get_video_property(prop);
+  }
+
+  Result<void> set_video_property(VidProp prop,
+                                  const PropSetting &setting) override {
+    if (auto fault = controller_->inject(device_, rng_)) {
+      return Result<void>(*fault);
+    }
+    return inner_->set_video_property(prop, setting);
+  }
+
+  Result<PropRange> get_video_property_range(VidProp prop) override {
+    if (auto fault = controller_->inject(device_, rng_)) {
+      return Result<PropRange>(*fault);
+    }
+    return inner_->get_video_property_range(prop);
+  }
+
+private:
+  std::unique_ptr<IDeviceConnection> inner_;
+  Device device_;
+  std::shared_ptr<ChaosController> controller_;
+  std::mt19937_64 rng_;
+};
+
+class ChaosPlatform : public IPlatformInterface {
+public:
+  ChaosPlatform(std::unique_ptr<IPlatformInterface> inner,
+                std::shared_ptr<ChaosController> controller)
+      : inner_(std::move(inner)), controller_(std::move(controller)),
+        rng_(controller_->stream(Device())) {}
+
+  Result<std::vector<Device>> list_devices() override {
+    auto result = inner_->list_devices();
+    if (result.is_error()) {
+      return result;
+    }
+    std::vector<Device> devices;
+    for (auto &device : std::move(result).value()) {
+      if (controller_->present(device)) {
+        devices.push_back(std::move(device));
+      }
+    }
+    return Ok(std::move(devices));
+  }
+
+  Result<bool> is_device_connected(const Device &device) override {
+    if (!controller_->present(device)) {
+      return Ok(false);
+    }
+    return inner_->is_device_connected(device);
+  }
+
+  Result<std::unique_ptr<IDeviceConnection>>
+  create_connection(const Device &device) override {
+    std::optional<Error> fault;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      fault = controller_->inject(device, rng_);
+    }
+    if (fault) {
+      return Result<std::unique_ptr<IDeviceConnection>>(*fault);
+    }
+    auto result = inner_->create_connection(device);
+    if (result.is_error()) {
+      return result;
+    }
+    return Ok(make_chaos_connection(std::move(result).value(), device,
+                                    controller_));
+  }
+
+private:
+  std::unique_ptr<IPlatformInterface> inner_;
+  std::shared_ptr<ChaosController> controller_;
+  std::mutex mutex_;
+  std::mt19937_64 rng_;
+};
+
+} // namespace
+
+// ============================================================================
+// ChaosController
+// ============================================================================
+
+ChaosController::ChaosController(ChaosConfig config)
+    : config_(std::make_shared<const ChaosConfig>(std::move(config))),
+      epoch_(Clock::now()) {}
+
+ChaosConfig ChaosController::config() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return *config_;
+}
+
+void ChaosController::set_config(ChaosConfig config) {
+  auto next = std::make_shared<const ChaosConfig>(std::move(config));
+  std::lock_guard<std::mutex> lock(mutex_);
+  config_ = std::move(next);
+}
+
+void ChaosController::remove(const Device &device,
+                             std::chrono::milliseconds duration) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  removed_[device_key(device)] = duration.count() > 0
+                                     ? Clock::now() + duration
+                                     : Clock::time_point::max();
+}
+
+void ChaosController::restore(const Device &device) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  removed_.erase(device_key(device));
+}
+
+bool ChaosController::present(const Device &device) const {
+  std::wstring key = device_key(device);
+  uint64_t hash = identity_hash(key);
+  std::lock_guard<std::mutex> lock(mutex_);
+  return present_locked(key, hash, Clock::now());
+}
+
+bool ChaosController::present_locked(const std::wstring &key, uint64_t hash,
+                                     Clock::time_point now) const {
+  auto removed = removed_.find(key);
+  if (removed != removed_.end() && removed->second > now) {
+    return false;
+  }
+  auto period = std::chrono::duration_cast<std::chrono::microseconds>(
+                    config_->flap_period)
+                    .count();
+  if (period > 0) {
+    // Each device flaps with its own phase so they do not all drop at once
+    auto t = std::chrono::duration_cast<std::chrono::microseconds>(now - epoch_)
+                 .count();
+    auto phase = static_cast<int64_t>(hash % static_cast<uint64_t>(period));
+    if ((t + phase) % period >= period / 2) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ChaosStats ChaosController::stats() const {
+  ChaosStats stats;
+  stats.calls = calls_.load();
+  stats.errors = errors_.load();
+  stats.spikes = spikes_.load();
+  stats.hangs = hangs_.load();
+  stats.removals = removals_.load();
+  stats.absent_calls = absent_calls_.load();
+  stats.opens = opens_.load();
+  stats.open_connections = open_connections_.load();
+  return stats;
+}
+
+std::optional<Error> ChaosController::inject(const Device &device,
+                                             std::mt19937_64 &rng) {
+  calls_.fetch_add(1);
+  std::wstring key = device_key(device);
+  uint64_t hash = identity_hash(key);
+
+  std::shared_ptr<const ChaosConfig> config;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    if (!present_locked(key, hash, now)) {
+      absent_calls_.fetch_add(1);
+      return absent_error();
+    }
+    config = config_;
+  }
+
+  // Draw every decision on every call so a stream's later decisions do not
+  // depend on which faults earlier calls hit
+  bool remove_now = draw(rng, config->removal_rate);
+  bool spike = draw(rng, config->spike_rate);
+  bool hang = draw(rng, config->hang_rate);
+  bool fail = draw(rng, config->error_rate);
+  size_t code = config->errors.empty() ? 0 : rng() % config->errors.size();
+
+  if (remove_now) {
+    removals_.fetch_add(1);
+    std::lock_guard<std::mutex> lock(mutex_);
+    removed_[key] = Clock::now() + config->removal_duration;
+    return absent_error();
+  }
+  if (config->latency.count() > 0) {
+    std::this_thread::sleep_for(config->latency);
+  }
+  if (spike) {
+    spikes_.fetch_add(1);
+    std::this_thread::sleep_for(config->spike_latency);
+  }
+  if (hang) {
+    hangs_.fetch_add(1);
+    std::this_thread::sleep_for(config->hang_duration);
+  }
+  if (fail && !config->errors.empty()) {
+    errors_.fetch_add(1);
+    return Error(config->errors[code], "Injected fault");
+  }
+  return std::nullopt;
+}
+
+std::mt19937_64 ChaosController::stream(const Device &device) {
+  std::wstring key = device_key(device);
+  uint64_t ordinal;
+  uint64_t seed;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ordinal = streams_[key]++;
+    seed = config_->seed;
+  }
+  uint64_t hash = identity_hash(key);
+  std::seed_seq sequence{static_cast<uint32_t>(seed),
+                         static_cast<uint32_t>(seed >> 32),
+                         static_cast<uint32_t>(hash),
+                         static_cast<uint32_t>(hash >> 32),
+                         static_cast<uint32_t>(ordinal)};
+  return std::mt19937_64(sequence);
+}
+
+void ChaosController::connection_opened() {
+  opens_.fetch_add(1);
+  open_connections_.fetch_add(1);
+}
+
+void ChaosController::connection_closed() { open_connections_.fetch_sub(1); }
+
+// ============================================================================
+// Factories
+// ============================================================================
+
+std::unique_ptr<IPlatformInterface>
+make_chaos_platform(std::unique_ptr<IPlatformInterface> inner,
+                    std::shared_ptr<ChaosController> controller) {
+  if (!inner || !controller) {
+    return inner;
+  }
+  return std::make_unique<ChaosPlatform>(std::move(inner),
+                                         std::move(controller));
+}
+
+std::unique_ptr<IDeviceConnection>
+make_chaos_connection(std::unique_ptr<IDeviceConnection> inner,
+                      const Device &device,
+                      std::shared_ptr<ChaosController> controller) {
+  if (!inner || !controller) {
+    return inner;
+  }
+  return std::make_unique<ChaosConnection>(std::move(inner), device,
+                                           std::move(controller));
+}
+
+void install_chaos(std::shared_ptr<ChaosController> controller,
+                   PlatformFactory inner) {
+  if (!controller) {
+    set_platform_interface_factory(nullptr);
+    return;
+  }
+  set_platform_interface_factory([controller, inner = std::move(inner)] {
+    return make_chaos_platform(inner ? inner() : create_native_platform_interface(),
+                               controller);
+  });
+}
+
+} // namespace duvc
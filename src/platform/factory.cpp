@@ -4,12 +4,21 @@
  */
 
 #include <duvc-ctl/detail/directshow_impl.h>
+#include <duvc-ctl/platform/fake.h>
 #include <duvc-ctl/platform/interface.h>
+#include <duvc-ctl/utils/logging.h>
+
+#include <cctype>
+#include <cstdlib>
 #include <memory>
+#include <mutex>
 
 #ifdef _WIN32
 #include <duvc-ctl/platform/windows/directshow.h>
 #endif
+#ifdef DUVC_WITH_V4L2
+#include <duvc-ctl/platform/linux/v4l2.h>
+#endif
 
 namespace duvc {
 
@@ -57,13 +66,102 @@ public:
 
 #endif // _WIN32
 
+namespace {
+
+std::mutex g_factory_mutex;
+PlatformFactory g_factory;
+
+#if defined(_WIN32)
+const char *const kOperatingSystemBackend = "directshow";
+#elif defined(DUVC_WITH_V4L2)
+const char *const kOperatingSystemBackend = "v4l2";
+#else
+const char *const kOperatingSystemBackend = "none";
+#endif
+
+/// Backend chosen from the environment (read once, on first use)
+struct NativeBackend {
+  std::string name;
+  std::shared_ptr<FakeBackend> fake; ///< Set when name is "fake"
+};
+
+std::shared_ptr<FakeBackend> environment_fake_backend() {
+  const char *path = std::getenv("DUVC_FAKE_SCENARIO");
+  if (!path || !*path) {
+    return std::make_shared<FakeBackend>();
+  }
+  auto scenario = load_fake_scenario(path);
+  if (!scenario.is_ok()) {
+    DUVC_LOG_ERROR("DUVC_FAKE_SCENARIO: " + scenario.error().description() +
+                   "; using the built-in scenario");
+    return std::make_shared<FakeBackend>();
+  }
+  return std::make_shared<FakeBackend>(scenario.value());
+}
+
+const NativeBackend &native_backend() {
+  static const NativeBackend backend = [] {
+    NativeBackend selected;
+    selected.name = kOperatingSystemBackend;
+    const char *requested = std::getenv("DUVC_BACKEND");
+    if (!requested || !*requested) {
+      return selected;
+    }
+    std::string name = requested;
+    for (char &c : name) {
+      c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    if (name == "fake") {
+      selected.name = name;
+      selected.fake = environment_fake_backend();
+    } else if (name != selected.name) {
+      DUVC_LOG_WARNING("DUVC_BACKEND=" + name + " is not available; using " +
+                       selected.name);
+    }
+    return selected;
+  }();
+  return backend;
+}
+
+} // namespace
+
 std::unique_ptr<IPlatformInterface> create_platform_interface() {
-#ifdef _WIN32
+  PlatformFactory factory;
+  {
+    std::lock_guard<std::mutex> lock(g_factory_mutex);
+    factory = g_factory;
+  }
+  return factory ? factory() : create_native_platform_interface();
+}
+
+void set_platform_interface_factory(PlatformFactory factory) {
+  std::lock_guard<std::mutex> lock(g_factory_mutex);
+  g_factory = std::move(factory);
+}
+
+bool platform_interface_overridden() {
+  if (native_backend().fake) {
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(g_factory_mutex);
+  return static_cast<bool>(g_factory);
+}
+
+std::unique_ptr<IPlatformInterface> create_native_platform_interface() {
+  const NativeBackend &backend = native_backend();
+  if (backend.fake) {
+    return make_fake_platform(backend.fake);
+  }
+#if defined(_WIN32)
   return std::make_unique<WindowsPlatformInterface>();
+#elif defined(DUVC_WITH_V4L2)
+  return create_v4l2_platform_interface();
 #else
   // Return null for unsupported platforms
   return nullptr;
 #endif
 }
 
+std::string native_platform_backend() { return native_backend().name; }
+
 } // namespace duvc
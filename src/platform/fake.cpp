@@ -0,0 +1,594 @@
+/**
+ * @file fake.cpp
+ * @brief In-memory fake camera backend implementation
+ */
+
+#include <duvc-ctl/core/device_identity.h>
+#include <duvc-ctl/detail/json_fields.h>
+#include <duvc-ctl/platform/fake.h>
+#include <duvc-ctl/utils/json.h>
+#include <duvc-ctl/utils/logging.h>
+#include <duvc-ctl/utils/string_conversion.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace duvc {
+
+namespace {
+
+using detail::is_integer;
+
+/**
+ * Scenario compiled into the library, in the same format as scenario files.
+ * Ranges follow the DirectShow conventions real cameras report (exposure in
+ * log2 seconds, relative controls as -1/0/1 direction).
+ */
+const char *const kBuiltinScenario = R"({
+  "devices": [
+    {
+      "name": "Fake PTZ Camera", "path": "fake://ptz",
+      "motor_speed": 1.0,
+      "camera": {
+        "Pan":          {"min": -180, "max": 180, "default": 0},
+        "Tilt":         {"min": -90, "max": 90, "default": 0},
+        "Zoom":         {"min": 100, "max": 500, "default": 100},
+        "Focus":        {"min": 0, "max": 255, "step": 5, "default": 0, "mode": "auto"},
+        "Exposure":     {"min": -11, "max": -2, "default": -6, "mode": "auto"},
+        "PanRelative":  {"min": -1, "max": 1, "default": 0},
+        "TiltRelative": {"min": -1, "max": 1, "default": 0},
+        "ZoomRelative": {"min": -1, "max": 1, "default": 0},
+        "Privacy":      {"min": 0, "max": 1, "default": 0}
+      },
+      "video": {
+        "Brightness":   {"min": 0, "max": 255, "default": 128},
+        "Contrast":     {"min": 0, "max": 255, "default": 128},
+        "Saturation":   {"min": 0, "max": 255, "default": 128},
+        "Sharpness":    {"min": 0, "max": 255, "default": 128},
+        "Gain":         {"min": 0, "max": 255, "default": 0},
+        "WhiteBalance": {"min": 2800, "max": 6500, "step": 10, "default": 4600, "mode": "auto"},
+        "BacklightCompensation": {"min": 0, "max": 1, "default": 0},
+        "PowerLineFrequency":    {"min": 0, "max": 2, "default": 1}
+      }
+    },
+    {
+      "name": "Fake Webcam", "path": "fake://webcam",
+      "camera": {
+        "Focus":    {"min": 0, "max": 255, "step": 5, "default": 0, "mode": "auto"},
+        "Exposure": {"min": -11, "max": -2, "default": -6, "mode": "auto"}
+      },
+      "video": {
+        "Brightness":   {"min": -64, "max": 64, "default": 0},
+        "Contrast":     {"min": 0, "max": 100, "default": 50},
+        "Hue":          {"min": -40, "max": 40, "default": 0},
+        "Saturation":   {"min": 0, "max": 100, "default": 60},
+        "Sharpness":    {"min": 0, "max": 7, "default": 2},
+        "Gamma":        {"min": 100, "max": 500, "default": 300},
+        "WhiteBalance": {"min": 2800, "max": 6500, "step": 10, "default": 4600, "mode": "auto"},
+        "BacklightCompensation": {"min": 0, "max": 2, "default": 1},
+        "PowerLineFrequency":    {"min": 0, "max": 2, "default": 1}
+      }
+    }
+  ]
+})";
+
+// ============================================================================
+// JSON scenario format
+// ============================================================================
+
+Result<FakeScenario> scenario_error(const std::string &where,
+                                    const std::string &message) {
+  return Err<FakeScenario>(ErrorCode::InvalidArgument, where + ": " + message);
+}
+
+bool parse_mode(const JsonValue &json, CamMode &mode, std::string &error) {
+  if (json.is_string() && json.as_string() == "auto") {
+    mode = CamMode::Auto;
+  } else if (json.is_string() && json.as_string() == "manual") {
+    mode = CamMode::Manual;
+  } else {
+    error = "\"mode\" must be \"auto\" or \"manual\"";
+    return false;
+  }
+  return true;
+}
+
+/// Parse {"min", "max", "step", "default", "mode", "value", "read_only"}
+bool parse_control(const JsonValue &json, FakeControl &control,
+                   std::string &error) {
+  if (!json.is_object()) {
+    error = "expected an object";
+    return false;
+  }
+  const JsonValue *min = json.find("min");
+  const JsonValue *max = json.find("max");
+  if (!min || !max || !is_integer(*min) || !is_integer(*max)) {
+    error = "\"min\" and \"max\" must be integers";
+    return false;
+  }
+  PropRange &range = control.range;
+  range.min = static_cast<int>(min->as_number());
+  range.max = static_cast<int>(max->as_number());
+  range.step = 1;
+  range.default_val = range.min;
+  range.default_mode = CamMode::Manual;
+  if (range.min > range.max) {
+    error = "\"min\" is greater than \"max\"";
+    return false;
+  }
+
+  const std::pair<const char *, int *> fields[] = {{"step", &range.step},
+                                                   {"default", &range.default_val}};
+  for (const auto &field : fields) {
+    if (const JsonValue *value = json.find(field.first)) {
+      if (!is_integer(*value)) {
+        error = "\"" + std::string(field.first) + "\" must be an integer";
+        return false;
+      }
+      *field.second = static_cast<int>(value->as_number());
+    }
+  }
+  if (range.step < 1) {
+    error = "\"step\" must be positive";
+    return false;
+  }
+  if (!range.is_valid(range.default_val)) {
+    error = "\"default\" is outside the range";
+    return false;
+  }
+  if (const JsonValue *mode = json.find("mode")) {
+    if (!parse_mode(*mode, range.default_mode, error)) {
+      return false;
+    }
+  }
+
+  control.value = PropSetting(range.default_val, range.default_mode);
+  if (const JsonValue *value = json.find("value")) {
+    if (!is_integer(*value) || !range.is_valid(static_cast<int>(value->as_number()))) {
+      error = "\"value\" must be an integer inside the range";
+      return false;
+    }
+    control.value.value = static_cast<int>(value->as_number());
+  }
+  if (const JsonValue *read_only = json.find("read_only")) {
+    if (!read_only->is_bool()) {
+      error = "\"read_only\" must be true or false";
+      return false;
+    }
+    control.read_only = read_only->as_bool();
+  }
+  return true;
+}
+
+/// Parse one domain's {"<property name>": control} object
+template <typename Prop, typename Lookup>
+bool parse_controls(const JsonValue &json, std::map<Prop, FakeControl> &controls,
+                    Lookup lookup, std::string &error) {
+  if (!json.is_object()) {
+    error = "expected an object of controls";
+    return false;
+  }
+  for (const auto &member : json.as_object()) {
+    auto prop = lookup(member.first);
+    if (!prop) {
+      error = "unknown property \"" + member.first + "\"";
+      return false;
+    }
+    if (!parse_control(member.second, controls[*prop], error)) {
+      error = "\"" + member.first + "\": " + error;
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Camera controls driven by a motor (absolute positions only)
+bool is_motorized(CamProp prop) {
+  switch (prop) {
+  case CamProp::Pan:
+  case CamProp::Tilt:
+  case CamProp::Roll:
+  case CamProp::Zoom:
+  case CamProp::Focus:
+  case CamProp::Iris:
+    return true;
+  default:
+    return false;
+  }
+}
+
+} // namespace
+
+// ============================================================================
+// Backend state
+// ============================================================================
+
+/// One device's live state (controls guarded by mutex)
+struct FakeBackend::DeviceState {
+  explicit DeviceState(FakeDevice device)
+      : initial(std::move(device)), camera(initial.camera),
+        video(initial.video) {}
+
+  /// An unfinished motor move
+  struct Move {
+    int from = 0;
+    int to = 0;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  /// Current position of a camera control (call with mutex held)
+  PropSetting position(CamProp prop, const PropSetting &stored) {
+    auto it = moves.find(prop);
+    if (it == moves.end()) {
+      return stored;
+    }
+    const Move &move = it->second;
+    auto ms = std::chrono::duration<double, std::milli>(
+                  std::chrono::steady_clock::now() - move.start)
+                  .count();
+    auto travelled = static_cast<int>(ms * initial.motor_speed);
+    int distance = move.to - move.from;
+    if (std::abs(distance) <= travelled) {
+      moves.erase(it);
+      return stored;
+    }
+    return PropSetting(move.from + (distance > 0 ? travelled : -travelled),
+                       stored.mode);
+  }
+
+  const FakeDevice initial;
+  std::mutex mutex;
+  std::map<CamProp, FakeControl> camera;
+  std::map<VidProp, FakeControl> video;
+  std::map<CamProp, Move> moves;
+  std::atomic<bool> connected{true};
+};
+
+FakeBackend::FakeBackend(FakeScenario scenario) {
+  devices_.reserve(scenario.devices.size());
+  for (auto &device : scenario.devices) {
+    devices_.push_back(std::make_shared<DeviceState>(std::move(device)));
+  }
+}
+
+FakeBackend::~FakeBackend() = default;
+
+std::vector<Device> FakeBackend::devices() const {
+  std::vector<Device> result;
+  for (const auto &state : devices_) {
+    if (state->connected.load()) {
+      result.push_back(state->initial.device);
+    }
+  }
+  return result;
+}
+
+bool FakeBackend::connected(const Device &device) const {
+  auto state = find(device);
+  return state && state->connected.load();
+}
+
+bool FakeBackend::set_connected(const Device &device, bool connected) {
+  auto state = find(device);
+  if (!state) {
+    return false;
+  }
+  state->connected = connected;
+  return true;
+}
+
+void FakeBackend::reset() {
+  for (const auto &state : devices_) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->camera = state->initial.camera;
+    state->video = state->initial.video;
+    state->moves.clear();
+    state->connected = true;
+  }
+}
+
+FakeStats FakeBackend::stats() const {
+  FakeStats stats;
+  stats.calls = calls_.load();
+  stats.writes = writes_.load();
+  stats.opens = opens_.load();
+  stats.open_connections = open_connections_.load();
+  return stats;
+}
+
+std::shared_ptr<FakeBackend::DeviceState>
+FakeBackend::find(const Device &device) const {
+  for (const auto &state : devices_) {
+    if (same_device_path(state->initial.device.path, device.path)) {
+      return state;
+    }
+  }
+  return nullptr;
+}
+
+// ============================================================================
+// Platform and connections
+// ============================================================================
+
+class FakeConnection : public IDeviceConnection {
+public:
+  FakeConnection(std::shared_ptr<FakeBackend> backend,
+                 std::shared_ptr<FakeBackend::DeviceState> state)
+      : backend_(std::move(backend)), state_(std::move(state)) {
+    backend_->opens_.fetch_add(1);
+    backend_->open_connections_.fetch_add(1);
+  }
+
+  ~FakeConnection() override { backend_->open_connections_.fetch_sub(1); }
+
+  bool is_valid() const override { return state_->connected.load(); }
+
+  Result<PropSetting> get_camera_property(CamProp prop) override {
+    return read(state_->camera, prop);
+  }
+
+  Result<void> set_camera_property(CamProp prop,
+                                   const PropSetting &setting) override {
+    return write(state_->camera, prop, setting);
+  }
+
+  Result<PropRange> get_camera_property_range(CamProp prop) override {
+    return range(state_->camera, prop);
+  }
+
+  Result<PropSetting> get_video_property(VidProp prop) override {
+    return read(state_->video, prop);
+  }
+
+  Result<void> set_video_property(VidProp prop,
+                                  const PropSetting &setting) override {
+    return write(state_->video, prop, setting);
+  }
+
+  Result<PropRange> get_video_property_range(VidProp prop) override {
+    return range(state_->video, prop);
+  }
+
+private:
+  /// Count the call and spend the device latency; error if unplugged
+  std::optional<Error> begin_call() {
+    backend_->calls_.fetch_add(1, std::memory_order_relaxed);
+    if (state_->initial.latency.count() > 0) {
+      std::this_thread::sleep_for(state_->initial.latency);
+    }
+    if (!state_->connected.load()) {
+      return Error(ErrorCode::DeviceNotFound, "Device unplugged (fake)");
+    }
+    return std::nullopt;
+  }
+
+  Error not_supported() const {
+    return Error(ErrorCode::PropertyNotSupported,
+                 "Not supported by " + to_utf8(state_->initial.device.name) +
+                     " (fake)");
+  }
+
+  PropSetting current(CamProp prop, const FakeControl &control) {
+    return state_->position(prop, control.value);
+  }
+
+  PropSetting current(VidProp, const FakeControl &control) {
+    return control.value;
+  }
+
+  void start_move(CamProp prop, const FakeControl &control,
+                  const PropSetting &setting) {
+    if (state_->initial.motor_speed > 0.0 && is_motorized(prop) &&
+        setting.mode == CamMode::Manual) {
+      int from = state_->position(prop, control.value).value;
+      state_->moves[prop] = {from, setting.value, std::chrono::steady_clock::now()};
+    } else {
+      state_->moves.erase(prop);
+    }
+  }
+
+  void start_move(VidProp, const FakeControl &, const PropSetting &) {}
+
+  template <typename Prop>
+  Result<PropSetting> read(std::map<Prop, FakeControl> &controls, Prop prop) {
+    if (auto error = begin_call()) {
+      return Result<PropSetting>(*error);
+    }
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    auto it = controls.find(prop);
+    if (it == controls.end()) {
+      return Result<PropSetting>(not_supported());
+    }
+    return Ok(current(prop, it->second));
+  }
+
+  template <typename Prop>
+  Result<void> write(std::map<Prop, FakeControl> &controls, Prop prop,
+                     const PropSetting &setting) {
+    if (auto error = begin_call()) {
+      return Result<void>(*error);
+    }
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    auto it = controls.find(prop);
+    if (it == controls.end()) {
+      return Result<void>(not_supported());
+    }
+    FakeControl &control = it->second;
+    if (control.read_only) {
+      return Err<void>(ErrorCode::PermissionDenied, "Read-only control (fake)");
+    }
+    // Like drivers, an auto write keeps the value and only switches mode
+    PropSetting next = setting;
+    if (setting.mode == CamMode::Auto) {
+      next.value = control.value.value;
+    } else if (!control.range.is_valid(setting.value)) {
+      return Err<void>(ErrorCode::InvalidValue,
+                       "Value " + std::to_string(setting.value) +
+                           " is outside the range (fake)");
+    }
+    start_move(prop, control, next);
+    control.value = next;
+    backend_->writes_.fetch_add(1, std::memory_order_relaxed);
+    return Ok();
+  }
+
+  template <typename Prop>
+  Result<PropRange> range(std::map<Prop, FakeControl> &controls, Prop prop) {
+    if (auto error = begin_call()) {
+      return Result<PropRange>(*error);
+    }
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    auto it = controls.find(prop);
+    if (it == controls.end()) {
+      return Result<PropRange>(not_supported());
+    }
+    return Ok(it->second.range);
+  }
+
+  std::shared_ptr<FakeBackend> backend_;
+  std::shared_ptr<FakeBackend::DeviceState> state_;
+};
+
+class FakePlatform : public IPlatformInterface {
+public:
+  explicit FakePlatform(std::shared_ptr<FakeBackend> backend)
+      : backend_(std::move(backend)) {}
+
+  Result<std::vector<Device>> list_devices() override {
+    return Ok(backend_->devices());
+  }
+
+  Result<bool> is_device_connected(const Device &device) override {
+    return Ok(backend_->connected(device));
+  }
+
+  Result<std::unique_ptr<IDeviceConnection>>
+  create_connection(const Device &device) override {
+    auto state = backend_->find(device);
+    if (!state || !state->connected.load()) {
+      return Err<std::unique_ptr<IDeviceConnection>>(ErrorCode::DeviceNotFound,
+                                                     "No such fake device");
+    }
+    return Ok(std::unique_ptr<IDeviceConnection>(
+        std::make_unique<FakeConnection>(backend_, std::move(state))));
+  }
+
+private:
+  std::shared_ptr<FakeBackend> backend_;
+};
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+Result<FakeScenario> parse_fake_scenario(const std::string &text) {
+  auto document = parse_json(text);
+  if (!document.is_ok()) {
+    return Result<FakeScenario>(document.error());
+  }
+  const JsonValue *entries = document.value().find("devices");
+  if (!entries || !entries->is_array()) {
+    return scenario_error("Fake scenario", "\"devices\" array is required");
+  }
+
+  FakeScenario scenario;
+  for (size_t i = 0; i < entries->as_array().size(); ++i) {
+    const JsonValue &entry = entries->as_array()[i];
+    std::string where = "Fake device " + std::to_string(i);
+    if (!entry.is_object()) {
+      return scenario_error(where, "expected an object");
+    }
+
+    FakeDevice device;
+    const JsonValue *name = entry.find("name");
+    if (!name || !name->is_string()) {
+      return scenario_error(where, "\"name\" must be a string");
+    }
+    device.device.name = to_wstring(name->as_string());
+    if (const JsonValue *path = entry.find("path")) {
+      if (!path->is_string() || path->as_string().empty()) {
+        return scenario_error(where, "\"path\" must be a non-empty string");
+      }
+      device.device.path = to_wstring(path->as_string());
+    } else {
+      device.device.path = L"fake://" + std::to_wstring(i);
+    }
+    for (const auto &other : scenario.devices) {
+      if (same_device_path(other.device.path, device.device.path)) {
+        return scenario_error(where, "duplicate \"path\"");
+      }
+    }
+
+    if (const JsonValue *latency = entry.find("latency_us")) {
+      if (!is_integer(*latency) || latency->as_number() < 0) {
+        return scenario_error(where, "\"latency_us\" must be a non-negative integer");
+      }
+      device.latency =
+          std::chrono::microseconds(static_cast<int64_t>(latency->as_number()));
+    }
+    if (const JsonValue *speed = entry.find("motor_speed")) {
+      if (!speed->is_number() || speed->as_number() < 0) {
+        return scenario_error(where, "\"motor_speed\" must be a non-negative number");
+      }
+      device.motor_speed = speed->as_number();
+    }
+
+    std::string error;
+    if (const JsonValue *camera = entry.find("camera")) {
+      if (!parse_controls(*camera, device.camera, cam_prop_from_string, error)) {
+        return scenario_error(where + " \"camera\"", error);
+      }
+    }
+    if (const JsonValue *video = entry.find("video")) {
+      if (!parse_controls(*video, device.video, vid_prop_from_string, error)) {
+        return scenario_error(where + " \"video\"", error);
+      }
+    }
+    scenario.devices.push_back(std::move(device));
+  }
+  return Ok(std::move(scenario));
+}
+
+Result<FakeScenario> load_fake_scenario(const std::filesystem::path &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return Err<FakeScenario>(ErrorCode::InvalidArgument,
+                             "Cannot open fake scenario: " + path.u8string());
+  }
+  std::string text((std::istreambuf_iterator<char>(file)),
+                   std::istreambuf_iterator<char>());
+  return parse_fake_scenario(text);
+}
+
+const FakeScenario &builtin_fake_scenario() {
+  static const FakeScenario scenario = [] {
+    auto parsed = parse_fake_scenario(kBuiltinScenario);
+    if (!parsed.is_ok()) {
+      DUVC_LOG_ERROR("Built-in fake scenario is invalid: " +
+                     parsed.error().description());
+      return FakeScenario();
+    }
+    return parsed.value();
+  }();
+  return scenario;
+}
+
+std::unique_ptr<IPlatformInterface>
+make_fake_platform(std::shared_ptr<FakeBackend> backend) {
+  return std::make_unique<FakePlatform>(std::move(backend));
+}
+
+void install_fake_backend(std::shared_ptr<FakeBackend> backend) {
+  if (!backend) {
+    set_platform_interface_factory(nullptr);
+    return;
+  }
+  set_platform_interface_factory([backend] { return make_fake_platform(backend); });
+}
+
+} // namespace duvc
@@ -0,0 +1,368 @@
+/**
+ * @file v4l2.cpp
+ * @brief Video4Linux2 platform backend implementation
+ */
+
+#ifdef __linux__
+
+#include <duvc-ctl/platform/linux/v4l2.h>
+#include <duvc-ctl/utils/string_conversion.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+#include <fcntl.h>
+#include <linux/videodev2.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace duvc {
+
+namespace {
+
+/// V4L2 control behind a property
+struct V4l2Control {
+  uint32_t id = 0;       ///< Value control
+  uint32_t auto_id = 0;  ///< Companion auto control, or 0 if none
+  int32_t manual = 0;    ///< auto_id value selecting manual mode
+  int32_t automatic = 1; ///< auto_id value selecting auto mode
+};
+
+std::optional<V4l2Control> control_for(CamProp prop) {
+  switch (prop) {
+  case CamProp::Pan:
+    return V4l2Control{V4L2_CID_PAN_ABSOLUTE};
+  case CamProp::Tilt:
+    return V4l2Control{V4L2_CID_TILT_ABSOLUTE};
+  case CamProp::Zoom:
+    return V4l2Control{V4L2_CID_ZOOM_ABSOLUTE};
+  case CamProp::Exposure:
+    return V4l2Control{V4L2_CID_EXPOSURE_ABSOLUTE, V4L2_CID_EXPOSURE_AUTO,
+                       V4L2_EXPOSURE_MANUAL, V4L2_EXPOSURE_APERTURE_PRIORITY};
+  case CamProp::Iris:
+    return V4l2Control{V4L2_CID_IRIS_ABSOLUTE};
+  case CamProp::Focus:
+    return V4l2Control{V4L2_CID_FOCUS_ABSOLUTE, V4L2_CID_FOCUS_AUTO};
+  case CamProp::Privacy:
+    return V4l2Control{V4L2_CID_PRIVACY};
+  case CamProp::PanRelative:
+    return V4l2Control{V4L2_CID_PAN_RELATIVE};
+  case CamProp::TiltRelative:
+    return V4l2Control{V4L2_CID_TILT_RELATIVE};
+  case CamProp::ZoomRelative:
+    return V4l2Control{V4L2_CID_ZOOM_CONTINUOUS};
+  case CamProp::FocusRelative:
+    return V4l2Control{V4L2_CID_FOCUS_RELATIVE};
+  case CamProp::IrisRelative:
+    return V4l2Control{V4L2_CID_IRIS_RELATIVE};
+  case CamProp::BacklightCompensation:
+    return V4l2Control{V4L2_CID_BACKLIGHT_COMPENSATION};
+  default:
+    return std::nullopt;
+  }
+}
+
+std::optional<V4l2Control> control_for(VidProp prop) {
+  switch (prop) {
+  case VidProp::Brightness:
+    return V4l2Control{V4L2_CID_BRIGHTNESS};
+  case VidProp::Contrast:
+    return V4l2Control{V4L2_CID_CONTRAST};
+  case VidProp::Hue:
+    return V4l2Control{V4L2_CID_HUE, V4L2_CID_HUE_AUTO};
+  case VidProp::Saturation:
+    return V4l2Control{V4L2_CID_SATURATION};
+  case VidProp::Sharpness:
+    return V4l2Control{V4L2_CID_SHARPNESS};
+  case VidProp::Gamma:
+    return V4l2Control{V4L2_CID_GAMMA};
+  case VidProp::WhiteBalance:
+    return V4l2Control{V4L2_CID_WHITE_BALANCE_TEMPERATURE,
+                       V4L2_CID_AUTO_WHITE_BALANCE};
+  case VidProp::BacklightCompensation:
+    return V4l2Control{V4L2_CID_BACKLIGHT_COMPENSATION};
+  case VidProp::Gain:
+    return V4l2Control{V4L2_CID_GAIN, V4L2_CID_AUTOGAIN};
+  case VidProp::PowerLineFrequency:
+    return V4l2Control{V4L2_CID_POWER_LINE_FREQUENCY};
+  default:
+    return std::nullopt;
+  }
+}
+
+int xioctl(int fd, unsigned long request, void *arg) {
+  int result;
+  do {
+    result = ::ioctl(fd, request, arg);
+  } while (result == -1 && errno == EINTR);
+  return result;
+}
+
+/// Map an errno from a V4L2 call to a library error
+Error errno_error(int error, const std::string &what) {
+  ErrorCode code = ErrorCode::SystemError;
+  switch (error) {
+  case ENODEV:
+  case ENOENT:
+  case ENXIO:
+    code = ErrorCode::DeviceNotFound;
+    break;
+  case EACCES:
+  case EPERM:
+    code = ErrorCode::PermissionDenied;
+    break;
+  case EINVAL:
+    code = ErrorCode::PropertyNotSupported;
+    break;
+  case ERANGE:
+    code = ErrorCode::InvalidValue;
+    break;
+  case EBUSY:
+  case EAGAIN:
+    code = ErrorCode::DeviceBusy;
+    break;
+  default:
+    break;
+  }
+  return Error(code, what + ": " + std::strerror(error));
+}
+
+/// Open file descriptor, closed on destruction
+class FileHandle {
+public:
+  explicit FileHandle(const std::string &path)
+      : fd_(::open(path.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC)) {}
+  ~FileHandle() {
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+  }
+
+  FileHandle(const FileHandle &) = delete;
+  FileHandle &operator=(const FileHandle &) = delete;
+
+  int get() const { return fd_; }
+  explicit operator bool() const { return fd_ >= 0; }
+
+private:
+  int fd_;
+};
+
+/// Card name of a node if it captures video
+std::optional<std::string> capture_card(int fd) {
+  v4l2_capability cap{};
+  if (xioctl(fd, VIDIOC_QUERYCAP, &cap) != 0) {
+    return std::nullopt;
+  }
+  uint32_t caps = (cap.capabilities & V4L2_CAP_DEVICE_CAPS) ? cap.device_caps
+                                                           : cap.capabilities;
+  if (!(caps & V4L2_CAP_VIDEO_CAPTURE)) {
+    return std::nullopt; // Metadata and output nodes of the same camera
+  }
+  return std::string(reinterpret_cast<const char *>(cap.card),
+                     strnlen(reinterpret_cast<const char *>(cap.card),
+                             sizeof(cap.card)));
+}
+
+/// /dev/videoN nodes in N order
+std::vector<std::string> video_nodes() {
+  std::vector<std::pair<int, std::string>> nodes;
+  std::error_code ec;
+  for (const auto &entry : std::filesystem::directory_iterator("/dev", ec)) {
+    std::string name = entry.path().filename().string();
+    if (name.size() > 5 && name.compare(0, 5, "video") == 0 &&
+        std::all_of(name.begin() + 5, name.end(),
+                    [](char c) { return c >= '0' && c <= '9'; })) {
+      nodes.emplace_back(std::stoi(name.substr(5)), entry.path().string());
+    }
+  }
+  std::sort(nodes.begin(), nodes.end());
+  std::vector<std::string> paths;
+  for (auto &node : nodes) {
+    paths.push_back(std::move(node.second));
+  }
+  return paths;
+}
+
+class V4l2Connection : public IDeviceConnection {
+public:
+  explicit V4l2Connection(const std::string &path) : file_(path) {}
+
+  bool is_valid() const override {
+    v4l2_capability cap{};
+    return file_ && xioctl(file_.get(), VIDIOC_QUERYCAP, &cap) == 0;
+  }
+
+  Result<PropSetting> get_camera_property(CamProp prop) override {
+    return get(control_for(prop));
+  }
+
+  Result<void> set_camera_property(CamProp prop,
+                                   const PropSetting &setting) override {
+    return set(control_for(prop), setting);
+  }
+
+  Result<PropRange> get_camera_property_range(CamProp prop) override {
+    return range(control_for(prop));
+  }
+
+  Result<PropSetting> get_video_property(VidProp prop) override {
+    return get(control_for(prop));
+  }
+
+  Result<void> set_video_property(VidProp prop,
+                                  const PropSetting &setting) override {
+    return set(control_for(prop), setting);
+  }
+
+  Result<PropRange> get_video_property_range(VidProp prop) override {
+    return range(control_for(prop));
+  }
+
+private:
+  static Error unmapped() {
+    return Error(ErrorCode::PropertyNotSupported, "No V4L2 control for property");
+  }
+
+  bool read(uint32_t id, int32_t &value) const {
+    v4l2_control control{};
+    control.id = id;
+    if (xioctl(file_.get(), VIDIOC_G_CTRL, &control) != 0) {
+      return false;
+    }
+    value = control.value;
+    return true;
+  }
+
+  bool write(uint32_t id, int32_t value) {
+    v4l2_control control{};
+    control.id = id;
+    control.value = value;
+    return xioctl(file_.get(), VIDIOC_S_CTRL, &control) == 0;
+  }
+
+  Result<PropSetting> get(const std::optional<V4l2Control> &control) {
+    if (!control) {
+      return Result<PropSetting>(unmapped());
+    }
+    int32_t value = 0;
+    if (!read(control->id, value)) {
+      return Result<PropSetting>(errno_error(errno, "VIDIOC_G_CTRL"));
+    }
+    CamMode mode = CamMode::Manual;
+    int32_t automatic = 0;
+    if (control->auto_id && read(control->auto_id, automatic) &&
+        automatic != control->manual) {
+      mode = CamMode::Auto;
+    }
+    return Ok(PropSetting(value, mode));
+  }
+
+  Result<void> set(const std::optional<V4l2Control> &control,
+                   const PropSetting &setting) {
+    if (!control) {
+      return Result<void>(unmapped());
+    }
+    if (setting.mode == CamMode::Auto) {
+      if (!control->auto_id) {
+        return Err<void>(ErrorCode::PropertyNotSupported,
+                         "Property has no automatic mode");
+      }
+      // Exposure: UVC cameras offer aperture priority or full auto
+      if (!write(control->auto_id, control->automatic) &&
+          !(control->auto_id == V4L2_CID_EXPOSURE_AUTO &&
+            write(control->auto_id, V4L2_EXPOSURE_AUTO))) {
+        return Result<void>(errno_error(errno, "VIDIOC_S_CTRL (auto)"));
+      }
+      return Ok();
+    }
+    if (control->auto_id && !write(control->auto_id, control->manual) &&
+        errno != EINVAL) {
+      return Result<void>(errno_error(errno, "VIDIOC_S_CTRL (manual)"));
+    }
+    if (!write(control->id, setting.value)) {
+      return Result<void>(errno_error(errno, "VIDIOC_S_CTRL"));
+    }
+    return Ok();
+  }
+
+  Result<PropRange> range(const std::optional<V4l2Control> &control) {
+    if (!control) {
+      return Result<PropRange>(unmapped());
+    }
+    v4l2_queryctrl query{};
+    query.id = control->id;
+    if (xioctl(file_.get(), VIDIOC_QUERYCTRL, &query) != 0) {
+      return Result<PropRange>(errno_error(errno, "VIDIOC_QUERYCTRL"));
+    }
+    if (query.flags & V4L2_CTRL_FLAG_DISABLED) {
+      return Err<PropRange>(ErrorCode::PropertyNotSupported, "Control disabled");
+    }
+    PropRange range;
+    range.min = query.minimum;
+    range.max = query.maximum;
+    range.step = std::max(query.step, 1);
+    range.default_val = query.default_value;
+    range.default_mode = CamMode::Manual;
+    if (control->auto_id) {
+      v4l2_queryctrl automatic{};
+      automatic.id = control->auto_id;
+      if (xioctl(file_.get(), VIDIOC_QUERYCTRL, &automatic) == 0 &&
+          automatic.default_value != control->manual) {
+        range.default_mode = CamMode::Auto;
+      }
+    }
+    return Ok(range);
+  }
+
+  FileHandle file_;
+};
+
+class V4l2PlatformInterface : public IPlatformInterface {
+public:
+  Result<std::vector<Device>> list_devices() override {
+    std::vector<Device> devices;
+    for (const auto &path : video_nodes()) {
+      FileHandle file(path);
+      if (!file) {
+        continue;
+      }
+      if (auto card = capture_card(file.get())) {
+        devices.emplace_back(to_wstring(*card), to_wstring(path));
+      }
+    }
+    return Ok(std::move(devices));
+  }
+
+  Result<bool> is_device_connected(const Device &device) override {
+    FileHandle file(to_utf8(device.path));
+    return Ok(file && capture_card(file.get()).has_value());
+  }
+
+  Result<std::unique_ptr<IDeviceConnection>>
+  create_connection(const Device &device) override {
+    std::string path = to_utf8(device.path);
+    auto connection = std::make_unique<V4l2Connection>(path);
+    if (!connection->is_valid()) {
+      return Err<std::unique_ptr<IDeviceConnection>>(
+          errno == EACCES || errno == EPERM ? ErrorCode::PermissionDenied
+                                            : ErrorCode::DeviceNotFound,
+          "Cannot open " + path);
+    }
+    return Ok(std::unique_ptr<IDeviceConnection>(std::move(connection)));
+  }
+};
+
+} // namespace
+
+std::unique_ptr<IPlatformInterface> create_v4l2_platform_interface() {
+  return std::make_unique<V4l2PlatformInterface>();
+}
+
+} // namespace duvc
+
+#endif // __linux__
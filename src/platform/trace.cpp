@@ -0,0 +1,774 @@
+/**
+ * @file trace.cpp
+ * @brief Device interaction trace recording and replay implementation
+ */
+
+#include <duvc-ctl/core/device_identity.h>
+#include <duvc-ctl/detail/binary_io.h>
+#include <duvc-ctl/platform/trace.h>
+#include <duvc-ctl/utils/string_conversion.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <thread>
+
+namespace duvc {
+
+const char *to_string(TraceOp op) {
+  switch (op) {
+  case TraceOp::ListDevices:
+    return "ListDevices";
+  case TraceOp::IsDeviceConnected:
+    return "IsDeviceConnected";
+  case TraceOp::CreateConnection:
+    return "CreateConnection";
+  case TraceOp::GetCameraProperty:
+    return "GetCameraProperty";
+  case TraceOp::SetCameraProperty:
+    return "SetCameraProperty";
+  case TraceOp::GetCameraPropertyRange:
+    return "GetCameraPropertyRange";
+  case TraceOp::GetVideoProperty:
+    return "GetVideoProperty";
+  case TraceOp::SetVideoProperty:
+    return "SetVideoProperty";
+  case TraceOp::GetVideoPropertyRange:
+    return "GetVideoPropertyRange";
+  default:
+    return "Unknown";
+  }
+}
+
+namespace {
+
+using detail::has_magic;
+using detail::put;
+using detail::put_string;
+using detail::Reader;
+
+bool is_property_op(TraceOp op) { return op >= TraceOp::GetCameraProperty; }
+
+bool is_video_op(TraceOp op) { return op >= TraceOp::GetVideoProperty; }
+
+bool is_set_op(TraceOp op) {
+  return op == TraceOp::SetCameraProperty || op == TraceOp::SetVideoProperty;
+}
+
+bool is_get_op(TraceOp op) {
+  return op == TraceOp::GetCameraProperty || op == TraceOp::GetVideoProperty;
+}
+
+bool is_range_op(TraceOp op) {
+  return op == TraceOp::GetCameraPropertyRange ||
+         op == TraceOp::GetVideoPropertyRange;
+}
+
+/// Key under which a device is recorded and looked up
+std::wstring device_key(const Device &device) {
+  DeviceIdentity identity = parse_device_identity(device.path);
+  return identity.key.empty() ? device.path : identity.key;
+}
+
+// ============================================================================
+// Binary trace format
+// ============================================================================
+//
+// "DUVCTRC" + version byte, u32 device_count, then per device (little-endian):
+// u16 name_length, name, u16 path_length, path (UTF-8). Then u32 event_count
+// and per event: u8 op, u8 error code, u32 latency (us); u32 device unless
+// ListDevices; u8 property for property calls; u8 mode and i32 value for set
+// calls. A failed call ends with u16 message_length and message; a successful
+// one with its result: u8 mode and i32 value (get), i32 min, max, step,
+// default and u8 mode (range), u8 connected (IsDeviceConnected) or u32 count
+// and u32 device indices (ListDevices).
+
+constexpr char trace_magic[] = {'D', 'U', 'V', 'C', 'T', 'R', 'C', 1};
+
+Result<Trace> trace_error(const std::string &message) {
+  return Err<Trace>(ErrorCode::InvalidArgument, "Invalid trace: " + message);
+}
+
+bool valid_mode(uint64_t mode) {
+  return mode <= static_cast<uint8_t>(CamMode::Manual);
+}
+
+bool get_setting(Reader &reader, PropSetting &setting) {
+  uint64_t mode;
+  if (!reader.get(mode, 1) || !valid_mode(mode) ||
+      !reader.get_int(setting.value)) {
+    return false;
+  }
+  setting.mode = static_cast<CamMode>(mode);
+  return true;
+}
+
+/// Decode the fields after op, error and latency
+bool get_event(Reader &reader, TraceEvent &event, size_t device_count) {
+  if (event.op != TraceOp::ListDevices) {
+    uint64_t device;
+    if (!reader.get(device, 4) || device >= device_count) {
+      return false;
+    }
+    event.device = static_cast<uint32_t>(device);
+  }
+  if (is_property_op(event.op)) {
+    uint64_t prop;
+    uint64_t last = is_video_op(event.op)
+                        ? static_cast<uint8_t>(VidProp::PowerLineFrequency)
+                        : static_cast<uint8_t>(CamProp::Lamp);
+    if (!reader.get(prop, 1) || prop > last) {
+      return false;
+    }
+    event.property = static_cast<uint8_t>(prop);
+  }
+  if (is_set_op(event.op) && !get_setting(reader, event.argument)) {
+    return false;
+  }
+
+  if (event.error != ErrorCode::Success) {
+    return reader.get_string(event.message);
+  }
+  if (is_get_op(event.op)) {
+    return get_setting(reader, event.setting);
+  }
+  if (is_range_op(event.op)) {
+    uint64_t mode;
+    if (!reader.get_int(event.range.min) || !reader.get_int(event.range.max) ||
+        !reader.get_int(event.range.step) ||
+        !reader.get_int(event.range.default_val) || !reader.get(mode, 1) ||
+        !valid_mode(mode)) {
+      return false;
+    }
+    event.range.default_mode = static_cast<CamMode>(mode);
+    return true;
+  }
+  if (event.op == TraceOp::IsDeviceConnected) {
+    uint64_t connected;
+    if (!reader.get(connected, 1) || connected > 1) {
+      return false;
+    }
+    event.connected = connected != 0;
+    return true;
+  }
+  if (event.op == TraceOp::ListDevices) {
+    uint64_t count;
+    if (!reader.get(count, 4) || count > reader.remaining() / 4) {
+      return false;
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+      uint64_t index;
+      if (!reader.get(index, 4) || index >= device_count) {
+        return false;
+      }
+      event.listed.push_back(static_cast<uint32_t>(index));
+    }
+  }
+  return true;
+}
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+using Clock = std::chrono::steady_clock;
+
+std::chrono::microseconds elapsed_since(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() -
+                                                               start);
+}
+
+template <typename T> void set_outcome(TraceEvent &event, const Result<T> &result) {
+  if (result.is_error()) {
+    event.error = result.error().code();
+    event.message = result.error().message();
+  }
+}
+
+class RecordingConnection : public IDeviceConnection {
+public:
+  RecordingConnection(std::unique_ptr<IDeviceConnection> inner, Device device,
+                      std::shared_ptr<TraceRecorder> recorder)
+      : inner_(std::move(inner)), device_(std::move(device)),
+        recorder_(std::move(recorder)) {}
+
+  bool is_valid() const override { return inner_->is_valid(); }
+
+  Result<PropSetting> get_camera_property(CamProp prop) override {
+    return get(TraceOp::GetCameraProperty, static_cast<uint8_t>(prop),
+               [&] { return inner_->get_camera_property(prop); });
+  }
+
+  Result<void> set_camera_property(CamProp prop,
+                                   const PropSetting &setting) override {
+    return set(TraceOp::SetCameraProperty, static_cast<uint8_t>(prop), setting,
+               [&] { return inner_->set_camera_property(prop, setting); });
+  }
+
+  Result<PropRange> get_camera_property_range(CamProp prop) override {
+    return range(TraceOp::GetCameraPropertyRange, static_cast<uint8_t>(prop),
+                 [&] { return inner_->get_camera_property_range(prop); });
+  }
+
+  Result<PropSetting> get_video_property(VidProp prop) override {
+    return get(TraceOp::GetVideoProperty, static_cast<uint8_t>(prop),
+               [&] { return inner_->get_video_property(prop); });
+  }
+
+  Result<void> set_video_property(VidProp prop,
+                                  const PropSetting &setting) override {
+    return set(TraceOp::SetVideoProperty, static_cast<uint8_t>(prop), setting,
+               [&] { return inner_->set_video_property(prop, setting); });
+  }
+
+  Result<PropRange> get_video_property_range(VidProp prop) override {
+    return range(TraceOp::GetVideoPropertyRange, static_cast<uint8_t>(prop),
+                 [&] { return inner_->get_video_property_range(prop); });
+  }
+
+private:
+  template <typename Call>
+  Result<PropSetting> get(TraceOp op, uint8_t prop, Call call) {
+    TraceEvent event;
+    event.op = op;
+    event.property = prop;
+    auto start = Clock::now();
+    auto result = call();
+    event.latency = elapsed_since(start);
+    set_outcome(event, result);
+    if (result.is_ok()) {
+      event.setting = result.value();
+    }
+    recorder_->record(device_, std::move(event));
+    return result;
+  }
+
+  template <typename Call>
+  Result<void> set(TraceOp op, uint8_t prop, const PropSetting &setting,
+                   Call call) {
+    TraceEvent event;
+    event.op = op;
+    event.property = prop;
+    event.argument = setting;
+    auto start = Clock::now();
+    auto result = call();
+    event.latency = elapsed_since(start);
+    set_outcome(event, result);
+    recorder_->record(device_, std::move(event));
+    return result;
+  }
+
+  template <typename Call>
+  Result<PropRange> range(TraceOp op, uint8_t prop, Call call) {
+    TraceEvent event;
+    event.op = op;
+    event.property = prop;
+    auto start = Clock::now();
+    auto result = call();
+    event.latency = elapsed_since(start);
+    set_outcome(event, result);
+    if (result.is_ok()) {
+      event.range = result.value();
+    }
+    recorder_->record(device_, std::move(event));
+    return result;
+  }
+
+  std::unique_ptr<IDeviceConnection> inner_;
+  Device device_;
+  std::shared_ptr<TraceRecorder> recorder_;
+};
+
+class RecordingPlatform : public IPlatformInterface {
+public:
+  RecordingPlatform(std::unique_ptr<IPlatformInterface> inner,
+                    std::shared_ptr<TraceRecorder> recorder)
+      : inner_(std::move(inner)), recorder_(std::move(recorder)) {}
+
+  Result<std::vector<Device>> list_devices() override {
+    TraceEvent event;
+    event.op = TraceOp::ListDevices;
+    auto start = Clock::now();
+    auto result = inner_->list_devices();
+    event.latency = elapsed_since(start);
+    set_outcome(event, result);
+    recorder_->record_list(result.is_ok() ? result.value()
+                                          : std::vector<Device>(),
+                           std::move(event));
+    return result;
+  }
+
+  Result<bool> is_device_connected(const Device &device) override {
+    TraceEvent event;
+    event.op = TraceOp::IsDeviceConnected;
+    auto start = Clock::now();
+    auto result = inner_->is_device_connected(device);
+    event.latency = elapsed_since(start);
+    set_outcome(event, result);
+    event.connected = result.is_ok() && result.value();
+    recorder_->record(device, std::move(event));
+    return result;
+  }
+
+  Result<std::unique_ptr<IDeviceConnection>>
+  create_connection(const Device &device) override {
+    TraceEvent event;
+    event.op = TraceOp::CreateConnection;
+    auto start = Clock::now();
+    auto result = inner_->create_connection(device);
+    event.latency = elapsed_since(start);
+    set_outcome(event, result);
+    recorder_->record(device, std::move(event));
+    if (result.is_error()) {
+      return result;
+    }
+    return Ok(make_recording_connection(std::move(result).value(), device,
+                                        recorder_));
+  }
+
+private:
+  std::unique_ptr<IPlatformInterface> inner_;
+  std::shared_ptr<TraceRecorder> recorder_;
+};
+
+// ============================================================================
+// Replay
+// ============================================================================
+
+/// Position in a trace, shared by a replay platform and its connections
+class ReplayState {
+public:
+  ReplayState(std::shared_ptr<const Trace> trace, ReplayOptions options)
+      : trace_(std::move(trace)), options_(options) {
+    for (size_t i = 0; i < trace_->devices.size(); ++i) {
+      devices_.emplace(device_key(trace_->devices[i]),
+                       static_cast<uint32_t>(i));
+    }
+    for (const auto &event : trace_->events) {
+      calls_[call_key(event.op, event.device, event.property)].responses.push_back(
+          &event);
+    }
+  }
+
+  const Trace &trace() const { return *trace_; }
+
+  /// Find a recorded device (-1 if unknown)
+  int64_t find_device(const Device &device) const {
+    auto it = devices_.find(device_key(device));
+    return it == devices_.end() ? -1 : static_cast<int64_t>(it->second);
+  }
+
+  /// Take the next recorded response to a call and wait out its latency
+  /// (nullptr if the call was never recorded)
+  const TraceEvent *next(TraceOp op, uint32_t device, uint8_t property) {
+    const TraceEvent *event = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = calls_.find(call_key(op, device, property));
+      if (it == calls_.end()) {
+        return nullptr;
+      }
+      Call &call = it->second;
+      if (call.cursor == call.responses.size()) {
+        call.cursor = options_.loop ? 0 : call.responses.size() - 1;
+      }
+      event = call.responses[call.cursor++];
+    }
+    if (options_.time_scale > 0 && event->latency.count() > 0) {
+      std::this_thread::sleep_for(
+          std::chrono::duration<double, std::micro>(event->latency.count() *
+                                                    options_.time_scale));
+    }
+    return event;
+  }
+
+private:
+  struct Call {
+    std::vector<const TraceEvent *> responses;
+    size_t cursor = 0;
+  };
+
+  static uint64_t call_key(TraceOp op, uint32_t device, uint8_t property) {
+    if (op == TraceOp::ListDevices) {
+      device = 0;
+    }
+    return (static_cast<uint64_t>(device) << 16) |
+           (static_cast<uint64_t>(op) << 8) | property;
+  }
+
+  std::shared_ptr<const Trace> trace_;
+  ReplayOptions options_;
+  std::unordered_map<std::wstring, uint32_t> devices_;
+
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, Call> calls_;
+};
+
+template <typename T> Result<T> replayed_error(const TraceEvent &event) {
+  return Err<T>(event.error, event.message);
+}
+
+template <typename T> Result<T> not_recorded(TraceOp op) {
+  return Err<T>(ErrorCode::PropertyNotSupported,
+                std::string("No recorded response to ") + to_string(op));
+}
+
+class ReplayConnection : public IDeviceConnection {
+public:
+  ReplayConnection(std::shared_ptr<ReplayState> state, uint32_t device)
+      : state_(std::move(state)), device_(device) {}
+
+  bool is_valid() const override { return true; }
+
+  Result<PropSetting> get_camera_property(CamProp prop) override {
+    return get(TraceOp::GetCameraProperty, static_cast<uint8_t>(prop));
+  }
+
+  Result<void> set_camera_property(CamProp prop, const PropSetting &) override {
+    return set(TraceOp::SetCameraProperty, static_cast<uint8_t>(prop));
+  }
+
+  Result<PropRange> get_camera_property_range(CamProp prop) override {
+    return range(TraceOp::GetCameraPropertyRange, static_cast<uint8_t>(prop));
+  }
+
+  Result<PropSetting> get_video_property(VidProp prop) override {
+    return get(TraceOp::GetVideoProperty, static_cast<uint8_t>(prop));
+  }
+
+  Result<void> set_video_property(VidProp prop, const PropSetting &) override {
+    return set(TraceOp::SetVideoProperty, static_cast<uint8_t>(prop));
+  }
+
+  Result<PropRange> get_video_property_range(VidProp prop) override {
+    return range(TraceOp::GetVideoPropertyRange, static_cast<uint8_t>(prop));
+  }
+
+private:
+  Result<PropSetting> get(TraceOp op, uint8_t prop) {
+    const TraceEvent *event = state_->next(op, device_, prop);
+    if (!event) {
+      return not_recorded<PropSetting>(op);
+    }
+    if (event->error != ErrorCode::Success) {
+      return replayed_error<PropSetting>(*event);
+    }
+    return Ok(event->setting);
+  }
+
+  Result<void> set(TraceOp op, uint8_t prop) {
+    const TraceEvent *event = state_->next(op, device_, prop);
+    if (!event) {
+      return not_recorded<void>(op);
+    }
+    if (event->error != ErrorCode::Success) {
+      return replayed_error<void>(*event);
+    }
+    return Ok();
+  }
+
+  Result<PropRange> range(TraceOp op, uint8_t prop) {
+    const TraceEvent *event = state_->next(op, device_, prop);
+    if (!event) {
+      return not_recorded<PropRange>(op);
+    }
+    if (event->error != ErrorCode::Success) {
+      return replayed_error<PropRange>(*event);
+    }
+    return Ok(event->range);
+  }
+
+  std::shared_ptr<ReplayState> state_;
+  uint32_t device_;
+};
+
+class ReplayPlatform : public IPlatformInterface {
+public:
+  explicit ReplayPlatform(std::shared_ptr<ReplayState> state)
+      : state_(std::move(state)) {}
+
+  Result<std::vector<Device>> list_devices() override {
+    const TraceEvent *event = state_->next(TraceOp::ListDevices, 0, 0);
+    if (!event) {
+      return Ok(state_->trace().devices);
+    }
+    if (event->error != ErrorCode::Success) {
+      return replayed_error<std::vector<Device>>(*event);
+    }
+    std::vector<Device> devices;
+    devices.reserve(event->listed.size());
+    for (uint32_t index : event->listed) {
+      devices.push_back(state_->trace().devices[index]);
+    }
+    return Ok(std::move(devices));
+  }
+
+  Result<bool> is_device_connected(const Device &device) override {
+    int64_t index = state_->find_device(device);
+    if (index < 0) {
+      return Ok(false);
+    }
+    const TraceEvent *event = state_->next(TraceOp::IsDeviceConnected,
+                                           static_cast<uint32_t>(index), 0);
+    if (!event) {
+      return Ok(true);
+    }
+    if (event->error != ErrorCode::Success) {
+      return replayed_error<bool>(*event);
+    }
+    return Ok(event->connected);
+  }
+
+  Result<std::unique_ptr<IDeviceConnection>>
+  create_connection(const Device &device) override {
+    int64_t index = state_->find_device(device);
+    if (index < 0) {
+      return Err<std::unique_ptr<IDeviceConnection>>(
+          ErrorCode::DeviceNotFound, "Device not in trace");
+    }
+    auto device_index = static_cast<uint32_t>(index);
+    const TraceEvent *event =
+        state_->next(TraceOp::CreateConnection, device_index, 0);
+    if (event && event->error != ErrorCode::Success) {
+      return replayed_error<std::unique_ptr<IDeviceConnection>>(*event);
+    }
+    return Ok(std::unique_ptr<IDeviceConnection>(
+        std::make_unique<ReplayConnection>(state_, device_index)));
+  }
+
+private:
+  std::shared_ptr<ReplayState> state_;
+};
+
+} // namespace
+
+// ============================================================================
+// Trace files
+// ============================================================================
+
+std::vector<uint8_t> serialize_trace(const Trace &trace) {
+  std::vector<uint8_t> out(std::begin(trace_magic), std::end(trace_magic));
+  put(out, trace.devices.size(), 4);
+  for (const auto &device : trace.devices) {
+    put_string(out, to_utf8(device.name));
+    put_string(out, to_utf8(device.path));
+  }
+  put(out, trace.events.size(), 4);
+  for (const auto &event : trace.events) {
+    put(out, static_cast<uint8_t>(event.op), 1);
+    put(out, static_cast<uint8_t>(event.error), 1);
+    put(out,
+        static_cast<uint32_t>(std::min<int64_t>(
+            std::max<int64_t>(event.latency.count(), 0), 0xFFFFFFFF)),
+        4);
+    if (event.op != TraceOp::ListDevices) {
+      put(out, event.device, 4);
+    }
+    if (is_property_op(event.op)) {
+      put(out, event.property, 1);
+    }
+    if (is_set_op(event.op)) {
+      put(out, static_cast<uint8_t>(event.argument.mode), 1);
+      put(out, static_cast<uint32_t>(event.argument.value), 4);
+    }
+
+    if (event.error != ErrorCode::Success) {
+      put_string(out, event.message);
+    } else if (is_get_op(event.op)) {
+      put(out, static_cast<uint8_t>(event.setting.mode), 1);
+      put(out, static_cast<uint32_t>(event.setting.value), 4);
+    } else if (is_range_op(event.op)) {
+      put(out, static_cast<uint32_t>(event.range.min), 4);
+      put(out, static_cast<uint32_t>(event.range.max), 4);
+      put(out, static_cast<uint32_t>(event.range.step), 4);
+      put(out, static_cast<uint32_t>(event.range.default_val), 4);
+      put(out, static_cast<uint8_t>(event.range.default_mode), 1);
+    } else if (event.op == TraceOp::IsDeviceConnected) {
+      put(out, event.connected ? 1 : 0, 1);
+    } else if (event.op == TraceOp::ListDevices) {
+      put(out, event.listed.size(), 4);
+      for (uint32_t index : event.listed) {
+        put(out, index, 4);
+      }
+    }
+  }
+  return out;
+}
+
+Result<Trace> parse_trace(const std::vector<uint8_t> &data) {
+  if (!has_magic(data, trace_magic)) {
+    return trace_error("bad header");
+  }
+  Reader reader(data, sizeof(trace_magic));
+
+  Trace trace;
+  uint64_t devices;
+  if (!reader.get(devices, 4) || devices > reader.remaining() / 4) {
+    return trace_error("truncated");
+  }
+  for (uint64_t i = 0; i < devices; ++i) {
+    std::string name, path;
+    if (!reader.get_string(name) || !reader.get_string(path)) {
+      return trace_error("truncated device " + std::to_string(i));
+    }
+    trace.devices.emplace_back(to_wstring(name), to_wstring(path));
+  }
+
+  uint64_t events;
+  if (!reader.get(events, 4) || events > reader.remaining() / 6) {
+    return trace_error("truncated");
+  }
+  trace.events.reserve(events);
+  for (uint64_t i = 0; i < events; ++i) {
+    uint64_t op, error, latency;
+    if (!reader.get(op, 1) || !reader.get(error, 1) || !reader.get(latency, 4)) {
+      return trace_error("truncated event " + std::to_string(i));
+    }
+    if (op > static_cast<uint8_t>(TraceOp::GetVideoPropertyRange) ||
+        error > static_cast<uint8_t>(ErrorCode::NotImplemented)) {
+      return trace_error("invalid event " + std::to_string(i));
+    }
+    TraceEvent event;
+    event.op = static_cast<TraceOp>(op);
+    event.error = static_cast<ErrorCode>(error);
+    event.latency = std::chrono::microseconds(latency);
+    if (!get_event(reader, event, trace.devices.size())) {
+      return trace_error("invalid event " + std::to_string(i));
+    }
+    trace.events.push_back(std::move(event));
+  }
+  if (!reader.at_end()) {
+    return trace_error("trailing data");
+  }
+  return Ok(std::move(trace));
+}
+
+Result<void> save_trace(const Trace &trace, const std::filesystem::path &path) {
+  std::error_code ec;
+  if (path.has_parent_path()) {
+    std::filesystem::create_directories(path.parent_path(), ec);
+  }
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  auto data = serialize_trace(trace);
+  file.write(reinterpret_cast<const char *>(data.data()),
+             static_cast<std::streamsize>(data.size()));
+  if (!file.flush()) {
+    return Err<void>(ErrorCode::SystemError,
+                     "Cannot write trace: " + path.u8string());
+  }
+  return Ok();
+}
+
+Result<Trace> load_trace(const std::filesystem::path &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return Err<Trace>(ErrorCode::SystemError,
+                      "Cannot open trace: " + path.u8string());
+  }
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+  return parse_trace(data);
+}
+
+// ============================================================================
+// TraceRecorder
+// ============================================================================
+
+uint32_t TraceRecorder::device_index(const Device &device) {
+  auto inserted = index_.emplace(device_key(device),
+                                 static_cast<uint32_t>(trace_.devices.size()));
+  if (inserted.second) {
+    trace_.devices.push_back(device);
+  }
+  return inserted.first->second;
+}
+
+void TraceRecorder::record(const Device &device, TraceEvent event) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  event.device = device_index(device);
+  trace_.events.push_back(std::move(event));
+}
+
+void TraceRecorder::record_list(const std::vector<Device> &devices,
+                                TraceEvent event) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  event.device = 0;
+  event.listed.clear();
+  for (const auto &device : devices) {
+    event.listed.push_back(device_index(device));
+  }
+  trace_.events.push_back(std::move(event));
+}
+
+Trace TraceRecorder::snapshot() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return trace_;
+}
+
+size_t TraceRecorder::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return trace_.events.size();
+}
+
+void TraceRecorder::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  trace_ = Trace();
+  index_.clear();
+}
+
+// ============================================================================
+// Factories
+// ============================================================================
+
+std::unique_ptr<IPlatformInterface>
+make_recording_platform(std::unique_ptr<IPlatformInterface> inner,
+                        std::shared_ptr<TraceRecorder> recorder) {
+  if (!inner || !recorder) {
+    return inner;
+  }
+  return std::make_unique<RecordingPlatform>(std::move(inner),
+                                             std::move(recorder));
+}
+
+std::unique_ptr<IDeviceConnection>
+make_recording_connection(std::unique_ptr<IDeviceConnection> inner,
+                          const Device &device,
+                          std::shared_ptr<TraceRecorder> recorder) {
+  if (!inner || !recorder) {
+    return inner;
+  }
+  return std::make_unique<RecordingConnection>(std::move(inner), device,
+                                               std::move(recorder));
+}
+
+std::unique_ptr<IPlatformInterface>
+make_replay_platform(std::shared_ptr<const Trace> trace, ReplayOptions options) {
+  return std::make_unique<ReplayPlatform>(
+      std::make_shared<ReplayState>(std::move(trace), options));
+}
+
+void install_trace_recorder(std::shared_ptr<TraceRecorder> recorder) {
+  if (!recorder) {
+    set_platform_interface_factory(nullptr);
+    return;
+  }
+  set_platform_interface_factory([recorder] {
+    return make_recording_platform(create_native_platform_interface(),
+                                   recorder);
+  });
+}
+
+void install_trace_replay(std::shared_ptr<const Trace> trace,
+                          ReplayOptions options) {
+  if (!trace) {
+    set_platform_interface_factory(nullptr);
+    return;
+  }
+  auto state = std::make_shared<ReplayState>(std::move(trace), options);
+  set_platform_interface_factory([state]() -> std::unique_ptr<IPlatformInterface> {
+    return std::make_unique<ReplayPlatform>(state);
+  });
+}
+
+} // namespace duvc
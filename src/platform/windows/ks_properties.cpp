@@ -19,7 +19,7 @@ namespace detail {
     com_ptr<IBaseFilter> open_device_filter(const Device& dev);
 }
 
-KsPropertySet::KsPropertySet(const Device &device) : device_(device), mfksproxy_dll_(nullptr) {
+KsPropertySet::KsPropertySet(const Device &device) : device_(intern_device(device)), mfksproxy_dll_(nullptr) {
     try {
         // VALIDATION 1: Check device validity before any operations
         if (!device.is_valid()) {
@@ -29,7 +29,7 @@ KsPropertySet::KsPropertySet(const Device &device) : device_(device), mfksproxy_
         }
 
         // VALIDATION 2: Attempt to open device filter with null check
-        auto filter = detail::open_device_filter(device_);
+        auto filter = detail::open_device_filter(*device_);
         if (!filter) {
             throw std::runtime_error(
                 "Failed to obtain device filter. Device may not be properly opened "
@@ -0,0 +1,333 @@
+/**
+ * @file json.cpp
+ * @brief Minimal JSON reader implementation
+ */
+
+#include <duvc-ctl/utils/json.h>
+
+#include <charconv>
+
+namespace duvc {
+
+const JsonValue *JsonValue::find(const std::string &key) const {
+  for (const auto &member : object_) {
+    if (member.first == key) {
+      return &member.second;
+    }
+  }
+  return nullptr;
+}
+
+/// Recursive-descent parser; fills JsonValue internals directly
+class JsonParser {
+public:
+  explicit JsonParser(const std::string &text) : text_(text) {}
+
+  Result<JsonValue> parse() {
+    JsonValue value;
+    skip_whitespace();
+    if (!parse_value(value, 0)) {
+      return fail();
+    }
+    skip_whitespace();
+    if (pos_ != text_.size()) {
+      error_ = "unexpected trailing characters";
+      return fail();
+    }
+    return Ok(std::move(value));
+  }
+
+private:
+  static constexpr int max_depth = 64;
+
+  Result<JsonValue> fail() const {
+    return Err<JsonValue>(ErrorCode::InvalidArgument,
+                          "Invalid JSON at offset " + std::to_string(pos_) +
+                              ": " + error_);
+  }
+
+  bool error(const char *message) {
+    error_ = message;
+    return false;
+  }
+
+  void skip_whitespace() {
+    while (pos_ < text_.size() &&
+           (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\n' ||
+            text_[pos_] == '\r')) {
+      ++pos_;
+    }
+  }
+
+  bool consume(char c) {
+    if (pos_ < text_.size() && text_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  bool consume_literal(const char *literal) {
+    size_t start = pos_;
+    for (const char *p = literal; *p; ++p) {
+      if (!consume(*p)) {
+        pos_ = start;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool parse_value(JsonValue &out, int depth) {
+    if (depth > max_depth) {
+      return error("nesting too deep");
+    }
+    if (pos_ >= text_.size()) {
+      return error("unexpected end of input");
+    }
+    char c = text_[pos_];
+    if (c == '{') {
+      return parse_object(out, depth);
+    }
+    if (c == '[') {
+      return parse_array(out, depth);
+    }
+    if (c == '"') {
+      out.type_ = JsonValue::Type::String;
+      return parse_string(out.string_);
+    }
+    if (c == '-' || (c >= '0' && c <= '9')) {
+      return parse_number(out);
+    }
+    if (consume_literal("true")) {
+      out.type_ = JsonValue::Type::Bool;
+      out.bool_ = true;
+      return true;
+    }
+    if (consume_literal("false")) {
+      out.type_ = JsonValue::Type::Bool;
+      return true;
+    }
+    if (consume_literal("null")) {
+      return true;
+    }
+    return error("unexpected character");
+  }
+
+  bool parse_object(JsonValue &out, int depth) {
+    ++pos_; // '{'
+    out.type_ = JsonValue::Type::Object;
+    skip_whitespace();
+    if (consume('}')) {
+      return true;
+    }
+    while (true) {
+      skip_whitespace();
+      std::string key;
+      if (pos_ >= text_.size() || text_[pos_] != '"') {
+        return error("expected member name");
+      }
+      if (!parse_string(key)) {
+        return false;
+      }
+      skip_whitespace();
+      if (!consume(':')) {
+        return error("expected ':'");
+      }
+      skip_whitespace();
+      JsonValue value;
+      if (!parse_value(value, depth + 1)) {
+        return false;
+      }
+      out.object_.emplace_back(std::move(key), std::move(value));
+      skip_whitespace();
+      if (consume('}')) {
+        return true;
+      }
+      if (!consume(',')) {
+        return error("expected ',' or '}'");
+      }
+    }
+  }
+
+  bool parse_array(JsonValue &out, int depth) {
+    ++pos_; // '['
+    out.type_ = JsonValue::Type::Array;
+    skip_whitespace();
+    if (consume(']')) {
+      return true;
+    }
+    while (true) {
+      skip_whitespace();
+      JsonValue value;
+      if (!parse_value(value, depth + 1)) {
+        return false;
+      }
+      out.array_.push_back(std::move(value));
+      skip_whitespace();
+      if (consume(']')) {
+        return true;
+      }
+      if (!consume(',')) {
+        return error("expected ',' or ']'");
+      }
+    }
+  }
+
+  bool parse_number(JsonValue &out) {
+    size_t start = pos_;
+    consume('-');
+    if (!consume('0')) {
+      if (pos_ >= text_.size() || text_[pos_] < '1' || text_[pos_] > '9') {
+        return error("invalid number");
+      }
+      skip_digits();
+    }
+    if (consume('.')) {
+      if (!skip_digits()) {
+        return error("invalid number");
+      }
+    }
+    if (consume('e') || consume('E')) {
+      if (!consume('+')) {
+        consume('-');
+      }
+      if (!skip_digits()) {
+        return error("invalid number");
+      }
+    }
+    // from_chars ignores the C locale, which may use a decimal comma
+    out.type_ = JsonValue::Type::Number;
+    auto parsed = std::from_chars(text_.data() + start, text_.data() + pos_,
+                                  out.number_);
+    if (parsed.ec != std::errc()) {
+      pos_ = start;
+      return error("number out of range");
+    }
+    return true;
+  }
+
+  bool skip_digits() {
+    size_t start = pos_;
+    while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9') {
+      ++pos_;
+    }
+    return pos_ > start;
+  }
+
+  bool parse_hex4(unsigned &out) {
+    if (text_.size() - pos_ < 4) {
+      return error("truncated \\u escape");
+    }
+    out = 0;
+    for (int i = 0; i < 4; ++i) {
+      char c = text_[pos_++];
+      out <<= 4;
+      if (c >= '0' && c <= '9') {
+        out |= static_cast<unsigned>(c - '0');
+      } else if (c >= 'a' && c <= 'f') {
+        out |= static_cast<unsigned>(c - 'a' + 10);
+      } else if (c >= 'A' && c <= 'F') {
+        out |= static_cast<unsigned>(c - 'A' + 10);
+      } else {
+        return error("invalid \\u escape");
+      }
+    }
+    return true;
+  }
+
+  static void append_utf8(std::string &out, unsigned cp) {
+    if (cp < 0x80) {
+      out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+      out += static_cast<char>(0xC0 | (cp >> 6));
+      out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+      out += static_cast<char>(0xE0 | (cp >> 12));
+      out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+      out += static_cast<char>(0xF0 | (cp >> 18));
+      out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+      out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+  }
+
+  bool parse_string(std::string &out) {
+    ++pos_; // '"'
+    while (pos_ < text_.size()) {
+      char c = text_[pos_++];
+      if (c == '"') {
+        return true;
+      }
+      if (static_cast<unsigned char>(c) < 0x20) {
+        return error("control character in string");
+      }
+      if (c != '\\') {
+        out += c;
+        continue;
+      }
+      if (pos_ >= text_.size()) {
+        break;
+      }
+      switch (text_[pos_++]) {
+      case '"':
+        out += '"';
+        break;
+      case '\\':
+        out += '\\';
+        break;
+      case '/':
+        out += '/';
+        break;
+      case 'b':
+        out += '\b';
+        break;
+      case 'f':
+        out += '\f';
+        break;
+      case 'n':
+        out += '\n';
+        break;
+      case 'r':
+        out += '\r';
+        break;
+      case 't':
+        out += '\t';
+        break;
+      case 'u': {
+        unsigned cp;
+        if (!parse_hex4(cp)) {
+          return false;
+        }
+        if (cp >= 0xD800 && cp <= 0xDBFF) {
+          unsigned low;
+          if (!consume('\\') || !consume('u') || !parse_hex4(low) ||
+              low < 0xDC00 || low > 0xDFFF) {
+            return error("unpaired surrogate");
+          }
+          cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+        } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+          return error("unpaired surrogate");
+        }
+        append_utf8(out, cp);
+        break;
+      }
+      default:
+        return error("invalid escape");
+      }
+    }
+    return error("unterminated string");
+  }
+
+  const std::string &text_;
+  size_t pos_ = 0;
+  std::string error_;
+};
+
+Result<JsonValue> parse_json(const std::string &text) {
+  return JsonParser(text).parse();
+}
+
+} // namespace duvc
@@ -3,19 +3,22 @@
  * @brief Logging system implementation
  */
 
+#include <atomic>
 #include <chrono>
 #include <duvc-ctl/utils/logging.h>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <sstream>
 
 namespace duvc {
 
-// Global logging state
+// Global logging state. The level is atomic so suppressed records cost one
+// load; the callback is swapped under the mutex but invoked outside it.
 static std::mutex g_log_mutex;
-static LogCallback g_log_callback = nullptr;
-static LogLevel g_min_log_level = LogLevel::Info;
+static std::shared_ptr<const LogCallback> g_log_callback;
+static std::atomic<LogLevel> g_min_log_level{LogLevel::Info};
 
 const char *to_string(LogLevel level) {
   switch (level) {
@@ -71,32 +74,42 @@ static void default_log_callback(LogLevel level, const std::string &message) {
 }
 
 void set_log_callback(LogCallback callback) {
+  auto next = callback ? std::make_shared<const LogCallback>(std::move(callback))
+                       : nullptr;
   std::lock_guard<std::mutex> lock(g_log_mutex);
-  g_log_callback = callback;
+  // The previous callback is released after the lock (calls still running
+  // it hold their own reference)
+  g_log_callback.swap(next);
 }
 
 void set_log_level(LogLevel level) {
-  std::lock_guard<std::mutex> lock(g_log_mutex);
-  g_min_log_level = level;
+  g_min_log_level.store(level, std::memory_order_relaxed);
 }
 
 LogLevel get_log_level() {
-  std::lock_guard<std::mutex> lock(g_log_mutex);
-  return g_min_log_level;
+  return g_min_log_level.load(std::memory_order_relaxed);
 }
 
-void log_message(LogLevel level, const std::string &message) {
-  std::lock_guard<std::mutex> lock(g_log_mutex);
+bool log_enabled(LogLevel level) {
+  return level >= g_min_log_level.load(std::memory_order_relaxed);
+}
 
+void log_message(LogLevel level, const std::string &message) {
   // Check minimum log level
-  if (level < g_min_log_level) {
+  if (!log_enabled(level)) {
     return;
   }
 
+  std::shared_ptr<const LogCallback> callback;
+  {
+    std::lock_guard<std::mutex> lock(g_log_mutex);
+    callback = g_log_callback;
+  }
+
   // Use callback if set, otherwise use default
-  if (g_log_callback) {
+  if (callback) {
     try {
-      g_log_callback(level, message);
+      (*callback)(level, message);
     } catch (...) {
       // If user callback throws, fall back to default
       default_log_callback(LogLevel::Error,
@@ -0,0 +1,615 @@
+/**
+ * @file serializer.cpp
+ * @brief Streaming JSON, JSON Lines, CSV and MessagePack writer implementation
+ */
+
+#include <duvc-ctl/utils/serializer.h>
+#include <duvc-ctl/utils/utf8.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace duvc {
+
+namespace {
+
+/// Whether a UTF-8 byte must be escaped inside a JSON string
+bool json_needs_escape(unsigned char c) {
+  return c < 0x20 || c == '"' || c == '\\';
+}
+
+/// Whether a CSV field must be quoted
+bool csv_needs_quotes(std::string_view text) {
+  return text.find_first_of(",\"\r\n") != std::string_view::npos;
+}
+
+} // namespace
+
+Serializer::Serializer(SerialFormat format) : format_(format) {}
+
+std::string Serializer::take() {
+  std::string bytes;
+  bytes.swap(out_);
+  header_buffered_ = false;
+  row_ends_.clear();
+  return bytes;
+}
+
+void Serializer::clear() {
+  out_.clear();
+  header_buffered_ = false;
+  row_ends_.clear();
+}
+
+// ============================================================================
+// Structure
+// ============================================================================
+
+Serializer &Serializer::begin_object() {
+  begin(Frame::Object);
+  return *this;
+}
+
+Serializer &Serializer::end_object() {
+  end(Frame::Object);
+  return *this;
+}
+
+Serializer &Serializer::begin_array() {
+  begin(Frame::Array);
+  return *this;
+}
+
+Serializer &Serializer::end_array() {
+  end(Frame::Array);
+  return *this;
+}
+
+void Serializer::begin(Frame frame) {
+  before_value();
+  Scope scope{frame};
+  if (msgpack()) {
+    scope.header = out_.size();
+    out_.append(5, '\0');
+  } else if (csv()) {
+    if (frame == Frame::Array && scopes_.empty()) {
+      path_ = "value";
+    }
+    if (frame == Frame::Array && !joining_) {
+      // The whole array becomes one cell
+      joining_ = true;
+      join_depth_ = scopes_.size();
+      join_items_ = 0;
+      join_target_ = &cell();
+    }
+    scope.path = path_.size();
+  } else {
+    out_.push_back(frame == Frame::Object ? '{' : '[');
+  }
+  scopes_.push_back(scope);
+}
+
+void Serializer::end(Frame frame) {
+  if (scopes_.empty() || scopes_.back().frame != frame) {
+    return;
+  }
+  Scope scope = scopes_.back();
+  scopes_.pop_back();
+  if (msgpack()) {
+    pack_container_end(scope);
+  } else if (csv()) {
+    if (joining_ && scopes_.size() == join_depth_) {
+      joining_ = false;
+    }
+  } else {
+    out_.push_back(frame == Frame::Object ? '}' : ']');
+  }
+  after_value();
+}
+
+void Serializer::before_value() {
+  if (scopes_.empty()) {
+    if (csv()) {
+      csv_begin_record();
+    }
+    return;
+  }
+  Scope &scope = scopes_.back();
+  if (scope.frame == Frame::Array) {
+    if (scope.count > 0 && !msgpack() && !csv()) {
+      out_.push_back(',');
+    }
+    ++scope.count;
+  }
+}
+
+void Serializer::after_value() {
+  if (!scopes_.empty()) {
+    return;
+  }
+  if (format_ == SerialFormat::JsonLines) {
+    out_.push_back('\n');
+  } else if (csv()) {
+    csv_end_record();
+  }
+}
+
+Serializer &Serializer::key(std::string_view name) {
+  if (scopes_.empty() || scopes_.back().frame != Frame::Object) {
+    return *this;
+  }
+  Scope &scope = scopes_.back();
+  if (msgpack()) {
+    pack_str_header(name.size());
+    out_.append(name.data(), name.size());
+  } else if (csv()) {
+    if (!joining_) {
+      path_.resize(scope.path);
+      if (scope.path > 0) {
+        path_.push_back('.');
+      }
+      path_.append(name.data(), name.size());
+    }
+  } else {
+    if (scope.count > 0) {
+      out_.push_back(',');
+    }
+    json_string(name.data(), name.size());
+    out_.push_back(':');
+  }
+  ++scope.count;
+  return *this;
+}
+
+Serializer &Serializer::key(std::wstring_view name) {
+  if (scopes_.empty() || scopes_.back().frame != Frame::Object) {
+    return *this;
+  }
+  Scope &scope = scopes_.back();
+  if (msgpack()) {
+    size_t length = utf8_length(name.data(), name.size());
+    pack_str_header(length);
+    size_t at = out_.size();
+    out_.resize(at + length);
+    encode_utf8(name.data(), name.size(), &out_[at]);
+  } else if (csv()) {
+    if (!joining_) {
+      path_.resize(scope.path);
+      if (scope.path > 0) {
+        path_.push_back('.');
+      }
+      size_t at = path_.size();
+      path_.resize(at + utf8_length(name.data(), name.size()));
+      encode_utf8(name.data(), name.size(), &path_[at]);
+    }
+  } else {
+    if (scope.count > 0) {
+      out_.push_back(',');
+    }
+    json_wide(name);
+    out_.push_back(':');
+  }
+  ++scope.count;
+  return *this;
+}
+
+// ============================================================================
+// Scalars
+// ============================================================================
+
+Serializer &Serializer::value(std::string_view text) {
+  before_value();
+  if (msgpack()) {
+    pack_str_header(text.size());
+    out_.append(text.data(), text.size());
+  } else if (csv()) {
+    csv_scalar(text);
+  } else {
+    json_string(text.data(), text.size());
+  }
+  after_value();
+  return *this;
+}
+
+Serializer &Serializer::value(std::wstring_view text) {
+  before_value();
+  if (msgpack()) {
+    size_t length = utf8_length(text.data(), text.size());
+    pack_str_header(length);
+    size_t at = out_.size();
+    out_.resize(at + length);
+    encode_utf8(text.data(), text.size(), &out_[at]);
+  } else if (csv()) {
+    csv_wide(text);
+  } else {
+    json_wide(text);
+  }
+  after_value();
+  return *this;
+}
+
+Serializer &Serializer::value(bool flag) {
+  before_value();
+  if (msgpack()) {
+    pack_byte(flag ? 0xc3 : 0xc2);
+  } else if (csv()) {
+    csv_scalar(flag ? "true" : "false");
+  } else {
+    out_.append(flag ? "true" : "false");
+  }
+  after_value();
+  return *this;
+}
+
+Serializer &Serializer::value(double number) {
+  if (msgpack()) {
+    before_value();
+    uint64_t bits;
+    std::memcpy(&bits, &number, sizeof(bits));
+    pack_byte(0xcb);
+    pack_be(bits, 8);
+    after_value();
+    return *this;
+  }
+  if (!std::isfinite(number)) {
+    return null();
+  }
+  before_value();
+  char digits[32];
+  auto end = std::to_chars(digits, digits + sizeof(digits), number).ptr;
+  if (csv()) {
+    csv_scalar(std::string_view(digits, end - digits));
+  } else {
+    out_.append(digits, end);
+  }
+  after_value();
+  return *this;
+}
+
+Serializer &Serializer::null() {
+  before_value();
+  if (msgpack()) {
+    pack_byte(0xc0);
+  } else if (csv()) {
+    csv_scalar(std::string_view());
+  } else {
+    out_.append("null");
+  }
+  after_value();
+  return *this;
+}
+
+Serializer &Serializer::write_int(int64_t number) {
+  if (number >= 0) {
+    return write_uint(static_cast<uint64_t>(number));
+  }
+  before_value();
+  if (msgpack()) {
+    if (number >= -32) {
+      pack_byte(static_cast<uint8_t>(number));
+    } else if (number >= INT8_MIN) {
+      pack_byte(0xd0);
+      pack_be(static_cast<uint64_t>(number), 1);
+    } else if (number >= INT16_MIN) {
+      pack_byte(0xd1);
+      pack_be(static_cast<uint64_t>(number), 2);
+    } else if (number >= INT32_MIN) {
+      pack_byte(0xd2);
+      pack_be(static_cast<uint64_t>(number), 4);
+    } else {
+      pack_byte(0xd3);
+      pack_be(static_cast<uint64_t>(number), 8);
+    }
+  } else {
+    char digits[24];
+    auto end = std::to_chars(digits, digits + sizeof(digits), number).ptr;
+    if (csv()) {
+      csv_scalar(std::string_view(digits, end - digits));
+    } else {
+      out_.append(digits, end);
+    }
+  }
+  after_value();
+  return *this;
+}
+
+Serializer &Serializer::write_uint(uint64_t number) {
+  before_value();
+  if (msgpack()) {
+    if (number < 0x80) {
+      pack_byte(static_cast<uint8_t>(number));
+    } else if (number <= UINT8_MAX) {
+      pack_byte(0xcc);
+      pack_be(number, 1);
+    } else if (number <= UINT16_MAX) {
+      pack_byte(0xcd);
+      pack_be(number, 2);
+    } else if (number <= UINT32_MAX) {
+      pack_byte(0xce);
+      pack_be(number, 4);
+    } else {
+      pack_byte(0xcf);
+      pack_be(number, 8);
+    }
+  } else {
+    char digits[24];
+    auto end = std::to_chars(digits, digits + sizeof(digits), number).ptr;
+    if (csv()) {
+      csv_scalar(std::string_view(digits, end - digits));
+    } else {
+      out_.append(digits, end);
+    }
+  }
+  after_value();
+  return *this;
+}
+
+// ============================================================================
+// JSON
+// ============================================================================
+
+void Serializer::json_string(const char *text, size_t length) {
+  static const char hex[] = "0123456789abcdef";
+  out_.push_back('"');
+  size_t run = 0; // Start of the pending run of unescaped bytes
+  for (size_t i = 0; i < length; ++i) {
+    unsigned char c = static_cast<unsigned char>(text[i]);
+    if (!json_needs_escape(c)) {
+      continue;
+    }
+    out_.append(text + run, i - run);
+    run = i + 1;
+    switch (c) {
+    case '"':
+      out_.append("\\\"");
+      break;
+    case '\\':
+      out_.append("\\\\");
+      break;
+    case '\n':
+      out_.append("\\n");
+      break;
+    case '\r':
+      out_.append("\\r");
+      break;
+    case '\t':
+      out_.append("\\t");
+      break;
+    case '\b':
+      out_.append("\\b");
+      break;
+    case '\f':
+      out_.append("\\f");
+      break;
+    default:
+      out_.append("\\u00");
+      out_.push_back(hex[c >> 4]);
+      out_.push_back(hex[c & 0xf]);
+      break;
+    }
+  }
+  out_.append(text + run, length - run);
+  out_.push_back('"');
+}
+
+void Serializer::json_wide(std::wstring_view text) {
+  // Transcode straight into the output; escape afterwards only if needed
+  size_t start = out_.size();
+  size_t length = utf8_length(text.data(), text.size());
+  out_.push_back('"');
+  out_.resize(start + 1 + length);
+  encode_utf8(text.data(), text.size(), &out_[start + 1]);
+  for (size_t i = start + 1; i < out_.size(); ++i) {
+    if (json_needs_escape(static_cast<unsigned char>(out_[i]))) {
+      scratch_.assign(out_, start + 1, length);
+      out_.resize(start);
+      json_string(scratch_.data(), scratch_.size());
+      return;
+    }
+  }
+  out_.push_back('"');
+}
+
+// ============================================================================
+// MessagePack
+// ============================================================================
+
+void Serializer::pack_be(uint64_t bits, int bytes) {
+  for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+    out_.push_back(static_cast<char>((bits >> shift) & 0xff));
+  }
+}
+
+void Serializer::pack_str_header(size_t length) {
+  if (length < 32) {
+    pack_byte(static_cast<uint8_t>(0xa0 | length));
+  } else if (length <= UINT8_MAX) {
+    pack_byte(0xd9);
+    pack_be(length, 1);
+  } else if (length <= UINT16_MAX) {
+    pack_byte(0xda);
+    pack_be(length, 2);
+  } else {
+    pack_byte(0xdb);
+    pack_be(length, 4);
+  }
+}
+
+void Serializer::pack_container_end(const Scope &scope) {
+  // The 5-byte placeholder shrinks to the smallest header for the count
+  bool object = scope.frame == Frame::Object;
+  uint32_t count = scope.count;
+  uint8_t header[5];
+  size_t size;
+  if (count < 16) {
+    header[0] = static_cast<uint8_t>((object ? 0x80 : 0x90) | count);
+    size = 1;
+  } else if (count <= UINT16_MAX) {
+    header[0] = object ? 0xde : 0xdc;
+    header[1] = static_cast<uint8_t>(count >> 8);
+    header[2] = static_cast<uint8_t>(count);
+    size = 3;
+  } else {
+    header[0] = object ? 0xdf : 0xdd;
+    for (int i = 0; i < 4; ++i) {
+      header[1 + i] = static_cast<uint8_t>(count >> (24 - 8 * i));
+    }
+    size = 5;
+  }
+  char *at = &out_[scope.header];
+  std::memcpy(at, header, size);
+  if (size < 5) {
+    size_t body = out_.size() - scope.header - 5;
+    std::memmove(at + size, at + 5, body);
+    out_.resize(out_.size() - (5 - size));
+  }
+}
+
+// ============================================================================
+// CSV
+// ============================================================================
+
+std::string &Serializer::cell() {
+  size_t index;
+  if (header_written_ && next_column_ < columns_.size() &&
+      columns_[next_column_] == path_) {
+    // Records usually repeat the previous record's layout
+    index = next_column_;
+  } else {
+    auto found = column_index_.find(path_);
+    if (found != column_index_.end()) {
+      index = found->second;
+    } else if (!header_written_ || header_buffered_) {
+      index = columns_.size();
+      column_index_.emplace(path_, index);
+      columns_.push_back(path_);
+      cells_.emplace_back();
+      filled_.push_back(false);
+    } else {
+      // The header has left the buffer, so the column cannot be added
+      if (std::find(dropped_columns_.begin(), dropped_columns_.end(), path_) ==
+          dropped_columns_.end()) {
+        dropped_columns_.push_back(path_);
+      }
+      scratch_.clear();
+      return scratch_;
+    }
+  }
+  next_column_ = index + 1;
+  filled_[index] = true;
+  cells_[index].clear();
+  return cells_[index];
+}
+
+void Serializer::csv_scalar(std::string_view text) {
+  if (scopes_.empty()) {
+    path_ = "value";
+  }
+  if (joining_) {
+    if (join_items_++ > 0) {
+      join_target_->push_back(';');
+    }
+    join_target_->append(text.data(), text.size());
+    return;
+  }
+  cell().assign(text.data(), text.size());
+}
+
+void Serializer::csv_wide(std::wstring_view text) {
+  if (scopes_.empty()) {
+    path_ = "value";
+  }
+  std::string *target;
+  if (joining_) {
+    target = join_target_;
+    if (join_items_++ > 0) {
+      target->push_back(';');
+    }
+  } else {
+    target = &cell();
+  }
+  size_t at = target->size();
+  target->resize(at + utf8_length(text.data(), text.size()));
+  encode_utf8(text.data(), text.size(), &(*target)[at]);
+}
+
+void Serializer::csv_begin_record() {
+  for (size_t i = 0; i < cells_.size(); ++i) {
+    cells_[i].clear();
+    filled_[i] = false;
+  }
+  next_column_ = 0;
+  path_.clear();
+  joining_ = false;
+}
+
+void Serializer::csv_end_record() {
+  if (!header_written_) {
+    csv_write_header();
+    header_written_ = true;
+    header_buffered_ = true;
+    row_ends_.push_back(out_.size());
+  } else if (columns_.size() > header_columns_) {
+    csv_extend_header();
+  }
+  for (size_t i = 0; i < columns_.size(); ++i) {
+    if (i > 0) {
+      out_.push_back(',');
+    }
+    if (filled_[i]) {
+      csv_append_quoted(out_, cells_[i]);
+    }
+  }
+  out_.push_back('\n');
+  if (header_buffered_) {
+    row_ends_.push_back(out_.size());
+  }
+}
+
+void Serializer::csv_write_header() {
+  for (size_t i = 0; i < columns_.size(); ++i) {
+    if (i > 0) {
+      out_.push_back(',');
+    }
+    csv_append_quoted(out_, columns_[i]);
+  }
+  out_.push_back('\n');
+  header_columns_ = columns_.size();
+}
+
+void Serializer::csv_extend_header() {
+  // Rewrite the buffered header and pad the earlier rows with empty cells
+  // for the new columns, which are appended after the existing ones
+  std::string rows;
+  rows.swap(out_);
+  size_t added = columns_.size() - header_columns_;
+  size_t start = row_ends_[0];
+  csv_write_header();
+  row_ends_[0] = out_.size();
+  for (size_t i = 1; i < row_ends_.size(); ++i) {
+    out_.append(rows, start, row_ends_[i] - 1 - start);
+    out_.append(added, ',');
+    out_.push_back('\n');
+    start = row_ends_[i];
+    row_ends_[i] = out_.size();
+  }
+}
+
+void Serializer::csv_append_quoted(std::string &target, std::string_view text) {
+  if (!csv_needs_quotes(text)) {
+    target.append(text.data(), text.size());
+    return;
+  }
+  target.push_back('"');
+  for (char c : text) {
+    if (c == '"') {
+      target.push_back('"');
+    }
+    target.push_back(c);
+  }
+  target.push_back('"');
+}
+
+} // namespace duvc
@@ -4,9 +4,9 @@
  */
 
 #include <duvc-ctl/utils/string_conversion.h>
-#include <stdexcept>
+#include <duvc-ctl/utils/utf8.h>
+#include <cctype>
 #include <string>
-#include <windows.h>
 
 namespace duvc {
 
@@ -195,40 +195,50 @@ const wchar_t *to_wstring(CamMode m) {
 }
 
 std::string to_utf8(const std::wstring &wstr) {
-  if (wstr.empty()) {
-    return std::string();
-  }
-  int size_needed = WideCharToMultiByte(CP_UTF8, 0, &wstr[0], (int)wstr.size(),
-                                        NULL, 0, NULL, NULL);
-  if (size_needed == 0) {
-    throw std::runtime_error("WideCharToMultiByte failed.");
-  }
-  std::string str_to(size_needed, 0);
-  WideCharToMultiByte(CP_UTF8, 0, &wstr[0], (int)wstr.size(), &str_to[0],
-                      size_needed, NULL, NULL);
-  return str_to;
+  std::string result(utf8_length(wstr.data(), wstr.size()), '\0');
+  encode_utf8(wstr.data(), wstr.size(), result.data());
+  return result;
 }
 
 std::wstring to_wstring(const std::string &str) {
-#ifdef _WIN32
-  if (str.empty())
-    return std::wstring();
-  
-  int size = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, nullptr, 0);
-  if (size <= 0)
-    return std::wstring();
-  
-  std::wstring result(size - 1, L'\0');
-  MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, &result[0], size);
+  std::wstring result(wide_length(str.data(), str.size()), L'\0');
+  decode_utf8(str.data(), str.size(), result.data());
   return result;
-#else
-  std::wstring result;
-  result.reserve(str.size());
-  for (char c : str) {
-    result.push_back(static_cast<wchar_t>(static_cast<unsigned char>(c)));
+}
+
+namespace {
+
+bool equals_ignore_case(const std::string &a, const char *b) {
+  size_t i = 0;
+  for (; i < a.size() && b[i]; ++i) {
+    if (std::tolower(static_cast<unsigned char>(a[i])) !=
+        std::tolower(static_cast<unsigned char>(b[i]))) {
+      return false;
+    }
   }
-  return result;
-#endif
+  return i == a.size() && !b[i];
+}
+
+} // namespace
+
+std::optional<CamProp> cam_prop_from_string(const std::string &name) {
+  for (int i = 0; i <= static_cast<int>(CamProp::Lamp); ++i) {
+    auto prop = static_cast<CamProp>(i);
+    if (equals_ignore_case(name, to_string(prop))) {
+      return prop;
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<VidProp> vid_prop_from_string(const std::string &name) {
+  for (int i = 0; i <= static_cast<int>(VidProp::PowerLineFrequency); ++i) {
+    auto prop = static_cast<VidProp>(i);
+    if (equals_ignore_case(name, to_string(prop))) {
+      return prop;
+    }
+  }
+  return std::nullopt;
 }
 
 } // namespace duvc
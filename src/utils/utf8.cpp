@@ -0,0 +1,291 @@
+/**
+ * @file utf8.cpp
+ * @brief Wide string <-> UTF-8 transcoding implementation
+ */
+
+#include <duvc-ctl/utils/utf8.h>
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DUVC_UTF8_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace duvc {
+
+namespace {
+
+constexpr bool kWide16 = sizeof(wchar_t) == 2;
+constexpr uint32_t kReplacement = 0xFFFD;
+
+// ============================================================================
+// ASCII runs
+// ============================================================================
+
+/// Narrow the leading ASCII run of text into out (when Write) and return its
+/// length
+template <bool Write>
+size_t ascii_run(const wchar_t *text, size_t length, char *out) {
+  size_t i = 0;
+#ifdef DUVC_UTF8_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  if constexpr (kWide16) {
+    const __m128i high = _mm_set1_epi16(static_cast<short>(0xFF80));
+    for (; i + 8 <= length; i += 8) {
+      __m128i v =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + i));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, high), zero)) !=
+          0xFFFF) {
+        break;
+      }
+      if (Write) {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + i),
+                         _mm_packus_epi16(v, v));
+      }
+    }
+  } else {
+    const __m128i high = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+    for (; i + 8 <= length; i += 8) {
+      __m128i a =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + i));
+      __m128i b =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + i + 4));
+      __m128i bits = _mm_and_si128(_mm_or_si128(a, b), high);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi32(bits, zero)) != 0xFFFF) {
+        break;
+      }
+      if (Write) {
+        __m128i words = _mm_packs_epi32(a, b);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + i),
+                         _mm_packus_epi16(words, words));
+      }
+    }
+  }
+#endif
+  for (; i < length; ++i) {
+    uint32_t c = static_cast<uint32_t>(text[i]);
+    if (c >= 0x80) {
+      break;
+    }
+    if (Write) {
+      out[i] = static_cast<char>(c);
+    }
+  }
+  return i;
+}
+
+/// Widen the leading ASCII run of text into out (when Write) and return its
+/// length
+template <bool Write>
+size_t ascii_run(const char *text, size_t length, wchar_t *out) {
+  size_t i = 0;
+#ifdef DUVC_UTF8_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + i));
+    if (_mm_movemask_epi8(v) != 0) {
+      break;
+    }
+    if (Write) {
+      __m128i lo = _mm_unpacklo_epi8(v, zero);
+      __m128i hi = _mm_unpackhi_epi8(v, zero);
+      auto *dst = reinterpret_cast<__m128i *>(out + i);
+      if constexpr (kWide16) {
+        _mm_storeu_si128(dst, lo);
+        _mm_storeu_si128(dst + 1, hi);
+      } else {
+        _mm_storeu_si128(dst, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi, zero));
+      }
+    }
+  }
+#else
+  // Eight bytes at a time: any set high bit ends the run
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, text + i, sizeof(word));
+    if (word & 0x8080808080808080ull) {
+      break;
+    }
+    if (Write) {
+      for (size_t k = 0; k < 8; ++k) {
+        out[i + k] = static_cast<wchar_t>(text[i + k]);
+      }
+    }
+  }
+#endif
+  for (; i < length; ++i) {
+    unsigned char c = static_cast<unsigned char>(text[i]);
+    if (c >= 0x80) {
+      break;
+    }
+    if (Write) {
+      out[i] = static_cast<wchar_t>(c);
+    }
+  }
+  return i;
+}
+
+// ============================================================================
+// Wide -> UTF-8
+// ============================================================================
+
+template <bool Write>
+size_t encode(const wchar_t *text, size_t length, char *out) {
+  size_t i = 0;
+  size_t o = 0;
+  while (i < length) {
+    size_t run =
+        ascii_run<Write>(text + i, length - i, Write ? out + o : nullptr);
+    i += run;
+    o += run;
+    if (i == length) {
+      break;
+    }
+
+    uint32_t cp = static_cast<uint32_t>(text[i]);
+    if constexpr (kWide16) {
+      cp &= 0xFFFF;
+    }
+    ++i;
+    if (cp >= 0xD800 && cp <= 0xDFFF) {
+      uint32_t low =
+          (kWide16 && cp <= 0xDBFF && i < length)
+              ? static_cast<uint32_t>(text[i]) & 0xFFFF
+              : 0;
+      if (low >= 0xDC00 && low <= 0xDFFF) {
+        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+        ++i;
+      } else {
+        cp = kReplacement;
+      }
+    } else if (cp > 0x10FFFF) {
+      cp = kReplacement;
+    }
+
+    if (cp < 0x800) {
+      if (Write) {
+        out[o] = static_cast<char>(0xC0 | (cp >> 6));
+        out[o + 1] = static_cast<char>(0x80 | (cp & 0x3F));
+      }
+      o += 2;
+    } else if (cp < 0x10000) {
+      if (Write) {
+        out[o] = static_cast<char>(0xE0 | (cp >> 12));
+        out[o + 1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[o + 2] = static_cast<char>(0x80 | (cp & 0x3F));
+      }
+      o += 3;
+    } else {
+      if (Write) {
+        out[o] = static_cast<char>(0xF0 | (cp >> 18));
+        out[o + 1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out[o + 2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[o + 3] = static_cast<char>(0x80 | (cp & 0x3F));
+      }
+      o += 4;
+    }
+  }
+  return o;
+}
+
+// ============================================================================
+// UTF-8 -> Wide
+// ============================================================================
+
+template <bool Write>
+size_t decode(const char *text, size_t length, wchar_t *out) {
+  const auto *bytes = reinterpret_cast<const unsigned char *>(text);
+  size_t i = 0;
+  size_t o = 0;
+  while (i < length) {
+    size_t run =
+        ascii_run<Write>(text + i, length - i, Write ? out + o : nullptr);
+    i += run;
+    o += run;
+    if (i == length) {
+      break;
+    }
+
+    // Well-formed sequences per Unicode table 3-7; the second byte range
+    // excludes overlongs, surrogates and code points above U+10FFFF
+    unsigned char lead = bytes[i];
+    size_t trail;
+    uint32_t cp;
+    unsigned char lo = 0x80;
+    unsigned char hi = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+      trail = 1;
+      cp = lead & 0x1F;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+      trail = 2;
+      cp = lead & 0x0F;
+      lo = lead == 0xE0 ? 0xA0 : lo;
+      hi = lead == 0xED ? 0x9F : hi;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+      trail = 3;
+      cp = lead & 0x07;
+      lo = lead == 0xF0 ? 0x90 : lo;
+      hi = lead == 0xF4 ? 0x8F : hi;
+    } else {
+      trail = 0;
+      cp = kReplacement;
+    }
+
+    // A broken sequence becomes one U+FFFD for its longest valid prefix
+    size_t used = 1;
+    for (; used <= trail; ++used) {
+      if (i + used >= length) {
+        break;
+      }
+      unsigned char b = bytes[i + used];
+      if (used == 1 ? (b < lo || b > hi) : (b < 0x80 || b > 0xBF)) {
+        break;
+      }
+      cp = (cp << 6) | (b & 0x3F);
+    }
+    if (used <= trail) {
+      cp = kReplacement;
+    }
+    i += used;
+
+    if (kWide16 && cp >= 0x10000) {
+      if (Write) {
+        out[o] = static_cast<wchar_t>(0xD800 + ((cp - 0x10000) >> 10));
+        out[o + 1] = static_cast<wchar_t>(0xDC00 + ((cp - 0x10000) & 0x3FF));
+      }
+      o += 2;
+    } else {
+      if (Write) {
+        out[o] = static_cast<wchar_t>(cp);
+      }
+      o += 1;
+    }
+  }
+  return o;
+}
+
+} // namespace
+
+size_t utf8_length(const wchar_t *text, size_t length) {
+  return encode<false>(text, length, nullptr);
+}
+
+size_t encode_utf8(const wchar_t *text, size_t length, char *out) {
+  return encode<true>(text, length, out);
+}
+
+size_t wide_length(const char *text, size_t length) {
+  return decode<false>(text, length, nullptr);
+}
+
+size_t decode_utf8(const char *text, size_t length, wchar_t *out) {
+  return decode<true>(text, length, out);
+}
+
+} // namespace duvc
@@ -0,0 +1,71 @@
+"""
+Operations-per-second benchmark for CameraController property access.
+
+Runs against the built-in fake PTZ camera (no hardware needed, on Windows or
+Linux), so the numbers are the cost of the Python API itself. The first rows
+call the core Camera binding directly and are the floor the controller paths
+are measured against. A scenario file adds device latency or other controls.
+
+Run: python tests/bindings/python/bench_controller.py [--iterations 20000]
+     [--scenario fake_scenario.json]
+"""
+import argparse
+import sys
+import time
+
+import duvc_ctl as duvc
+from duvc_ctl import CameraController
+
+
+def measure(label: str, operation, iterations: int) -> None:
+    operation()  # Warm up (range caches, connection)
+    start = time.perf_counter()
+    for _ in range(iterations):
+        operation()
+    elapsed = time.perf_counter() - start
+    print(f"{label:<36} {iterations / elapsed:>12.0f} {elapsed / iterations * 1e6:>10.2f}")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("--iterations", type=int, default=20000)
+    parser.add_argument("--scenario", help="Fake scenario JSON (default: built-in)")
+    args = parser.parse_args()
+    n = args.iterations
+
+    scenario = (duvc.load_fake_scenario(args.scenario) if args.scenario
+                else duvc.builtin_fake_scenario())
+    backend = duvc.FakeBackend(scenario)
+    duvc.install_fake_backend(backend)
+    try:
+        device = backend.devices()[0]
+        core = duvc.Camera(device)
+        cam = CameraController(device=device)
+        setting = duvc.PropSetting(128, duvc.CamMode.Manual)
+        bulk = {"brightness": 120, "contrast": 60, "saturation": 40}
+
+        print(f"{'operation':<36} {'ops/s':>12} {'us/op':>10}")
+        measure("core Camera.set (floor)",
+                lambda: core.set(duvc.VidProp.Brightness, setting), n)
+        measure("core Camera.get (floor)",
+                lambda: core.get_video_property(duvc.VidProp.Brightness), n)
+        measure("cam.brightness = value", lambda: setattr(cam, "brightness", 128), n)
+        measure("cam.brightness", lambda: cam.brightness, n)
+        measure("cam.set('bright', value)", lambda: cam.set("bright", 128), n)
+        measure("cam.set('zoom', value, 'manual')",
+                lambda: cam.set("zoom", 100, "manual"), n)
+        measure("cam.get('zoom')", lambda: cam.get("zoom"), n)
+        measure("cam.pan_relative(1)", lambda: cam.pan_relative(1), n)
+        measure("cam.set_multiple(3 properties)",
+                lambda: cam.set_multiple(bulk), max(1, n // 3))
+        measure("cam.get_multiple(3 properties)",
+                lambda: cam.get_multiple(list(bulk)), max(1, n // 3))
+        cam.close()
+        print(f"{backend.stats().calls} fake device calls")
+    finally:
+        duvc.install_fake_backend(None)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,103 @@
+"""
+Thread-scaling benchmark for the Camera bindings.
+
+Each thread drives its own camera, answered from a synthetic trace replay
+(no hardware needed), and the benchmark reports how throughput grows with
+the thread count. The replayed device latency is spent with the thread
+detached from the interpreter, so calls overlap even with the GIL; on a
+free-threaded build (python3.13t) the Python side of each call overlaps too.
+
+Run: python tests/bindings/python/bench_thread_scaling.py [--seconds 2]
+     [--latency-us 200] [--threads 1 2 4 8]
+"""
+import argparse
+import sys
+import threading
+import time
+from datetime import timedelta
+
+import duvc_ctl as duvc
+
+
+def make_trace(devices: int, latency_us: int) -> "duvc.Trace":
+    """One zoom read and one zoom write per device, looped by the replay."""
+    trace = duvc.Trace()
+    device_list = []
+    events = []
+    for index in range(devices):
+        device_list.append(duvc.Device(
+            f"Bench Camera {index}",
+            f"\\\\?\\usb#vid_046d&pid_085e&mi_00#7&{index:08x}&0&0000#"
+            "{65e8773d-8f56-11d0-a3b9-00a0c9223196}\\global"))
+        for op in (duvc.TraceOp.GetCameraProperty, duvc.TraceOp.SetCameraProperty):
+            event = duvc.TraceEvent()
+            event.op = op
+            event.device = index
+            event.property = int(duvc.CamProp.Zoom)
+            event.setting = duvc.PropSetting(100, duvc.CamMode.Manual)
+            event.latency = timedelta(microseconds=latency_us)
+            events.append(event)
+    trace.devices = device_list
+    trace.events = events
+    return trace
+
+
+def run(cameras, threads: int, seconds: float) -> int:
+    """Total operations completed by `threads` threads in `seconds`."""
+    counts = [0] * threads
+    start = threading.Barrier(threads + 1)
+    stop = threading.Event()
+
+    def worker(slot: int) -> None:
+        camera = cameras[slot]
+        setting = duvc.PropSetting(100, duvc.CamMode.Manual)
+        done = 0
+        start.wait()
+        while not stop.is_set():
+            camera.get_camera_property(duvc.CamProp.Zoom)
+            camera.set(duvc.CamProp.Zoom, setting)
+            done += 2
+        counts[slot] = done
+
+    pool = [threading.Thread(target=worker, args=(i,)) for i in range(threads)]
+    for thread in pool:
+        thread.start()
+    start.wait()
+    time.sleep(seconds)
+    stop.set()
+    for thread in pool:
+        thread.join()
+    return sum(counts)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("--seconds", type=float, default=2.0)
+    parser.add_argument("--latency-us", type=int, default=200,
+                        help="Replayed device latency per call")
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 2, 4, 8])
+    args = parser.parse_args()
+
+    gil = getattr(sys, "_is_gil_enabled", lambda: True)()
+    print(f"Python {sys.version.split()[0]}, GIL {'enabled' if gil else 'disabled'}")
+    print(f"Replayed latency {args.latency_us} us, {args.seconds:g} s per run")
+
+    trace = make_trace(max(args.threads), args.latency_us)
+    options = duvc.ReplayOptions()
+    options.time_scale = 1.0
+    duvc.install_trace_replay(trace, options)
+    try:
+        cameras = [duvc.Camera(device) for device in trace.devices]
+        baseline = None
+        print(f"{'threads':>8} {'ops/s':>12} {'scaling':>8}")
+        for threads in args.threads:
+            rate = run(cameras, threads, args.seconds) / args.seconds
+            baseline = baseline or rate / threads
+            print(f"{threads:>8} {rate:>12.0f} {rate / baseline:>7.2f}x")
+    finally:
+        duvc.install_trace_replay(None)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,466 @@
+// tests/cpp/soak/chaos_soak.cpp
+//
+// Soak test: drives the whole API surface from many threads against
+// simulated cameras wrapped in the chaos layer, then reports throughput,
+// tail latencies, errors and leaked connections, handles and threads.
+//
+// Usage: chaos_soak [--seconds N] [--threads N] [--devices N] [--seed N]
+// Exits nonzero on a stuck call or a leak.
+
+#include "duvc-ctl/core/camera.h"
+#include "duvc-ctl/core/device_actor.h"
+#include "duvc-ctl/core/preset.h"
+#include "duvc-ctl/core/reconciler.h"
+#include "duvc-ctl/core/scheduler.h"
+#include "duvc-ctl/platform/chaos.h"
+#include "support/simulated_device.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <filesystem>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+using namespace duvc;
+using namespace duvc::test;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// ============================================================================
+// Options
+// ============================================================================
+struct Options {
+    int seconds = 10;
+    int threads = 8;
+    int devices = 4;
+    uint64_t seed = 1;
+};
+
+Options parse_options(int argc, char **argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        long long value = std::atoll(argv[i + 1]);
+        if (std::strcmp(argv[i], "--seconds") == 0) {
+            options.seconds = static_cast<int>(value);
+        } else if (std::strcmp(argv[i], "--threads") == 0) {
+            options.threads = static_cast<int>(value);
+        } else if (std::strcmp(argv[i], "--devices") == 0) {
+            options.devices = static_cast<int>(value);
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            options.seed = static_cast<uint64_t>(value);
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            std::exit(2);
+        }
+    }
+    options.threads = std::max(options.threads, 1);
+    options.devices = std::max(options.devices, 1);
+    return options;
+}
+
+// ============================================================================
+// Process Resources
+// ============================================================================
+struct Resources {
+    long handles = 0; ///< Open file descriptors (handles on Windows)
+    long threads = 0;
+};
+
+Resources process_resources() {
+    Resources resources;
+#ifdef _WIN32
+    DWORD handles = 0;
+    GetProcessHandleCount(GetCurrentProcess(), &handles);
+    resources.handles = static_cast<long>(handles);
+    resources.threads = -1; // Not tracked; handle count covers thread handles
+#else
+    std::error_code ec;
+    for (auto it = std::filesystem::directory_iterator("/proc/self/fd", ec);
+         !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+        ++resources.handles;
+    }
+    for (auto it = std::filesystem::directory_iterator("/proc/self/task", ec);
+         !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+        ++resources.threads;
+    }
+#endif
+    return resources;
+}
+
+// ============================================================================
+// Measurements
+// ============================================================================
+enum class Op {
+    CameraGet,
+    CameraSet,
+    CameraRange,
+    VideoGet,
+    VideoSet,
+    VideoRange,
+    SetAndWait,
+    Recall,
+    Open,
+    List,
+    Sweep,
+    Count
+};
+
+constexpr std::array<const char *, static_cast<size_t>(Op::Count)> kOpNames = {
+    "camera get", "camera set", "camera range", "video get", "video set", "video range",
+    "set and wait", "preset recall", "camera open", "list devices", "reconcile sweep"};
+
+/// Latencies and errors of one thread, merged at the end
+struct Samples {
+    std::array<std::vector<int64_t>, static_cast<size_t>(Op::Count)> latency_us;
+    std::array<uint64_t, static_cast<size_t>(ErrorCode::NotImplemented) + 1> errors{};
+
+    template <typename F> void time(Op op, F &&f) {
+        auto start = Clock::now();
+        std::optional<ErrorCode> error = f();
+        latency_us[static_cast<size_t>(op)].push_back(
+            std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start)
+                .count());
+        if (error) {
+            ++errors[static_cast<size_t>(*error)];
+        }
+    }
+
+    void merge(const Samples &other) {
+        for (size_t op = 0; op < latency_us.size(); ++op) {
+            latency_us[op].insert(latency_us[op].end(), other.latency_us[op].begin(),
+                                  other.latency_us[op].end());
+        }
+        for (size_t code = 0; code < errors.size(); ++code) {
+            errors[code] += other.errors[code];
+        }
+    }
+};
+
+template <typename T> std::optional<ErrorCode> outcome(const Result<T> &result) {
+    if (result.is_ok()) {
+        return std::nullopt;
+    }
+    return result.error().code();
+}
+
+int64_t percentile(const std::vector<int64_t> &sorted, double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    auto index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+
+// ============================================================================
+// Fleet
+// ============================================================================
+Device fleet_device(int index) {
+    wchar_t path[160];
+    std::swprintf(path, 160,
+                  L"\\\\?\\usb#vid_046d&pid_%04x&mi_00#7&soak&0&%04d#"
+                  L"{65e8773d-8f56-11d0-a3b9-00a0c9223196}\\global",
+                  0x0800 + index, index);
+    return Device(L"Soak Cam " + std::to_wstring(index), path);
+}
+
+std::shared_ptr<SimulatedDeviceState> fleet_state() {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Zoom] = PropSetting(100, CamMode::Manual);
+    state->camera[CamProp::Pan] = PropSetting(0, CamMode::Manual);
+    state->camera[CamProp::Focus] = PropSetting(30, CamMode::Auto);
+    state->video[VidProp::Brightness] = PropSetting(50, CamMode::Manual);
+    state->video[VidProp::Contrast] = PropSetting(50, CamMode::Manual);
+    state->latency = std::chrono::microseconds(100);
+    return state;
+}
+
+Preset soak_preset(int variant) {
+    Preset preset;
+    preset.name = "soak" + std::to_string(variant);
+    preset.set(CamProp::Zoom, PropSetting(10 * variant, CamMode::Manual));
+    preset.set(CamProp::Focus, PropSetting(0, CamMode::Auto));
+    preset.set(VidProp::Brightness, PropSetting(40 + variant, CamMode::Manual));
+    return preset;
+}
+
+// ============================================================================
+// Workers
+// ============================================================================
+void worker(int id, const Options &options, const std::vector<Device> &devices,
+            Clock::time_point deadline, Samples &samples) {
+    std::mt19937_64 rng(options.seed * 7919 + static_cast<uint64_t>(id));
+    auto platform = create_platform_interface();
+
+    std::vector<std::unique_ptr<Camera>> cameras;
+    std::vector<std::unique_ptr<PresetRecaller>> recallers;
+    for (const auto &device : devices) {
+        cameras.push_back(std::make_unique<Camera>(device));
+        cameras.back()->set_timeout(std::chrono::milliseconds(500));
+        recallers.push_back(std::make_unique<PresetRecaller>(acquire_device_actor(device)));
+    }
+    const std::array<Preset, 3> presets = {soak_preset(1), soak_preset(2), soak_preset(3)};
+
+    SettleOptions settle;
+    settle.deadline = std::chrono::milliseconds(200);
+
+    while (Clock::now() < deadline) {
+        size_t index = rng() % devices.size();
+        Camera &camera = *cameras[index];
+        int value = static_cast<int>(rng() % 100);
+
+        switch (static_cast<Op>(rng() % (static_cast<size_t>(Op::Count) - 1))) {
+        case Op::CameraGet:
+            samples.time(Op::CameraGet, [&] { return outcome(camera.get(CamProp::Zoom)); });
+            break;
+        case Op::CameraSet:
+            samples.time(Op::CameraSet, [&] {
+                return outcome(camera.set(CamProp::Pan, PropSetting(value, CamMode::Manual)));
+            });
+            break;
+        case Op::CameraRange:
+            samples.time(Op::CameraRange,
+                         [&] { return outcome(camera.get_range(CamProp::Zoom)); });
+            break;
+        case Op::VideoGet:
+            samples.time(Op::VideoGet,
+                         [&] { return outcome(camera.get(VidProp::Brightness)); });
+            break;
+        case Op::VideoSet:
+            samples.time(Op::VideoSet, [&] {
+                return outcome(
+                    camera.set(VidProp::Contrast, PropSetting(value, CamMode::Manual)));
+            });
+            break;
+        case Op::VideoRange:
+            samples.time(Op::VideoRange,
+                         [&] { return outcome(camera.get_range(VidProp::Contrast)); });
+            break;
+        case Op::SetAndWait:
+            samples.time(Op::SetAndWait, [&] {
+                return outcome(camera.set_and_wait(
+                    CamProp::Zoom, PropSetting(value, CamMode::Manual), settle));
+            });
+            break;
+        case Op::Recall:
+            samples.time(Op::Recall, [&]() -> std::optional<ErrorCode> {
+                auto report = recallers[index]->recall(presets[rng() % presets.size()]);
+                if (report.failed > 0) {
+                    for (const auto &entry : report.entries) {
+                        if (entry.error) {
+                            return entry.error->code();
+                        }
+                    }
+                }
+                return std::nullopt;
+            });
+            break;
+        case Op::Open:
+            // Churn: a fresh camera shares the device actor
+            samples.time(Op::Open, [&] {
+                Camera fresh(devices[index]);
+                fresh.set_timeout(std::chrono::milliseconds(500));
+                return outcome(fresh.get(CamProp::Focus));
+            });
+            break;
+        case Op::List:
+            samples.time(Op::List, [&] { return outcome(platform->list_devices()); });
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void sweeper(const std::vector<Device> &devices, Clock::time_point deadline,
+             Samples &samples) {
+    auto state = parse_desired_state(
+        R"({"devices":[{"name":"Soak Cam *","properties":{"zoom":50,"brightness":60}}]})");
+    DesiredState desired = std::move(state).value();
+    desired.max_ops_per_second = 1000.0;
+
+    auto platform = std::shared_ptr<IPlatformInterface>(create_platform_interface());
+    Reconciler reconciler(std::move(desired), [platform, devices] {
+        auto listed = platform->list_devices();
+        return listed.is_ok() ? std::move(listed).value() : std::vector<Device>();
+    });
+    while (Clock::now() < deadline) {
+        samples.time(Op::Sweep, [&]() -> std::optional<ErrorCode> {
+            SweepReport report = reconciler.sweep();
+            if (report.failures > 0) {
+                return ErrorCode::SystemError;
+            }
+            return std::nullopt;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+}
+
+/// Unplugs random devices for random stretches
+void monkey(uint64_t seed, ChaosController &controller, const std::vector<Device> &devices,
+            Clock::time_point deadline) {
+    std::mt19937_64 rng(seed);
+    while (Clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50 + rng() % 100));
+        const Device &device = devices[rng() % devices.size()];
+        controller.remove(device, std::chrono::milliseconds(1 + rng() % 200));
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// Main
+// ============================================================================
+int main(int argc, char **argv) {
+    Options options = parse_options(argc, argv);
+
+    std::vector<Device> devices;
+    SimulatedPlatform simulated;
+    for (int i = 0; i < options.devices; ++i) {
+        devices.push_back(fleet_device(i));
+        simulated.add(devices.back(), fleet_state());
+    }
+
+    ChaosConfig config;
+    config.seed = options.seed;
+    config.error_rate = 0.02;
+    config.spike_rate = 0.01;
+    config.spike_latency = std::chrono::milliseconds(20);
+    config.hang_rate = 0.0005;
+    config.hang_duration = std::chrono::milliseconds(800);
+    config.removal_rate = 0.0005;
+    config.removal_duration = std::chrono::milliseconds(100);
+    auto controller = std::make_shared<ChaosController>(config);
+    install_chaos(controller, [simulated] {
+        return std::unique_ptr<IPlatformInterface>(std::make_unique<SimulatedPlatform>(simulated));
+    });
+
+    // Start process-wide workers before taking the baseline, and hold the
+    // device actors so their breaker counters survive the run
+    TaskScheduler::shared();
+    std::vector<std::shared_ptr<DeviceActor>> actors;
+    for (const auto &device : devices) {
+        actors.push_back(acquire_device_actor(device));
+    }
+
+    Resources before = process_resources();
+    auto start = Clock::now();
+    auto deadline = start + std::chrono::seconds(options.seconds);
+
+    std::vector<Samples> samples(static_cast<size_t>(options.threads) + 1);
+    {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < options.threads; ++i) {
+            threads.emplace_back(worker, i, std::cref(options), std::cref(devices), deadline,
+                                 std::ref(samples[static_cast<size_t>(i)]));
+        }
+        threads.emplace_back(sweeper, std::cref(devices), deadline, std::ref(samples.back()));
+        threads.emplace_back(monkey, options.seed, std::ref(*controller), std::cref(devices),
+                             deadline);
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    PolicyStats policy;
+    for (const auto &actor : actors) {
+        PolicyStats stats = actor->policy().stats();
+        policy.attempts += stats.attempts;
+        policy.retries += stats.retries;
+        policy.short_circuited += stats.short_circuited;
+        policy.trips += stats.trips;
+    }
+    actors.clear();
+
+    // Actors drain hung calls before their threads exit
+    ChaosStats chaos = controller->stats();
+    auto settle_deadline = Clock::now() + config.hang_duration + std::chrono::seconds(2);
+    Resources after = process_resources();
+    while ((controller->stats().open_connections > 0 || after.threads > before.threads ||
+            after.handles > before.handles) &&
+           Clock::now() < settle_deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        after = process_resources();
+    }
+    uint64_t leaked_connections = controller->stats().open_connections;
+    install_chaos(nullptr);
+
+    Samples total;
+    for (const auto &s : samples) {
+        total.merge(s);
+    }
+
+    // Report
+    uint64_t operations = 0;
+    int64_t slowest = 0;
+    std::printf("%-16s %9s %9s %9s %9s %9s %9s\n", "operation", "count", "p50 us", "p90 us",
+                "p99 us", "p99.9 us", "max us");
+    for (size_t op = 0; op < total.latency_us.size(); ++op) {
+        auto &latency = total.latency_us[op];
+        std::sort(latency.begin(), latency.end());
+        operations += latency.size();
+        slowest = std::max(slowest, latency.empty() ? 0 : latency.back());
+        std::printf("%-16s %9zu %9lld %9lld %9lld %9lld %9lld\n", kOpNames[op], latency.size(),
+                    static_cast<long long>(percentile(latency, 0.50)),
+                    static_cast<long long>(percentile(latency, 0.90)),
+                    static_cast<long long>(percentile(latency, 0.99)),
+                    static_cast<long long>(percentile(latency, 0.999)),
+                    static_cast<long long>(latency.empty() ? 0 : latency.back()));
+    }
+    std::printf("\nthroughput: %.0f ops/s over %.1f s (%d threads, %d devices, seed %llu)\n",
+                static_cast<double>(operations) / elapsed, elapsed, options.threads,
+                options.devices, static_cast<unsigned long long>(options.seed));
+
+    std::printf("errors:");
+    for (size_t code = 1; code < total.errors.size(); ++code) {
+        if (total.errors[code] > 0) {
+            std::printf(" %s=%llu", to_string(static_cast<ErrorCode>(code)),
+                        static_cast<unsigned long long>(total.errors[code]));
+        }
+    }
+    std::printf("\ninjected: calls=%llu errors=%llu spikes=%llu hangs=%llu removals=%llu "
+                "absent=%llu opens=%llu\n",
+                static_cast<unsigned long long>(chaos.calls),
+                static_cast<unsigned long long>(chaos.errors),
+                static_cast<unsigned long long>(chaos.spikes),
+                static_cast<unsigned long long>(chaos.hangs),
+                static_cast<unsigned long long>(chaos.removals),
+                static_cast<unsigned long long>(chaos.absent_calls),
+                static_cast<unsigned long long>(chaos.opens));
+    std::printf("policy: attempts=%llu retries=%llu breaker trips=%llu short-circuited=%llu\n",
+                static_cast<unsigned long long>(policy.attempts),
+                static_cast<unsigned long long>(policy.retries),
+                static_cast<unsigned long long>(policy.trips),
+                static_cast<unsigned long long>(policy.short_circuited));
+    std::printf("resources: connections=%llu handles %ld -> %ld, threads %ld -> %ld\n",
+                static_cast<unsigned long long>(leaked_connections), before.handles,
+                after.handles, before.threads, after.threads);
+
+    // Every call is bounded by a timeout, settle deadline or hang duration
+    const int64_t stuck_us = 10'000'000;
+    bool failed = false;
+    if (slowest > stuck_us) {
+        std::printf("FAIL: a call took %lld us\n", static_cast<long long>(slowest));
+        failed = true;
+    }
+    if (leaked_connections > 0 || after.handles > before.handles ||
+        after.threads > before.threads) {
+        std::printf("FAIL: leaked connections, handles or threads\n");
+        failed = true;
+    }
+    if (operations == 0) {
+        std::printf("FAIL: no operations completed\n");
+        failed = true;
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,347 @@
+// tests/cpp/support/simulated_device.h
+#pragma once
+
+#include "duvc-ctl/platform/interface.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace duvc::test {
+
+// ============================================================================
+// Simulated Device
+// ============================================================================
+
+/// Device state shared between a test and the connections opened on it
+struct SimulatedDeviceState {
+    std::mutex mutex;
+    std::map<CamProp, PropSetting> camera;
+    std::map<VidProp, PropSetting> video;
+    PropRange range; ///< Range of every property without its own entry below
+    std::map<CamProp, PropRange> camera_ranges;
+    std::map<VidProp, PropRange> video_ranges;
+
+    std::atomic<bool> connected{true};
+    std::atomic<int> opens{0};
+    std::atomic<int> calls{0};
+    std::chrono::microseconds latency{0};
+
+    std::set<std::thread::id> calling_threads;
+
+    // Hang on demand: driver calls (and opens) block until release()
+    std::mutex hang_mutex;
+    std::condition_variable hang_cv;
+    bool hanging = false;
+    std::atomic<int> hung_calls{0};
+
+    // Fault injection: the next fail_remaining calls return fail_code
+    std::atomic<int> fail_remaining{0};
+    ErrorCode fail_code = ErrorCode::DeviceBusy;
+
+    // Read-only controls: writes to these fail with PermissionDenied
+    std::set<CamProp> read_only;
+
+    // Motorized camera properties: a set starts a move at motor_speed units
+    // per millisecond and reads report the current position. A move stops at
+    // motor_limit (stalled motor). Zero speed moves instantly.
+    struct Move {
+        int from = 0;
+        int to = 0;
+        std::chrono::steady_clock::time_point start;
+    };
+    double motor_speed = 0.0;
+    std::optional<int> motor_limit;
+    std::map<CamProp, Move> moves;
+
+    // Successful writes in order, for checking write sequencing
+    struct Write {
+        bool video = false;
+        int prop = 0;
+        PropSetting setting;
+    };
+    std::vector<Write> writes;
+
+    SimulatedDeviceState() {
+        range.min = 0;
+        range.max = 100;
+        range.step = 1;
+        range.default_val = 50;
+        range.default_mode = CamMode::Manual;
+    }
+
+    void record_call() {
+        calls.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            calling_threads.insert(std::this_thread::get_id());
+        }
+        if (latency.count() > 0) {
+            std::this_thread::sleep_for(latency);
+        }
+        block_if_hung();
+    }
+
+    /// Current position of a camera property (call with mutex held)
+    PropSetting position(CamProp prop, const PropSetting &stored) const {
+        auto it = moves.find(prop);
+        if (it == moves.end()) {
+            return stored;
+        }
+        const Move &move = it->second;
+        auto ms = std::chrono::duration<double, std::milli>(
+                      std::chrono::steady_clock::now() - move.start).count();
+        int travelled = static_cast<int>(ms * motor_speed);
+        int distance = move.to - move.from;
+        int value = std::abs(distance) <= travelled
+                        ? move.to
+                        : move.from + (distance > 0 ? travelled : -travelled);
+        if (motor_limit) {
+            value = distance > 0 ? std::min(value, *motor_limit)
+                                 : std::max(value, *motor_limit);
+        }
+        return PropSetting(value, stored.mode);
+    }
+
+    void fail_next(int count, ErrorCode code) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            fail_code = code;
+        }
+        fail_remaining = count;
+    }
+
+    std::optional<Error> take_fault() {
+        int remaining = fail_remaining.load();
+        while (remaining > 0 &&
+               !fail_remaining.compare_exchange_weak(remaining, remaining - 1)) {
+        }
+        if (remaining <= 0) {
+            return std::nullopt;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        return Error(fail_code, "Injected fault");
+    }
+
+    void hang() {
+        std::lock_guard<std::mutex> lock(hang_mutex);
+        hanging = true;
+    }
+
+    void release() {
+        {
+            std::lock_guard<std::mutex> lock(hang_mutex);
+            hanging = false;
+        }
+        hang_cv.notify_all();
+    }
+
+    void block_if_hung() {
+        std::unique_lock<std::mutex> lock(hang_mutex);
+        if (hanging) {
+            hung_calls.fetch_add(1);
+            hang_cv.wait(lock, [this] { return !hanging; });
+        }
+    }
+};
+
+/// In-memory IDeviceConnection backed by a SimulatedDeviceState
+class SimulatedConnection : public IDeviceConnection {
+public:
+    explicit SimulatedConnection(std::shared_ptr<SimulatedDeviceState> state)
+        : state_(std::move(state)) {}
+
+    bool is_valid() const override { return state_->connected.load(); }
+
+    Result<PropSetting> get_camera_property(CamProp prop) override {
+        state_->record_call();
+        if (auto fault = state_->take_fault()) {
+            return Result<PropSetting>(*fault);
+        }
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        auto it = state_->camera.find(prop);
+        if (it == state_->camera.end()) {
+            return Err<PropSetting>(ErrorCode::PropertyNotSupported, "Not simulated");
+        }
+        return Ok(state_->position(prop, it->second));
+    }
+
+    Result<void> set_camera_property(CamProp prop, const PropSetting &setting) override {
+        state_->record_call();
+        if (auto fault = state_->take_fault()) {
+            return Result<void>(*fault);
+        }
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        auto it = state_->camera.find(prop);
+        if (it == state_->camera.end()) {
+            return Err<void>(ErrorCode::PropertyNotSupported, "Not simulated");
+        }
+        if (state_->read_only.count(prop)) {
+            return Err<void>(ErrorCode::PermissionDenied, "Read-only control");
+        }
+        if (state_->motor_speed > 0.0) {
+            int from = state_->position(prop, it->second).value;
+            state_->moves[prop] = {from, setting.value, std::chrono::steady_clock::now()};
+        }
+        it->second = setting;
+        state_->writes.push_back({false, static_cast<int>(prop), setting});
+        return Ok();
+    }
+
+    Result<PropRange> get_camera_property_range(CamProp prop) override {
+        state_->record_call();
+        if (auto fault = state_->take_fault()) {
+            return Result<PropRange>(*fault);
+        }
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (state_->camera.find(prop) == state_->camera.end()) {
+            return Err<PropRange>(ErrorCode::PropertyNotSupported, "Not simulated");
+        }
+        auto range = state_->camera_ranges.find(prop);
+        return Ok(range != state_->camera_ranges.end() ? range->second : state_->range);
+    }
+
+    Result<PropSetting> get_video_property(VidProp prop) override {
+        state_->record_call();
+        if (auto fault = state_->take_fault()) {
+            return Result<PropSetting>(*fault);
+        }
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        auto it = state_->video.find(prop);
+        if (it == state_->video.end()) {
+            return Err<PropSetting>(ErrorCode::PropertyNotSupported, "Not simulated");
+        }
+        return Ok(it->second);
+    }
+
+    Result<void> set_video_property(VidProp prop, const PropSetting &setting) override {
+        state_->record_call();
+        if (auto fault = state_->take_fault()) {
+            return Result<void>(*fault);
+        }
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        auto it = state_->video.find(prop);
+        if (it == state_->video.end()) {
+            return Err<void>(ErrorCode::PropertyNotSupported, "Not simulated");
+        }
+        it->second = setting;
+        state_->writes.push_back({true, static_cast<int>(prop), setting});
+        return Ok();
+    }
+
+    Result<PropRange> get_video_property_range(VidProp prop) override {
+        state_->record_call();
+        if (auto fault = state_->take_fault()) {
+            return Result<PropRange>(*fault);
+        }
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (state_->video.find(prop) == state_->video.end()) {
+            return Err<PropRange>(ErrorCode::PropertyNotSupported, "Not simulated");
+        }
+        auto range = state_->video_ranges.find(prop);
+        return Ok(range != state_->video_ranges.end() ? range->second : state_->range);
+    }
+
+private:
+    std::shared_ptr<SimulatedDeviceState> state_;
+};
+
+// ============================================================================
+// Simulated Camera Model
+// ============================================================================
+
+/// Synthetic image metric that responds linearly to a simulated property,
+/// e.g. mean luminance as a function of exposure: gain * value + offset
+inline std::function<double()> linear_metric(std::shared_ptr<SimulatedDeviceState> state,
+                                             CamProp prop, double gain, double offset) {
+    return [state, prop, gain, offset] {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        return gain * state->camera[prop].value + offset;
+    };
+}
+
+/// Synthetic image metric with a single peak, e.g. sharpness as a function of
+/// focus: 100 at peak, falling off with distance over width
+inline std::function<double()> peaked_metric(std::shared_ptr<SimulatedDeviceState> state,
+                                             CamProp prop, int peak, double width) {
+    return [state, prop, peak, width] {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        double x = (state->camera[prop].value - peak) / width;
+        return 100.0 / (1.0 + x * x);
+    };
+}
+
+/// Connection factory opening SimulatedConnections on the given state
+inline auto simulated_factory(std::shared_ptr<SimulatedDeviceState> state) {
+    return [state]() -> Result<std::unique_ptr<IDeviceConnection>> {
+        if (!state->connected.load()) {
+            return Err<std::unique_ptr<IDeviceConnection>>(
+                ErrorCode::DeviceNotFound, "Simulated device unplugged");
+        }
+        state->block_if_hung();
+        state->opens.fetch_add(1);
+        return Ok(std::unique_ptr<IDeviceConnection>(
+            std::make_unique<SimulatedConnection>(state)));
+    };
+}
+
+// ============================================================================
+// Simulated Platform
+// ============================================================================
+
+/// Platform serving simulated devices; copies share the devices' state
+class SimulatedPlatform : public IPlatformInterface {
+public:
+    /// Add a device backed by state
+    void add(Device device, std::shared_ptr<SimulatedDeviceState> state) {
+        devices_.emplace_back(std::move(device), std::move(state));
+    }
+
+    Result<std::vector<Device>> list_devices() override {
+        std::vector<Device> devices;
+        for (const auto &entry : devices_) {
+            if (entry.second->connected.load()) {
+                devices.push_back(entry.first);
+            }
+        }
+        return Ok(std::move(devices));
+    }
+
+    Result<bool> is_device_connected(const Device &device) override {
+        auto state = find(device);
+        return Ok(state && state->connected.load());
+    }
+
+    Result<std::unique_ptr<IDeviceConnection>> create_connection(const Device &device) override {
+        auto state = find(device);
+        if (!state) {
+            return Err<std::unique_ptr<IDeviceConnection>>(ErrorCode::DeviceNotFound,
+                                                           "Not a simulated device");
+        }
+        return simulated_factory(state)();
+    }
+
+private:
+    std::shared_ptr<SimulatedDeviceState> find(const Device &device) const {
+        for (const auto &entry : devices_) {
+            if (entry.first.path == device.path) {
+                return entry.second;
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<std::pair<Device, std::shared_ptr<SimulatedDeviceState>>> devices_;
+};
+
+} // namespace duvc::test
@@ -0,0 +1,267 @@
+// tests/cpp/unit/capability_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "duvc-ctl/core/capability.h"
+#include "duvc-ctl/core/device_actor.h"
+#include "support/simulated_device.h"
+
+#include <unordered_map>
+#include <vector>
+
+using namespace duvc;
+using namespace duvc::test;
+
+namespace {
+
+PropRange make_range(int default_val, CamMode default_mode) {
+    PropRange range;
+    range.min = 0;
+    range.max = 255;
+    range.step = 1;
+    range.default_val = default_val;
+    range.default_mode = default_mode;
+    return range;
+}
+
+/// Camera with manual and auto-default properties, all away from defaults
+std::shared_ptr<SimulatedDeviceState> make_state() {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Exposure] = PropSetting(10, CamMode::Manual);
+    state->camera_ranges[CamProp::Exposure] = make_range(20, CamMode::Auto);
+    state->camera[CamProp::Iris] = PropSetting(7, CamMode::Auto);
+    state->camera_ranges[CamProp::Iris] = make_range(8, CamMode::Manual);
+    state->camera[CamProp::Zoom] = PropSetting(99, CamMode::Manual);
+    state->camera_ranges[CamProp::Zoom] = make_range(0, CamMode::Manual);
+    state->camera[CamProp::ZoomRelative] = PropSetting(1, CamMode::Manual);
+    state->camera_ranges[CamProp::ZoomRelative] = make_range(0, CamMode::Manual);
+
+    state->video[VidProp::WhiteBalance] = PropSetting(3000, CamMode::Manual);
+    state->video_ranges[VidProp::WhiteBalance] = make_range(4600, CamMode::Auto);
+    state->video[VidProp::Brightness] = PropSetting(128, CamMode::Manual);
+    state->video_ranges[VidProp::Brightness] = make_range(128, CamMode::Manual);
+    return state;
+}
+
+std::shared_ptr<DeviceActor> make_actor(const std::shared_ptr<SimulatedDeviceState> &state) {
+    return std::make_shared<DeviceActor>(simulated_factory(state));
+}
+
+} // namespace
+
+// ============================================================================
+// Reset To Defaults Tests
+// ============================================================================
+TEST_CASE("Reset writes defaults and skips properties already at default",
+          "[core][capability][reset]") {
+    auto state = make_state();
+
+    auto report = reset_to_defaults(make_actor(state));
+    REQUIRE(report.is_ok());
+    const auto &r = report.value();
+    REQUIRE(r.writes == 4); // Exposure, Iris, Zoom, WhiteBalance
+    REQUIRE(r.skipped == 1); // Brightness
+    REQUIRE(r.failed == 0);
+    REQUIRE(r.entries.size() == 5);
+    REQUIRE(r.entries.back().video);
+    REQUIRE(r.entries.back().vid_prop == VidProp::Brightness);
+    REQUIRE(r.entries.back().outcome == ResetOutcome::Skipped);
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    REQUIRE(state->writes.size() == 4);
+    REQUIRE(state->camera[CamProp::Exposure].mode == CamMode::Auto);
+    REQUIRE(state->camera[CamProp::Iris].value == 8);
+    REQUIRE(state->camera[CamProp::Iris].mode == CamMode::Manual);
+    REQUIRE(state->camera[CamProp::Zoom].value == 0);
+    REQUIRE(state->video[VidProp::WhiteBalance].mode == CamMode::Auto);
+}
+
+TEST_CASE("Reset writes auto defaults after manual ones", "[core][capability][reset]") {
+    auto state = make_state();
+
+    REQUIRE(reset_to_defaults(make_actor(state)).is_ok());
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    REQUIRE(state->writes.size() == 4);
+    // Manual: Zoom, Iris (enum order), then auto: Exposure, WhiteBalance
+    REQUIRE(state->writes[0].prop == static_cast<int>(CamProp::Zoom));
+    REQUIRE(state->writes[1].prop == static_cast<int>(CamProp::Iris));
+    REQUIRE(state->writes[2].prop == static_cast<int>(CamProp::Exposure));
+    REQUIRE(state->writes[3].video);
+    REQUIRE(state->writes[3].prop == static_cast<int>(VidProp::WhiteBalance));
+}
+
+TEST_CASE("Reset twice is a no-op the second time", "[core][capability][reset]") {
+    auto state = make_state();
+    auto actor = make_actor(state);
+
+    REQUIRE(reset_to_defaults(actor).value().writes == 4);
+    auto again = reset_to_defaults(actor);
+    REQUIRE(again.is_ok());
+    REQUIRE(again.value().writes == 0);
+    REQUIRE(again.value().skipped == 5);
+
+    // Auto-default properties in auto mode count as reset whatever their value
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->camera[CamProp::Exposure].value = 77;
+    }
+    REQUIRE(reset_to_defaults(actor).value().writes == 0);
+}
+
+TEST_CASE("Reset honours the filter", "[core][capability][reset]") {
+    auto state = make_state();
+    auto actor = make_actor(state);
+
+    ResetFilter only_zoom;
+    only_zoom.video = false;
+    only_zoom.camera_props = {CamProp::Zoom};
+    auto report = reset_to_defaults(actor, only_zoom);
+    REQUIRE(report.value().writes == 1);
+    REQUIRE(report.value().entries.size() == 1);
+    REQUIRE(report.value().entries[0].cam_prop == CamProp::Zoom);
+
+    ResetFilter video_only;
+    video_only.camera = false;
+    REQUIRE(reset_to_defaults(actor, video_only).value().writes == 1);
+
+    ResetFilter relative;
+    relative.video = false;
+    relative.include_relative = true;
+    report = reset_to_defaults(actor, relative);
+    REQUIRE(report.value().writes == 3); // Exposure, Iris, ZoomRelative
+    std::lock_guard<std::mutex> lock(state->mutex);
+    REQUIRE(state->camera[CamProp::ZoomRelative].value == 0);
+}
+
+TEST_CASE("Reset reports failed writes", "[core][capability][reset]") {
+    auto state = make_state();
+    state->read_only.insert(CamProp::Iris);
+
+    auto report = reset_to_defaults(make_actor(state));
+    REQUIRE(report.is_ok());
+    REQUIRE(report.value().writes == 3);
+    REQUIRE(report.value().failed == 1);
+    const auto &failed = report.value().entries[1];
+    REQUIRE(failed.cam_prop == CamProp::Iris);
+    REQUIRE(failed.outcome == ResetOutcome::Failed);
+    REQUIRE(failed.error->code() == ErrorCode::PermissionDenied);
+
+    state->connected = false;
+    auto unplugged = reset_to_defaults(make_actor(state));
+    REQUIRE(unplugged.is_error());
+    REQUIRE(unplugged.error().code() == ErrorCode::DeviceNotFound);
+}
+
+// ============================================================================
+// Property Set Tests
+// ============================================================================
+TEST_CASE("Property sets iterate in enum order", "[core][capability][set]") {
+    CamPropSet set;
+    REQUIRE(set.empty());
+    REQUIRE(set.begin() == set.end());
+
+    set.insert(CamProp::Lamp);
+    set.insert(CamProp::Pan);
+    set.insert(CamProp::Focus);
+    set.insert(CamProp::Focus);
+    REQUIRE(set.size() == 3);
+    REQUIRE(set.contains(CamProp::Focus));
+    REQUIRE_FALSE(set.contains(CamProp::Zoom));
+    REQUIRE(set.bits() == ((1ull << 0) | (1ull << 6) | (1ull << 22)));
+
+    std::vector<CamProp> props(set.begin(), set.end());
+    REQUIRE(props == std::vector<CamProp>{CamProp::Pan, CamProp::Focus, CamProp::Lamp});
+
+    set.erase(CamProp::Pan);
+    REQUIRE(*set.begin() == CamProp::Focus);
+
+    // The highest bit iterates and terminates
+    CamPropSet top(1ull << 63);
+    REQUIRE(top.size() == 1);
+    REQUIRE(static_cast<int>(*top.begin()) == 63);
+    REQUIRE(++top.begin() == top.end());
+}
+
+TEST_CASE("Property sets compare and diff with bit operations",
+          "[core][capability][set]") {
+    VidPropSet before;
+    before.insert(VidProp::Brightness);
+    before.insert(VidProp::Gain);
+    VidPropSet after = before;
+    REQUIRE(after == before);
+
+    after.erase(VidProp::Gain);
+    after.insert(VidProp::WhiteBalance);
+    REQUIRE(after != before);
+    REQUIRE((after - before) == VidPropSet(1ull << static_cast<int>(VidProp::WhiteBalance)));
+    REQUIRE((before - after).contains(VidProp::Gain));
+    REQUIRE((before & after).size() == 1);
+    REQUIRE((before | after).size() == 3);
+    REQUIRE((before ^ after).size() == 2);
+}
+
+TEST_CASE("Inaccessible snapshots report no capabilities", "[core][capability][set]") {
+    DeviceCapabilities caps(Device(L"Missing", L"USB\\VID_0000&PID_0000\\X"));
+    REQUIRE_FALSE(caps.is_device_accessible());
+    REQUIRE(caps.camera_properties().empty());
+    REQUIRE(caps.video_properties().empty());
+    REQUIRE(caps.supported_camera_properties().empty());
+    REQUIRE_FALSE(caps.supports_camera_property(CamProp::Pan));
+    REQUIRE_FALSE(caps.get_video_capability(VidProp::Gain).supported);
+    // Values outside the enum fall back to the empty capability
+    REQUIRE_FALSE(caps.get_camera_capability(static_cast<CamProp>(40)).supported);
+    REQUIRE(kCamPropCount == 23);
+    REQUIRE(kVidPropCount == 14);
+}
+
+// ============================================================================
+// Benchmarks (run with: capability_tests "[benchmark]")
+// ============================================================================
+TEST_CASE("Capability lookup and iteration", "[.][benchmark][core][capability]") {
+    // Previous representation: hash maps keyed by property
+    std::unordered_map<CamProp, PropertyCapability> map;
+    std::array<PropertyCapability, kCamPropCount> dense{};
+    CamPropSet supported;
+    for (CamProp prop : {CamProp::Pan, CamProp::Tilt, CamProp::Zoom, CamProp::Exposure,
+                         CamProp::Focus, CamProp::Privacy, CamProp::BacklightCompensation}) {
+        PropertyCapability capability;
+        capability.supported = true;
+        capability.range = make_range(5, CamMode::Manual);
+        map[prop] = capability;
+        dense[static_cast<size_t>(prop)] = capability;
+        supported.insert(prop);
+    }
+
+    BENCHMARK("hash map: list supported") {
+        std::vector<CamProp> props;
+        for (const auto &pair : map) {
+            if (pair.second.supported) {
+                props.push_back(pair.first);
+            }
+        }
+        return props.size();
+    };
+    BENCHMARK("bitmask: iterate supported") {
+        int sum = 0;
+        for (CamProp prop : supported) {
+            sum += dense[static_cast<size_t>(prop)].range.default_val;
+        }
+        return sum;
+    };
+    BENCHMARK("hash map: look up every property") {
+        int sum = 0;
+        for (size_t i = 0; i < kCamPropCount; ++i) {
+            auto it = map.find(static_cast<CamProp>(i));
+            sum += it != map.end() ? it->second.range.default_val : 0;
+        }
+        return sum;
+    };
+    BENCHMARK("dense array: look up every property") {
+        int sum = 0;
+        for (size_t i = 0; i < kCamPropCount; ++i) {
+            sum += dense[i].range.default_val;
+        }
+        return sum;
+    };
+}
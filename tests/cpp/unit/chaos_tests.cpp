@@ -0,0 +1,212 @@
+// tests/cpp/unit/chaos_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/device_actor.h"
+#include "duvc-ctl/platform/chaos.h"
+#include "../support/simulated_device.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace duvc;
+using namespace duvc::test;
+
+namespace {
+
+const Device kCamera(L"Chaos Cam",
+                     L"\\\\?\\usb#vid_046d&pid_0853&mi_00#7&2c3d&0&0000#"
+                     L"{65e8773d-8f56-11d0-a3b9-00a0c9223196}\\global");
+
+SimulatedPlatform simulated_platform() {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Zoom] = PropSetting(100, CamMode::Manual);
+    state->video[VidProp::Brightness] = PropSetting(128, CamMode::Manual);
+    SimulatedPlatform platform;
+    platform.add(kCamera, state);
+    return platform;
+}
+
+std::unique_ptr<IPlatformInterface> chaos_platform(std::shared_ptr<ChaosController> controller) {
+    return make_chaos_platform(std::make_unique<SimulatedPlatform>(simulated_platform()),
+                               std::move(controller));
+}
+
+/// Outcomes of a run of reads: 0 for success, else the error code
+std::vector<int> outcomes(uint64_t seed, int calls) {
+    ChaosConfig config;
+    config.seed = seed;
+    config.error_rate = 0.3;
+    auto platform = chaos_platform(std::make_shared<ChaosController>(config));
+    auto connection = platform->create_connection(kCamera);
+    std::vector<int> result;
+    for (int i = 0; i < calls; ++i) {
+        auto read = connection.value()->get_camera_property(CamProp::Zoom);
+        result.push_back(read.is_ok() ? 0 : static_cast<int>(read.error().code()));
+    }
+    return result;
+}
+
+} // namespace
+
+// ============================================================================
+// Injection Tests
+// ============================================================================
+TEST_CASE("Default chaos passes calls through", "[platform][chaos]") {
+    auto controller = std::make_shared<ChaosController>();
+    auto platform = chaos_platform(controller);
+    REQUIRE(platform->list_devices().value().size() == 1);
+
+    auto connection = platform->create_connection(kCamera);
+    REQUIRE(connection.is_ok());
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(connection.value()->get_camera_property(CamProp::Zoom).value().value == 100);
+    }
+
+    ChaosStats stats = controller->stats();
+    REQUIRE(stats.calls == 101);
+    REQUIRE(stats.errors == 0);
+    REQUIRE(stats.opens == 1);
+    REQUIRE(stats.open_connections == 1);
+    connection = Err<std::unique_ptr<IDeviceConnection>>(ErrorCode::DeviceNotFound);
+    REQUIRE(controller->stats().open_connections == 0);
+}
+
+TEST_CASE("Injected faults are reproducible from the seed", "[platform][chaos]") {
+    REQUIRE(outcomes(7, 500) == outcomes(7, 500));
+    REQUIRE(outcomes(7, 500) != outcomes(8, 500));
+}
+
+TEST_CASE("Injected errors follow the configured rate and codes", "[platform][chaos]") {
+    ChaosConfig config;
+    config.seed = 42;
+    config.error_rate = 0.2;
+    config.errors = {ErrorCode::PermissionDenied};
+    auto controller = std::make_shared<ChaosController>(config);
+    auto connection = chaos_platform(controller)->create_connection(kCamera);
+
+    int failures = 0;
+    for (int i = 0; i < 10000; ++i) {
+        auto result = connection.value()->set_video_property(
+            VidProp::Brightness, PropSetting(i % 255, CamMode::Manual));
+        if (!result.is_ok()) {
+            REQUIRE(result.error().code() == ErrorCode::PermissionDenied);
+            ++failures;
+        }
+    }
+    REQUIRE(failures > 1700);
+    REQUIRE(failures < 2300);
+    REQUIRE(controller->stats().errors == static_cast<uint64_t>(failures));
+}
+
+TEST_CASE("Latency spikes delay calls", "[platform][chaos]") {
+    using Clock = std::chrono::steady_clock;
+    ChaosConfig config;
+    config.spike_rate = 1.0;
+    config.spike_latency = std::chrono::milliseconds(20);
+    auto controller = std::make_shared<ChaosController>(config);
+    auto connection = chaos_platform(controller)->create_connection(kCamera);
+
+    auto start = Clock::now();
+    REQUIRE(connection.value()->get_camera_property(CamProp::Zoom).is_ok());
+    REQUIRE(Clock::now() - start >= std::chrono::milliseconds(20));
+    REQUIRE(controller->stats().spikes == 2);
+}
+
+// ============================================================================
+// Removal Tests
+// ============================================================================
+TEST_CASE("Removed devices disappear until restored", "[platform][chaos]") {
+    auto controller = std::make_shared<ChaosController>();
+    auto platform = chaos_platform(controller);
+    auto connection = platform->create_connection(kCamera);
+    REQUIRE(connection.value()->is_valid());
+
+    controller->remove(kCamera);
+    REQUIRE_FALSE(controller->present(kCamera));
+    REQUIRE(platform->list_devices().value().empty());
+    REQUIRE_FALSE(platform->is_device_connected(kCamera).value());
+    REQUIRE_FALSE(connection.value()->is_valid());
+    REQUIRE(connection.value()->get_camera_property(CamProp::Zoom).error().code() ==
+            ErrorCode::DeviceNotFound);
+    REQUIRE(platform->create_connection(kCamera).error().code() == ErrorCode::DeviceNotFound);
+
+    controller->restore(kCamera);
+    REQUIRE(connection.value()->is_valid());
+    REQUIRE(platform->list_devices().value().size() == 1);
+
+    // Timed removals expire on their own
+    controller->remove(kCamera, std::chrono::milliseconds(20));
+    REQUIRE_FALSE(controller->present(kCamera));
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    REQUIRE(controller->present(kCamera));
+}
+
+TEST_CASE("Flapping devices come and go", "[platform][chaos]") {
+    ChaosConfig config;
+    config.flap_period = std::chrono::milliseconds(20);
+    auto controller = std::make_shared<ChaosController>(config);
+
+    bool seen_present = false, seen_absent = false;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+    while (std::chrono::steady_clock::now() < deadline && !(seen_present && seen_absent)) {
+        (controller->present(kCamera) ? seen_present : seen_absent) = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(seen_present);
+    REQUIRE(seen_absent);
+}
+
+// ============================================================================
+// Library Behaviour Under Faults
+// ============================================================================
+TEST_CASE("Actors recover after a device returns", "[platform][chaos]") {
+    auto controller = std::make_shared<ChaosController>();
+    install_chaos(controller, [] {
+        return std::unique_ptr<IPlatformInterface>(
+            std::make_unique<SimulatedPlatform>(simulated_platform()));
+    });
+
+    {
+        auto actor = acquire_device_actor(kCamera);
+        auto read = [&] {
+            return actor->call<PropSetting>(
+                [](IDeviceConnection &c) { return c.get_camera_property(CamProp::Zoom); });
+        };
+        REQUIRE(read().value().value == 100);
+
+        controller->remove(kCamera);
+        REQUIRE(read().error().code() == ErrorCode::DeviceNotFound);
+
+        controller->restore(kCamera);
+        REQUIRE(read().value().value == 100);
+        REQUIRE(actor->stats().connects == 2);
+    }
+
+    // Releasing the actor releases its connection
+    REQUIRE(controller->stats().open_connections == 0);
+    install_chaos(nullptr);
+}
+
+TEST_CASE("Injected hangs time out at the caller", "[platform][chaos]") {
+    ChaosConfig config;
+    config.hang_rate = 1.0;
+    config.hang_duration = std::chrono::milliseconds(200);
+    auto controller = std::make_shared<ChaosController>(config);
+    auto platform = std::shared_ptr<IPlatformInterface>(chaos_platform(controller));
+    auto actor = std::make_shared<DeviceActor>(
+        [platform] { return platform->create_connection(kCamera); });
+
+    auto read = actor->call<PropSetting>(
+        [](IDeviceConnection &c) { return c.get_camera_property(CamProp::Zoom); },
+        std::chrono::milliseconds(50));
+    REQUIRE(read.error().code() == ErrorCode::DeviceBusy);
+    REQUIRE(controller->stats().hangs >= 1);
+
+    // Once the device answers again, calls go through
+    controller->set_config(ChaosConfig());
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    auto later = actor->call<PropSetting>(
+        [](IDeviceConnection &c) { return c.get_camera_property(CamProp::Zoom); },
+        std::chrono::seconds(2));
+    REQUIRE(later.is_ok());
+}
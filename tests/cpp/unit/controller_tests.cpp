@@ -0,0 +1,254 @@
+// tests/cpp/unit/controller_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/controller.h"
+#include "duvc-ctl/core/device_actor.h"
+#include "support/simulated_device.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace duvc;
+using namespace duvc::test;
+using namespace std::chrono;
+
+namespace {
+
+std::shared_ptr<SimulatedDeviceState> make_state(int exposure = 0) {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Exposure] = PropSetting(exposure, CamMode::Manual);
+    return state;
+}
+
+int exposure(SimulatedDeviceState &state) {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.camera[CamProp::Exposure].value;
+}
+
+PropertyAccess exposure_access(const std::shared_ptr<SimulatedDeviceState> &state) {
+    return property_access(std::make_shared<DeviceActor>(simulated_factory(state)),
+                           CamProp::Exposure);
+}
+
+MeasurementFeed feed(std::function<double()> metric) {
+    return [metric] { return std::optional<double>(metric()); };
+}
+
+/// Poll until the predicate holds or the timeout expires
+template <typename Pred> bool eventually(Pred pred, milliseconds timeout = seconds(3)) {
+    auto deadline = steady_clock::now() + timeout;
+    while (steady_clock::now() < deadline) {
+        if (pred()) {
+            return true;
+        }
+        std::this_thread::sleep_for(milliseconds(2));
+    }
+    return pred();
+}
+
+ControlLoopConfig fast_config(ControlMode mode) {
+    ControlLoopConfig config;
+    config.mode = mode;
+    config.setpoint = 110.0; // luminance = 2 * exposure + 10 -> exposure 50
+    config.period = milliseconds(2);
+    return config;
+}
+
+} // namespace
+
+// ============================================================================
+// Control Law Tests
+// ============================================================================
+TEST_CASE("PID loop drives the property to the setpoint", "[core][controller]") {
+    auto state = make_state();
+    ControlEngine engine;
+
+    auto config = fast_config(ControlMode::Pid);
+    config.gains.kp = 0.1;
+    config.gains.ki = 10.0;
+    auto id = engine.add_loop(exposure_access(state),
+                              feed(linear_metric(state, CamProp::Exposure, 2.0, 10.0)),
+                              config);
+    REQUIRE(id.is_ok());
+
+    REQUIRE(eventually([&] { return exposure(*state) == 50; }));
+    auto stats = engine.stats(id.value());
+    REQUIRE(stats.is_ok());
+    REQUIRE(stats.value().ticks > 0);
+    REQUIRE(stats.value().writes > 0);
+    REQUIRE(stats.value().write_failures == 0);
+
+    // Retarget while running
+    REQUIRE(engine.set_setpoint(id.value(), 70.0).is_ok());
+    REQUIRE(eventually([&] { return exposure(*state) == 30; }));
+}
+
+TEST_CASE("Step-limited loop moves at most max_step per tick", "[core][controller]") {
+    auto state = make_state();
+    ControlEngine engine;
+
+    std::mutex written_mutex;
+    std::vector<int> written;
+    auto target = exposure_access(state);
+    auto set = target.set;
+    target.set = [&, set](const PropSetting &s) {
+        std::lock_guard<std::mutex> lock(written_mutex);
+        written.push_back(s.value);
+        return set(s);
+    };
+
+    auto config = fast_config(ControlMode::StepLimited);
+    config.gains.kp = 1.0; // would overshoot wildly without the limit
+    config.max_step = 5;
+    config.deadband = 1.0;
+    auto id = engine.add_loop(target, feed(linear_metric(state, CamProp::Exposure, 2.0, 10.0)),
+                              config);
+    REQUIRE(id.is_ok());
+    REQUIRE(eventually([&] { return exposure(*state) == 50; }));
+    REQUIRE(engine.remove_loop(id.value()).is_ok());
+
+    std::lock_guard<std::mutex> lock(written_mutex);
+    REQUIRE(written.size() >= 10);
+    int previous = 0;
+    for (int value : written) {
+        REQUIRE(std::abs(value - previous) <= 5);
+        previous = value;
+    }
+}
+
+TEST_CASE("Control outputs are quantized and coalesced", "[core][controller]") {
+    auto state = make_state();
+    state->range.step = 10;
+    ControlEngine engine;
+
+    std::atomic<bool> bad_value{false};
+    auto target = exposure_access(state);
+    auto set = target.set;
+    target.set = [&, set](const PropSetting &s) {
+        if (s.value % 10 != 0) {
+            bad_value = true;
+        }
+        return set(s);
+    };
+
+    auto config = fast_config(ControlMode::StepLimited);
+    config.gains.kp = 0.2;
+    config.setpoint = 75.0; // exposure 32.5: unreachable on a step of 10
+    config.deadband = 10.0; // half the metric change of one step
+    auto id = engine.add_loop(target, feed(linear_metric(state, CamProp::Exposure, 2.0, 10.0)),
+                              config);
+    REQUIRE(id.is_ok());
+
+    // Settles on a grid value and stops writing once it stops changing
+    REQUIRE(eventually([&] {
+        auto stats = engine.stats(id.value()).value();
+        return stats.coalesced > 20 && exposure(*state) == 30;
+    }));
+    REQUIRE_FALSE(bad_value);
+    auto writes = engine.stats(id.value()).value().writes;
+    std::this_thread::sleep_for(milliseconds(20));
+    REQUIRE(engine.stats(id.value()).value().writes <= writes + 2);
+}
+
+TEST_CASE("Output is held inside the deadband", "[core][controller]") {
+    auto state = make_state(50);
+    ControlEngine engine;
+
+    auto config = fast_config(ControlMode::Pid);
+    config.gains.kp = 1.0;
+    config.deadband = 5.0;
+    config.setpoint = 113.0; // within the deadband of 110
+    auto id = engine.add_loop(exposure_access(state),
+                              feed(linear_metric(state, CamProp::Exposure, 2.0, 10.0)),
+                              config);
+    REQUIRE(id.is_ok());
+    REQUIRE(eventually([&] { return engine.stats(id.value()).value().ticks >= 10; }));
+
+    auto stats = engine.stats(id.value()).value();
+    REQUIRE(stats.writes == 0);
+    REQUIRE(stats.coalesced == stats.ticks);
+    REQUIRE(stats.last_output == 50);
+    REQUIRE(stats.last_error == 3.0);
+}
+
+// ============================================================================
+// Engine Tests
+// ============================================================================
+TEST_CASE("Control loop skips ticks without a measurement", "[core][controller]") {
+    auto state = make_state(20);
+    ControlEngine engine;
+
+    auto config = fast_config(ControlMode::Pid);
+    config.gains.kp = 1.0;
+    auto id = engine.add_loop(exposure_access(state),
+                              [] { return std::optional<double>(); }, config);
+    REQUIRE(id.is_ok());
+    REQUIRE(eventually([&] {
+        return engine.stats(id.value()).value().missed_measurements >= 5;
+    }));
+    REQUIRE(engine.stats(id.value()).value().writes == 0);
+    REQUIRE(exposure(*state) == 20);
+}
+
+TEST_CASE("Control loop reports latency and jitter", "[core][controller]") {
+    auto state = make_state();
+    state->latency = microseconds(500);
+    ControlEngine engine;
+
+    auto config = fast_config(ControlMode::StepLimited);
+    config.gains.kp = 0.1;
+    config.max_step = 1;
+    config.period = milliseconds(5);
+    auto id = engine.add_loop(exposure_access(state),
+                              feed(linear_metric(state, CamProp::Exposure, 2.0, 10.0)),
+                              config);
+    REQUIRE(id.is_ok());
+    REQUIRE(eventually([&] { return engine.stats(id.value()).value().writes >= 5; }));
+
+    auto stats = engine.stats(id.value()).value();
+    REQUIRE(stats.latency_avg >= microseconds(500));
+    REQUIRE(stats.latency_max >= stats.latency_avg);
+    REQUIRE(stats.jitter_max >= stats.jitter_avg);
+}
+
+TEST_CASE("Control engine manages loops", "[core][controller]") {
+    auto state = make_state();
+    ControlEngine engine;
+    auto config = fast_config(ControlMode::Pid);
+
+    // Invalid registrations
+    REQUIRE(engine.add_loop(PropertyAccess{}, feed([] { return 0.0; }), config)
+                .error().code() == ErrorCode::InvalidArgument);
+    REQUIRE(engine.add_loop(exposure_access(state), nullptr, config)
+                .error().code() == ErrorCode::InvalidArgument);
+    auto bad_period = config;
+    bad_period.period = milliseconds(0);
+    REQUIRE(engine.add_loop(exposure_access(state), feed([] { return 0.0; }), bad_period)
+                .error().code() == ErrorCode::InvalidArgument);
+    auto unsupported = property_access(
+        std::make_shared<DeviceActor>(simulated_factory(state)), CamProp::Focus);
+    REQUIRE(engine.add_loop(unsupported, feed([] { return 0.0; }), config)
+                .error().code() == ErrorCode::PropertyNotSupported);
+
+    // Removal stops the measurement feed
+    std::atomic<int> calls{0};
+    auto id = engine.add_loop(exposure_access(state), [&] {
+        ++calls;
+        return std::optional<double>(110.0);
+    }, config);
+    REQUIRE(id.is_ok());
+    REQUIRE(engine.loop_count() == 1);
+    REQUIRE(eventually([&] { return calls > 0; }));
+
+    REQUIRE(engine.remove_loop(id.value()).is_ok());
+    int after = calls;
+    std::this_thread::sleep_for(milliseconds(20));
+    REQUIRE(calls == after);
+    REQUIRE(engine.loop_count() == 0);
+
+    REQUIRE(engine.remove_loop(id.value()).error().code() == ErrorCode::InvalidArgument);
+    REQUIRE(engine.stats(id.value()).error().code() == ErrorCode::InvalidArgument);
+    REQUIRE(engine.set_setpoint(id.value(), 1.0).error().code() == ErrorCode::InvalidArgument);
+}
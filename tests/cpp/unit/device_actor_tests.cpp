@@ -0,0 +1,490 @@
+// tests/cpp/unit/device_actor_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/camera.h"
+#include "duvc-ctl/core/device_actor.h"
+#include "duvc-ctl/detail/mpsc_queue.h"
+#include "support/simulated_device.h"
+
+#include <future>
+#include <thread>
+#include <vector>
+
+using namespace duvc;
+using namespace duvc::test;
+
+namespace {
+
+std::shared_ptr<SimulatedDeviceState> make_state() {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Pan] = PropSetting(0, CamMode::Manual);
+    state->camera[CamProp::Zoom] = PropSetting(100, CamMode::Manual);
+    state->video[VidProp::Brightness] = PropSetting(50, CamMode::Auto);
+    return state;
+}
+
+struct CountedNode : detail::mpsc_node {
+    int producer = 0;
+    int sequence = 0;
+};
+
+} // namespace
+
+// ============================================================================
+// MPSC Queue Tests
+// ============================================================================
+TEST_CASE("MPSC queue preserves FIFO order", "[core][actor]") {
+    detail::mpsc_queue queue;
+    REQUIRE(queue.empty());
+    REQUIRE(queue.pop() == nullptr);
+
+    std::vector<CountedNode> nodes(5);
+    for (int i = 0; i < 5; ++i) {
+        nodes[i].sequence = i;
+        queue.push(&nodes[i]);
+    }
+    REQUIRE_FALSE(queue.empty());
+
+    for (int i = 0; i < 5; ++i) {
+        auto *node = static_cast<CountedNode *>(queue.pop());
+        REQUIRE(node != nullptr);
+        REQUIRE(node->sequence == i);
+    }
+    REQUIRE(queue.pop() == nullptr);
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("MPSC queue with concurrent producers", "[core][actor]") {
+    constexpr int producers = 4;
+    constexpr int per_producer = 2000;
+
+    detail::mpsc_queue queue;
+    std::vector<CountedNode> nodes(producers * per_producer);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < per_producer; ++i) {
+                auto &node = nodes[p * per_producer + i];
+                node.producer = p;
+                node.sequence = i;
+                queue.push(&node);
+            }
+        });
+    }
+
+    std::vector<int> next(producers, 0);
+    int received = 0;
+    while (received < producers * per_producer) {
+        auto *node = static_cast<CountedNode *>(queue.pop());
+        if (!node) {
+            std::this_thread::yield();
+            continue;
+        }
+        // Per-producer order is preserved
+        REQUIRE(node->sequence == next[node->producer]);
+        ++next[node->producer];
+        ++received;
+    }
+
+    for (auto &t : threads) {
+        t.join();
+    }
+    REQUIRE(queue.pop() == nullptr);
+    REQUIRE(queue.empty());
+}
+
+// ============================================================================
+// Device Actor Tests
+// ============================================================================
+TEST_CASE("Device actor executes property operations", "[core][actor]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+
+    auto pan = actor.get(CamProp::Pan);
+    REQUIRE(pan.is_ok());
+    REQUIRE(pan.value().value == 0);
+
+    REQUIRE(actor.set(CamProp::Pan, PropSetting(42, CamMode::Manual)).is_ok());
+    REQUIRE(actor.get(CamProp::Pan).value().value == 42);
+
+    auto brightness = actor.get(VidProp::Brightness);
+    REQUIRE(brightness.is_ok());
+    REQUIRE(brightness.value().mode == CamMode::Auto);
+
+    auto range = actor.get_range(CamProp::Zoom);
+    REQUIRE(range.is_ok());
+    REQUIRE(range.value().max == 100);
+
+    // Errors from the connection are passed through unchanged
+    auto focus = actor.get(CamProp::Focus);
+    REQUIRE(focus.is_error());
+    REQUIRE(focus.error().code() == ErrorCode::PropertyNotSupported);
+}
+
+TEST_CASE("Device actor owns its connection on one thread", "[core][actor]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 4; ++t) {
+        callers.emplace_back([&actor, t] {
+            for (int i = 0; i < 50; ++i) {
+                actor.set(CamProp::Pan, PropSetting(t * 100 + i, CamMode::Manual));
+                actor.get(VidProp::Brightness);
+            }
+        });
+    }
+    for (auto &t : callers) {
+        t.join();
+    }
+
+    REQUIRE(state->opens == 1);
+    REQUIRE(state->calls == 400);
+    REQUIRE(state->calling_threads.size() == 1);
+    REQUIRE(actor.stats().requests == 400);
+    REQUIRE(actor.stats().connects == 1);
+}
+
+TEST_CASE("Device actor batches requests queued while busy", "[core][actor]") {
+    auto state = make_state();
+    state->latency = std::chrono::milliseconds(20);
+    DeviceActor actor(simulated_factory(state));
+
+    std::atomic<int> completed{0};
+    for (int i = 0; i < 10; ++i) {
+        actor.post([&completed](const Result<IDeviceConnection *> &conn) {
+            if (conn.is_ok()) {
+                conn.value()->get_camera_property(CamProp::Pan);
+            }
+            ++completed;
+        });
+    }
+    // A synchronous call queues behind the posted work
+    REQUIRE(actor.get(CamProp::Zoom).is_ok());
+    REQUIRE(completed == 10);
+
+    auto stats = actor.stats();
+    REQUIRE(stats.requests == 11);
+    REQUIRE(stats.batches < stats.requests);
+    REQUIRE(stats.max_batch > 1);
+}
+
+TEST_CASE("Device actor reports and recovers from open failures", "[core][actor]") {
+    auto state = make_state();
+    state->connected = false;
+    DeviceActor actor(simulated_factory(state));
+
+    auto result = actor.get(CamProp::Pan);
+    REQUIRE(result.is_error());
+    REQUIRE(result.error().code() == ErrorCode::DeviceNotFound);
+    REQUIRE(state->opens == 0);
+
+    // Device comes back: the next request reopens it
+    state->connected = true;
+    REQUIRE(actor.get(CamProp::Pan).is_ok());
+    REQUIRE(state->opens == 1);
+
+    actor.reconnect();
+    REQUIRE(actor.get(CamProp::Pan).is_ok());
+    REQUIRE(state->opens == 2);
+    REQUIRE(actor.stats().connects == 2);
+}
+
+TEST_CASE("Device actor runs nested calls inline", "[core][actor]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+
+    bool inline_call = false;
+    auto result = actor.call<int>([&](IDeviceConnection &) -> Result<int> {
+        inline_call = actor.on_actor_thread();
+        auto pan = actor.get(CamProp::Pan); // would deadlock if queued
+        return pan.is_ok() ? Ok(pan.value().value + 1) : Result<int>(pan.error());
+    });
+    REQUIRE(result.is_ok());
+    REQUIRE(result.value() == 1);
+    REQUIRE(inline_call);
+    REQUIRE_FALSE(actor.on_actor_thread());
+}
+
+TEST_CASE("Device actor drains queued work on destruction", "[core][actor]") {
+    auto state = make_state();
+    std::atomic<int> completed{0};
+    {
+        DeviceActor actor(simulated_factory(state));
+        for (int i = 0; i < 20; ++i) {
+            actor.post([&completed](const Result<IDeviceConnection *> &) { ++completed; });
+        }
+    }
+    REQUIRE(completed == 20);
+}
+
+TEST_CASE("Device actors are shared per device path", "[core][actor]") {
+    Device device(L"Simulated Camera", L"\\\\?\\usb#vid_046d&pid_085e#sim");
+    Device same(L"Simulated Camera", L"\\\\?\\USB#VID_046D&PID_085E#SIM");
+    Device other(L"Other Camera", L"\\\\?\\usb#vid_1234&pid_5678#sim");
+
+    auto a = acquire_device_actor(device);
+    auto b = acquire_device_actor(same);
+    auto c = acquire_device_actor(other);
+
+    REQUIRE(a == b);
+    REQUIRE(a != c);
+}
+
+TEST_CASE("Device actor can be released by its own task", "[core][actor]") {
+    auto state = make_state();
+    auto actor = std::make_shared<DeviceActor>(simulated_factory(state));
+    std::promise<void> released;
+
+    // The task holds the only reference once the caller lets go
+    actor->post([keep = actor, &released](const Result<IDeviceConnection *> &) mutable {
+        keep.reset();
+        released.set_value();
+    });
+    actor.reset();
+    REQUIRE(released.get_future().wait_for(std::chrono::seconds(2)) ==
+            std::future_status::ready);
+}
+
+TEST_CASE("One camera can be shared across threads", "[core][actor]") {
+    Device device(L"Simulated Camera", L"\\\\?\\usb#vid_046d&pid_085e#shared");
+    SimulatedPlatform platform;
+    platform.add(device, make_state());
+    set_platform_interface_factory([platform] {
+        return std::unique_ptr<IPlatformInterface>(std::make_unique<SimulatedPlatform>(platform));
+    });
+
+    {
+        Camera camera(device);
+        std::atomic<int> failures{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t) {
+            threads.emplace_back([&camera, &failures, t] {
+                for (int i = 0; i < 200; ++i) {
+                    // Timeouts change while other threads operate
+                    camera.set_timeout(std::chrono::milliseconds(1000 + t));
+                    if (!camera.set(CamProp::Pan, PropSetting(i, CamMode::Manual)).is_ok() ||
+                        !camera.get(CamProp::Zoom).is_ok()) {
+                        ++failures;
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        REQUIRE(failures == 0);
+        REQUIRE(camera.timeout() >= std::chrono::milliseconds(1000));
+    }
+
+    set_platform_interface_factory(nullptr);
+}
+
+// ============================================================================
+// Timeout and Hang Isolation Tests
+// ============================================================================
+TEST_CASE("Device actor times out a hung call", "[core][actor][timeout]") {
+    using namespace std::chrono;
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+    REQUIRE(actor.get(CamProp::Pan).is_ok()); // connection open
+
+    state->hang();
+    auto start = steady_clock::now();
+    auto result = actor.get(CamProp::Pan, milliseconds(50));
+    auto elapsed = steady_clock::now() - start;
+
+    REQUIRE(result.is_error());
+    REQUIRE(result.error().code() == ErrorCode::DeviceBusy);
+    REQUIRE(elapsed < milliseconds(1000));
+    REQUIRE_FALSE(actor.healthy());
+
+    // Later calls fail fast without queueing behind the stuck one
+    start = steady_clock::now();
+    auto rejected = actor.set(CamProp::Zoom, PropSetting(10, CamMode::Manual),
+                              milliseconds(5000));
+    REQUIRE(rejected.is_error());
+    REQUIRE(rejected.error().code() == ErrorCode::DeviceBusy);
+    REQUIRE(steady_clock::now() - start < milliseconds(1000));
+
+    auto stats = actor.stats();
+    REQUIRE(stats.timeouts == 1);
+    REQUIRE(stats.rejected == 1);
+
+    // Device recovers once the stuck call returns
+    state->release();
+    for (int i = 0; i < 200 && !actor.healthy(); ++i) {
+        std::this_thread::sleep_for(milliseconds(5));
+    }
+    REQUIRE(actor.healthy());
+    REQUIRE(actor.get(CamProp::Zoom, milliseconds(1000)).is_ok());
+    REQUIRE(state->camera[CamProp::Zoom].value == 100); // rejected write never ran
+}
+
+TEST_CASE("Device actor drops requests whose callers gave up", "[core][actor][timeout]") {
+    using namespace std::chrono;
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+    REQUIRE(actor.get(CamProp::Pan).is_ok());
+
+    state->hang();
+    actor.post([](const Result<IDeviceConnection *> &conn) {
+        if (conn.is_ok()) {
+            conn.value()->get_camera_property(CamProp::Pan); // blocks
+        }
+    });
+
+    std::atomic<bool> ran{false};
+    std::atomic<int> code{-1};
+    actor.post(
+        [&](const Result<IDeviceConnection *> &conn) {
+            ran = conn.is_ok();
+            code = conn.is_ok() ? 0 : static_cast<int>(conn.error().code());
+        },
+        steady_clock::now() + milliseconds(20));
+
+    std::this_thread::sleep_for(milliseconds(50));
+    state->release();
+    REQUIRE(actor.get(CamProp::Pan, milliseconds(1000)).is_ok());
+
+    REQUIRE_FALSE(ran);
+    REQUIRE(code == static_cast<int>(ErrorCode::DeviceBusy));
+    REQUIRE(actor.stats().expired == 1);
+}
+
+TEST_CASE("Device actor isolates a hang while opening", "[core][actor][timeout]") {
+    using namespace std::chrono;
+    auto state = make_state();
+    state->hang();
+    DeviceActor actor(simulated_factory(state));
+
+    auto result = actor.get(VidProp::Brightness, milliseconds(50));
+    REQUIRE(result.is_error());
+    REQUIRE(result.error().code() == ErrorCode::DeviceBusy);
+    REQUIRE_FALSE(actor.healthy());
+
+    state->release();
+    for (int i = 0; i < 200 && !actor.healthy(); ++i) {
+        std::this_thread::sleep_for(milliseconds(5));
+    }
+    REQUIRE(actor.get(VidProp::Brightness, milliseconds(1000)).is_ok());
+    REQUIRE(state->opens == 1);
+}
+
+TEST_CASE("Destroying a hung device actor does not block", "[core][actor][timeout]") {
+    using namespace std::chrono;
+    auto state = make_state();
+    auto start = steady_clock::now();
+    {
+        DeviceActor actor(simulated_factory(state));
+        REQUIRE(actor.get(CamProp::Pan).is_ok());
+        state->hang();
+        REQUIRE(actor.get(CamProp::Pan, milliseconds(50)).is_error());
+    }
+    REQUIRE(steady_clock::now() - start < milliseconds(1000));
+
+    // The detached thread finishes once the driver call returns
+    state->release();
+    for (int i = 0; i < 200 && state.use_count() > 1; ++i) {
+        std::this_thread::sleep_for(milliseconds(5));
+    }
+    REQUIRE(state.use_count() == 1);
+}
+
+// ============================================================================
+// Unsupported Property Cache Tests
+// ============================================================================
+TEST_CASE("Device actor answers unsupported properties from cache", "[core][actor][cache]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+
+    REQUIRE(actor.get_range(CamProp::Focus).error().code() ==
+            ErrorCode::PropertyNotSupported);
+    REQUIRE(actor.unsupported().contains(CamProp::Focus));
+    REQUIRE_FALSE(actor.unsupported().contains(CamProp::Pan));
+    int calls = state->calls;
+
+    // get, get_range and set are all answered without touching the device
+    REQUIRE(actor.get(CamProp::Focus).error().code() == ErrorCode::PropertyNotSupported);
+    REQUIRE(actor.get_range(CamProp::Focus).error().code() ==
+            ErrorCode::PropertyNotSupported);
+    REQUIRE(actor.set(CamProp::Focus, PropSetting(1, CamMode::Manual)).error().code() ==
+            ErrorCode::PropertyNotSupported);
+    REQUIRE(state->calls == calls);
+
+    REQUIRE(actor.get(VidProp::Gamma).is_error());
+    REQUIRE(actor.get(VidProp::Gamma).is_error());
+    REQUIRE(actor.get(VidProp::Brightness).is_ok());
+
+    auto stats = actor.stats();
+    REQUIRE(stats.unsupported_learned == 2);
+    REQUIRE(stats.unsupported_hits == 4);
+    REQUIRE(stats.unsupported_resets == 0);
+}
+
+TEST_CASE("Failed sets do not mark a property unsupported", "[core][actor][cache]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+
+    state->fail_next(1, ErrorCode::PropertyNotSupported);
+    REQUIRE(actor.set(CamProp::Pan, PropSetting(5, CamMode::Auto)).is_error());
+    REQUIRE_FALSE(actor.unsupported().contains(CamProp::Pan));
+    REQUIRE(actor.get(CamProp::Pan).is_ok());
+}
+
+TEST_CASE("Unsupported property cache resets on reconnect", "[core][actor][cache]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+
+    REQUIRE(actor.get(CamProp::Focus).is_error());
+    REQUIRE(actor.unsupported().contains(CamProp::Focus));
+
+    // Explicit reconnect
+    actor.reconnect();
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->camera[CamProp::Focus] = PropSetting(10, CamMode::Auto);
+    }
+    REQUIRE(actor.get(CamProp::Focus).is_ok());
+    REQUIRE(actor.stats().unsupported_resets == 1);
+
+    // Device dropped and came back
+    REQUIRE(actor.get(CamProp::Iris).is_error());
+    REQUIRE(actor.unsupported().contains(CamProp::Iris));
+    state->connected = false;
+    REQUIRE(actor.get(CamProp::Pan).is_error());
+    REQUIRE_FALSE(actor.unsupported().contains(CamProp::Iris));
+    REQUIRE(actor.stats().unsupported_resets == 2);
+}
+
+TEST_CASE("Unsupported property cache outlives device actors", "[core][actor][cache]") {
+    Device device(L"Simulated Camera", L"\\\\?\\usb#vid_046d&pid_085e#cache");
+    auto cache = std::make_shared<UnsupportedPropertyCache>();
+    auto state = make_state();
+
+    {
+        DeviceActor actor(simulated_factory(state), cache);
+        REQUIRE(actor.get_range(CamProp::Roll).is_error());
+    }
+    int calls = state->calls;
+    {
+        DeviceActor actor(simulated_factory(state), cache);
+        REQUIRE(actor.get_range(CamProp::Roll).error().code() ==
+                ErrorCode::PropertyNotSupported);
+    }
+    REQUIRE(state->calls == calls);
+    REQUIRE(cache->hits() == 1);
+
+    // The registry's cache for a path goes away with the path's last actor
+    SimulatedPlatform platform;
+    platform.add(device, state);
+    set_platform_interface_factory([platform] {
+        return std::unique_ptr<IPlatformInterface>(std::make_unique<SimulatedPlatform>(platform));
+    });
+    auto first = acquire_device_actor(device);
+    REQUIRE(first->get_range(CamProp::Roll).is_error());
+    REQUIRE(first->unsupported().contains(CamProp::Roll));
+    first.reset();
+    REQUIRE_FALSE(acquire_device_actor(device)->unsupported().contains(CamProp::Roll));
+    set_platform_interface_factory(nullptr);
+}
@@ -0,0 +1,192 @@
+// tests/cpp/unit/device_identity_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/device_identity.h"
+
+#include <algorithm>
+#include <cwctype>
+#include <random>
+#include <string>
+
+using namespace duvc;
+
+namespace {
+
+const std::wstring kBrioPath =
+    L"\\\\?\\usb#vid_046d&pid_085e&mi_00#7&1a2b3c4d&0&0000#"
+    L"{65E8773D-8F56-11D0-A3B9-00A0C9223196}\\global";
+const std::wstring kC920Path =
+    L"\\\\?\\usb#vid_046d&pid_082d#A1B2C3D4#"
+    L"{65e8773d-8f56-11d0-a3b9-00a0c9223196}\\global";
+
+std::wstring upper(std::wstring text) {
+    for (auto &c : text) {
+        c = static_cast<wchar_t>(std::towupper(c));
+    }
+    return text;
+}
+
+} // namespace
+
+// ============================================================================
+// Path Parsing Tests
+// ============================================================================
+TEST_CASE("Interface paths parse into identity fields", "[core][identity]") {
+    auto id = parse_device_identity(kBrioPath);
+    REQUIRE(id.bus == L"usb");
+    REQUIRE(id.vid == 0x046D);
+    REQUIRE(id.pid == 0x085E);
+    REQUIRE(id.interface_number == 0);
+    REQUIRE(id.usb_id() == 0x046D085Eu);
+    REQUIRE(id.hardware_id == L"vid_046d&pid_085e&mi_00");
+    REQUIRE(id.instance == L"7&1a2b3c4d&0&0000");
+    REQUIRE_FALSE(id.has_serial());
+    REQUIRE(id.serial().empty());
+    REQUIRE(id.interface_guid == L"{65e8773d-8f56-11d0-a3b9-00a0c9223196}");
+    REQUIRE(id.key == L"usb\\vid_046d&pid_085e&mi_00\\7&1a2b3c4d&0&0000");
+    REQUIRE(id.key_hash == identity_hash(id.key));
+
+    auto serial = parse_device_identity(kC920Path);
+    REQUIRE_FALSE(serial.interface_number);
+    REQUIRE(serial.has_serial());
+    REQUIRE(serial.serial() == L"A1B2C3D4");
+    REQUIRE(serial.serial_hash == identity_hash(L"a1b2c3d4"));
+}
+
+TEST_CASE("Path forms of one device share a key", "[core][identity]") {
+    auto interface_path = parse_device_identity(kBrioPath);
+    auto instance_id = parse_device_identity(
+        L"USB\\VID_046D&PID_085E&MI_00\\7&1A2B3C4D&0&0000");
+    auto moniker = parse_device_identity(L"@device:pnp:" + kBrioPath);
+
+    REQUIRE(instance_id.vid == 0x046D);
+    REQUIRE(instance_id.interface_guid.empty());
+    REQUIRE(instance_id.key == interface_path.key);
+    REQUIRE(moniker.key == interface_path.key);
+    REQUIRE(moniker.interface_guid == interface_path.interface_guid);
+    REQUIRE(device_key_hash(kBrioPath) == interface_path.key_hash);
+    REQUIRE(device_key_hash(upper(kBrioPath)) == interface_path.key_hash);
+    REQUIRE(device_key_hash(L"@device:pnp:" + kBrioPath) == moniker.key_hash);
+    REQUIRE(same_device_path(kBrioPath, upper(kBrioPath)));
+    REQUIRE_FALSE(same_device_path(kBrioPath, kC920Path));
+    REQUIRE_FALSE(same_device_path(kBrioPath, L""));
+}
+
+TEST_CASE("Unrecognized paths fall back to the folded path",
+          "[core][identity]") {
+    auto software = parse_device_identity(
+        L"@device:sw:{860BB310-5D01-11D0-BD3B-00A0C911CE86}\\Virtual Cam");
+    REQUIRE(software.bus.empty());
+    REQUIRE_FALSE(software.vid);
+    REQUIRE(software.key ==
+            L"{860bb310-5d01-11d0-bd3b-00a0c911ce86}\\virtual cam");
+
+    auto bad_ids = parse_device_identity(L"USB\\VID_04G6&PID_12&MI_0\\X");
+    REQUIRE(bad_ids.bus == L"usb");
+    REQUIRE_FALSE(bad_ids.vid);
+    REQUIRE_FALSE(bad_ids.pid);
+    REQUIRE_FALSE(bad_ids.interface_number);
+
+    REQUIRE(parse_device_identity(L"").key.empty());
+    REQUIRE(parse_device_identity(L"\\\\?\\").key == L"\\\\?\\");
+    REQUIRE(device_key_hash(L"") == identity_hash(L""));
+    REQUIRE(device_key_hash(L"USB\\VID_04G6&PID_12&MI_0\\X") == bad_ids.key_hash);
+}
+
+TEST_CASE("Parsing survives random input", "[core][identity][fuzz]") {
+    const std::wstring seeds[] = {
+        kBrioPath, kC920Path, L"USB\\VID_046D&PID_085E\\SERIAL",
+        L"@device:pnp:\\\\?\\swd#x#y#{z}", L"\\\\.\\root#image#0000#{g}\\r"};
+    const std::wstring alphabet = L"\\#&_{}:@?.vidpmVIDPM0123456789abcdefAF \0\xFF\x263A";
+
+    std::mt19937 rng(20240613);
+    for (int round = 0; round < 20000; ++round) {
+        std::wstring text = seeds[rng() % 5];
+        int edits = static_cast<int>(rng() % 8);
+        for (int e = 0; e < edits; ++e) {
+            size_t at = text.empty() ? 0 : rng() % (text.size() + 1);
+            wchar_t c = alphabet[rng() % alphabet.size()];
+            switch (rng() % 3) {
+            case 0:
+                text.insert(at, 1, c);
+                break;
+            case 1:
+                if (at < text.size()) {
+                    text.erase(at, 1 + rng() % 4);
+                }
+                break;
+            default:
+                if (at < text.size()) {
+                    text[at] = c;
+                }
+                break;
+            }
+        }
+
+        auto id = parse_device_identity(text);
+        REQUIRE(id.key_hash == identity_hash(id.key));
+        REQUIRE(device_key_hash(text) == id.key_hash);
+        REQUIRE(std::all_of(id.key.begin(), id.key.end(), [](wchar_t c) {
+            return std::towlower(c) == static_cast<std::wint_t>(c);
+        }));
+        REQUIRE(id.has_serial() == (id.serial_hash != 0));
+        if (id.vid || id.pid || id.interface_number) {
+            REQUIRE_FALSE(id.hardware_id.empty());
+        }
+        // Case never changes identity
+        REQUIRE(parse_device_identity(upper(text)).key == id.key);
+    }
+}
+
+// ============================================================================
+// Device Index Tests
+// ============================================================================
+TEST_CASE("Index finds devices by path, serial, VID:PID and name",
+          "[core][identity][index]") {
+    const std::wstring brio_video =
+        L"\\\\?\\usb#vid_046d&pid_085e&mi_02#7&1a2b3c4d&0&0002#"
+        L"{65e8773d-8f56-11d0-a3b9-00a0c9223196}\\global";
+    DeviceIndex index({
+        Device(L"Logitech BRIO", kBrioPath),
+        Device(L"HD Pro Webcam C920", kC920Path),
+        Device(L"Logitech BRIO", brio_video),
+        Device(L"Logitech BRIO (duplicate)", upper(kBrioPath)),
+        Device(L"Virtual Cam", L""),
+        Device(L"Another Virtual Cam", L""),
+    });
+    REQUIRE(index.size() == 5);
+
+    auto *brio = index.find_by_path(
+        L"USB\\VID_046D&PID_085E&MI_00\\7&1A2B3C4D&0&0000");
+    REQUIRE(brio);
+    REQUIRE(brio->position == 0);
+    REQUIRE(brio->device.path == kBrioPath);
+    REQUIRE(index.find_by_path(upper(brio_video))->position == 2);
+    REQUIRE(index.find_by_path(L"\\\\?\\usb#vid_1234&pid_5678#x#{g}") == nullptr);
+
+    auto *c920 = index.find_by_serial(L"a1b2c3d4");
+    REQUIRE(c920);
+    REQUIRE(c920->identity.pid == 0x082D);
+    REQUIRE(index.find_by_serial(L"7&1a2b3c4d&0&0000") == nullptr);
+
+    auto brios = index.find_by_usb_id(0x046D, 0x085E);
+    REQUIRE(brios.size() == 2);
+    REQUIRE(brios[0]->position == 0);
+    REQUIRE(brios[1]->position == 2);
+    REQUIRE(index.find_by_usb_id(0x046D, 0x0000).empty());
+
+    auto named = index.find_by_name(L"logitech brio");
+    REQUIRE(named.size() == 2);
+    REQUIRE(named[1]->position == 2);
+    REQUIRE(index.find_by_name(L"Virtual Cam").size() == 1);
+    REQUIRE(index.entries().back().position == 5);
+}
+
+TEST_CASE("Empty index finds nothing", "[core][identity][index]") {
+    DeviceIndex index;
+    REQUIRE(index.size() == 0);
+    REQUIRE(index.find_by_path(kBrioPath) == nullptr);
+    REQUIRE(index.find_by_serial(L"A1B2C3D4") == nullptr);
+    REQUIRE(index.find_by_usb_id(0x046D, 0x085E).empty());
+    REQUIRE(index.find_by_name(L"").empty());
+}
@@ -0,0 +1,235 @@
+// tests/cpp/unit/device_profile_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/device_profile.h"
+#include "../support/simulated_device.h"
+
+#include <chrono>
+
+using namespace duvc;
+using namespace duvc::test;
+
+namespace {
+
+std::shared_ptr<SimulatedDeviceState> camera_state() {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Pan] = PropSetting(0, CamMode::Manual);
+    state->camera[CamProp::Zoom] = PropSetting(100, CamMode::Manual);
+    state->camera[CamProp::Privacy] = PropSetting(0, CamMode::Manual);
+    state->video[VidProp::Brightness] = PropSetting(128, CamMode::Manual);
+    return state;
+}
+
+std::unique_ptr<IDeviceConnection> profiled(std::shared_ptr<SimulatedDeviceState> state,
+                                            const std::string &json) {
+    auto profiles = parse_device_profiles(json);
+    REQUIRE(profiles.is_ok());
+    REQUIRE(profiles.value().size() == 1);
+    return apply_device_profile(
+        std::make_unique<SimulatedConnection>(state),
+        std::make_shared<const DeviceProfile>(profiles.value()[0]));
+}
+
+Device usb_device(const wchar_t *ids) {
+    return Device(L"Camera", std::wstring(L"\\\\?\\usb#") + ids +
+                                 L"&mi_00#7&1a2b3c4d&0&0000#"
+                                 L"{65e8773d-8f56-11d0-a3b9-00a0c9223196}\\global");
+}
+
+} // namespace
+
+// ============================================================================
+// Parsing Tests
+// ============================================================================
+TEST_CASE("Device profiles parse from JSON", "[core][profile]") {
+    auto profiles = parse_device_profiles(R"({"profiles": [{
+        "vid": "0x046D", "pid": 2131, "name": "Test PTZ",
+        "supported": ["Pan", "Tilt", "vid.Brightness"],
+        "never_probe": ["cam.Privacy"],
+        "paced": ["Pan"],
+        "write_interval_ms": 40,
+        "ranges": {"Pan": {"min": -170, "max": 170, "mode": "manual"}}
+    }, {"vid": "1BCF"}]})");
+    REQUIRE(profiles.is_ok());
+    REQUIRE(profiles.value().size() == 2);
+
+    const DeviceProfile &ptz = profiles.value()[0];
+    REQUIRE(ptz.vid == 0x046D);
+    REQUIRE(ptz.pid == 2131);
+    REQUIRE(ptz.name == "Test PTZ");
+    REQUIRE(ptz.camera_supported->size() == 2);
+    REQUIRE(ptz.video_supported->contains(VidProp::Brightness));
+    REQUIRE(ptz.camera_never_probe.contains(CamProp::Privacy));
+    REQUIRE(ptz.write_interval == std::chrono::milliseconds(40));
+    REQUIRE(ptz.paces(CamProp::Pan));
+    REQUIRE_FALSE(ptz.paces(CamProp::Tilt));
+    REQUIRE(ptz.range_override(CamProp::Pan).min == -170);
+    REQUIRE(ptz.range_override(CamProp::Pan).default_mode == CamMode::Manual);
+    REQUIRE(ptz.range_override(CamProp::Tilt).empty());
+
+    REQUIRE(ptz.probes(CamProp::Tilt));
+    REQUIRE_FALSE(ptz.probes(CamProp::Zoom));
+    REQUIRE_FALSE(ptz.probes(VidProp::Contrast));
+
+    const DeviceProfile &vendor = profiles.value()[1];
+    REQUIRE(vendor.vid == 0x1BCF);
+    REQUIRE_FALSE(vendor.pid);
+    REQUIRE(vendor.name == "1BCF:*");
+    REQUIRE(vendor.probes(CamProp::Zoom));
+    // No paced list: every write is paced (a no-op with a zero interval)
+    REQUIRE(vendor.paces(VidProp::Gain));
+}
+
+TEST_CASE("Invalid device profiles are rejected", "[core][profile]") {
+    const char *invalid[] = {
+        R"({})",
+        R"({"profiles": [{"pid": "0853"}]})",
+        R"({"profiles": [{"vid": "12345"}]})",
+        R"({"profiles": [{"vid": 70000}]})",
+        R"({"profiles": [{"vid": "046D", "supported": ["Warp"]}]})",
+        R"({"profiles": [{"vid": "046D", "paced": "Pan"}]})",
+        R"({"profiles": [{"vid": "046D", "write_interval_ms": -5}]})",
+        R"({"profiles": [{"vid": "046D", "ranges": {"Pan": {"min": 1.5}}}]})",
+        R"({"profiles": [{"vid": "046D", "ranges": {"Pan": {"min": 9, "max": 1}}}]})",
+        R"({"profiles": [{"vid": "046D", "ranges": {"Pan": {"mode": "fast"}}}]})",
+    };
+    for (const char *json : invalid) {
+        INFO(json);
+        auto profiles = parse_device_profiles(json);
+        REQUIRE_FALSE(profiles.is_ok());
+        REQUIRE(profiles.error().code() == ErrorCode::InvalidArgument);
+    }
+}
+
+TEST_CASE("Built-in device profiles are valid", "[core][profile]") {
+    const auto &builtin = builtin_device_profiles();
+    for (const auto &profile : builtin) {
+        REQUIRE(profile.vid != 0);
+        REQUIRE_FALSE(profile.name.empty());
+    }
+}
+
+// ============================================================================
+// Database Tests
+// ============================================================================
+TEST_CASE("Profile lookup prefers the exact model", "[core][profile]") {
+    auto &database = DeviceProfileDatabase::instance();
+    database.reset();
+
+    DeviceProfile vendor;
+    vendor.vid = 0x1234;
+    vendor.name = "Vendor";
+    database.add(vendor);
+    DeviceProfile model;
+    model.vid = 0x1234;
+    model.pid = 0x0001;
+    model.name = "Model";
+    database.add(model);
+
+    REQUIRE(database.find(0x1234, 0x0001)->name == "Model");
+    REQUIRE(database.find(0x1234, 0x0002)->name == "Vendor");
+    REQUIRE(database.find(0x4321, 0x0001) == nullptr);
+
+    REQUIRE(database.find(usb_device(L"vid_1234&pid_0001"))->name == "Model");
+    REQUIRE(database.find(Device(L"Virtual", L"no usb ids here")) == nullptr);
+
+    // Adding the same VID/PID replaces the earlier profile
+    model.name = "Model v2";
+    database.add(model);
+    REQUIRE(database.find(0x1234, 0x0001)->name == "Model v2");
+    REQUIRE(database.profiles().size() == builtin_device_profiles().size() + 2);
+
+    database.reset();
+    REQUIRE(database.find(0x1234, 0x0001) == nullptr);
+    REQUIRE(database.profiles().size() == builtin_device_profiles().size());
+}
+
+// ============================================================================
+// Profiled Connection Tests
+// ============================================================================
+TEST_CASE("Unlisted properties never reach the driver", "[core][profile]") {
+    auto state = camera_state();
+    auto connection = profiled(state, R"({"profiles": [{"vid": "046D",
+        "supported": ["Pan", "Zoom", "Privacy", "Brightness"],
+        "never_probe": ["Privacy"]}]})");
+
+    REQUIRE(connection->get_camera_property(CamProp::Pan).is_ok());
+    int calls = state->calls.load();
+
+    auto privacy = connection->get_camera_property(CamProp::Privacy);
+    REQUIRE_FALSE(privacy.is_ok());
+    REQUIRE(privacy.error().code() == ErrorCode::PropertyNotSupported);
+    REQUIRE_FALSE(connection->set_camera_property(CamProp::Privacy, PropSetting(1, CamMode::Manual)).is_ok());
+    REQUIRE_FALSE(connection->get_camera_property_range(CamProp::Tilt).is_ok());
+    REQUIRE_FALSE(connection->get_video_property(VidProp::Contrast).is_ok());
+    REQUIRE(state->calls.load() == calls);
+
+    REQUIRE(connection->get_video_property(VidProp::Brightness).value().value == 128);
+}
+
+TEST_CASE("Range overrides correct reported ranges", "[core][profile]") {
+    auto state = camera_state();
+    auto connection = profiled(state, R"({"profiles": [{"vid": "046D",
+        "ranges": {"Zoom": {"min": 100, "max": 400, "default": 100}}}]})");
+
+    auto zoom = connection->get_camera_property_range(CamProp::Zoom);
+    REQUIRE(zoom.is_ok());
+    REQUIRE(zoom.value().min == 100);
+    REQUIRE(zoom.value().max == 400);
+    REQUIRE(zoom.value().step == 1);
+    REQUIRE(zoom.value().default_val == 100);
+
+    auto pan = connection->get_camera_property_range(CamProp::Pan);
+    REQUIRE(pan.value().min == 0);
+    REQUIRE(pan.value().max == 100);
+}
+
+TEST_CASE("Range overrides never produce min above max", "[core][profile]") {
+    // Each bound is valid on its own, but not against the device's range
+    auto state = camera_state();
+    auto connection = profiled(state, R"({"profiles": [{"vid": "046D",
+        "ranges": {"Zoom": {"min": 500}, "Pan": {"max": -10}}}]})");
+
+    auto zoom = connection->get_camera_property_range(CamProp::Zoom);
+    REQUIRE_FALSE(zoom.is_ok());
+    REQUIRE(zoom.error().code() == ErrorCode::InvalidArgument);
+    REQUIRE_FALSE(connection->get_camera_property_range(CamProp::Pan).is_ok());
+
+    RangeOverride override_;
+    override_.max = 100;
+    PropRange range;
+    range.min = 0;
+    range.max = 50;
+    REQUIRE(override_.apply(range).value().max == 100);
+    override_.min = 101;
+    REQUIRE_FALSE(override_.apply(range).is_ok());
+}
+
+TEST_CASE("Paced writes are spaced by the write interval", "[core][profile]") {
+    using Clock = std::chrono::steady_clock;
+    auto state = camera_state();
+    auto connection = profiled(state, R"({"profiles": [{"vid": "046D",
+        "paced": ["Pan"], "write_interval_ms": 30}]})");
+
+    auto start = Clock::now();
+    REQUIRE(connection->set_camera_property(CamProp::Pan, PropSetting(10, CamMode::Manual)).is_ok());
+    REQUIRE(connection->set_camera_property(CamProp::Pan, PropSetting(20, CamMode::Manual)).is_ok());
+    REQUIRE(connection->set_camera_property(CamProp::Pan, PropSetting(30, CamMode::Manual)).is_ok());
+    REQUIRE(Clock::now() - start >= std::chrono::milliseconds(60));
+
+    // Unpaced properties are written immediately
+    start = Clock::now();
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(connection->set_camera_property(CamProp::Zoom, PropSetting(i, CamMode::Manual)).is_ok());
+    }
+    REQUIRE(Clock::now() - start < std::chrono::milliseconds(30));
+    REQUIRE(state->writes.size() == 8);
+}
+
+TEST_CASE("Connections without a profile are not wrapped", "[core][profile]") {
+    auto state = camera_state();
+    auto inner = std::make_unique<SimulatedConnection>(state);
+    IDeviceConnection *raw = inner.get();
+    auto connection = apply_device_profile(std::move(inner), nullptr);
+    REQUIRE(connection.get() == raw);
+}
@@ -0,0 +1,93 @@
+// tests/cpp/unit/device_registry_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/device_registry.h"
+
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace duvc;
+
+namespace {
+
+Device brio() {
+    return Device(L"Logitech BRIO",
+                  L"\\\\?\\usb#vid_046d&pid_085e&mi_00#7&1a2b3c4d&0&0000#"
+                  L"{65e8773d-8f56-11d0-a3b9-00a0c9223196}\\global");
+}
+
+} // namespace
+
+// ============================================================================
+// Device Registry Tests
+// ============================================================================
+TEST_CASE("Interning a device twice shares one record", "[core][registry]") {
+    auto a = intern_device(brio());
+    auto b = intern_device(brio());
+    REQUIRE(a);
+    REQUIRE(a.record() == b.record());
+    REQUIRE(a == b);
+    REQUIRE(a.hash() == a.record()->identity.key_hash);
+    REQUIRE(a->name == L"Logitech BRIO");
+    REQUIRE(a.name_utf8() == "Logitech BRIO");
+    REQUIRE(a.path_utf8().rfind("\\\\?\\usb#vid_046d", 0) == 0);
+    REQUIRE(a.record()->identity.pid == 0x085E);
+
+    // Copies are pointer copies of the same record
+    DeviceHandle copy = a;
+    REQUIRE(&copy.device() == &a.device());
+}
+
+TEST_CASE("Handles compare by identity across path forms", "[core][registry]") {
+    auto interface_path = intern_device(brio());
+    auto instance_id = intern_device(
+        Device(L"Logitech BRIO", L"USB\\VID_046D&PID_085E&MI_00\\7&1A2B3C4D&0&0000"));
+    auto other = intern_device(Device(L"Logitech BRIO", L"USB\\VID_046D&PID_085E\\X"));
+
+    REQUIRE(interface_path.record() != instance_id.record());
+    REQUIRE(interface_path == instance_id);
+    REQUIRE(interface_path != other);
+
+    std::unordered_set<DeviceHandle> set{interface_path, instance_id, other};
+    REQUIRE(set.size() == 2);
+}
+
+TEST_CASE("Records are freed with their last handle", "[core][registry]") {
+    auto &registry = DeviceRegistry::instance();
+    size_t before = registry.size();
+    {
+        auto handle = intern_device(Device(L"Transient", L"USB\\VID_1234&PID_5678\\T1"));
+        REQUIRE(registry.size() == before + 1);
+    }
+    REQUIRE(registry.size() == before);
+}
+
+TEST_CASE("Null handles refer to an empty device", "[core][registry]") {
+    DeviceHandle handle;
+    REQUIRE_FALSE(handle);
+    REQUIRE(handle.record() == nullptr);
+    REQUIRE(handle->name.empty());
+    REQUIRE(handle.path_utf8().empty());
+    REQUIRE(handle == DeviceHandle());
+    REQUIRE(handle != intern_device(brio()));
+}
+
+TEST_CASE("Concurrent interning converges on one record", "[core][registry]") {
+    auto keep = intern_device(brio());
+    std::vector<const DeviceRecord *> seen(8);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < seen.size(); ++t) {
+        threads.emplace_back([&seen, t] {
+            for (int i = 0; i < 1000; ++i) {
+                seen[t] = intern_device(brio()).record();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (const auto *record : seen) {
+        REQUIRE(record == keep.record());
+    }
+}
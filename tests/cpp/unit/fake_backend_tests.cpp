@@ -0,0 +1,207 @@
+// tests/cpp/unit/fake_backend_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/camera.h"
+#include "duvc-ctl/core/device.h"
+#include "duvc-ctl/platform/fake.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace duvc;
+
+namespace {
+
+const char *const kScenario = R"({
+  "devices": [
+    {
+      "name": "Bench PTZ", "path": "fake://bench",
+      "motor_speed": 1.0,
+      "camera": {
+        "Pan":     {"min": -100, "max": 100, "default": 0},
+        "Privacy": {"min": 0, "max": 1, "default": 1, "read_only": true}
+      },
+      "video": {
+        "Brightness":   {"min": 0, "max": 255, "step": 5, "default": 125, "value": 200},
+        "WhiteBalance": {"min": 2800, "max": 6500, "default": 4600, "mode": "auto"}
+      }
+    },
+    {"name": "Bare Camera"}
+  ]
+})";
+
+std::shared_ptr<FakeBackend> scenario_backend() {
+    auto scenario = parse_fake_scenario(kScenario);
+    REQUIRE(scenario.is_ok());
+    return std::make_shared<FakeBackend>(scenario.value());
+}
+
+std::unique_ptr<IDeviceConnection> open(const std::shared_ptr<FakeBackend> &backend,
+                                        const Device &device) {
+    auto connection = make_fake_platform(backend)->create_connection(device);
+    REQUIRE(connection.is_ok());
+    return std::move(connection).value();
+}
+
+} // namespace
+
+// ============================================================================
+// Scenario Parsing Tests
+// ============================================================================
+TEST_CASE("Fake scenarios parse devices and controls", "[platform][fake]") {
+    auto scenario = parse_fake_scenario(kScenario);
+    REQUIRE(scenario.is_ok());
+    const auto &devices = scenario.value().devices;
+    REQUIRE(devices.size() == 2);
+
+    const FakeDevice &ptz = devices[0];
+    REQUIRE(ptz.device.name == L"Bench PTZ");
+    REQUIRE(ptz.motor_speed == 1.0);
+    REQUIRE(ptz.camera.at(CamProp::Pan).range.min == -100);
+    REQUIRE(ptz.camera.at(CamProp::Privacy).read_only);
+    const FakeControl &brightness = ptz.video.at(VidProp::Brightness);
+    REQUIRE(brightness.range.step == 5);
+    REQUIRE(brightness.range.default_val == 125);
+    REQUIRE(brightness.value.value == 200);
+    REQUIRE(ptz.video.at(VidProp::WhiteBalance).value.mode == CamMode::Auto);
+
+    // Missing paths are generated from the index
+    REQUIRE(devices[1].device.path == L"fake://1");
+    REQUIRE(devices[1].camera.empty());
+}
+
+TEST_CASE("Invalid fake scenarios are rejected with their location", "[platform][fake]") {
+    auto error_of = [](const char *text) {
+        auto scenario = parse_fake_scenario(text);
+        REQUIRE_FALSE(scenario.is_ok());
+        REQUIRE(scenario.error().code() == ErrorCode::InvalidArgument);
+        return scenario.error().message();
+    };
+    REQUIRE(error_of(R"({})").find("\"devices\"") != std::string::npos);
+    REQUIRE(error_of(R"({"devices": [{"path": "fake://x"}]})").find("\"name\"") !=
+            std::string::npos);
+    REQUIRE(error_of(R"({"devices": [{"name": "A", "camera": {"Warp": {"min": 0, "max": 1}}}]})")
+                .find("Warp") != std::string::npos);
+    REQUIRE(error_of(R"({"devices": [{"name": "A", "video": {"Gain": {"min": 5, "max": 1}}}]})")
+                .find("Gain") != std::string::npos);
+    REQUIRE(error_of(R"({"devices": [{"name": "A", "video": {"Gain": {"min": 0, "max": 9, "step": 3, "value": 4}}}]})")
+                .find("\"value\"") != std::string::npos);
+    REQUIRE(error_of(R"({"devices": [{"name": "A", "path": "fake://a"}, {"name": "B", "path": "fake://a"}]})")
+                .find("Fake device 1") != std::string::npos);
+}
+
+TEST_CASE("Built-in fake scenario is valid", "[platform][fake]") {
+    const FakeScenario &scenario = builtin_fake_scenario();
+    REQUIRE(scenario.devices.size() == 2);
+    REQUIRE(scenario.devices[0].camera.count(CamProp::Zoom) == 1);
+    REQUIRE(scenario.devices[0].camera.count(CamProp::PanRelative) == 1);
+    REQUIRE(scenario.devices[1].video.count(VidProp::Brightness) == 1);
+}
+
+// ============================================================================
+// Device Behaviour Tests
+// ============================================================================
+TEST_CASE("Fake devices keep written values", "[platform][fake]") {
+    auto backend = scenario_backend();
+    auto devices = backend->devices();
+    auto connection = open(backend, devices[0]);
+
+    REQUIRE(connection->get_video_property(VidProp::Brightness).value().value == 200);
+    REQUIRE(connection->set_video_property(VidProp::Brightness,
+                                           PropSetting(50, CamMode::Manual)).is_ok());
+    REQUIRE(connection->get_video_property(VidProp::Brightness).value().value == 50);
+    REQUIRE(connection->get_video_property_range(VidProp::Brightness).value().max == 255);
+
+    // Auto writes switch the mode and keep the value
+    REQUIRE(connection->set_video_property(VidProp::Brightness,
+                                           PropSetting(0, CamMode::Auto)).is_ok());
+    PropSetting automatic = connection->get_video_property(VidProp::Brightness).value();
+    REQUIRE(automatic.value == 50);
+    REQUIRE(automatic.mode == CamMode::Auto);
+
+    FakeStats stats = backend->stats();
+    REQUIRE(stats.writes == 2);
+    REQUIRE(stats.calls == 6);
+    REQUIRE(stats.open_connections == 1);
+    connection.reset();
+    REQUIRE(backend->stats().open_connections == 0);
+}
+
+TEST_CASE("Fake devices reject what real ones do", "[platform][fake]") {
+    auto backend = scenario_backend();
+    auto connection = open(backend, backend->devices()[0]);
+
+    auto misaligned = connection->set_video_property(VidProp::Brightness,
+                                                     PropSetting(52, CamMode::Manual));
+    REQUIRE(misaligned.error().code() == ErrorCode::InvalidValue);
+    auto outside = connection->set_camera_property(CamProp::Pan,
+                                                   PropSetting(101, CamMode::Manual));
+    REQUIRE(outside.error().code() == ErrorCode::InvalidValue);
+    auto read_only = connection->set_camera_property(CamProp::Privacy,
+                                                     PropSetting(0, CamMode::Manual));
+    REQUIRE(read_only.error().code() == ErrorCode::PermissionDenied);
+    REQUIRE(connection->get_camera_property(CamProp::Zoom).error().code() ==
+            ErrorCode::PropertyNotSupported);
+    REQUIRE(backend->stats().writes == 0);
+}
+
+TEST_CASE("Motorized fake controls move over time", "[platform][fake]") {
+    auto backend = scenario_backend();
+    auto connection = open(backend, backend->devices()[0]);
+
+    REQUIRE(connection->set_camera_property(CamProp::Pan,
+                                            PropSetting(100, CamMode::Manual)).is_ok());
+    REQUIRE(connection->get_camera_property(CamProp::Pan).value().value < 100);
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    REQUIRE(connection->get_camera_property(CamProp::Pan).value().value == 100);
+
+    // reset() restores starting values
+    backend->reset();
+    REQUIRE(connection->get_camera_property(CamProp::Pan).value().value == 0);
+}
+
+TEST_CASE("Unplugged fake devices fail until replugged", "[platform][fake]") {
+    auto backend = scenario_backend();
+    Device device = backend->devices()[0];
+    auto platform = make_fake_platform(backend);
+    auto connection = open(backend, device);
+
+    REQUIRE(backend->set_connected(device, false));
+    REQUIRE(platform->list_devices().value().size() == 1);
+    REQUIRE_FALSE(platform->is_device_connected(device).value());
+    REQUIRE_FALSE(connection->is_valid());
+    REQUIRE(connection->get_camera_property(CamProp::Pan).error().code() ==
+            ErrorCode::DeviceNotFound);
+    REQUIRE(platform->create_connection(device).error().code() == ErrorCode::DeviceNotFound);
+
+    REQUIRE(backend->set_connected(device, true));
+    REQUIRE(connection->get_camera_property(CamProp::Pan).is_ok());
+    REQUIRE_FALSE(backend->set_connected(Device(L"Other", L"fake://other"), false));
+}
+
+// ============================================================================
+// Installed Backend Tests
+// ============================================================================
+TEST_CASE("Installed fake backend serves enumeration and cameras", "[platform][fake]") {
+    auto backend = scenario_backend();
+    install_fake_backend(backend);
+    REQUIRE(platform_interface_overridden());
+
+    auto devices = list_devices();
+    REQUIRE(devices.size() == 2);
+    REQUIRE(devices[0].name == L"Bench PTZ");
+    REQUIRE(is_device_connected(devices[0]));
+    REQUIRE(find_device_by_path(L"FAKE://BENCH").name == L"Bench PTZ");
+
+    {
+        Camera camera(devices[0]);
+        REQUIRE(camera.set(VidProp::Brightness, PropSetting(100, CamMode::Manual)).is_ok());
+        REQUIRE(camera.get(VidProp::Brightness).value().value == 100);
+    }
+
+    backend->set_connected(devices[1], false);
+    REQUIRE(list_devices().size() == 1);
+    REQUIRE_FALSE(is_device_connected(devices[1]));
+
+    install_fake_backend(nullptr);
+}
@@ -0,0 +1,195 @@
+// tests/cpp/unit/nudge_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/camera.h"
+#include "support/simulated_device.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace duvc;
+using namespace duvc::test;
+
+namespace {
+
+const Device kCamera(L"Nudge Cam", L"\\\\?\\usb#vid_046d&pid_085e#nudge");
+// Unsupported properties are remembered per path, so tests that give the
+// device a relative control use their own
+const Device kStepCamera(L"Step Cam", L"\\\\?\\usb#vid_046d&pid_085e#step");
+const Device kDirectionCamera(L"Direction Cam", L"\\\\?\\usb#vid_046d&pid_085e#direction");
+
+/// Install a simulated platform serving one device with the given state
+void install(const std::shared_ptr<SimulatedDeviceState> &state,
+             const Device &device = kCamera) {
+    SimulatedPlatform platform;
+    platform.add(device, state);
+    set_platform_interface_factory([platform] {
+        return std::unique_ptr<IPlatformInterface>(std::make_unique<SimulatedPlatform>(platform));
+    });
+}
+
+std::shared_ptr<SimulatedDeviceState> make_state() {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Pan] = PropSetting(0, CamMode::Manual);
+    state->video[VidProp::Brightness] = PropSetting(50, CamMode::Manual);
+    return state;
+}
+
+int pan(const std::shared_ptr<SimulatedDeviceState> &state) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->camera[CamProp::Pan].value;
+}
+
+} // namespace
+
+// ============================================================================
+// Emulated Relative Moves
+// ============================================================================
+TEST_CASE("Emulated nudges cost one device call", "[core][nudge]") {
+    auto state = make_state();
+    install(state);
+    {
+        Camera camera(kCamera);
+        // First nudge: PanRelative range (unsupported), range, current
+        // value, write
+        REQUIRE(camera.nudge(CamProp::Pan, 10).is_ok());
+        REQUIRE(pan(state) == 10);
+        int after_first = state->calls.load();
+
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(camera.nudge(CamProp::Pan, 10).is_ok());
+        }
+        REQUIRE(pan(state) == 60);
+        REQUIRE(state->calls.load() - after_first == 5);
+    }
+    set_platform_interface_factory(nullptr);
+}
+
+TEST_CASE("Nudges clamp at the range ends", "[core][nudge]") {
+    auto state = make_state();
+    install(state);
+    {
+        Camera camera(kCamera);
+        REQUIRE(camera.nudge(VidProp::Brightness, -80).is_ok());
+        REQUIRE(camera.get(VidProp::Brightness).value().value == 0);
+
+        // Pushing against the end writes nothing
+        int calls = state->calls.load();
+        REQUIRE(camera.nudge(VidProp::Brightness, -5).is_ok());
+        REQUIRE(state->calls.load() == calls);
+
+        REQUIRE(camera.nudge(VidProp::Brightness, 1000).is_ok());
+        REQUIRE(camera.get(VidProp::Brightness).value().value == 100);
+    }
+    set_platform_interface_factory(nullptr);
+}
+
+TEST_CASE("Nudges follow writes and resync with the device", "[core][nudge]") {
+    auto state = make_state();
+    install(state);
+    {
+        Camera camera(kCamera);
+        REQUIRE(camera.nudge(CamProp::Pan, 5).is_ok());
+
+        // Writes through the same handle make the tracked value stale
+        REQUIRE(camera.set(CamProp::Pan, PropSetting(40, CamMode::Manual)).is_ok());
+        REQUIRE(camera.nudge(CamProp::Pan, 5).is_ok());
+        REQUIRE(pan(state) == 45);
+
+        // Writes from elsewhere are picked up once the tracked value is old
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->camera[CamProp::Pan] = PropSetting(80, CamMode::Manual);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+        REQUIRE(camera.nudge(CamProp::Pan, 5).is_ok());
+        REQUIRE(pan(state) == 85);
+    }
+    set_platform_interface_factory(nullptr);
+}
+
+TEST_CASE("Auto and async writes invalidate the tracked value", "[core][nudge]") {
+    auto state = make_state();
+    install(state);
+    {
+        Camera camera(kCamera);
+        REQUIRE(camera.nudge(CamProp::Pan, 5).is_ok());
+
+        // In auto mode the device picks the value; nudging starts from it
+        REQUIRE(camera.set(CamProp::Pan, PropSetting(0, CamMode::Auto)).is_ok());
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->camera[CamProp::Pan] = PropSetting(30, CamMode::Auto);
+        }
+        REQUIRE(camera.nudge(CamProp::Pan, 5).is_ok());
+        REQUIRE(pan(state) == 35);
+
+        auto settled = camera.set_and_wait_async(CamProp::Pan,
+                                                 PropSetting(70, CamMode::Manual));
+        REQUIRE(settled.get().is_ok());
+        REQUIRE(camera.nudge(CamProp::Pan, 5).is_ok());
+        REQUIRE(pan(state) == 75);
+    }
+    set_platform_interface_factory(nullptr);
+}
+
+// ============================================================================
+// Native Relative Controls
+// ============================================================================
+TEST_CASE("Nudges use relative controls whose range admits the step", "[core][nudge]") {
+    auto state = make_state();
+    state->camera[CamProp::PanRelative] = PropSetting(0, CamMode::Manual);
+    PropRange steps = state->range;
+    steps.min = -10;
+    steps.max = 10;
+    steps.default_val = 0;
+    state->camera_ranges[CamProp::PanRelative] = steps;
+    install(state, kStepCamera);
+    {
+        Camera camera(kStepCamera);
+        REQUIRE(camera.nudge(CamProp::Pan, -3).is_ok());
+        int calls = state->calls.load();
+        REQUIRE(camera.nudge(CamProp::Pan, -3).is_ok());
+        REQUIRE(state->calls.load() - calls == 1);
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            REQUIRE(state->writes.back().prop == static_cast<int>(CamProp::PanRelative));
+            REQUIRE(state->writes.back().setting.value == -3);
+        }
+
+        // Steps outside the control's range are emulated
+        REQUIRE(camera.nudge(CamProp::Pan, 25).is_ok());
+        REQUIRE(pan(state) == 25);
+
+        // So is a step the device rejects
+        state->fail_next(1, ErrorCode::InvalidValue);
+        REQUIRE(camera.nudge(CamProp::Pan, 5).is_ok());
+        REQUIRE(pan(state) == 30);
+
+        REQUIRE(camera.nudge(CamProp::PanRelative, 1).error().code() ==
+                ErrorCode::InvalidArgument);
+        REQUIRE(camera.nudge(CamProp::Pan, 0).is_ok());
+    }
+    set_platform_interface_factory(nullptr);
+}
+
+TEST_CASE("Direction-only relative controls are not used", "[core][nudge]") {
+    auto state = make_state();
+    state->camera[CamProp::PanRelative] = PropSetting(0, CamMode::Manual);
+    PropRange direction = state->range;
+    direction.min = -1;
+    direction.max = 1;
+    direction.default_val = 0;
+    state->camera_ranges[CamProp::PanRelative] = direction;
+    install(state, kDirectionCamera);
+    {
+        Camera camera(kDirectionCamera);
+        REQUIRE(camera.nudge(CamProp::Pan, 1).is_ok());
+        REQUIRE(pan(state) == 1);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        for (const auto &write : state->writes) {
+            REQUIRE(write.prop != static_cast<int>(CamProp::PanRelative));
+        }
+    }
+    set_platform_interface_factory(nullptr);
+}
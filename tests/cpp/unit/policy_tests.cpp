@@ -0,0 +1,213 @@
+// tests/cpp/unit/policy_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/device_actor.h"
+#include "duvc-ctl/core/policy.h"
+#include "support/simulated_device.h"
+
+#include <thread>
+
+using namespace duvc;
+using namespace duvc::test;
+using namespace std::chrono;
+
+namespace {
+
+std::shared_ptr<SimulatedDeviceState> make_state() {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Pan] = PropSetting(0, CamMode::Manual);
+    return state;
+}
+
+DevicePolicy fast_policy() {
+    DevicePolicy policy;
+    policy.retry.max_attempts = 3;
+    policy.retry.initial_backoff = milliseconds(1);
+    policy.retry.max_backoff = milliseconds(5);
+    policy.retry.jitter = 0.0;
+    policy.breaker.failure_threshold = 3;
+    policy.breaker.open_duration = milliseconds(50);
+    return policy;
+}
+
+Result<PropSetting> get_pan(DevicePolicyEngine &engine, DeviceActor &actor) {
+    return engine.run<PropSetting>([&] { return actor.get(CamProp::Pan); });
+}
+
+} // namespace
+
+// ============================================================================
+// Error Classification Tests
+// ============================================================================
+TEST_CASE("Policy error classification", "[core][policy]") {
+    REQUIRE(is_transient_error(Error(ErrorCode::DeviceBusy)));
+    REQUIRE_FALSE(is_transient_error(Error(ErrorCode::DeviceNotFound)));
+    REQUIRE_FALSE(is_transient_error(Error(ErrorCode::PropertyNotSupported)));
+
+    REQUIRE(is_device_failure(Error(ErrorCode::DeviceNotFound)));
+    REQUIRE(is_device_failure(Error(ErrorCode::SystemError)));
+    REQUIRE_FALSE(is_device_failure(Error(ErrorCode::PropertyNotSupported)));
+    REQUIRE_FALSE(is_device_failure(Error(ErrorCode::InvalidValue)));
+}
+
+// ============================================================================
+// Retry Tests
+// ============================================================================
+TEST_CASE("Policy retries transient errors", "[core][policy]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+    DevicePolicyEngine engine(fast_policy());
+
+    state->fail_next(2, ErrorCode::DeviceBusy);
+    auto result = get_pan(engine, actor);
+    REQUIRE(result.is_ok());
+
+    auto stats = engine.stats();
+    REQUIRE(stats.attempts == 3);
+    REQUIRE(stats.retries == 2);
+    REQUIRE(stats.failures == 2);
+    REQUIRE(stats.successes == 1);
+    REQUIRE(stats.consecutive_failures == 0);
+    REQUIRE(stats.state == CircuitState::Closed);
+}
+
+TEST_CASE("Policy gives up after max attempts", "[core][policy]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+    auto policy = fast_policy();
+    policy.breaker.failure_threshold = 10;
+    DevicePolicyEngine engine(policy);
+
+    state->fail_next(5, ErrorCode::DeviceBusy);
+    auto result = get_pan(engine, actor);
+    REQUIRE(result.is_error());
+    REQUIRE(result.error().code() == ErrorCode::DeviceBusy);
+    REQUIRE(engine.stats().attempts == 3);
+    REQUIRE(state->fail_remaining == 2);
+}
+
+TEST_CASE("Policy does not retry permanent errors", "[core][policy]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+    DevicePolicyEngine engine(fast_policy());
+
+    // Unsupported property: the device answered, nothing to retry
+    auto result = engine.run<PropSetting>([&] { return actor.get(CamProp::Focus); });
+    REQUIRE(result.error().code() == ErrorCode::PropertyNotSupported);
+    REQUIRE(engine.stats().attempts == 1);
+    REQUIRE(engine.stats().failures == 0);
+
+    state->fail_next(1, ErrorCode::PermissionDenied);
+    result = get_pan(engine, actor);
+    REQUIRE(result.error().code() == ErrorCode::PermissionDenied);
+    REQUIRE(engine.stats().attempts == 2);
+    REQUIRE(engine.stats().failures == 1);
+}
+
+TEST_CASE("Policy backoff grows exponentially", "[core][policy]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+    auto policy = fast_policy();
+    policy.retry.initial_backoff = milliseconds(10);
+    policy.retry.max_backoff = milliseconds(100);
+    policy.breaker.failure_threshold = 10;
+    DevicePolicyEngine engine(policy);
+
+    state->fail_next(2, ErrorCode::DeviceBusy);
+    auto start = steady_clock::now();
+    REQUIRE(get_pan(engine, actor).is_ok());
+    REQUIRE(steady_clock::now() - start >= milliseconds(30)); // 10 + 20
+}
+
+// ============================================================================
+// Circuit Breaker Tests
+// ============================================================================
+TEST_CASE("Circuit breaker opens and fails fast", "[core][policy]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+    auto policy = fast_policy();
+    policy.breaker.open_duration = seconds(10);
+    DevicePolicyEngine engine(policy);
+
+    state->fail_next(100, ErrorCode::SystemError);
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(get_pan(engine, actor).error().code() == ErrorCode::SystemError);
+    }
+    REQUIRE(engine.stats().state == CircuitState::Open);
+    REQUIRE(engine.stats().trips == 1);
+
+    int calls_before = state->calls;
+    auto result = get_pan(engine, actor);
+    REQUIRE(result.error().code() == ErrorCode::DeviceBusy);
+    REQUIRE(state->calls == calls_before); // device not touched
+    REQUIRE(engine.stats().short_circuited == 1);
+
+    engine.reset();
+    REQUIRE(engine.stats().state == CircuitState::Closed);
+}
+
+TEST_CASE("Circuit breaker half-opens and recovers", "[core][policy]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+    DevicePolicyEngine engine(fast_policy());
+
+    state->fail_next(3, ErrorCode::SystemError);
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(get_pan(engine, actor).is_error());
+    }
+    REQUIRE(engine.stats().state == CircuitState::Open);
+
+    std::this_thread::sleep_for(milliseconds(60));
+    REQUIRE(get_pan(engine, actor).is_ok()); // probe succeeds
+    REQUIRE(engine.stats().state == CircuitState::Closed);
+    REQUIRE(engine.stats().consecutive_failures == 0);
+}
+
+TEST_CASE("Circuit breaker reopens when the probe fails", "[core][policy]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+    DevicePolicyEngine engine(fast_policy());
+
+    state->fail_next(4, ErrorCode::DeviceBusy);
+    REQUIRE(get_pan(engine, actor).is_error()); // 3 attempts trip the breaker
+    REQUIRE(engine.stats().state == CircuitState::Open);
+
+    std::this_thread::sleep_for(milliseconds(60));
+    REQUIRE(get_pan(engine, actor).is_error()); // probe fails, no retry
+    auto stats = engine.stats();
+    REQUIRE(stats.state == CircuitState::Open);
+    REQUIRE(stats.trips == 2);
+    REQUIRE(stats.attempts == 4);
+
+    std::this_thread::sleep_for(milliseconds(60));
+    REQUIRE(get_pan(engine, actor).is_ok());
+    REQUIRE(engine.stats().state == CircuitState::Closed);
+}
+
+TEST_CASE("Disabled policy passes results through", "[core][policy]") {
+    auto state = make_state();
+    DeviceActor actor(simulated_factory(state));
+    auto policy = fast_policy();
+    policy.enabled = false;
+    DevicePolicyEngine engine(policy);
+
+    state->fail_next(10, ErrorCode::DeviceBusy);
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(get_pan(engine, actor).error().code() == ErrorCode::DeviceBusy);
+    }
+    REQUIRE(engine.stats().attempts == 5);
+    REQUIRE(engine.stats().state == CircuitState::Closed);
+}
+
+TEST_CASE("Default device policy is configurable", "[core][policy]") {
+    auto saved = default_device_policy();
+
+    auto policy = fast_policy();
+    policy.retry.max_attempts = 7;
+    set_default_device_policy(policy);
+    REQUIRE(DevicePolicyEngine().policy().retry.max_attempts == 7);
+
+    set_default_device_policy(saved);
+    REQUIRE(DevicePolicyEngine().policy().retry.max_attempts ==
+            saved.retry.max_attempts);
+}
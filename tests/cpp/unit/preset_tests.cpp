@@ -0,0 +1,280 @@
+// tests/cpp/unit/preset_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/camera.h"
+#include "duvc-ctl/core/device_actor.h"
+#include "duvc-ctl/core/preset.h"
+#include "support/simulated_device.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace duvc;
+using namespace duvc::test;
+
+namespace {
+
+PropRange make_range(int min, int max, int step) {
+    PropRange range;
+    range.min = min;
+    range.max = max;
+    range.step = step;
+    range.default_val = min;
+    range.default_mode = CamMode::Manual;
+    return range;
+}
+
+std::shared_ptr<SimulatedDeviceState> make_state() {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Zoom] = PropSetting(100, CamMode::Manual);
+    state->camera_ranges[CamProp::Zoom] = make_range(100, 500, 10);
+    state->camera[CamProp::Focus] = PropSetting(0, CamMode::Auto);
+    state->camera_ranges[CamProp::Focus] = make_range(0, 255, 1);
+    state->video[VidProp::Brightness] = PropSetting(128, CamMode::Manual);
+    state->video_ranges[VidProp::Brightness] = make_range(0, 255, 1);
+    return state;
+}
+
+Preset make_preset(const std::string &name, int zoom, int brightness) {
+    Preset preset;
+    preset.name = name;
+    preset.set(CamProp::Zoom, PropSetting(zoom, CamMode::Manual));
+    preset.set(VidProp::Brightness, PropSetting(brightness, CamMode::Manual));
+    preset.set(CamProp::Focus, PropSetting(0, CamMode::Auto));
+    return preset;
+}
+
+} // namespace
+
+// ============================================================================
+// Preset Store Tests
+// ============================================================================
+TEST_CASE("Preset set replaces earlier values", "[core][preset]") {
+    Preset preset;
+    preset.set(CamProp::Zoom, PropSetting(1, CamMode::Manual));
+    preset.set(VidProp::Gain, PropSetting(2, CamMode::Manual));
+    preset.set(CamProp::Zoom, PropSetting(3, CamMode::Manual));
+    REQUIRE(preset.values.size() == 2);
+    REQUIRE(preset.values[0].setting.value == 3);
+    REQUIRE(preset.values[1].video);
+}
+
+TEST_CASE("Preset binary format round-trips", "[core][preset]") {
+    std::vector<Preset> presets = {make_preset("wide", 100, 140),
+                                   make_preset("tele", -5, 90)};
+    presets[1].version = 7;
+
+    auto parsed = parse_presets(serialize_presets(presets));
+    REQUIRE(parsed.is_ok());
+    const auto &out = parsed.value();
+    REQUIRE(out.size() == 2);
+    REQUIRE(out[1].name == "tele");
+    REQUIRE(out[1].version == 7);
+    REQUIRE(out[1].values.size() == 3);
+    REQUIRE(out[1].values[0].cam_prop == CamProp::Zoom);
+    REQUIRE(out[1].values[0].setting.value == -5);
+    REQUIRE(out[1].values[1].vid_prop == VidProp::Brightness);
+    REQUIRE(out[1].values[2].setting.mode == CamMode::Auto);
+
+    auto bytes = serialize_presets(presets);
+    bytes.pop_back();
+    REQUIRE(parse_presets(bytes).is_error());
+    REQUIRE(parse_presets({'n', 'o', 'p', 'e'}).is_error());
+}
+
+TEST_CASE("Preset store versions and persists presets", "[core][preset]") {
+    auto dir = std::filesystem::temp_directory_path() / "duvc_preset_tests";
+    std::filesystem::remove_all(dir);
+    auto path = dir / "nested" / "presets.bin";
+
+    PresetStore store(path);
+    REQUIRE(store.load().is_ok()); // Missing file loads as empty
+    REQUIRE(store.presets().empty());
+
+    REQUIRE(store.put(make_preset("wide", 100, 140)).version == 1);
+    REQUIRE(store.put(make_preset("tele", 400, 120)).version == 1);
+    REQUIRE(store.put(make_preset("wide", 150, 140)).version == 2);
+    REQUIRE(store.save().is_ok());
+
+    PresetStore reopened(path);
+    REQUIRE(reopened.load().is_ok());
+    REQUIRE(reopened.presets().size() == 2);
+    REQUIRE(reopened.find("wide")->version == 2);
+    REQUIRE(reopened.find("wide")->values[0].setting.value == 150);
+    REQUIRE(reopened.find("missing") == nullptr);
+
+    REQUIRE(reopened.remove("tele"));
+    REQUIRE_FALSE(reopened.remove("tele"));
+
+    {
+        std::ofstream corrupt(path, std::ios::binary | std::ios::trunc);
+        corrupt << "garbage";
+    }
+    REQUIRE(reopened.load().is_error());
+    std::filesystem::remove_all(dir);
+}
+
+// ============================================================================
+// Preset Recall Tests
+// ============================================================================
+TEST_CASE("Recall clamps to range and orders auto last", "[core][preset]") {
+    auto state = make_state();
+    PresetRecaller recaller(std::make_shared<DeviceActor>(simulated_factory(state)));
+
+    Preset preset = make_preset("p", 1000, 140);
+    preset.set(VidProp::Gamma, PropSetting(1, CamMode::Manual)); // Unsupported
+    auto plan = recaller.compile(preset);
+    REQUIRE(plan.steps.size() == 3);
+    REQUIRE(plan.unsupported.size() == 1);
+    REQUIRE(plan.adjusted == 1);
+    REQUIRE(plan.steps[0].value.setting.value == 500);
+    REQUIRE(plan.steps.back().value.cam_prop == CamProp::Focus);
+
+    auto report = recaller.recall(plan);
+    REQUIRE(report.writes == 3);
+    REQUIRE(report.unsupported == 1);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    REQUIRE(state->camera[CamProp::Zoom].value == 500);
+    REQUIRE(state->writes.back().prop == static_cast<int>(CamProp::Focus));
+}
+
+TEST_CASE("Recall writes only what changed since the last recall", "[core][preset]") {
+    auto state = make_state();
+    PresetRecaller recaller(std::make_shared<DeviceActor>(simulated_factory(state)));
+
+    Preset wide = make_preset("wide", 100, 140);
+    Preset tele = make_preset("tele", 400, 140);
+    wide.version = tele.version = 1;
+
+    auto first = recaller.recall(wide);
+    REQUIRE(first.writes == 3); // Nothing cached yet
+    REQUIRE(first.failed == 0);
+
+    auto second = recaller.recall(tele);
+    REQUIRE(second.writes == 1); // Only zoom differs
+    REQUIRE(second.skipped == 2);
+
+    auto again = recaller.recall(tele);
+    REQUIRE(again.writes == 0);
+
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        REQUIRE(state->writes.size() == 4);
+        REQUIRE(state->camera[CamProp::Zoom].value == 400);
+        state->camera[CamProp::Zoom].value = 200; // Changed behind our back
+    }
+    recaller.invalidate();
+    REQUIRE(recaller.recall(tele).writes == 3);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    REQUIRE(state->camera[CamProp::Zoom].value == 400);
+}
+
+TEST_CASE("Recall reports failed writes and retries them next time", "[core][preset]") {
+    auto state = make_state();
+    state->read_only.insert(CamProp::Zoom);
+    PresetRecaller recaller(std::make_shared<DeviceActor>(simulated_factory(state)));
+
+    Preset preset = make_preset("p", 200, 10);
+    auto report = recaller.recall(preset);
+    REQUIRE(report.failed == 1);
+    REQUIRE(report.entries[0].outcome == ResetOutcome::Failed);
+    REQUIRE(report.entries[0].error->code() == ErrorCode::PermissionDenied);
+
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->read_only.clear();
+    }
+    auto retry = recaller.recall(preset);
+    REQUIRE(retry.writes == 1);
+    REQUIRE(retry.skipped == 2);
+}
+
+TEST_CASE("Capture reads current values into a preset", "[core][preset]") {
+    auto state = make_state();
+    state->camera[CamProp::ZoomRelative] = PropSetting(1, CamMode::Manual);
+    state->camera_ranges[CamProp::ZoomRelative] = make_range(-1, 1, 1);
+    PresetRecaller recaller(std::make_shared<DeviceActor>(simulated_factory(state)));
+
+    Preset captured = recaller.capture("now");
+    REQUIRE(captured.name == "now");
+    REQUIRE(captured.values.size() == 3); // Zoom, Focus, Brightness
+    REQUIRE(captured.values[0].cam_prop == CamProp::Zoom);
+    REQUIRE(captured.values[0].setting.value == 100);
+
+    // Captured values are cached, so recalling them changes nothing
+    REQUIRE(recaller.recall(captured).writes == 0);
+}
+
+TEST_CASE("Compiled plans follow preset contents, not versions", "[core][preset]") {
+    auto state = make_state();
+    PresetRecaller recaller(std::make_shared<DeviceActor>(simulated_factory(state)));
+    const auto path = std::filesystem::temp_directory_path() / "duvc_preset_cache_test.bin";
+
+    PresetStore store(path);
+    REQUIRE(recaller.compile(store.put(make_preset("p", 200, 10))).steps[0].value.setting.value == 200);
+
+    // Removing and re-adding restarts the version at 1
+    REQUIRE(store.remove("p"));
+    const Preset &readded = store.put(make_preset("p", 300, 10));
+    REQUIRE(readded.version == 1);
+    REQUIRE(recaller.compile(readded).steps[0].value.setting.value == 300);
+
+    // Another store holding the same name and version
+    PresetStore other(path);
+    REQUIRE(recaller.compile(other.put(make_preset("p", 400, 10))).steps[0].value.setting.value == 400);
+}
+
+TEST_CASE("Transient range errors are not cached as unsupported", "[core][preset]") {
+    auto state = make_state();
+    PresetRecaller recaller(std::make_shared<DeviceActor>(simulated_factory(state)));
+    Preset preset = make_preset("p", 200, 10);
+
+    state->fail_next(1, ErrorCode::DeviceBusy);
+    auto plan = recaller.compile(preset);
+    REQUIRE(plan.unsupported.size() == 1);
+    REQUIRE(plan.steps.size() == 2);
+
+    plan = recaller.compile(preset);
+    REQUIRE(plan.unsupported.empty());
+    REQUIRE(plan.steps.size() == 3);
+}
+
+TEST_CASE("Relative controls are never recalled", "[core][preset]") {
+    auto state = make_state();
+    state->camera[CamProp::ZoomRelative] = PropSetting(0, CamMode::Manual);
+    state->camera_ranges[CamProp::ZoomRelative] = make_range(-1, 1, 1);
+    PresetRecaller recaller(std::make_shared<DeviceActor>(simulated_factory(state)));
+
+    Preset preset = make_preset("p", 200, 10);
+    preset.set(CamProp::ZoomRelative, PropSetting(1, CamMode::Manual));
+    auto report = recaller.recall(preset);
+    REQUIRE(report.writes == 3);
+    REQUIRE(report.unsupported == 1);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    REQUIRE(state->camera[CamProp::ZoomRelative].value == 0);
+}
+
+TEST_CASE("Writes through the camera invalidate recalled values", "[core][preset]") {
+    const Device device(L"Preset Cam", L"\\\\?\\usb#vid_046d&pid_085e#preset");
+    auto state = make_state();
+    SimulatedPlatform platform;
+    platform.add(device, state);
+    set_platform_interface_factory([platform] {
+        return std::unique_ptr<IPlatformInterface>(std::make_unique<SimulatedPlatform>(platform));
+    });
+    {
+        Camera camera(device);
+        PresetRecaller recaller(camera);
+        Preset preset = make_preset("p", 200, 10);
+        REQUIRE(recaller.recall(preset).writes == 3);
+        REQUIRE(recaller.recall(preset).writes == 0);
+
+        REQUIRE(camera.set(CamProp::Zoom, PropSetting(300, CamMode::Manual)).is_ok());
+        auto report = recaller.recall(preset);
+        REQUIRE(report.writes == 1);
+        REQUIRE(report.skipped == 2);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        REQUIRE(state->camera[CamProp::Zoom].value == 200);
+    }
+    set_platform_interface_factory(nullptr);
+}
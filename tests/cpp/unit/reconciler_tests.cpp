@@ -0,0 +1,450 @@
+// tests/cpp/unit/reconciler_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/device_actor.h"
+#include "duvc-ctl/core/reconciler.h"
+#include "support/simulated_device.h"
+
+#include <algorithm>
+#include <cwctype>
+#include <map>
+#include <random>
+#include <thread>
+
+using namespace duvc;
+using namespace duvc::test;
+using namespace std::chrono;
+
+namespace {
+
+/// Simulated fleet with one actor per device and seeded random drift
+struct DriftingFleet {
+    std::vector<Device> devices;
+    std::vector<std::shared_ptr<SimulatedDeviceState>> states;
+    std::map<std::wstring, std::shared_ptr<DeviceActor>> actors;
+    std::mt19937 rng;
+
+    DriftingFleet(int count, unsigned seed = 1) : rng(seed) {
+        for (int i = 0; i < count; ++i) {
+            auto state = std::make_shared<SimulatedDeviceState>();
+            state->camera[CamProp::Zoom] = PropSetting(10, CamMode::Manual);
+            state->camera[CamProp::Focus] = PropSetting(20, CamMode::Auto);
+            state->video[VidProp::Brightness] = PropSetting(30, CamMode::Manual);
+            states.push_back(state);
+            devices.emplace_back(L"Cam " + std::to_wstring(i),
+                                 L"\\\\?\\usb#cam" + std::to_wstring(i));
+            actors[devices.back().path] =
+                std::make_shared<DeviceActor>(simulated_factory(state));
+        }
+    }
+
+    Reconciler::DeviceSource device_source() const {
+        return [this] { return devices; };
+    }
+
+    Reconciler::ActorSource actor_source() const {
+        return [this](const Device &device) -> std::shared_ptr<DeviceActor> {
+            auto it = actors.find(device.path);
+            return it != actors.end() ? it->second : nullptr;
+        };
+    }
+
+    /// Knock count random (device, property) pairs away from any desired value
+    void drift(int count) {
+        std::uniform_int_distribution<size_t> device(0, states.size() - 1);
+        std::uniform_int_distribution<int> prop(0, 2);
+        std::uniform_int_distribution<int> value(60, 90);
+        for (int i = 0; i < count; ++i) {
+            auto &state = *states[device(rng)];
+            std::lock_guard<std::mutex> lock(state.mutex);
+            switch (prop(rng)) {
+            case 0:
+                state.camera[CamProp::Zoom] = PropSetting(value(rng), CamMode::Manual);
+                break;
+            case 1:
+                state.camera[CamProp::Focus] = PropSetting(value(rng), CamMode::Manual);
+                break;
+            default:
+                state.video[VidProp::Brightness] = PropSetting(value(rng), CamMode::Manual);
+                break;
+            }
+        }
+    }
+
+    size_t writes() const {
+        size_t total = 0;
+        for (const auto &state : states) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            total += state->writes.size();
+        }
+        return total;
+    }
+};
+
+/// Every camera held at Zoom 10, Focus auto, Brightness 30
+DesiredState fleet_state(double rate = 10000.0) {
+    auto state = parse_desired_state(R"({
+        "devices": [
+            {"name": "Cam *", "properties": {"zoom": 10, "focus": "auto",
+                                             "brightness": {"value": 30}}}
+        ]
+    })");
+    REQUIRE(state.is_ok());
+    DesiredState desired = state.value();
+    desired.max_ops_per_second = rate;
+    return desired;
+}
+
+} // namespace
+
+// ============================================================================
+// Desired State Document Tests
+// ============================================================================
+TEST_CASE("Desired state parses selectors, values and settings",
+          "[core][reconciler]") {
+    auto state = parse_desired_state(R"({
+        "interval": 2.5, "rate": 40, "tolerance": 2, "timeout": 1.5,
+        "devices": [
+            {"name": "Logi*", "properties": {"Zoom": 100, "exposure": "auto"}},
+            {"path": "\\\\?\\usb#cam0", "properties": {
+                "vid.brightness": {"value": 5, "mode": "manual"},
+                "whitebalance": {"mode": "auto"}}}
+        ]
+    })");
+    REQUIRE(state.is_ok());
+    const auto &s = state.value();
+    REQUIRE(s.interval == milliseconds(2500));
+    REQUIRE(s.max_ops_per_second == 40.0);
+    REQUIRE(s.tolerance == 2);
+    REQUIRE(s.timeout == milliseconds(1500));
+    REQUIRE(s.devices.size() == 2);
+    REQUIRE(s.devices[0].selector.name == L"Logi*");
+    REQUIRE(s.devices[0].properties.size() == 2);
+    REQUIRE(s.devices[0].properties[0].cam_prop == CamProp::Zoom);
+    REQUIRE(s.devices[0].properties[0].setting.value == 100);
+    REQUIRE(s.devices[0].properties[1].setting.mode == CamMode::Auto);
+    REQUIRE(s.devices[1].selector.path == L"\\\\?\\usb#cam0");
+    REQUIRE(s.devices[1].properties[0].video);
+    REQUIRE(s.devices[1].properties[0].vid_prop == VidProp::Brightness);
+    REQUIRE(s.devices[1].properties[1].setting.mode == CamMode::Auto);
+}
+
+TEST_CASE("Desired state rejects malformed documents", "[core][reconciler]") {
+    const char *bad[] = {
+        "[]",
+        R"({})",
+        R"({"devices": [{"properties": {"zoom": 1}}]})",
+        R"({"devices": [{"name": "x"}]})",
+        R"({"devices": [{"name": "x", "properties": {"nosuch": 1}}]})",
+        R"({"devices": [{"name": "x", "properties": {"zoom": 1.5}}]})",
+        R"({"devices": [{"name": "x", "properties": {"zoom": {"mode": "manual"}}}]})",
+        R"({"interval": 0, "devices": []})",
+        R"({"rate": -1, "devices": []})",
+    };
+    for (const char *text : bad) {
+        auto state = parse_desired_state(text);
+        REQUIRE(state.is_error());
+        REQUIRE(state.error().code() == ErrorCode::InvalidArgument);
+    }
+}
+
+TEST_CASE("Selectors match by path or wildcard name", "[core][reconciler]") {
+    Device logi(L"Logitech BRIO", L"\\\\?\\USB#VID_046D");
+
+    DeviceSelector by_path;
+    by_path.path = L"\\\\?\\usb#vid_046d";
+    REQUIRE(by_path.matches(logi));
+
+    DeviceSelector by_name;
+    by_name.name = L"logi*";
+    REQUIRE(by_name.matches(logi));
+    by_name.name = L"*BR?O";
+    REQUIRE(by_name.matches(logi));
+    by_name.name = L"*Cam*";
+    REQUIRE_FALSE(by_name.matches(logi));
+
+    REQUIRE_FALSE(DeviceSelector{}.matches(logi));
+}
+
+TEST_CASE("Later entries override earlier ones", "[core][reconciler]") {
+    auto state = parse_desired_state(R"({"devices": [
+        {"name": "*", "properties": {"zoom": 1, "focus": 2}},
+        {"name": "Cam 1", "properties": {"zoom": 9}}
+    ]})");
+    REQUIRE(state.is_ok());
+
+    auto cam0 = state.value().desired_for(Device(L"Cam 0", L"p0"));
+    auto cam1 = state.value().desired_for(Device(L"Cam 1", L"p1"));
+    REQUIRE(cam0.size() == 2);
+    REQUIRE(cam0[0].setting.value == 1);
+    REQUIRE(cam1.size() == 2);
+    REQUIRE(cam1[0].setting.value == 9);
+    REQUIRE(cam1[1].setting.value == 2);
+}
+
+// ============================================================================
+// Reconciliation Tests
+// ============================================================================
+TEST_CASE("Sweep writes only drifted properties", "[core][reconciler]") {
+    DriftingFleet fleet(3);
+    {
+        std::lock_guard<std::mutex> lock(fleet.states[1]->mutex);
+        fleet.states[1]->camera[CamProp::Zoom] = PropSetting(50, CamMode::Manual);
+        fleet.states[1]->camera[CamProp::Focus] = PropSetting(20, CamMode::Manual);
+    }
+    Reconciler reconciler(fleet_state(), fleet.device_source(), fleet.actor_source());
+
+    std::vector<DriftEvent> seen;
+    auto report = reconciler.sweep([&](const DriftEvent &e) { seen.push_back(e); });
+    REQUIRE(report.devices == 3);
+    REQUIRE(report.reads == 9);
+    REQUIRE(report.drifted == 2);
+    REQUIRE(report.writes == 2);
+    REQUIRE(report.failures == 0);
+    REQUIRE(report.converged);
+    REQUIRE(seen.size() == 2);
+    REQUIRE(seen[0].device.path == fleet.devices[1].path);
+    REQUIRE(seen[0].actual->value == 50);
+    REQUIRE(seen[0].corrected);
+    REQUIRE(seen[1].desired.setting.mode == CamMode::Auto);
+
+    std::lock_guard<std::mutex> lock(fleet.states[1]->mutex);
+    REQUIRE(fleet.states[1]->writes.size() == 2);
+    REQUIRE(fleet.states[1]->camera[CamProp::Zoom].value == 10);
+    REQUIRE(fleet.states[1]->camera[CamProp::Focus].mode == CamMode::Auto);
+}
+
+TEST_CASE("Converged fleet sweeps without writing", "[core][reconciler]") {
+    DriftingFleet fleet(4);
+    Reconciler reconciler(fleet_state(), fleet.device_source(), fleet.actor_source());
+
+    auto report = reconciler.sweep();
+    REQUIRE(report.drifted == 0);
+    REQUIRE(report.writes == 0);
+    REQUIRE(fleet.writes() == 0);
+
+    // Auto-mode values may move freely; tolerance absorbs small manual jitter
+    auto state = fleet_state();
+    state.tolerance = 1;
+    reconciler.set_desired_state(state);
+    {
+        std::lock_guard<std::mutex> lock(fleet.states[0]->mutex);
+        fleet.states[0]->camera[CamProp::Focus].value = 77;
+        fleet.states[0]->camera[CamProp::Zoom].value = 11;
+    }
+    REQUIRE(reconciler.sweep().writes == 0);
+}
+
+TEST_CASE("Random drift converges in one sweep", "[core][reconciler]") {
+    DriftingFleet fleet(8, 42);
+    Reconciler reconciler(fleet_state(), fleet.device_source(), fleet.actor_source());
+
+    for (int round = 0; round < 5; ++round) {
+        fleet.drift(6);
+        auto report = reconciler.sweep();
+        REQUIRE(report.converged);
+        REQUIRE(report.writes == report.drifted);
+        REQUIRE(reconciler.sweep().writes == 0);
+    }
+
+    auto stats = reconciler.stats();
+    REQUIRE(stats.sweeps == 10);
+    REQUIRE(stats.reads == 10 * 8 * 3);
+    REQUIRE(stats.writes == stats.drift_events);
+    REQUIRE(stats.writes > 0);
+    REQUIRE(stats.converged);
+    REQUIRE(stats.last_convergence_time.count() > 0);
+}
+
+TEST_CASE("Failed corrections leave the fleet unconverged", "[core][reconciler]") {
+    DriftingFleet fleet(2);
+    {
+        std::lock_guard<std::mutex> lock(fleet.states[0]->mutex);
+        fleet.states[0]->camera[CamProp::Zoom] = PropSetting(0, CamMode::Manual);
+    }
+    fleet.states[0]->read_only.insert(CamProp::Zoom);
+    fleet.states[1]->connected = false;
+    Reconciler reconciler(fleet_state(), fleet.device_source(), fleet.actor_source());
+
+    auto report = reconciler.sweep();
+    REQUIRE_FALSE(report.converged);
+    REQUIRE(report.failures == 2); // Read-only write and unplugged device
+    REQUIRE(report.events.size() == 1);
+    REQUIRE(report.events[0].error->code() == ErrorCode::PermissionDenied);
+    REQUIRE_FALSE(reconciler.stats().converged);
+}
+
+TEST_CASE("Sweeps honour the rate limit", "[core][reconciler]") {
+    DriftingFleet fleet(2);
+    {
+        std::lock_guard<std::mutex> lock(fleet.states[0]->mutex);
+        fleet.states[0]->camera[CamProp::Zoom] = PropSetting(0, CamMode::Manual);
+    }
+    // At 100 ops/s the second device's reads wait out 3 reads and 1 write
+    Reconciler reconciler(fleet_state(100.0), fleet.device_source(),
+                          fleet.actor_source());
+
+    auto start = steady_clock::now();
+    auto report = reconciler.sweep();
+    REQUIRE(report.writes == 1);
+    REQUIRE(steady_clock::now() - start >= milliseconds(38));
+}
+
+TEST_CASE("Background sweeps spread devices over the interval",
+          "[core][reconciler]") {
+    DriftingFleet fleet(4);
+    auto state = fleet_state();
+    state.interval = milliseconds(200);
+    Reconciler reconciler(state, fleet.device_source(), fleet.actor_source());
+
+    std::mutex mutex;
+    std::vector<steady_clock::time_point> corrected;
+    std::vector<SweepReport> sweeps;
+    for (auto &s : fleet.states) {
+        std::lock_guard<std::mutex> lock(s->mutex);
+        s->camera[CamProp::Zoom] = PropSetting(0, CamMode::Manual);
+    }
+
+    auto start = steady_clock::now();
+    REQUIRE(reconciler.start(
+        [&](const DriftEvent &) {
+            std::lock_guard<std::mutex> lock(mutex);
+            corrected.push_back(steady_clock::now());
+        },
+        [&](const SweepReport &report) {
+            std::lock_guard<std::mutex> lock(mutex);
+            sweeps.push_back(report);
+        }));
+    REQUIRE(reconciler.running());
+    REQUIRE_FALSE(reconciler.start());
+
+    for (int i = 0; i < 100; ++i) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (sweeps.size() >= 2) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(milliseconds(10));
+    }
+    reconciler.stop();
+    REQUIRE_FALSE(reconciler.running());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    REQUIRE(sweeps.size() >= 2);
+    REQUIRE(sweeps[0].writes == 4);
+    REQUIRE(sweeps[1].writes == 0);
+    REQUIRE(corrected.size() == 4);
+    // Device i is swept about i * 50 ms into the sweep
+    REQUIRE(corrected[3] - start >= milliseconds(140));
+    REQUIRE(corrected[0] - start < milliseconds(100));
+    REQUIRE(reconciler.stats().converged);
+}
+
+TEST_CASE("Unreachable devices leave the sweep unconverged", "[core][reconciler]") {
+    DriftingFleet fleet(2);
+    fleet.states[1]->connected = false;
+    Reconciler reconciler(fleet_state(), fleet.device_source(), fleet.actor_source());
+
+    auto report = reconciler.sweep();
+    REQUIRE(report.events.empty());
+    REQUIRE(report.failures == 1);
+    REQUIRE_FALSE(report.converged);
+}
+
+TEST_CASE("Hung devices time out without stalling the sweep", "[core][reconciler]") {
+    DriftingFleet fleet(2);
+    {
+        std::lock_guard<std::mutex> lock(fleet.states[1]->mutex);
+        fleet.states[1]->camera[CamProp::Zoom] = PropSetting(0, CamMode::Manual);
+    }
+    auto state = fleet_state();
+    state.timeout = milliseconds(100);
+    state.interval = milliseconds(50);
+    Reconciler reconciler(state, fleet.device_source(), fleet.actor_source());
+    fleet.states[0]->hang();
+
+    auto start = steady_clock::now();
+    auto report = reconciler.sweep();
+    REQUIRE(steady_clock::now() - start < seconds(2));
+    REQUIRE(report.failures == 1);
+    REQUIRE(report.writes == 1);
+    REQUIRE_FALSE(report.converged);
+
+    // Background sweeps on the hung device stop promptly too
+    REQUIRE(reconciler.start());
+    std::this_thread::sleep_for(milliseconds(150));
+    start = steady_clock::now();
+    reconciler.stop();
+    REQUIRE(steady_clock::now() - start < seconds(2));
+    fleet.states[0]->release();
+}
+
+TEST_CASE("Device actors are held across sweeps", "[core][reconciler]") {
+    DriftingFleet fleet(2);
+    int acquired = 0;
+    auto source = fleet.actor_source();
+    std::vector<Device> listed = fleet.devices;
+    Reconciler reconciler(
+        fleet_state(), [&] { return listed; },
+        [&](const Device &device) {
+            ++acquired;
+            return source(device);
+        });
+
+    reconciler.sweep();
+    reconciler.sweep();
+    REQUIRE(acquired == 2);
+    auto &first = fleet.actors[fleet.devices[0].path];
+    REQUIRE(first.use_count() == 2);
+
+    // A device that leaves the list has its actor released
+    listed.erase(listed.begin());
+    reconciler.sweep();
+    REQUIRE(first.use_count() == 1);
+    REQUIRE(acquired == 2);
+}
+
+TEST_CASE("Reads that outlive their timeout finish safely", "[core][reconciler]") {
+    DriftingFleet fleet(1);
+    auto state = fleet_state();
+    state.timeout = milliseconds(50);
+    auto &device = *fleet.states[0];
+    device.hang();
+    int before;
+    {
+        Reconciler reconciler(state, fleet.device_source(), fleet.actor_source());
+        auto report = reconciler.sweep();
+        REQUIRE(report.failures == 1);
+        before = device.calls.load();
+    }
+
+    // Once released, the abandoned task reads all three desired properties
+    // from its own copy, then the get queued behind it runs
+    device.release();
+    auto &actor = fleet.actors[fleet.devices[0].path];
+    REQUIRE(actor->get(CamProp::Zoom, seconds(2)).is_ok());
+    REQUIRE(device.calls.load() - before == 4);
+}
+
+TEST_CASE("Held actors match paths regardless of case", "[core][reconciler]") {
+    DriftingFleet fleet(2);
+    int acquired = 0;
+    auto source = fleet.actor_source();
+    std::vector<Device> listed = fleet.devices;
+    Reconciler reconciler(
+        fleet_state(), [&] { return listed; },
+        [&](const Device &device) {
+            ++acquired;
+            return source(device);
+        });
+
+    reconciler.sweep();
+    for (auto &device : listed) {
+        std::transform(device.path.begin(), device.path.end(), device.path.begin(),
+                       [](wchar_t c) { return static_cast<wchar_t>(std::towupper(c)); });
+    }
+    reconciler.sweep();
+    REQUIRE(acquired == 2);
+    REQUIRE(fleet.actors[fleet.devices[0].path].use_count() == 2);
+}
@@ -0,0 +1,202 @@
+// tests/cpp/unit/search_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/device_actor.h"
+#include "duvc-ctl/core/search.h"
+#include "support/simulated_device.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace duvc;
+using namespace duvc::test;
+using namespace std::chrono;
+
+namespace {
+
+std::shared_ptr<SimulatedDeviceState> make_state(int max = 255, int step = 1) {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Focus] = PropSetting(0, CamMode::Manual);
+    state->range.max = max;
+    state->range.step = step;
+    return state;
+}
+
+int focus(SimulatedDeviceState &state) {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.camera[CamProp::Focus].value;
+}
+
+PropertyAccess focus_access(const std::shared_ptr<SimulatedDeviceState> &state) {
+    return property_access(std::make_shared<DeviceActor>(simulated_factory(state)),
+                           CamProp::Focus);
+}
+
+} // namespace
+
+// ============================================================================
+// Search Strategy Tests
+// ============================================================================
+TEST_CASE("Coarse-to-fine search finds the peak", "[core][search]") {
+    auto state = make_state();
+    auto sharpness = peaked_metric(state, CamProp::Focus, 137, 20.0);
+
+    bool at_position = true;
+    auto result = search_property(focus_access(state), ScoreFunction([&](int value) {
+        at_position = at_position && focus(*state) == value;
+        return sharpness();
+    }));
+    REQUIRE(result.is_ok());
+    REQUIRE(at_position);
+
+    const auto &r = result.value();
+    REQUIRE(r.best_value == 137);
+    REQUIRE(r.best_score == 100.0);
+    REQUIRE(r.evaluations < 60);
+    REQUIRE(r.samples.size() == static_cast<size_t>(r.evaluations));
+    REQUIRE(r.writes <= static_cast<uint64_t>(r.evaluations) + 1);
+    REQUIRE(focus(*state) == 137); // best value applied
+}
+
+TEST_CASE("Golden-section search finds the peak", "[core][search]") {
+    auto state = make_state();
+    auto sharpness = peaked_metric(state, CamProp::Focus, 61, 30.0);
+
+    SearchOptions options;
+    options.method = SearchMethod::GoldenSection;
+    auto result = search_property(focus_access(state),
+                                  ScoreFunction([&](int) { return sharpness(); }), options);
+    REQUIRE(result.is_ok());
+    REQUIRE(result.value().best_value == 61);
+    REQUIRE(result.value().evaluations < 20);
+    REQUIRE(focus(*state) == 61);
+}
+
+TEST_CASE("Search can minimize the score", "[core][search]") {
+    auto state = make_state(100);
+    auto sharpness = peaked_metric(state, CamProp::Focus, 30, 10.0);
+
+    SearchOptions options;
+    options.maximize = false;
+    options.lower = 20;
+    options.upper = 90;
+    auto result = search_property(focus_access(state),
+                                  ScoreFunction([&](int) { return sharpness(); }), options);
+    REQUIRE(result.is_ok());
+    REQUIRE(result.value().best_value == 90); // farthest from the peak
+}
+
+TEST_CASE("Search positions follow the property step", "[core][search]") {
+    auto state = make_state(200, 5);
+    auto sharpness = peaked_metric(state, CamProp::Focus, 72, 15.0);
+
+    bool aligned = true;
+    auto result = search_property(focus_access(state), ScoreFunction([&](int value) {
+        aligned = aligned && value % 5 == 0;
+        return sharpness();
+    }));
+    REQUIRE(result.is_ok());
+    REQUIRE(aligned);
+    REQUIRE(result.value().best_value == 70);
+}
+
+// ============================================================================
+// Cost Tests
+// ============================================================================
+TEST_CASE("Search overlaps scoring with the next move", "[core][search]") {
+    const auto delay = milliseconds(15);
+    auto state = make_state(8);
+    state->latency = duration_cast<microseconds>(delay);
+    auto sharpness = peaked_metric(state, CamProp::Focus, 4, 2.0);
+
+    SearchOptions options;
+    options.apply_best = false;
+
+    // Both: 9 positions, each costing one write and one scoring delay
+    auto sequential = search_property(focus_access(state), ScoreFunction([&](int) {
+        double s = sharpness();
+        std::this_thread::sleep_for(delay);
+        return s;
+    }), options);
+    REQUIRE(sequential.is_ok());
+
+    auto pipelined = search_property(focus_access(state), ProbeFunction([&](int) {
+        double s = sharpness(); // capture at the position...
+        return DeferredScore([s, delay] {
+            std::this_thread::sleep_for(delay); // ...score while moving on
+            return s;
+        });
+    }), options);
+    REQUIRE(pipelined.is_ok());
+
+    REQUIRE(pipelined.value().best_value == 4);
+    REQUIRE(pipelined.value().evaluations == 9);
+    REQUIRE(pipelined.value().elapsed * 10 < sequential.value().elapsed * 8);
+}
+
+TEST_CASE("Search skips writes to the current position", "[core][search]") {
+    auto state = make_state(4);
+    auto sharpness = peaked_metric(state, CamProp::Focus, 0, 1.0);
+
+    auto result = search_property(focus_access(state),
+                                  ScoreFunction([&](int) { return sharpness(); }));
+    REQUIRE(result.is_ok());
+    // Starts at 0: positions 1..4 are written, returning to 0 costs one more
+    REQUIRE(result.value().evaluations == 5);
+    REQUIRE(result.value().writes == 5);
+    REQUIRE(result.value().best_value == 0);
+}
+
+TEST_CASE("Search respects the evaluation budget", "[core][search]") {
+    auto state = make_state(1000);
+    auto sharpness = peaked_metric(state, CamProp::Focus, 500, 50.0);
+
+    SearchOptions options;
+    options.max_evaluations = 12;
+    int calls = 0;
+    auto result = search_property(focus_access(state), ScoreFunction([&](int) {
+        ++calls;
+        return sharpness();
+    }), options);
+    REQUIRE(result.is_ok());
+    REQUIRE(calls == 12);
+    REQUIRE(result.value().evaluations == 12);
+}
+
+// ============================================================================
+// Error Tests
+// ============================================================================
+TEST_CASE("Search reports invalid arguments and device errors", "[core][search]") {
+    auto state = make_state();
+    auto score = ScoreFunction([](int) { return 0.0; });
+
+    REQUIRE(search_property(PropertyAccess{}, score).error().code() ==
+            ErrorCode::InvalidArgument);
+
+    SearchOptions options;
+    options.points_per_pass = 2;
+    REQUIRE(search_property(focus_access(state), score, options).error().code() ==
+            ErrorCode::InvalidArgument);
+
+    options = SearchOptions{};
+    options.lower = 200;
+    options.upper = 100;
+    REQUIRE(search_property(focus_access(state), score, options).error().code() ==
+            ErrorCode::InvalidArgument);
+
+    auto iris = property_access(std::make_shared<DeviceActor>(simulated_factory(state)),
+                                CamProp::Iris);
+    REQUIRE(search_property(iris, score).error().code() == ErrorCode::PropertyNotSupported);
+
+    // A failed write aborts the search
+    auto target = focus_access(state);
+    std::atomic<int> writes{0};
+    auto set = target.set;
+    target.set = [&, set](const PropSetting &s) -> Result<void> {
+        if (++writes == 3) {
+            return Err<void>(ErrorCode::PermissionDenied, "Denied");
+        }
+        return set(s);
+    };
+    REQUIRE(search_property(target, score).error().code() == ErrorCode::PermissionDenied);
+}
@@ -0,0 +1,162 @@
+// tests/cpp/unit/serializer_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/utils/json.h"
+#include "duvc-ctl/utils/serializer.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace duvc;
+
+namespace {
+
+/// A device record as the CLI writes it
+void write_device(Serializer &out, int index, const std::wstring &name) {
+    out.begin_object();
+    out.field("index", index);
+    out.field("name", name);
+    out.key("controls").begin_object();
+    out.field("cam", 2).field("vid", 1);
+    out.end_object();
+    out.key("supported_cam").begin_array().value(L"Pan").value(L"Zoom").end_array();
+    out.end_object();
+}
+
+std::vector<uint8_t> bytes(const std::string &text) {
+    return std::vector<uint8_t>(text.begin(), text.end());
+}
+
+} // namespace
+
+// ============================================================================
+// JSON Tests
+// ============================================================================
+TEST_CASE("JSON output nests and separates values", "[utils][serializer]") {
+    Serializer out;
+    out.begin_object();
+    out.key("devices").begin_array();
+    write_device(out, 0, L"Cam A");
+    write_device(out, 1, L"Cam B");
+    out.end_array();
+    out.field("empty", std::vector<int>().size());
+    out.key("none").null();
+    out.field("ok", true);
+    out.field("ratio", 0.5);
+    out.end_object();
+
+    REQUIRE(out.buffer() ==
+            R"({"devices":[{"index":0,"name":"Cam A","controls":{"cam":2,"vid":1},)"
+            R"("supported_cam":["Pan","Zoom"]},{"index":1,"name":"Cam B","controls":)"
+            R"({"cam":2,"vid":1},"supported_cam":["Pan","Zoom"]}],"empty":0,)"
+            R"("none":null,"ok":true,"ratio":0.5})");
+    REQUIRE(parse_json(out.buffer()).is_ok());
+}
+
+TEST_CASE("JSON strings are escaped and transcoded", "[utils][serializer]") {
+    Serializer out;
+    out.begin_array();
+    out.value(L"Caf\u00e9 \"HD\"\n");
+    out.value("tab\there\\ \x01");
+    out.value(std::numeric_limits<double>::infinity());
+    out.value(std::numeric_limits<int64_t>::min());
+    out.end_array();
+
+    REQUIRE(out.buffer() == "[\"Caf\xc3\xa9 \\\"HD\\\"\\n\",\"tab\\there\\\\ \\u0001\","
+                            "null,-9223372036854775808]");
+    auto parsed = parse_json(out.buffer());
+    REQUIRE(parsed.is_ok());
+    REQUIRE(parsed.value().as_array()[0].as_string() == "Caf\xc3\xa9 \"HD\"\n");
+}
+
+TEST_CASE("JSON Lines ends every record with a newline", "[utils][serializer]") {
+    Serializer out(SerialFormat::JsonLines);
+    write_device(out, 0, L"A");
+    out.begin_object().field("event", "added").end_object();
+    out.value(7);
+
+    std::string text = out.take();
+    REQUIRE(text.find("}\n{\"event\":\"added\"}\n7\n") != std::string::npos);
+    REQUIRE(out.size() == 0);
+}
+
+// ============================================================================
+// CSV Tests
+// ============================================================================
+TEST_CASE("CSV flattens records into rows", "[utils][serializer]") {
+    Serializer out(SerialFormat::Csv);
+    write_device(out, 0, L"Cam, \"A\"");
+    write_device(out, 1, L"Cam B");
+
+    REQUIRE(out.buffer() == "index,name,controls.cam,controls.vid,supported_cam\n"
+                            "0,\"Cam, \"\"A\"\"\",2,1,Pan;Zoom\n"
+                            "1,Cam B,2,1,Pan;Zoom\n");
+}
+
+TEST_CASE("CSV header is the union of every record's columns", "[utils][serializer]") {
+    Serializer out(SerialFormat::Csv);
+    out.begin_object().field("a", 1).field("b", "x\ny").end_object();
+    out.begin_object().field("b", 3).field("c", 4).end_object();
+    out.begin_object().field("a", 5).key("b").null().end_object();
+    out.value("bare");
+
+    REQUIRE(out.buffer() == "a,b,c,value\n1,\"x\ny\",,\n,3,4,\n5,,,\n,,,bare\n");
+    REQUIRE(out.dropped_columns().empty());
+}
+
+TEST_CASE("CSV reports columns that arrive after the header was taken", "[utils][serializer]") {
+    Serializer out(SerialFormat::Csv);
+    out.begin_object().field("a", 1).end_object();
+    REQUIRE(out.take() == "a\n1\n");
+
+    out.begin_object().field("a", 2).field("b", 3).end_object();
+    out.begin_object().field("b", 4).field("c", 5).end_object();
+
+    REQUIRE(out.buffer() == "2\n\n");
+    REQUIRE(out.dropped_columns() == std::vector<std::string>{"b", "c"});
+}
+
+// ============================================================================
+// MessagePack Tests
+// ============================================================================
+TEST_CASE("MessagePack uses the smallest encodings", "[utils][serializer]") {
+    Serializer out(SerialFormat::MessagePack);
+    out.begin_object();
+    out.field("a", 1);
+    out.field("n", -33);
+    out.field("u", 300);
+    out.key("s").value(L"\u00e9");
+    out.key("x").begin_array().value(true).null().end_array();
+    out.end_object();
+
+    REQUIRE(bytes(out.buffer()) ==
+            std::vector<uint8_t>{0x85, 0xa1, 'a', 0x01, 0xa1, 'n', 0xd0, 0xdf,
+                                 0xa1, 'u', 0xcd, 0x01, 0x2c, 0xa1, 's', 0xa2,
+                                 0xc3, 0xa9, 0xa1, 'x', 0x92, 0xc3, 0xc0});
+}
+
+TEST_CASE("MessagePack container headers grow with their size", "[utils][serializer]") {
+    Serializer out(SerialFormat::MessagePack);
+    out.begin_array();
+    for (int i = 0; i < 20; ++i) {
+        out.value(i);
+    }
+    out.end_array();
+    out.value(std::string(40, 'x'));
+    out.value(1.5);
+
+    std::vector<uint8_t> data = bytes(out.buffer());
+    REQUIRE(data.size() == 3 + 20 + 2 + 40 + 9);
+    REQUIRE(data[0] == 0xdc);
+    REQUIRE(data[1] == 0x00);
+    REQUIRE(data[2] == 20);
+    REQUIRE(data[3] == 0x00);
+    REQUIRE(data[22] == 19);
+    REQUIRE(data[23] == 0xd9);
+    REQUIRE(data[24] == 40);
+    REQUIRE(data[65] == 0xcb);
+    REQUIRE(data[66] == 0x3f);
+    REQUIRE(data[67] == 0xf8);
+}
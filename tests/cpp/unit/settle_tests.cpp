@@ -0,0 +1,189 @@
+// tests/cpp/unit/settle_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/device_actor.h"
+#include "duvc-ctl/core/scheduler.h"
+#include "duvc-ctl/core/settle.h"
+#include "support/simulated_device.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace duvc;
+using namespace duvc::test;
+using namespace std::chrono;
+
+namespace {
+
+std::shared_ptr<SimulatedDeviceState> make_state(double speed) {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Zoom] = PropSetting(0, CamMode::Manual);
+    state->motor_speed = speed;
+    return state;
+}
+
+/// Start a move on the simulated device and wait for it to settle
+Result<SettleResult> move_and_wait(const std::shared_ptr<SimulatedDeviceState> &state,
+                                   int target, const SettleOptions &options,
+                                   TaskScheduler &scheduler = TaskScheduler::shared()) {
+    auto actor = std::make_shared<DeviceActor>(simulated_factory(state));
+    auto written = actor->set(CamProp::Zoom, PropSetting(target, CamMode::Manual));
+    if (!written.is_ok()) {
+        return Result<SettleResult>(written.error());
+    }
+    return wait_for_settle(async_property_read(actor, CamProp::Zoom), target, options,
+                           scheduler)
+        .get();
+}
+
+} // namespace
+
+// ============================================================================
+// Task Scheduler Tests
+// ============================================================================
+TEST_CASE("Task scheduler runs tasks in time order", "[core][settle]") {
+    TaskScheduler scheduler;
+    std::mutex mutex;
+    std::vector<int> order;
+    std::atomic<int> done{0};
+    auto record = [&](int id) {
+        return [&, id] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(id);
+            ++done;
+        };
+    };
+
+    auto now = TaskScheduler::Clock::now();
+    scheduler.schedule(now + milliseconds(30), record(3));
+    scheduler.schedule(now + milliseconds(10), record(1));
+    scheduler.schedule(now + milliseconds(10), record(2)); // same time: FIFO
+    scheduler.schedule(now - milliseconds(5), record(0));  // overdue: runs now
+
+    for (int i = 0; i < 200 && done < 4; ++i) {
+        std::this_thread::sleep_for(milliseconds(2));
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    REQUIRE(order == std::vector<int>{0, 1, 2, 3});
+    REQUIRE(scheduler.pending() == 0);
+}
+
+// ============================================================================
+// Settle Outcome Tests
+// ============================================================================
+TEST_CASE("Settle wait converges on a moving motor", "[core][settle]") {
+    auto state = make_state(0.5); // 100 units in 200 ms
+
+    auto result = move_and_wait(state, 100, SettleOptions{});
+    REQUIRE(result.is_ok());
+    const auto &r = result.value();
+    REQUIRE(r.converged());
+    REQUIRE(r.achieved.value == 100);
+    REQUIRE(r.elapsed >= milliseconds(150));
+    REQUIRE(r.elapsed < milliseconds(400));
+    // Backed-off polling: far fewer reads than a fixed 5 ms interval
+    REQUIRE(r.polls < 20);
+}
+
+TEST_CASE("Settle wait accepts values within tolerance", "[core][settle]") {
+    auto state = make_state(0.2); // 100 units in 500 ms
+
+    SettleOptions options;
+    options.tolerance = 40;
+    auto result = move_and_wait(state, 100, options);
+    REQUIRE(result.is_ok());
+    REQUIRE(result.value().converged());
+    REQUIRE(result.value().achieved.value >= 60);
+    REQUIRE(result.value().elapsed < milliseconds(450));
+}
+
+TEST_CASE("Settle wait detects a stalled motor", "[core][settle]") {
+    auto state = make_state(1.0);
+    state->motor_limit = 60;
+
+    SettleOptions options;
+    options.stall_timeout = milliseconds(100);
+    auto result = move_and_wait(state, 100, options);
+    REQUIRE(result.is_ok());
+    REQUIRE(result.value().status == SettleStatus::Stalled);
+    REQUIRE(result.value().achieved.value == 60);
+    REQUIRE(result.value().elapsed < milliseconds(1000));
+}
+
+TEST_CASE("Settle wait times out on a slow motor", "[core][settle]") {
+    auto state = make_state(0.05);
+
+    SettleOptions options;
+    options.deadline = milliseconds(100);
+    options.stall_timeout = milliseconds(0);
+    auto result = move_and_wait(state, 100, options);
+    REQUIRE(result.is_ok());
+    REQUIRE(result.value().status == SettleStatus::TimedOut);
+    REQUIRE(result.value().achieved.value > 0);
+    REQUIRE(result.value().achieved.value < 100);
+}
+
+TEST_CASE("Settle wait finishes when the device hangs", "[core][settle]") {
+    auto state = make_state(0.0);
+    auto actor = std::make_shared<DeviceActor>(simulated_factory(state));
+    REQUIRE(actor->get(CamProp::Zoom).is_ok());
+    state->hang();
+
+    SettleOptions options;
+    options.deadline = milliseconds(50);
+    auto future = wait_for_settle(async_property_read(actor, CamProp::Zoom), 10, options);
+    REQUIRE(future.wait_for(seconds(2)) == std::future_status::ready);
+    auto result = future.get();
+    REQUIRE(result.is_ok());
+    REQUIRE(result.value().status == SettleStatus::TimedOut);
+
+    state->release();
+}
+
+TEST_CASE("Settle wait reports read errors", "[core][settle]") {
+    auto state = make_state(0.0);
+    auto actor = std::make_shared<DeviceActor>(simulated_factory(state));
+
+    auto result = wait_for_settle(async_property_read(actor, CamProp::Focus), 10).get();
+    REQUIRE(result.is_error());
+    REQUIRE(result.error().code() == ErrorCode::PropertyNotSupported);
+
+    SettleOptions bad;
+    bad.initial_interval = milliseconds(0);
+    result = wait_for_settle(async_property_read(actor, CamProp::Zoom), 0, bad).get();
+    REQUIRE(result.error().code() == ErrorCode::InvalidArgument);
+
+    // Transient errors are polled through
+    state->fail_next(2, ErrorCode::DeviceBusy);
+    result = wait_for_settle(async_property_read(actor, CamProp::Zoom), 0).get();
+    REQUIRE(result.is_ok());
+    REQUIRE(result.value().converged());
+    REQUIRE(result.value().polls == 3);
+}
+
+// ============================================================================
+// Shared Scheduler Tests
+// ============================================================================
+TEST_CASE("Settle waits on many devices share one scheduler", "[core][settle]") {
+    TaskScheduler scheduler;
+    const int devices = 16;
+
+    std::vector<std::shared_ptr<SimulatedDeviceState>> states;
+    std::vector<std::future<Result<SettleResult>>> waits;
+    auto start = steady_clock::now();
+    for (int i = 0; i < devices; ++i) {
+        states.push_back(make_state(1.0)); // 100 units in 100 ms
+        auto actor = std::make_shared<DeviceActor>(simulated_factory(states.back()));
+        REQUIRE(actor->set(CamProp::Zoom, PropSetting(100, CamMode::Manual)).is_ok());
+        waits.push_back(wait_for_settle(async_property_read(actor, CamProp::Zoom), 100,
+                                        SettleOptions{}, scheduler));
+    }
+
+    for (auto &wait : waits) {
+        auto result = wait.get();
+        REQUIRE(result.is_ok());
+        REQUIRE(result.value().converged());
+    }
+    // Waited concurrently, not one after another
+    REQUIRE(steady_clock::now() - start < milliseconds(100 * devices / 2));
+}
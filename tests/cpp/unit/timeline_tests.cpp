@@ -0,0 +1,390 @@
+// tests/cpp/unit/timeline_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+
+#include "duvc-ctl/core/device_actor.h"
+#include "duvc-ctl/core/timeline.h"
+#include "support/simulated_device.h"
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <thread>
+
+using namespace duvc;
+using namespace duvc::test;
+using namespace std::chrono;
+
+namespace {
+
+/// Simulated devices addressable by path, served through the actor source
+struct SimulatedFleet {
+    std::vector<Device> devices;
+    std::vector<std::shared_ptr<SimulatedDeviceState>> states;
+
+    explicit SimulatedFleet(int count) {
+        for (int i = 0; i < count; ++i) {
+            auto state = std::make_shared<SimulatedDeviceState>();
+            state->camera[CamProp::Zoom] = PropSetting(0, CamMode::Manual);
+            state->video[VidProp::Brightness] = PropSetting(0, CamMode::Manual);
+            states.push_back(state);
+            devices.emplace_back(L"Cam " + std::to_wstring(i),
+                                 L"\\\\?\\usb#cam" + std::to_wstring(i));
+        }
+    }
+
+    TimelinePlayer::ActorSource source() const {
+        return [this](const Device &device) -> std::shared_ptr<DeviceActor> {
+            for (size_t i = 0; i < devices.size(); ++i) {
+                if (devices[i].path == device.path) {
+                    return std::make_shared<DeviceActor>(simulated_factory(states[i]));
+                }
+            }
+            return nullptr;
+        };
+    }
+
+    int zoom(size_t i) const {
+        std::lock_guard<std::mutex> lock(states[i]->mutex);
+        return states[i]->camera[CamProp::Zoom].value;
+    }
+};
+
+Cue zoom_cue(milliseconds at, int device, int value) {
+    Cue cue;
+    cue.at = at;
+    cue.device_index = device;
+    cue.cam_prop = CamProp::Zoom;
+    cue.setting = PropSetting(value, CamMode::Manual);
+    return cue;
+}
+
+} // namespace
+
+// ============================================================================
+// Cue File Tests
+// ============================================================================
+TEST_CASE("JSON cue lists are parsed", "[core][timeline]") {
+    auto cues = parse_cue_json(R"({"cues": [
+        {"time": 12.0, "device": "Cam 1", "property": "Zoom", "value": 100},
+        {"time": 0.25, "device": 2, "property": "brightness", "value": 40,
+         "mode": "auto"},
+        {"time": 1, "device": 0, "property": "BacklightCompensation",
+         "domain": "vid", "value": 1}
+    ]})");
+    REQUIRE(cues.is_ok());
+    REQUIRE(cues.value().size() == 3);
+
+    const Cue &zoom = cues.value()[0];
+    REQUIRE(zoom.at == seconds(12));
+    REQUIRE(zoom.device == L"Cam 1");
+    REQUIRE(zoom.domain == CueDomain::Camera);
+    REQUIRE(zoom.cam_prop == CamProp::Zoom);
+    REQUIRE(zoom.setting.value == 100);
+    REQUIRE(zoom.setting.mode == CamMode::Manual);
+
+    const Cue &brightness = cues.value()[1];
+    REQUIRE(brightness.at == milliseconds(250));
+    REQUIRE(brightness.device.empty());
+    REQUIRE(brightness.device_index == 2);
+    REQUIRE(brightness.domain == CueDomain::Video);
+    REQUIRE(brightness.vid_prop == VidProp::Brightness);
+    REQUIRE(brightness.setting.mode == CamMode::Auto);
+
+    REQUIRE(cues.value()[2].vid_prop == VidProp::BacklightCompensation);
+
+    // A bare array is accepted too
+    REQUIRE(parse_cue_json(R"([{"time": 0, "device": 0, "property": "Pan",
+                                "value": -10}])").is_ok());
+}
+
+TEST_CASE("Invalid cues are rejected with their position", "[core][timeline]") {
+    auto check = [](const char *cue) {
+        auto result = parse_cue_json(std::string("[") +
+                                     R"({"time": 0, "device": 0, "property": "Pan", "value": 0},)" +
+                                     cue + "]");
+        REQUIRE(result.is_error());
+        REQUIRE(result.error().code() == ErrorCode::InvalidArgument);
+        REQUIRE(result.error().message().find("Cue 1") != std::string::npos);
+    };
+    check(R"({"time": -1, "device": 0, "property": "Pan", "value": 0})");
+    check(R"({"time": 0, "property": "Pan", "value": 0})");
+    check(R"({"time": 0, "device": 0, "property": "Warp", "value": 0})");
+    check(R"({"time": 0, "device": 0, "property": "BacklightCompensation", "value": 0})");
+    check(R"({"time": 0, "device": 0, "property": "Pan", "value": 1.5})");
+    check(R"({"time": 0, "device": 0, "property": "Pan", "value": 0, "mode": "x"})");
+
+    // Out-of-range numbers saturate instead of overflowing
+    auto huge = parse_cue_json(R"([{"time": 1e300, "device": 1e300,
+                                    "property": "Pan", "value": -1e300}])");
+    REQUIRE(huge.is_ok());
+    REQUIRE(huge.value()[0].at.count() > 0);
+    REQUIRE(huge.value()[0].device_index == std::numeric_limits<int>::max());
+    REQUIRE(huge.value()[0].setting.value == std::numeric_limits<int>::min());
+
+    REQUIRE(parse_cue_json(R"({"cue": []})").is_error());
+}
+
+TEST_CASE("Binary cue lists round-trip", "[core][timeline]") {
+    std::vector<Cue> cues{zoom_cue(milliseconds(1500), 3, -7)};
+    Cue video;
+    video.at = microseconds(42);
+    video.device = L"\\\\?\\usb#vid_046d";
+    video.domain = CueDomain::Video;
+    video.vid_prop = VidProp::WhiteBalance;
+    video.setting = PropSetting(4600, CamMode::Auto);
+    cues.push_back(video);
+
+    auto bytes = serialize_cue_binary(cues);
+    auto parsed = parse_cue_binary(bytes);
+    REQUIRE(parsed.is_ok());
+    REQUIRE(parsed.value().size() == 2);
+    REQUIRE(parsed.value()[0].at == milliseconds(1500));
+    REQUIRE(parsed.value()[0].device_index == 3);
+    REQUIRE(parsed.value()[0].setting.value == -7);
+    REQUIRE(parsed.value()[1].device == video.device);
+    REQUIRE(parsed.value()[1].vid_prop == VidProp::WhiteBalance);
+    REQUIRE(parsed.value()[1].setting.mode == CamMode::Auto);
+
+    bytes.pop_back();
+    REQUIRE(parse_cue_binary(bytes).is_error());
+}
+
+TEST_CASE("Preset cues are parsed in either format", "[core][timeline]") {
+    auto cues = parse_cue_json(R"([{"time": 1, "device": "Cam 0", "preset": "podium"}])");
+    REQUIRE(cues.is_ok());
+    REQUIRE(cues.value()[0].domain == CueDomain::Preset);
+    REQUIRE(cues.value()[0].preset == "podium");
+
+    auto parsed = parse_cue_binary(serialize_cue_binary(cues.value()));
+    REQUIRE(parsed.is_ok());
+    REQUIRE(parsed.value()[0].domain == CueDomain::Preset);
+    REQUIRE(parsed.value()[0].preset == "podium");
+    REQUIRE(parsed.value()[0].device == L"Cam 0");
+
+    REQUIRE(parse_cue_json(R"([{"time": 0, "device": 0, "preset": ""}])").is_error());
+    REQUIRE(parse_cue_json(R"([{"time": 0, "device": 0, "preset": "podium",
+                                "property": "Zoom", "value": 1}])").is_error());
+}
+
+TEST_CASE("Cue files are loaded in either format", "[core][timeline]") {
+    auto dir = std::filesystem::temp_directory_path();
+    auto json_path = dir / "duvc_timeline_test.json";
+    auto binary_path = dir / "duvc_timeline_test.cue";
+    {
+        std::ofstream json(json_path);
+        json << R"([{"time": 2, "device": 1, "property": "Zoom", "value": 5}])";
+        std::ofstream binary(binary_path, std::ios::binary);
+        auto bytes = serialize_cue_binary({zoom_cue(milliseconds(2000), 1, 5)});
+        binary.write(reinterpret_cast<const char *>(bytes.data()),
+                     static_cast<std::streamsize>(bytes.size()));
+    }
+
+    for (const auto &path : {json_path, binary_path}) {
+        auto cues = load_cue_file(path);
+        REQUIRE(cues.is_ok());
+        REQUIRE(cues.value().size() == 1);
+        REQUIRE(cues.value()[0].at == seconds(2));
+        REQUIRE(cues.value()[0].setting.value == 5);
+        std::filesystem::remove(path);
+    }
+    REQUIRE(load_cue_file(dir / "duvc_timeline_missing.json").is_error());
+}
+
+// ============================================================================
+// Preparation Tests
+// ============================================================================
+TEST_CASE("Timeline resolves devices by path, name and index", "[core][timeline]") {
+    SimulatedFleet fleet(3);
+    std::vector<Cue> cues{zoom_cue(milliseconds(0), 0, 1), zoom_cue(milliseconds(0), 1, 2),
+                          zoom_cue(milliseconds(0), -1, 3)};
+    cues[1].device = L"CAM 2";               // name, case-insensitive
+    cues[2].device = L"\\\\?\\USB#CAM2";     // path, case-insensitive
+
+    TimelinePlayer player(cues);
+    REQUIRE(player.prepare(fleet.devices, fleet.source()).is_ok());
+    REQUIRE(player.device_count() == 2);
+    for (auto &state : fleet.states) {
+        REQUIRE(state->opens <= 1);
+    }
+    REQUIRE(fleet.states[2]->opens == 1); // opened ahead of playback
+
+    std::vector<Cue> unknown{zoom_cue(milliseconds(0), -1, 0)};
+    unknown[0].device = L"Cam 9";
+    TimelinePlayer missing(unknown);
+    REQUIRE(missing.prepare(fleet.devices, fleet.source()).error().code() ==
+            ErrorCode::DeviceNotFound);
+    REQUIRE(missing.play().is_error());
+}
+
+TEST_CASE("Timeline rejects unsupported properties and bad values", "[core][timeline]") {
+    SimulatedFleet fleet(1);
+
+    Cue focus = zoom_cue(milliseconds(0), 0, 1);
+    focus.cam_prop = CamProp::Focus;
+    TimelinePlayer unsupported({focus});
+    auto result = unsupported.prepare(fleet.devices, fleet.source());
+    REQUIRE(result.error().code() == ErrorCode::PropertyNotSupported);
+
+    TimelinePlayer out_of_range({zoom_cue(milliseconds(0), 0, 500)});
+    result = out_of_range.prepare(fleet.devices, fleet.source());
+    REQUIRE(result.error().code() == ErrorCode::InvalidValue);
+}
+
+// ============================================================================
+// Playback Tests
+// ============================================================================
+TEST_CASE("Timeline fires cues on time", "[core][timeline]") {
+    SimulatedFleet fleet(3);
+    std::vector<Cue> cues;
+    for (int d = 0; d < 3; ++d) {
+        cues.push_back(zoom_cue(milliseconds(60), d, 60 + d));
+        cues.push_back(zoom_cue(milliseconds(10), d, 10 + d));
+        cues.push_back(zoom_cue(milliseconds(0), d, d));
+    }
+
+    TimelinePlayer player(cues);
+    REQUIRE(player.prepare(fleet.devices, fleet.source()).is_ok());
+
+    std::atomic<int> callbacks{0};
+    auto start = steady_clock::now();
+    auto report = player.play([&](const CueReport &) { ++callbacks; });
+    REQUIRE(report.is_ok());
+    REQUIRE(steady_clock::now() - start >= milliseconds(60));
+
+    const auto &r = report.value();
+    REQUIRE(r.cues.size() == 9);
+    REQUIRE(callbacks == 9);
+    REQUIRE(r.failures == 0);
+    REQUIRE_FALSE(r.cancelled);
+    for (size_t i = 1; i < r.cues.size(); ++i) {
+        REQUIRE(r.cues[i - 1].planned <= r.cues[i].planned);
+    }
+    for (const auto &cue : r.cues) {
+        REQUIRE(cue.fired >= cue.planned);
+        REQUIRE(cue.completed >= cue.fired);
+    }
+    REQUIRE(r.lateness_max < milliseconds(10));
+
+    // Last cue per device wins
+    for (int d = 0; d < 3; ++d) {
+        REQUIRE(fleet.zoom(d) == 60 + d);
+    }
+}
+
+TEST_CASE("Slow device does not delay cues on other devices", "[core][timeline]") {
+    SimulatedFleet fleet(2);
+    TimelinePlayer player({zoom_cue(milliseconds(0), 0, 1), zoom_cue(milliseconds(5), 0, 2),
+                           zoom_cue(milliseconds(20), 1, 3)});
+    REQUIRE(player.prepare(fleet.devices, fleet.source()).is_ok());
+    fleet.states[0]->latency = milliseconds(80);
+
+    auto report = player.play();
+    REQUIRE(report.is_ok());
+    const auto &cues = report.value().cues;
+    REQUIRE(cues.size() == 3);
+    REQUIRE(cues[1].lateness() > milliseconds(50)); // queued behind the slow write
+    REQUIRE(cues[2].index == 2);
+    REQUIRE(cues[2].lateness() < milliseconds(10));
+}
+
+TEST_CASE("Timeline reports write failures", "[core][timeline]") {
+    SimulatedFleet fleet(1);
+    TimelinePlayer player({zoom_cue(milliseconds(0), 0, 1), zoom_cue(milliseconds(5), 0, 2)});
+    REQUIRE(player.prepare(fleet.devices, fleet.source()).is_ok());
+
+    fleet.states[0]->fail_next(1, ErrorCode::DeviceBusy);
+    auto report = player.play();
+    REQUIRE(report.is_ok());
+    REQUIRE(report.value().failures == 1);
+    REQUIRE(report.value().cues[0].error->code() == ErrorCode::DeviceBusy);
+    REQUIRE_FALSE(report.value().cues[1].error.has_value());
+    REQUIRE(fleet.zoom(0) == 2);
+}
+
+TEST_CASE("Preset cues recall the preset's supported values", "[core][timeline]") {
+    SimulatedFleet fleet(1);
+    Preset podium;
+    podium.name = "podium";
+    podium.set(CamProp::Zoom, PropSetting(40, CamMode::Manual));
+    podium.set(CamProp::Focus, PropSetting(10, CamMode::Manual)); // unsupported
+    podium.set(VidProp::Brightness, PropSetting(70, CamMode::Manual));
+
+    Cue recall;
+    recall.at = milliseconds(5);
+    recall.device_index = 0;
+    recall.domain = CueDomain::Preset;
+    recall.preset = "podium";
+    TimelinePlayer player({zoom_cue(milliseconds(0), 0, 1), recall});
+    REQUIRE(player.prepare(fleet.devices, fleet.source(), {podium}).is_ok());
+
+    auto report = player.play();
+    REQUIRE(report.is_ok());
+    REQUIRE(report.value().failures == 0);
+    REQUIRE(fleet.zoom(0) == 40);
+    {
+        std::lock_guard<std::mutex> lock(fleet.states[0]->mutex);
+        REQUIRE(fleet.states[0]->video[VidProp::Brightness].value == 70);
+    }
+
+    TimelinePlayer missing({recall});
+    REQUIRE(missing.prepare(fleet.devices, fleet.source()).error().code() ==
+            ErrorCode::InvalidArgument);
+    Preset unsupported;
+    unsupported.name = "podium";
+    unsupported.set(CamProp::Focus, PropSetting(10, CamMode::Manual));
+    TimelinePlayer nothing({recall});
+    REQUIRE(nothing.prepare(fleet.devices, fleet.source(), {unsupported}).error().code() ==
+            ErrorCode::PropertyNotSupported);
+}
+
+TEST_CASE("Timeline can be cancelled", "[core][timeline]") {
+    SimulatedFleet fleet(1);
+    TimelinePlayer player({zoom_cue(milliseconds(0), 0, 1), zoom_cue(seconds(30), 0, 2)});
+    REQUIRE(player.prepare(fleet.devices, fleet.source()).is_ok());
+
+    std::thread canceller([&] {
+        std::this_thread::sleep_for(milliseconds(50));
+        player.cancel();
+    });
+    auto start = steady_clock::now();
+    auto report = player.play();
+    canceller.join();
+
+    REQUIRE(steady_clock::now() - start < seconds(5));
+    REQUIRE(report.is_ok());
+    REQUIRE(report.value().cancelled);
+    REQUIRE(report.value().cues.size() == 1);
+    REQUIRE(fleet.zoom(0) == 1);
+}
+
+TEST_CASE("Hung device does not stall timeline playback", "[core][timeline]") {
+    SimulatedFleet fleet(2);
+    TimelineOptions options;
+    options.write_timeout = milliseconds(100);
+    TimelinePlayer player({zoom_cue(milliseconds(0), 0, 4), zoom_cue(milliseconds(10), 1, 5)},
+                          options);
+    REQUIRE(player.prepare(fleet.devices, fleet.source()).is_ok());
+
+    fleet.states[0]->hang();
+    auto start = steady_clock::now();
+    auto report = player.play();
+    REQUIRE(steady_clock::now() - start < seconds(2));
+    REQUIRE(report.is_ok());
+    REQUIRE(report.value().timed_out == 1);
+    REQUIRE(report.value().failures == 1);
+    REQUIRE(report.value().cues.size() == 1);
+    REQUIRE_FALSE(report.value().cancelled);
+    REQUIRE(fleet.zoom(1) == 5);
+
+    // Cancelling does not wait on the hung write either
+    std::thread canceller([&] {
+        std::this_thread::sleep_for(milliseconds(20));
+        player.cancel();
+    });
+    start = steady_clock::now();
+    report = player.play();
+    canceller.join();
+    REQUIRE(steady_clock::now() - start < seconds(2));
+    REQUIRE(report.is_ok());
+    fleet.states[0]->release();
+}
@@ -0,0 +1,220 @@
+// tests/cpp/unit/trace_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "duvc-ctl/core/device_actor.h"
+#include "duvc-ctl/platform/trace.h"
+#include "../support/simulated_device.h"
+
+#include <chrono>
+#include <filesystem>
+
+using namespace duvc;
+using namespace duvc::test;
+
+namespace {
+
+const wchar_t *const kPath =
+    L"\\\\?\\usb#vid_046d&pid_085e&mi_00#7&1a2b3c4d&0&0000#"
+    L"{65e8773d-8f56-11d0-a3b9-00a0c9223196}\\global";
+
+std::shared_ptr<SimulatedDeviceState> camera_state() {
+    auto state = std::make_shared<SimulatedDeviceState>();
+    state->camera[CamProp::Zoom] = PropSetting(100, CamMode::Manual);
+    state->camera[CamProp::Focus] = PropSetting(30, CamMode::Auto);
+    state->video[VidProp::Brightness] = PropSetting(128, CamMode::Manual);
+    return state;
+}
+
+/// Record a short session against a simulated camera
+Trace record_session(std::shared_ptr<SimulatedDeviceState> state) {
+    auto recorder = std::make_shared<TraceRecorder>();
+    auto simulated = std::make_unique<SimulatedPlatform>();
+    simulated->add(Device(L"Logitech BRIO", kPath), state);
+    auto platform = make_recording_platform(std::move(simulated), recorder);
+
+    auto devices = platform->list_devices();
+    REQUIRE(devices.is_ok());
+    const Device &device = devices.value()[0];
+    REQUIRE(platform->is_device_connected(device).value());
+    auto connection = platform->create_connection(device);
+    REQUIRE(connection.is_ok());
+    IDeviceConnection &c = *connection.value();
+
+    REQUIRE(c.get_camera_property(CamProp::Zoom).value().value == 100);
+    REQUIRE(c.set_camera_property(CamProp::Zoom, PropSetting(200, CamMode::Manual)).is_ok());
+    REQUIRE(c.get_camera_property(CamProp::Zoom).value().value == 200);
+    REQUIRE(c.get_camera_property_range(CamProp::Focus).value().max == 100);
+    REQUIRE_FALSE(c.get_camera_property(CamProp::Pan).is_ok());
+    REQUIRE(c.get_video_property(VidProp::Brightness).value().value == 128);
+    REQUIRE(c.set_video_property(VidProp::Brightness, PropSetting(90, CamMode::Manual)).is_ok());
+    return recorder->snapshot();
+}
+
+} // namespace
+
+// ============================================================================
+// Recording Tests
+// ============================================================================
+TEST_CASE("Recording captures calls, arguments and results", "[platform][trace]") {
+    auto state = camera_state();
+    state->latency = std::chrono::microseconds(500);
+    Trace trace = record_session(state);
+
+    REQUIRE(trace.devices.size() == 1);
+    REQUIRE(trace.devices[0].path == kPath);
+    REQUIRE(trace.events.size() == 10);
+
+    REQUIRE(trace.events[0].op == TraceOp::ListDevices);
+    REQUIRE(trace.events[0].listed == std::vector<uint32_t>{0});
+    REQUIRE(trace.events[2].op == TraceOp::CreateConnection);
+
+    const TraceEvent &set = trace.events[4];
+    REQUIRE(set.op == TraceOp::SetCameraProperty);
+    REQUIRE(set.property == static_cast<uint8_t>(CamProp::Zoom));
+    REQUIRE(set.argument.value == 200);
+    REQUIRE(set.latency >= std::chrono::microseconds(500));
+
+    const TraceEvent &unsupported = trace.events[7];
+    REQUIRE(unsupported.error == ErrorCode::PropertyNotSupported);
+    REQUIRE(unsupported.message == "Not simulated");
+}
+
+TEST_CASE("Traces survive serialization", "[platform][trace]") {
+    Trace trace = record_session(camera_state());
+    auto data = serialize_trace(trace);
+    auto parsed = parse_trace(data);
+    REQUIRE(parsed.is_ok());
+    REQUIRE(serialize_trace(parsed.value()) == data);
+    REQUIRE(parsed.value().devices[0].name == L"Logitech BRIO");
+    REQUIRE(parsed.value().events[6].range.max == 100);
+
+    // Every truncation and a corrupted header are rejected
+    for (size_t length = 0; length < data.size(); ++length) {
+        std::vector<uint8_t> truncated(data.begin(), data.begin() + length);
+        REQUIRE_FALSE(parse_trace(truncated).is_ok());
+    }
+    data[0] = 'X';
+    REQUIRE(parse_trace(data).error().code() == ErrorCode::InvalidArgument);
+
+    auto path = std::filesystem::temp_directory_path() / "duvc_trace_test.bin";
+    REQUIRE(save_trace(trace, path).is_ok());
+    auto loaded = load_trace(path);
+    REQUIRE(loaded.is_ok());
+    REQUIRE(loaded.value().events.size() == trace.events.size());
+    std::filesystem::remove(path);
+}
+
+// ============================================================================
+// Replay Tests
+// ============================================================================
+TEST_CASE("Replay reproduces recorded responses", "[platform][trace]") {
+    auto trace = std::make_shared<const Trace>(record_session(camera_state()));
+    ReplayOptions options;
+    options.time_scale = 0;
+    auto platform = make_replay_platform(trace, options);
+
+    auto devices = platform->list_devices();
+    REQUIRE(devices.value().size() == 1);
+
+    // Any path form of the recorded device is accepted
+    Device device(L"BRIO", L"USB\\VID_046D&PID_085E&MI_00\\7&1A2B3C4D&0&0000");
+    REQUIRE(platform->is_device_connected(device).value());
+    auto connection = platform->create_connection(device);
+    REQUIRE(connection.is_ok());
+    IDeviceConnection &c = *connection.value();
+
+    // Responses replay per call in recorded order, then loop
+    REQUIRE(c.get_camera_property(CamProp::Zoom).value().value == 100);
+    REQUIRE(c.get_video_property(VidProp::Brightness).value().value == 128);
+    REQUIRE(c.get_camera_property(CamProp::Zoom).value().value == 200);
+    REQUIRE(c.get_camera_property(CamProp::Zoom).value().value == 100);
+    REQUIRE(c.set_camera_property(CamProp::Zoom, PropSetting(1, CamMode::Manual)).is_ok());
+    REQUIRE(c.get_camera_property_range(CamProp::Focus).value().step == 1);
+
+    // Recorded failures replay; unrecorded calls are unsupported
+    REQUIRE(c.get_camera_property(CamProp::Pan).error().code() ==
+            ErrorCode::PropertyNotSupported);
+    REQUIRE(c.get_camera_property(CamProp::Tilt).error().code() ==
+            ErrorCode::PropertyNotSupported);
+
+    REQUIRE_FALSE(platform->is_device_connected(Device(L"Other", L"usb#other")).value());
+    REQUIRE(platform->create_connection(Device(L"Other", L"usb#other")).error().code() ==
+            ErrorCode::DeviceNotFound);
+}
+
+TEST_CASE("Replay can hold the last response", "[platform][trace]") {
+    auto trace = std::make_shared<const Trace>(record_session(camera_state()));
+    ReplayOptions options;
+    options.time_scale = 0;
+    options.loop = false;
+    auto platform = make_replay_platform(trace, options);
+    auto connection = platform->create_connection(trace->devices[0]);
+    IDeviceConnection &c = *connection.value();
+
+    REQUIRE(c.get_camera_property(CamProp::Zoom).value().value == 100);
+    REQUIRE(c.get_camera_property(CamProp::Zoom).value().value == 200);
+    REQUIRE(c.get_camera_property(CamProp::Zoom).value().value == 200);
+}
+
+TEST_CASE("Replay reproduces latency with time scaling", "[platform][trace]") {
+    using Clock = std::chrono::steady_clock;
+    Trace trace;
+    trace.devices.emplace_back(L"Camera", kPath);
+    TraceEvent event;
+    event.op = TraceOp::GetCameraProperty;
+    event.property = static_cast<uint8_t>(CamProp::Zoom);
+    event.setting = PropSetting(5, CamMode::Manual);
+    event.latency = std::chrono::milliseconds(20);
+    trace.events.push_back(event);
+    auto shared = std::make_shared<const Trace>(trace);
+
+    auto time_call = [&](double scale) {
+        ReplayOptions options;
+        options.time_scale = scale;
+        auto connection = make_replay_platform(shared, options)
+                              ->create_connection(trace.devices[0]);
+        auto start = Clock::now();
+        REQUIRE(connection.value()->get_camera_property(CamProp::Zoom).value().value == 5);
+        return Clock::now() - start;
+    };
+    REQUIRE(time_call(1.0) >= std::chrono::milliseconds(20));
+    REQUIRE(time_call(2.0) >= std::chrono::milliseconds(40));
+    REQUIRE(time_call(0.0) < std::chrono::milliseconds(20));
+}
+
+TEST_CASE("Installed replay drives device actors", "[platform][trace]") {
+    auto trace = std::make_shared<const Trace>(record_session(camera_state()));
+    ReplayOptions options;
+    options.time_scale = 0;
+    install_trace_replay(trace, options);
+
+    {
+        auto actor = acquire_device_actor(trace->devices[0]);
+        auto zoom = actor->call<PropSetting>(
+            [](IDeviceConnection &c) { return c.get_camera_property(CamProp::Zoom); });
+        REQUIRE(zoom.is_ok());
+        REQUIRE(zoom.value().value == 100);
+    }
+
+    install_trace_replay(nullptr);
+}
+
+// ============================================================================
+// Benchmarks (run with: trace_tests "[benchmark]")
+// ============================================================================
+TEST_CASE("Replayed actor round trips", "[.][benchmark][platform][trace]") {
+    auto trace = std::make_shared<const Trace>(record_session(camera_state()));
+    ReplayOptions options;
+    options.time_scale = 0;
+    DeviceActor actor([platform = std::shared_ptr<IPlatformInterface>(
+                           make_replay_platform(trace, options)),
+                       device = trace->devices[0]] {
+        return platform->create_connection(device);
+    });
+
+    BENCHMARK("actor get via replay") {
+        return actor.call<PropSetting>(
+            [](IDeviceConnection &c) { return c.get_camera_property(CamProp::Zoom); });
+    };
+}
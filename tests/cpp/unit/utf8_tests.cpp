@@ -0,0 +1,249 @@
+// tests/cpp/unit/utf8_tests.cpp
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "duvc-ctl/utils/string_conversion.h"
+#include "duvc-ctl/utils/utf8.h"
+
+#include <random>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace duvc;
+
+namespace {
+
+constexpr bool kWide16 = sizeof(wchar_t) == 2;
+
+/// Code point at a time reference encoder
+std::string reference_utf8(const std::wstring &text) {
+    std::string out;
+    for (size_t i = 0; i < text.size(); ++i) {
+        uint32_t cp = static_cast<uint32_t>(text[i]) & (kWide16 ? 0xFFFF : 0xFFFFFFFF);
+        if (cp >= 0xD800 && cp <= 0xDBFF && kWide16 && i + 1 < text.size() &&
+            (static_cast<uint32_t>(text[i + 1]) & 0xFFFF) >= 0xDC00 &&
+            (static_cast<uint32_t>(text[i + 1]) & 0xFFFF) <= 0xDFFF) {
+            cp = 0x10000 + ((cp - 0xD800) << 10) +
+                 ((static_cast<uint32_t>(text[++i]) & 0xFFFF) - 0xDC00);
+        } else if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF) {
+            cp = 0xFFFD;
+        }
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+    return out;
+}
+
+/// Wide string for a code point
+std::wstring wide(uint32_t cp) {
+    if (kWide16 && cp >= 0x10000) {
+        return {static_cast<wchar_t>(0xD800 + ((cp - 0x10000) >> 10)),
+                static_cast<wchar_t>(0xDC00 + ((cp - 0x10000) & 0x3FF))};
+    }
+    return std::wstring(1, static_cast<wchar_t>(cp));
+}
+
+/// Random text mixing long ASCII runs, BMP, astral and unpaired surrogates
+std::wstring random_wide(std::mt19937 &rng) {
+    std::wstring text;
+    size_t pieces = rng() % 12;
+    for (size_t p = 0; p < pieces; ++p) {
+        switch (rng() % 6) {
+        case 0:
+        case 1:
+            text.append(rng() % 40, static_cast<wchar_t>(0x20 + rng() % 0x5F));
+            break;
+        case 2:
+            text += wide(0x80 + rng() % 0xD780);
+            break;
+        case 3:
+            text += wide(0x10000 + rng() % 0x100000);
+            break;
+        case 4:
+            text += static_cast<wchar_t>(0xD800 + rng() % 0x800);
+            break;
+        default:
+            text += static_cast<wchar_t>(rng() % 0x80);
+            break;
+        }
+    }
+    return text;
+}
+
+std::string legacy_to_utf8(const std::wstring &wstr) {
+#ifdef _WIN32
+    if (wstr.empty()) {
+        return std::string();
+    }
+    int size = WideCharToMultiByte(CP_UTF8, 0, &wstr[0], (int)wstr.size(),
+                                   NULL, 0, NULL, NULL);
+    std::string out(size, 0);
+    WideCharToMultiByte(CP_UTF8, 0, &wstr[0], (int)wstr.size(), &out[0], size,
+                        NULL, NULL);
+    return out;
+#else
+    return reference_utf8(wstr);
+#endif
+}
+
+std::wstring legacy_to_wstring(const std::string &str) {
+#ifdef _WIN32
+    if (str.empty()) {
+        return std::wstring();
+    }
+    int size = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, nullptr, 0);
+    std::wstring out(size - 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, &out[0], size);
+    return out;
+#else
+    std::wstring out;
+    out.reserve(str.size());
+    for (char c : str) {
+        out.push_back(static_cast<wchar_t>(static_cast<unsigned char>(c)));
+    }
+    return out;
+#endif
+}
+
+} // namespace
+
+// ============================================================================
+// Encoding Tests
+// ============================================================================
+TEST_CASE("Wide strings encode to UTF-8", "[utils][utf8]") {
+    REQUIRE(to_utf8(L"").empty());
+    REQUIRE(to_utf8(L"Logitech BRIO") == "Logitech BRIO");
+    REQUIRE(to_utf8(L"Caf\u00E9") == "Caf\xC3\xA9");
+    REQUIRE(to_utf8(L"\u20AC") == "\xE2\x82\xAC");
+    REQUIRE(to_utf8(wide(0x1F4F7)) == "\xF0\x9F\x93\xB7");
+
+    // Non-ASCII at every offset around the 8- and 16-unit block edges
+    for (size_t at = 0; at < 40; ++at) {
+        std::wstring text(40, L'a');
+        text[at] = L'\u00E9';
+        REQUIRE(to_utf8(text) == reference_utf8(text));
+        REQUIRE(utf8_length(text.data(), text.size()) == 41);
+    }
+}
+
+TEST_CASE("Unpaired surrogates encode as U+FFFD", "[utils][utf8]") {
+    std::wstring lone_high(1, static_cast<wchar_t>(0xD83D));
+    std::wstring lone_low(1, static_cast<wchar_t>(0xDCF7));
+    REQUIRE(to_utf8(lone_high) == "\xEF\xBF\xBD");
+    REQUIRE(to_utf8(lone_low + L"x") == "\xEF\xBF\xBDx");
+    REQUIRE(to_utf8(lone_high + L"x" + lone_low) == "\xEF\xBF\xBDx\xEF\xBF\xBD");
+}
+
+TEST_CASE("Encoding writes only into the caller buffer", "[utils][utf8]") {
+    std::wstring text = L"Integrated Webcam \u00B7 " + wide(0x1F4F7);
+    size_t needed = utf8_length(text.data(), text.size());
+    std::string buffer(needed + 4, '#');
+    REQUIRE(encode_utf8(text.data(), text.size(), &buffer[0]) == needed);
+    REQUIRE(buffer.substr(0, needed) == reference_utf8(text));
+    REQUIRE(buffer.substr(needed) == "####");
+    REQUIRE(utf8_length(nullptr, 0) == 0);
+}
+
+// ============================================================================
+// Decoding Tests
+// ============================================================================
+TEST_CASE("UTF-8 decodes to wide strings", "[utils][utf8]") {
+    REQUIRE(to_wstring(std::string()).empty());
+    REQUIRE(to_wstring(std::string("USB\\VID_046D")) == L"USB\\VID_046D");
+    REQUIRE(to_wstring(std::string("Caf\xC3\xA9")) == L"Caf\u00E9");
+    REQUIRE(to_wstring(std::string("\xF0\x9F\x93\xB7")) == wide(0x1F4F7));
+    REQUIRE(to_wstring(std::string("a\0b", 3)) == std::wstring(L"a\0b", 3));
+}
+
+TEST_CASE("Malformed UTF-8 decodes to U+FFFD per maximal subpart",
+          "[utils][utf8]") {
+    const std::wstring r(1, static_cast<wchar_t>(0xFFFD));
+    // Stray continuation and invalid lead bytes
+    REQUIRE(to_wstring(std::string("\x80x")) == r + L"x");
+    REQUIRE(to_wstring(std::string("\xC0\xAF")) == r + r);
+    REQUIRE(to_wstring(std::string("\xFF")) == r);
+    // Truncated sequences collapse to one replacement
+    REQUIRE(to_wstring(std::string("\xE2\x82")) == r);
+    REQUIRE(to_wstring(std::string("\xF0\x9F\x93x")) == r + L"x");
+    // Overlong, surrogate and out-of-range forms
+    REQUIRE(to_wstring(std::string("\xE0\x80\xAF")) == r + r + r);
+    REQUIRE(to_wstring(std::string("\xED\xA0\x80")) == r + r + r);
+    REQUIRE(to_wstring(std::string("\xF4\x90\x80\x80")) == r + r + r + r);
+}
+
+// ============================================================================
+// Fuzz Tests
+// ============================================================================
+TEST_CASE("Transcoding matches the reference on random text",
+          "[utils][utf8][fuzz]") {
+    std::mt19937 rng(20240701);
+    for (int round = 0; round < 20000; ++round) {
+        std::wstring text = random_wide(rng);
+        std::string utf8 = to_utf8(text);
+        REQUIRE(utf8 == reference_utf8(text));
+
+        // Decoding the encoding is lossless apart from replaced surrogates
+        std::wstring back = to_wstring(utf8);
+        REQUIRE(to_utf8(back) == utf8);
+    }
+}
+
+TEST_CASE("Decoding survives random bytes", "[utils][utf8][fuzz]") {
+    std::mt19937 rng(20240702);
+    const std::string seeds[] = {"Logitech BRIO", "Caf\xC3\xA9 \xE2\x82\xAC",
+                                 "\xF0\x9F\x93\xB7 camera"};
+    for (int round = 0; round < 20000; ++round) {
+        std::string bytes = seeds[rng() % 3];
+        int edits = static_cast<int>(rng() % 6);
+        for (int e = 0; e < edits; ++e) {
+            size_t at = rng() % (bytes.size() + 1);
+            bytes.insert(at, 1, static_cast<char>(rng() % 256));
+        }
+
+        size_t needed = wide_length(bytes.data(), bytes.size());
+        std::wstring text(needed, L'\0');
+        REQUIRE(decode_utf8(bytes.data(), bytes.size(), &text[0]) == needed);
+        // The decoded text is well-formed, so it round-trips exactly
+        REQUIRE(to_wstring(to_utf8(text)) == text);
+        // Input without replacements was valid, so it re-encodes exactly
+        if (text.find(static_cast<wchar_t>(0xFFFD)) == std::wstring::npos) {
+            REQUIRE(to_utf8(text) == bytes);
+        }
+    }
+}
+
+// ============================================================================
+// Benchmarks (run with: utf8_tests "[benchmark]")
+// ============================================================================
+TEST_CASE("Transcoding throughput", "[.][benchmark][utils][utf8]") {
+    const std::wstring path =
+        L"\\\\?\\usb#vid_046d&pid_085e&mi_00#7&1a2b3c4d&0&0000#"
+        L"{65e8773d-8f56-11d0-a3b9-00a0c9223196}\\global";
+    const std::wstring name = L"Cam\u00E9ra int\u00E9gr\u00E9e HD";
+    const std::string path_utf8 = to_utf8(path);
+
+    BENCHMARK("to_utf8 ASCII path") { return to_utf8(path); };
+    BENCHMARK("legacy to_utf8 ASCII path") { return legacy_to_utf8(path); };
+    BENCHMARK("to_utf8 accented name") { return to_utf8(name); };
+    BENCHMARK("legacy to_utf8 accented name") { return legacy_to_utf8(name); };
+    BENCHMARK("to_wstring ASCII path") { return to_wstring(path_utf8); };
+    BENCHMARK("legacy to_wstring ASCII path") {
+        return legacy_to_wstring(path_utf8);
+    };
+}
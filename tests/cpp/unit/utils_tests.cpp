@@ -3,9 +3,14 @@
 
 #include "duvc-ctl/utils/logging.h"
 #include "duvc-ctl/utils/error_decoder.h"
+#include "duvc-ctl/utils/event_queue.h"
+#include "duvc-ctl/utils/json.h"
 #include "duvc-ctl/utils/string_conversion.h"
 
+#include <clocale>
 #include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 
 using namespace duvc;
@@ -86,11 +91,11 @@ TEST_CASE("Log Level Get/Set", "[utils][logging]") {
 }
 
 TEST_CASE("Log Level String Conversion", "[utils][logging]") {
-    REQUIRE(std::string(to_string(LogLevel::Debug)) == "Debug");
-    REQUIRE(std::string(to_string(LogLevel::Info)) == "Info");
-    REQUIRE(std::string(to_string(LogLevel::Warning)) == "Warning");
-    REQUIRE(std::string(to_string(LogLevel::Error)) == "Error");
-    REQUIRE(std::string(to_string(LogLevel::Critical)) == "Critical");
+    REQUIRE(std::string(to_string(LogLevel::Debug)) == "DEBUG");
+    REQUIRE(std::string(to_string(LogLevel::Info)) == "INFO");
+    REQUIRE(std::string(to_string(LogLevel::Warning)) == "WARNING");
+    REQUIRE(std::string(to_string(LogLevel::Error)) == "ERROR");
+    REQUIRE(std::string(to_string(LogLevel::Critical)) == "CRITICAL");
 }
 
 TEST_CASE("Direct Log Message", "[utils][logging]") {
@@ -142,6 +147,154 @@ TEST_CASE("Logging Macros", "[utils][logging]") {
     capture.teardown();
 }
 
+TEST_CASE("Log Callback Runs Outside The Log Lock", "[utils][logging]") {
+    set_log_level(LogLevel::Info);
+    std::vector<std::string> messages;
+    set_log_callback([&](LogLevel, const std::string& message) {
+        messages.push_back(message);
+        // Re-entrant logging and level changes used to deadlock
+        if (message == "outer") {
+            set_log_level(LogLevel::Info);
+            log_info("inner");
+        }
+    });
+
+    log_info("outer");
+    REQUIRE(messages == std::vector<std::string>{"outer", "inner"});
+
+    REQUIRE(log_enabled(LogLevel::Error));
+    REQUIRE_FALSE(log_enabled(LogLevel::Debug));
+    set_log_callback(nullptr);
+}
+
+// ============================================================================
+// Event Queue Tests
+// ============================================================================
+TEST_CASE("Event Queue Order And Capacity", "[utils][events]") {
+    EventQueue<int> queue(3);
+    REQUIRE(queue.empty());
+    REQUIRE(queue.push(1));
+    REQUIRE(queue.push(2));
+    REQUIRE(queue.push(3));
+    REQUIRE_FALSE(queue.push(4));
+    REQUIRE(queue.dropped() == 1);
+
+    std::vector<int> out{0};
+    REQUIRE(queue.drain(out) == 3);
+    REQUIRE(out == std::vector<int>{0, 1, 2, 3});
+    REQUIRE(queue.empty());
+    REQUIRE(queue.push(5));
+}
+
+TEST_CASE("Event Queue Concurrent Producers", "[utils][events]") {
+    constexpr int kProducers = 4;
+    constexpr int kEvents = 20000;
+    EventQueue<std::pair<int, int>> queue(kProducers * kEvents);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&queue, p] {
+            for (int i = 0; i < kEvents; ++i) {
+                queue.push({p, i});
+            }
+        });
+    }
+
+    std::vector<std::pair<int, int>> received;
+    auto drain_all = [&] { queue.drain(received); };
+    while (received.size() < static_cast<size_t>(kProducers * kEvents)) {
+        drain_all();
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    // Each producer's events arrive in order
+    std::vector<int> next(kProducers, 0);
+    for (const auto& [producer, index] : received) {
+        REQUIRE(index == next[producer]);
+        ++next[producer];
+    }
+}
+
+TEST_CASE("Batch Dispatcher Delivers In Batches", "[utils][events]") {
+    DispatchOptions options;
+    options.max_batch = 64;
+    std::vector<int> delivered;
+    std::vector<size_t> batch_sizes;
+    BatchDispatcher<int> dispatcher([&](std::vector<int>& batch) {
+        batch_sizes.push_back(batch.size());
+        delivered.insert(delivered.end(), batch.begin(), batch.end());
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }, options);
+
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(dispatcher.post(i));
+    }
+    REQUIRE(dispatcher.flush(std::chrono::seconds(5)));
+
+    REQUIRE(delivered.size() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(delivered[static_cast<size_t>(i)] == i);
+    }
+    DispatchStats stats = dispatcher.stats();
+    REQUIRE(stats.posted == 1000);
+    REQUIRE(stats.delivered == 1000);
+    REQUIRE(stats.batches == batch_sizes.size());
+    REQUIRE(stats.batches < 1000);
+    REQUIRE(stats.max_batch <= 64);
+
+    // Stopping delivers what is queued and refuses new events
+    dispatcher.post(1000);
+    dispatcher.stop();
+    REQUIRE(delivered.size() == 1001);
+    REQUIRE_FALSE(dispatcher.post(1001));
+}
+
+TEST_CASE("Batch Dispatcher Wakes Promptly", "[utils][events]") {
+    DispatchOptions options;
+    options.flush_interval = std::chrono::seconds(10);
+    std::atomic<int> delivered{0};
+    BatchDispatcher<int> dispatcher(
+        [&](std::vector<int>& batch) { delivered += static_cast<int>(batch.size()); }, options);
+
+    // Idle thread is woken by the post, not by the (long) flush interval
+    for (int round = 1; round <= 3; ++round) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        dispatcher.post(round);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (delivered.load() < round && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        REQUIRE(delivered.load() == round);
+    }
+}
+
+TEST_CASE("Batch Dispatcher Stopped From Its Sink", "[utils][events]") {
+    std::atomic<bool> in_sink{false};
+    std::atomic<int> batches{0};
+    {
+        BatchDispatcher<int>* self = nullptr;
+        BatchDispatcher<int> dispatcher([&](std::vector<int>&) {
+            in_sink = true;
+            self->stop(); // Only requests the stop: the thread cannot join itself
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            ++batches;
+            in_sink = false;
+        });
+        self = &dispatcher;
+
+        REQUIRE(dispatcher.post(1));
+        while (!in_sink.load()) {
+            std::this_thread::yield();
+        }
+        REQUIRE_FALSE(dispatcher.post(2));
+    }
+    // The destructor joined the thread rather than leaving it on a dead object
+    REQUIRE_FALSE(in_sink.load());
+    REQUIRE(batches.load() == 1);
+}
+
 // ============================================================================
 // String Conversion Tests
 // ============================================================================
@@ -187,6 +340,78 @@ TEST_CASE("CamMode Wide String Conversion", "[utils][string]") {
     REQUIRE(std::wstring(to_wstring(CamMode::Manual)) == L"MANUAL");
 }
 
+TEST_CASE("Property Lookup By Name", "[utils][string]") {
+    REQUIRE(cam_prop_from_string("Zoom") == CamProp::Zoom);
+    REQUIRE(cam_prop_from_string("panrelative") == CamProp::PanRelative);
+    REQUIRE(cam_prop_from_string("Lamp") == CamProp::Lamp);
+    REQUIRE_FALSE(cam_prop_from_string("Brightness").has_value());
+    REQUIRE_FALSE(cam_prop_from_string("Zoo").has_value());
+
+    REQUIRE(vid_prop_from_string("BRIGHTNESS") == VidProp::Brightness);
+    REQUIRE(vid_prop_from_string("PowerLineFrequency") == VidProp::PowerLineFrequency);
+    REQUIRE_FALSE(vid_prop_from_string("").has_value());
+}
+
+// ============================================================================
+// JSON Reader Tests
+// ============================================================================
+TEST_CASE("JSON Document Parsing", "[utils][json]") {
+    auto doc = parse_json(R"( {"a": [1, -2.5e1, true, null], "b": {"c": "x\"y"}} )");
+    REQUIRE(doc.is_ok());
+    const JsonValue &root = doc.value();
+    REQUIRE(root.is_object());
+    REQUIRE(root.as_object().size() == 2);
+
+    const JsonValue *a = root.find("a");
+    REQUIRE(a != nullptr);
+    REQUIRE(a->as_array().size() == 4);
+    REQUIRE(a->as_array()[0].as_number() == 1);
+    REQUIRE(a->as_array()[1].as_number() == -25);
+    REQUIRE(a->as_array()[2].as_bool());
+    REQUIRE(a->as_array()[3].is_null());
+
+    REQUIRE(root.find("b")->find("c")->as_string() == "x\"y");
+    REQUIRE(root.find("missing") == nullptr);
+}
+
+TEST_CASE("JSON Unicode Escapes", "[utils][json]") {
+    auto doc = parse_json(R"(["\u00e9", "\ud83d\ude00"])");
+    REQUIRE(doc.is_ok());
+    REQUIRE(doc.value().as_array()[0].as_string() == "\xC3\xA9");
+    REQUIRE(doc.value().as_array()[1].as_string() == "\xF0\x9F\x98\x80");
+
+    REQUIRE(parse_json(R"(["\ud83d"])").is_error());
+}
+
+TEST_CASE("JSON Syntax Errors", "[utils][json]") {
+    for (const char *text : {"", "{", "[1,]", "{\"a\" 1}", "01", "\"abc", "tru",
+                             "[1] 2", "{\"a\":1,}"}) {
+        auto doc = parse_json(text);
+        REQUIRE(doc.is_error());
+        REQUIRE(doc.error().code() == ErrorCode::InvalidArgument);
+    }
+    REQUIRE(parse_json(std::string(100, '[') + std::string(100, ']')).is_error());
+}
+
+TEST_CASE("JSON Numbers Ignore The C Locale", "[utils][json]") {
+    // Hosts (Python, GUI toolkits) may switch to a locale with a decimal comma
+    std::string previous = std::setlocale(LC_NUMERIC, nullptr);
+    for (const char *name : {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "de_DE",
+                             "German_Germany.1252", "de-DE"}) {
+        if (std::setlocale(LC_NUMERIC, name)) {
+            break;
+        }
+    }
+    auto doc = parse_json(R"([0.25, -1.5e2, 2.5E-1])");
+    std::setlocale(LC_NUMERIC, previous.c_str());
+
+    REQUIRE(doc.is_ok());
+    REQUIRE(doc.value().as_array()[0].as_number() == 0.25);
+    REQUIRE(doc.value().as_array()[1].as_number() == -150);
+    REQUIRE(doc.value().as_array()[2].as_number() == 0.25);
+    REQUIRE(parse_json("1e999").is_error());
+}
+
 // ============================================================================
 // Error Decoder Tests
 // ============================================================================
@@ -267,7 +492,7 @@ TEST_CASE("Logging with String Conversion", "[utils][integration]") {
     capture.setup();
     
     // Use string conversion with logging
-    std::string prop_name = to_string(CamProp::Brightness);
+    std::string prop_name = to_string(VidProp::Brightness);
     log_info("Property: " + prop_name);
     
     REQUIRE(capture.captured_messages_.size() == 1);